@@ -0,0 +1,149 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "default".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "ns3::libapplications" for configuration "default"
+set_property(TARGET ns3::libapplications APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libapplications PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-applications-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-applications-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libapplications )
+list(APPEND _cmake_import_check_files_for_ns3::libapplications "${_IMPORT_PREFIX}/lib/libns3-dev-applications-default.so" )
+
+# Import target "ns3::libinternet" for configuration "default"
+set_property(TARGET ns3::libinternet APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libinternet PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-internet-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-internet-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libinternet )
+list(APPEND _cmake_import_check_files_for_ns3::libinternet "${_IMPORT_PREFIX}/lib/libns3-dev-internet-default.so" )
+
+# Import target "ns3::libwifi" for configuration "default"
+set_property(TARGET ns3::libwifi APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libwifi PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-wifi-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-wifi-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libwifi )
+list(APPEND _cmake_import_check_files_for_ns3::libwifi "${_IMPORT_PREFIX}/lib/libns3-dev-wifi-default.so" )
+
+# Import target "ns3::libnetwork" for configuration "default"
+set_property(TARGET ns3::libnetwork APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libnetwork PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-network-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-network-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libnetwork )
+list(APPEND _cmake_import_check_files_for_ns3::libnetwork "${_IMPORT_PREFIX}/lib/libns3-dev-network-default.so" )
+
+# Import target "ns3::libcore" for configuration "default"
+set_property(TARGET ns3::libcore APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libcore PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-core-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-core-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libcore )
+list(APPEND _cmake_import_check_files_for_ns3::libcore "${_IMPORT_PREFIX}/lib/libns3-dev-core-default.so" )
+
+# Import target "ns3::libstats" for configuration "default"
+set_property(TARGET ns3::libstats APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libstats PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-stats-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-stats-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libstats )
+list(APPEND _cmake_import_check_files_for_ns3::libstats "${_IMPORT_PREFIX}/lib/libns3-dev-stats-default.so" )
+
+# Import target "ns3::libbridge" for configuration "default"
+set_property(TARGET ns3::libbridge APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libbridge PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-bridge-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-bridge-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libbridge )
+list(APPEND _cmake_import_check_files_for_ns3::libbridge "${_IMPORT_PREFIX}/lib/libns3-dev-bridge-default.so" )
+
+# Import target "ns3::libtraffic-control" for configuration "default"
+set_property(TARGET ns3::libtraffic-control APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libtraffic-control PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-traffic-control-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-traffic-control-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libtraffic-control )
+list(APPEND _cmake_import_check_files_for_ns3::libtraffic-control "${_IMPORT_PREFIX}/lib/libns3-dev-traffic-control-default.so" )
+
+# Import target "ns3::libconfig-store" for configuration "default"
+set_property(TARGET ns3::libconfig-store APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libconfig-store PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-config-store-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-config-store-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libconfig-store )
+list(APPEND _cmake_import_check_files_for_ns3::libconfig-store "${_IMPORT_PREFIX}/lib/libns3-dev-config-store-default.so" )
+
+# Import target "ns3::libpropagation" for configuration "default"
+set_property(TARGET ns3::libpropagation APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libpropagation PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-propagation-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-propagation-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libpropagation )
+list(APPEND _cmake_import_check_files_for_ns3::libpropagation "${_IMPORT_PREFIX}/lib/libns3-dev-propagation-default.so" )
+
+# Import target "ns3::libmobility" for configuration "default"
+set_property(TARGET ns3::libmobility APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libmobility PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-mobility-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-mobility-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libmobility )
+list(APPEND _cmake_import_check_files_for_ns3::libmobility "${_IMPORT_PREFIX}/lib/libns3-dev-mobility-default.so" )
+
+# Import target "ns3::libenergy" for configuration "default"
+set_property(TARGET ns3::libenergy APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libenergy PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-energy-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-energy-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libenergy )
+list(APPEND _cmake_import_check_files_for_ns3::libenergy "${_IMPORT_PREFIX}/lib/libns3-dev-energy-default.so" )
+
+# Import target "ns3::libspectrum" for configuration "default"
+set_property(TARGET ns3::libspectrum APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libspectrum PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-spectrum-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-spectrum-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libspectrum )
+list(APPEND _cmake_import_check_files_for_ns3::libspectrum "${_IMPORT_PREFIX}/lib/libns3-dev-spectrum-default.so" )
+
+# Import target "ns3::libantenna" for configuration "default"
+set_property(TARGET ns3::libantenna APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::libantenna PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-antenna-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-antenna-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::libantenna )
+list(APPEND _cmake_import_check_files_for_ns3::libantenna "${_IMPORT_PREFIX}/lib/libns3-dev-antenna-default.so" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,210 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/VerifyGlobs.cmake"
+  "CMakeFiles/cmake.verify_globs"
+  "/root/repo/build-support/3rd-party/FindHarfBuzz.cmake"
+  "/root/repo/build-support/3rd-party/FindSphinx.cmake"
+  "/root/repo/build-support/3rd-party/colored-messages.cmake"
+  "/root/repo/build-support/Config.cmake.in"
+  "/root/repo/build-support/config-store-config-template.h"
+  "/root/repo/build-support/core-config-template.h"
+  "/root/repo/build-support/custom-modules/ns3-cmake-package.cmake"
+  "/root/repo/build-support/custom-modules/ns3-configtable.cmake"
+  "/root/repo/build-support/custom-modules/ns3-contributions.cmake"
+  "/root/repo/build-support/custom-modules/ns3-lock.cmake"
+  "/root/repo/build-support/custom-modules/ns3-module-macros.cmake"
+  "/root/repo/build-support/custom-modules/ns3-versioning.cmake"
+  "/root/repo/build-support/macros-and-definitions.cmake"
+  "/root/repo/build-support/pkgconfig-template.pc.in"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/scratch/CMakeLists.txt"
+  "/root/repo/scratch/datahose/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/antenna/CMakeLists.txt"
+  "/root/repo/src/applications/CMakeLists.txt"
+  "/root/repo/src/bridge/CMakeLists.txt"
+  "/root/repo/src/config-store/CMakeLists.txt"
+  "/root/repo/src/core/CMakeLists.txt"
+  "/root/repo/src/energy/CMakeLists.txt"
+  "/root/repo/src/internet/CMakeLists.txt"
+  "/root/repo/src/mobility/CMakeLists.txt"
+  "/root/repo/src/network/CMakeLists.txt"
+  "/root/repo/src/propagation/CMakeLists.txt"
+  "/root/repo/src/spectrum/CMakeLists.txt"
+  "/root/repo/src/stats/CMakeLists.txt"
+  "/root/repo/src/test/CMakeLists.txt"
+  "/root/repo/src/traffic-control/CMakeLists.txt"
+  "/root/repo/src/wifi/CMakeLists.txt"
+  "/root/repo/utils/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-ExactVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGSL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibXml2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython3.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/ProcessorCount.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "out/include/ns3/config-store-config.h"
+  "out/include/ns3/core-config.h"
+  "pkgconfig/ns3-antenna.pc"
+  "pkgconfig/ns3-spectrum.pc"
+  "pkgconfig/ns3-energy.pc"
+  "pkgconfig/ns3-mobility.pc"
+  "pkgconfig/ns3-propagation.pc"
+  "pkgconfig/ns3-config-store.pc"
+  "pkgconfig/ns3-traffic-control.pc"
+  "pkgconfig/ns3-bridge.pc"
+  "pkgconfig/ns3-stats.pc"
+  "pkgconfig/ns3-core.pc"
+  "pkgconfig/ns3-network.pc"
+  "pkgconfig/ns3-wifi.pc"
+  "pkgconfig/ns3-internet.pc"
+  "pkgconfig/ns3-applications.pc"
+  "ns3Config.cmake"
+  "ns3ConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/applications/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/internet/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/wifi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/network/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/stats/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/bridge/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/traffic-control/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/config-store/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/propagation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/mobility/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/energy/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/spectrum/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/antenna/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "scratch/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "scratch/datahose/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "CMakeFiles/copy_all_headers.dir/DependInfo.cmake"
+  "CMakeFiles/check-version.dir/DependInfo.cmake"
+  "CMakeFiles/all-test-targets.dir/DependInfo.cmake"
+  "CMakeFiles/run_test_py.dir/DependInfo.cmake"
+  "CMakeFiles/run-print-introspected-doxygen.dir/DependInfo.cmake"
+  "CMakeFiles/run-introspected-command-line.dir/DependInfo.cmake"
+  "CMakeFiles/assemble-introspected-command-line.dir/DependInfo.cmake"
+  "CMakeFiles/update_doxygen_version.dir/DependInfo.cmake"
+  "CMakeFiles/doxygen.dir/DependInfo.cmake"
+  "CMakeFiles/doxygen-no-build.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_manual.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_models.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_tutorial.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_contributing.dir/DependInfo.cmake"
+  "CMakeFiles/stdlib_pch.dir/DependInfo.cmake"
+  "CMakeFiles/stdlib_pch_exec.dir/DependInfo.cmake"
+  "src/applications/CMakeFiles/libapplications-obj.dir/DependInfo.cmake"
+  "src/applications/CMakeFiles/libapplications.dir/DependInfo.cmake"
+  "src/applications/CMakeFiles/libapplications-test.dir/DependInfo.cmake"
+  "src/internet/CMakeFiles/libinternet-obj.dir/DependInfo.cmake"
+  "src/internet/CMakeFiles/libinternet.dir/DependInfo.cmake"
+  "src/internet/CMakeFiles/libinternet-test.dir/DependInfo.cmake"
+  "src/wifi/CMakeFiles/libwifi-obj.dir/DependInfo.cmake"
+  "src/wifi/CMakeFiles/libwifi.dir/DependInfo.cmake"
+  "src/wifi/CMakeFiles/libwifi-test.dir/DependInfo.cmake"
+  "src/network/CMakeFiles/libnetwork-obj.dir/DependInfo.cmake"
+  "src/network/CMakeFiles/libnetwork.dir/DependInfo.cmake"
+  "src/network/CMakeFiles/libnetwork-test.dir/DependInfo.cmake"
+  "src/core/CMakeFiles/libcore-obj.dir/DependInfo.cmake"
+  "src/core/CMakeFiles/libcore.dir/DependInfo.cmake"
+  "src/core/CMakeFiles/libcore-test.dir/DependInfo.cmake"
+  "src/stats/CMakeFiles/libstats-obj.dir/DependInfo.cmake"
+  "src/stats/CMakeFiles/libstats.dir/DependInfo.cmake"
+  "src/stats/CMakeFiles/libstats-test.dir/DependInfo.cmake"
+  "src/bridge/CMakeFiles/libbridge-obj.dir/DependInfo.cmake"
+  "src/bridge/CMakeFiles/libbridge.dir/DependInfo.cmake"
+  "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/DependInfo.cmake"
+  "src/traffic-control/CMakeFiles/libtraffic-control.dir/DependInfo.cmake"
+  "src/traffic-control/CMakeFiles/libtraffic-control-test.dir/DependInfo.cmake"
+  "src/config-store/CMakeFiles/libconfig-store-obj.dir/DependInfo.cmake"
+  "src/config-store/CMakeFiles/libconfig-store.dir/DependInfo.cmake"
+  "src/propagation/CMakeFiles/libpropagation-obj.dir/DependInfo.cmake"
+  "src/propagation/CMakeFiles/libpropagation.dir/DependInfo.cmake"
+  "src/propagation/CMakeFiles/libpropagation-test.dir/DependInfo.cmake"
+  "src/mobility/CMakeFiles/libmobility-obj.dir/DependInfo.cmake"
+  "src/mobility/CMakeFiles/libmobility.dir/DependInfo.cmake"
+  "src/mobility/CMakeFiles/libmobility-test.dir/DependInfo.cmake"
+  "src/energy/CMakeFiles/libenergy-obj.dir/DependInfo.cmake"
+  "src/energy/CMakeFiles/libenergy.dir/DependInfo.cmake"
+  "src/energy/CMakeFiles/libenergy-test.dir/DependInfo.cmake"
+  "src/spectrum/CMakeFiles/libspectrum-obj.dir/DependInfo.cmake"
+  "src/spectrum/CMakeFiles/libspectrum.dir/DependInfo.cmake"
+  "src/spectrum/CMakeFiles/libspectrum-test.dir/DependInfo.cmake"
+  "src/antenna/CMakeFiles/libantenna-obj.dir/DependInfo.cmake"
+  "src/antenna/CMakeFiles/libantenna.dir/DependInfo.cmake"
+  "src/antenna/CMakeFiles/libantenna-test.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/libtest.dir/DependInfo.cmake"
+  "scratch/datahose/CMakeFiles/core-lib.dir/DependInfo.cmake"
+  "scratch/datahose/CMakeFiles/output-lib.dir/DependInfo.cmake"
+  "scratch/datahose/CMakeFiles/scratch_datahose_run.dir/DependInfo.cmake"
+  "utils/CMakeFiles/test-runner.dir/DependInfo.cmake"
+  "utils/CMakeFiles/bench-simulator.dir/DependInfo.cmake"
+  "utils/CMakeFiles/bench-packets.dir/DependInfo.cmake"
+  "utils/CMakeFiles/binary-trace-to-ascii.dir/DependInfo.cmake"
+  "utils/CMakeFiles/print-introspected-doxygen.dir/DependInfo.cmake"
+  "utils/CMakeFiles/bench-routing.dir/DependInfo.cmake"
+  "utils/CMakeFiles/bench-error-rate.dir/DependInfo.cmake"
+  "utils/CMakeFiles/perf-io.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,92 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by CMake Version 3.25
+cmake_policy(SET CMP0009 NEW)
+
+# single_source_file_scratches at scratch/CMakeLists.txt:67 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/scratch/[^.]*.cc")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_dev_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# scratch_sources at scratch/CMakeLists.txt:98 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/scratch/datahose/include/[^.]*.cc")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_dev_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# scratch_sources at scratch/CMakeLists.txt:98 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/scratch/datahose/lib/[^.]*.cc")
+set(OLD_GLOB
+  "/root/repo/scratch/datahose/lib/ue-mac-pscch-tx-output-stats.cc"
+  "/root/repo/scratch/datahose/lib/ue-mac-pssch-tx-output-stats.cc"
+  "/root/repo/scratch/datahose/lib/ue-phy-pscch-rx-output-stats.cc"
+  "/root/repo/scratch/datahose/lib/ue-phy-pssch-rx-output-stats.cc"
+  "/root/repo/scratch/datahose/lib/ue-rlc-rx-output-stats.cc"
+  "/root/repo/scratch/datahose/lib/ue-to-ue-pkt-txrx-output-stats.cc"
+  "/root/repo/scratch/datahose/lib/v2x-kpi.cc"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_dev_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# scratch_sources at scratch/CMakeLists.txt:98 (file)
+file(GLOB NEW_GLOB LIST_DIRECTORIES true "/root/repo/scratch/datahose/src/[^.]*.cc")
+set(OLD_GLOB
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_dev_build/CMakeFiles/cmake.verify_globs")
+endif()
+
+# scratch_subdirectories at scratch/CMakeLists.txt:74 (file)
+file(GLOB_RECURSE NEW_GLOB LIST_DIRECTORIES true "/root/repo/scratch/**")
+set(OLD_GLOB
+  "/root/repo/scratch/CMakeLists.txt"
+  "/root/repo/scratch/datahose"
+  "/root/repo/scratch/datahose/CMakeLists.txt"
+  "/root/repo/scratch/datahose/datahose.cc"
+  "/root/repo/scratch/datahose/include"
+  "/root/repo/scratch/datahose/include/ActivationReader.h"
+  "/root/repo/scratch/datahose/include/ArrowUtils.h"
+  "/root/repo/scratch/datahose/include/Columns.h"
+  "/root/repo/scratch/datahose/include/Core.h"
+  "/root/repo/scratch/datahose/include/LinkReader.h"
+  "/root/repo/scratch/datahose/include/Outputter.h"
+  "/root/repo/scratch/datahose/include/PositionReader.h"
+  "/root/repo/scratch/datahose/include/TraceMobility.h"
+  "/root/repo/scratch/datahose/include/TraceReader.h"
+  "/root/repo/scratch/datahose/lib"
+  "/root/repo/scratch/datahose/lib/ue-mac-pscch-tx-output-stats.cc"
+  "/root/repo/scratch/datahose/lib/ue-mac-pscch-tx-output-stats.h"
+  "/root/repo/scratch/datahose/lib/ue-mac-pssch-tx-output-stats.cc"
+  "/root/repo/scratch/datahose/lib/ue-mac-pssch-tx-output-stats.h"
+  "/root/repo/scratch/datahose/lib/ue-phy-pscch-rx-output-stats.cc"
+  "/root/repo/scratch/datahose/lib/ue-phy-pscch-rx-output-stats.h"
+  "/root/repo/scratch/datahose/lib/ue-phy-pssch-rx-output-stats.cc"
+  "/root/repo/scratch/datahose/lib/ue-phy-pssch-rx-output-stats.h"
+  "/root/repo/scratch/datahose/lib/ue-rlc-rx-output-stats.cc"
+  "/root/repo/scratch/datahose/lib/ue-rlc-rx-output-stats.h"
+  "/root/repo/scratch/datahose/lib/ue-to-ue-pkt-txrx-output-stats.cc"
+  "/root/repo/scratch/datahose/lib/ue-to-ue-pkt-txrx-output-stats.h"
+  "/root/repo/scratch/datahose/lib/v2x-kpi.cc"
+  "/root/repo/scratch/datahose/lib/v2x-kpi.h"
+  "/root/repo/scratch/datahose/src"
+  "/root/repo/scratch/datahose/src/ActivationReader.cpp"
+  "/root/repo/scratch/datahose/src/Core.cpp"
+  "/root/repo/scratch/datahose/src/LinkReader.cpp"
+  "/root/repo/scratch/datahose/src/Outputter.cpp"
+  "/root/repo/scratch/datahose/src/PositionReader.cpp"
+  "/root/repo/scratch/datahose/src/TraceMobility.cpp"
+  "/root/repo/scratch/datahose/src/TraceReader.cpp"
+  )
+if(NOT "${NEW_GLOB}" STREQUAL "${OLD_GLOB}")
+  message("-- GLOB mismatch!")
+  file(TOUCH_NOCREATE "/root/repo/_dev_build/CMakeFiles/cmake.verify_globs")
+endif()
@@ -0,0 +1,22 @@
+/* generated by CMake */
+
+#pragma GCC system_header
+#ifdef __cplusplus
+#include <iostream>
+#include <stdint.h>
+#include <stdlib.h>
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <list>
+#include <algorithm>
+#include <string>
+#include <set>
+#include <sstream>
+#include <fstream>
+#include <cstdlib>
+#include <exception>
+#include <cstring>
+#include <limits>
+#include <math.h>
+#endif // __cplusplus
@@ -0,0 +1 @@
+/root/repo/src/core/model/abort.h
\ No newline at end of file
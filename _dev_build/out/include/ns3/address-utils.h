@@ -0,0 +1 @@
+/root/repo/src/network/utils/address-utils.h
\ No newline at end of file
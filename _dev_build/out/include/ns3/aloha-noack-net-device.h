@@ -0,0 +1 @@
+/root/repo/src/spectrum/model/aloha-noack-net-device.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/ampdu-subframe-header.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/antenna/model/antenna-model.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/utils/bit-serializer.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/block-ack-type.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/block-ack-window.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/build-profile.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/calendar-scheduler.h
\ No newline at end of file
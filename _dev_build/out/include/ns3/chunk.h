@@ -0,0 +1 @@
+/root/repo/src/network/model/chunk.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/command-line.h
\ No newline at end of file
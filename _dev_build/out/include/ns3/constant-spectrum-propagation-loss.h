@@ -0,0 +1 @@
+/root/repo/src/spectrum/model/constant-spectrum-propagation-loss.h
\ No newline at end of file
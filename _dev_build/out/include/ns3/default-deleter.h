@@ -0,0 +1 @@
+/root/repo/src/core/model/default-deleter.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/non-ht/dsss-error-rate-model.h
\ No newline at end of file
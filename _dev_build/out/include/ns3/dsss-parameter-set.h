@@ -0,0 +1 @@
+/root/repo/src/wifi/model/non-ht/dsss-parameter-set.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/non-ht/dsss-ppdu.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/energy/helper/energy-source-container.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/non-ht/erp-information.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/helper/event-garbage-collector.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/fluid-traffic-model.h
\ No newline at end of file
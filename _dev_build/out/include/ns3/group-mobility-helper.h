@@ -0,0 +1 @@
+/root/repo/src/mobility/helper/group-mobility-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/spectrum/model/half-duplex-ideal-phy-signal-parameters.h
\ No newline at end of file
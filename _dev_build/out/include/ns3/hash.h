@@ -0,0 +1 @@
+/root/repo/src/core/model/hash.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/stats/model/histogram.h
\ No newline at end of file
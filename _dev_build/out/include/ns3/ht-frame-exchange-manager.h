@@ -0,0 +1 @@
+/root/repo/src/wifi/model/ht/ht-frame-exchange-manager.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/interference-helper.h
\ No newline at end of file
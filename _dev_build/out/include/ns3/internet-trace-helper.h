@@ -0,0 +1 @@
+/root/repo/src/internet/helper/internet-trace-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/ipv6-extension.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/ipv6-interface-address.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/ipv6-list-routing.h
\ No newline at end of file
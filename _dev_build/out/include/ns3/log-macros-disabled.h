@@ -0,0 +1 @@
+/root/repo/src/core/model/log-macros-disabled.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/utils/lollipop-counter.h
\ No newline at end of file
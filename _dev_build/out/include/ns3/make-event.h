@@ -0,0 +1 @@
+/root/repo/src/core/model/make-event.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/math.h
\ No newline at end of file
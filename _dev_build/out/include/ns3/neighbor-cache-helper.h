@@ -0,0 +1 @@
+/root/repo/src/internet/helper/neighbor-cache-helper.h
\ No newline at end of file
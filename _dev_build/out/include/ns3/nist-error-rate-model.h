@@ -0,0 +1 @@
+/root/repo/src/wifi/model/nist-error-rate-model.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/object-base.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/non-ht/ofdm-ppdu.h
\ No newline at end of file
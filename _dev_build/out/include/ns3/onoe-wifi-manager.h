@@ -0,0 +1 @@
+/root/repo/src/wifi/model/rate-control/onoe-wifi-manager.h
\ No newline at end of file
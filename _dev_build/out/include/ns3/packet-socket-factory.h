@@ -0,0 +1 @@
+/root/repo/src/network/utils/packet-socket-factory.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/utils/pcap-write-buffer.h
\ No newline at end of file
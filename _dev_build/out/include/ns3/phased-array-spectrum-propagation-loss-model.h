@@ -0,0 +1 @@
+/root/repo/src/spectrum/model/phased-array-spectrum-propagation-loss-model.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/prefix-trie.h
\ No newline at end of file
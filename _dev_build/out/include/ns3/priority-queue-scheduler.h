@@ -0,0 +1 @@
+/root/repo/src/core/model/priority-queue-scheduler.h
\ No newline at end of file
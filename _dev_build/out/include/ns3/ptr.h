@@ -0,0 +1 @@
+/root/repo/src/core/model/ptr.h
\ No newline at end of file
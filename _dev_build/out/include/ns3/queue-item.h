@@ -0,0 +1 @@
+/root/repo/src/network/utils/queue-item.h
\ No newline at end of file
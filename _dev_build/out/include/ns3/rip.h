@@ -0,0 +1 @@
+/root/repo/src/internet/model/rip.h
\ No newline at end of file
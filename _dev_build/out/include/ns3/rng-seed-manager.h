@@ -0,0 +1 @@
+/root/repo/src/core/model/rng-seed-manager.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/energy/helper/rv-battery-model-helper.h
\ No newline at end of file
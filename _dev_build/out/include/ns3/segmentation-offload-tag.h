@@ -0,0 +1 @@
+/root/repo/src/network/utils/segmentation-offload-tag.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/energy/model/simple-device-energy-model.h
\ No newline at end of file
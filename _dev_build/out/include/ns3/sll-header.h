@@ -0,0 +1 @@
+/root/repo/src/network/utils/sll-header.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/model/socket-factory.h
\ No newline at end of file
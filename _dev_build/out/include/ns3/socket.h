@@ -0,0 +1 @@
+/root/repo/src/network/model/socket.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/propagation/model/spatial-index.h
\ No newline at end of file
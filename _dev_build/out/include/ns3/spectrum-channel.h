@@ -0,0 +1 @@
+/root/repo/src/spectrum/model/spectrum-channel.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/stats/model/sqlite-output.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/string.h
\ No newline at end of file
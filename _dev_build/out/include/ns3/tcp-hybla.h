@@ -0,0 +1 @@
+/root/repo/src/internet/model/tcp-hybla.h
\ No newline at end of file
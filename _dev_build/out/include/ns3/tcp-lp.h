@@ -0,0 +1 @@
+/root/repo/src/internet/model/tcp-lp.h
\ No newline at end of file
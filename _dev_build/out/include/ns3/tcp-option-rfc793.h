@@ -0,0 +1 @@
+/root/repo/src/internet/model/tcp-option-rfc793.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/tcp-prr-recovery.h
\ No newline at end of file
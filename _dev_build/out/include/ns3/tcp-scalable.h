@@ -0,0 +1 @@
+/root/repo/src/internet/model/tcp-scalable.h
\ No newline at end of file
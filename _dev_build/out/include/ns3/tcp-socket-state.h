@@ -0,0 +1 @@
+/root/repo/src/internet/model/tcp-socket-state.h
\ No newline at end of file
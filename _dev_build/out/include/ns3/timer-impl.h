@@ -0,0 +1 @@
+/root/repo/src/core/model/timer-impl.h
\ No newline at end of file
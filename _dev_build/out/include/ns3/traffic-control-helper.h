@@ -0,0 +1 @@
+/root/repo/src/traffic-control/helper/traffic-control-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/traffic-control/model/traffic-control-layer.h
\ No newline at end of file
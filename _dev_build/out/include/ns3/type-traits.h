@@ -0,0 +1 @@
+/root/repo/src/core/model/type-traits.h
\ No newline at end of file
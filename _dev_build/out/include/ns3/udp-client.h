@@ -0,0 +1 @@
+/root/repo/src/applications/model/udp-client.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/stats/model/uinteger-16-probe.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/vht/vht-operation.h
\ No newline at end of file
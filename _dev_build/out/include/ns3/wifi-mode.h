@@ -0,0 +1 @@
+/root/repo/src/wifi/model/wifi-mode.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/wifi-net-device.h
\ No newline at end of file
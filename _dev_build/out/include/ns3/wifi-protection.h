@@ -0,0 +1 @@
+/root/repo/src/wifi/model/wifi-protection.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/helper/wifi-radio-energy-model-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/wifi-radio-energy-model.h
\ No newline at end of file
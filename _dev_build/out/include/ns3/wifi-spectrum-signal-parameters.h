@@ -0,0 +1 @@
+/root/repo/src/wifi/model/wifi-spectrum-signal-parameters.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/wifi-tx-vector.h
\ No newline at end of file
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../out/scratch/ns3-dev-tmp-cam-bench-default"
+  "../out/scratch/ns3-dev-tmp-cam-bench-default.pdb"
+  "CMakeFiles/scratch_tmp-cam-bench.dir/tmp-cam-bench.cc.o"
+  "CMakeFiles/scratch_tmp-cam-bench.dir/tmp-cam-bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scratch_tmp-cam-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../out/scratch/ns3-dev-tmp-minstrel-bench-default"
+  "../out/scratch/ns3-dev-tmp-minstrel-bench-default.pdb"
+  "CMakeFiles/scratch_tmp-minstrel-bench.dir/tmp-minstrel-bench.cc.o"
+  "CMakeFiles/scratch_tmp-minstrel-bench.dir/tmp-minstrel-bench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scratch_tmp-minstrel-bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/scratch
+# Build directory: /root/repo/_dev_build/scratch
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("datahose")
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/scratch/datahose/src/ActivationReader.cpp" "scratch/datahose/CMakeFiles/core-lib.dir/src/ActivationReader.cpp.o" "gcc" "scratch/datahose/CMakeFiles/core-lib.dir/src/ActivationReader.cpp.o.d"
+  "/root/repo/scratch/datahose/src/Core.cpp" "scratch/datahose/CMakeFiles/core-lib.dir/src/Core.cpp.o" "gcc" "scratch/datahose/CMakeFiles/core-lib.dir/src/Core.cpp.o.d"
+  "/root/repo/scratch/datahose/src/LinkReader.cpp" "scratch/datahose/CMakeFiles/core-lib.dir/src/LinkReader.cpp.o" "gcc" "scratch/datahose/CMakeFiles/core-lib.dir/src/LinkReader.cpp.o.d"
+  "/root/repo/scratch/datahose/src/Outputter.cpp" "scratch/datahose/CMakeFiles/core-lib.dir/src/Outputter.cpp.o" "gcc" "scratch/datahose/CMakeFiles/core-lib.dir/src/Outputter.cpp.o.d"
+  "/root/repo/scratch/datahose/src/PositionReader.cpp" "scratch/datahose/CMakeFiles/core-lib.dir/src/PositionReader.cpp.o" "gcc" "scratch/datahose/CMakeFiles/core-lib.dir/src/PositionReader.cpp.o.d"
+  "/root/repo/scratch/datahose/src/TraceMobility.cpp" "scratch/datahose/CMakeFiles/core-lib.dir/src/TraceMobility.cpp.o" "gcc" "scratch/datahose/CMakeFiles/core-lib.dir/src/TraceMobility.cpp.o.d"
+  "/root/repo/scratch/datahose/src/TraceReader.cpp" "scratch/datahose/CMakeFiles/core-lib.dir/src/TraceReader.cpp.o" "gcc" "scratch/datahose/CMakeFiles/core-lib.dir/src/TraceReader.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
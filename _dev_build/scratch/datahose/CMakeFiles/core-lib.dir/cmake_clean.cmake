@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libcore-lib.a"
+  "../../out/lib/libcore-lib.pdb"
+  "CMakeFiles/core-lib.dir/src/ActivationReader.cpp.o"
+  "CMakeFiles/core-lib.dir/src/ActivationReader.cpp.o.d"
+  "CMakeFiles/core-lib.dir/src/Core.cpp.o"
+  "CMakeFiles/core-lib.dir/src/Core.cpp.o.d"
+  "CMakeFiles/core-lib.dir/src/LinkReader.cpp.o"
+  "CMakeFiles/core-lib.dir/src/LinkReader.cpp.o.d"
+  "CMakeFiles/core-lib.dir/src/Outputter.cpp.o"
+  "CMakeFiles/core-lib.dir/src/Outputter.cpp.o.d"
+  "CMakeFiles/core-lib.dir/src/PositionReader.cpp.o"
+  "CMakeFiles/core-lib.dir/src/PositionReader.cpp.o.d"
+  "CMakeFiles/core-lib.dir/src/TraceMobility.cpp.o"
+  "CMakeFiles/core-lib.dir/src/TraceMobility.cpp.o.d"
+  "CMakeFiles/core-lib.dir/src/TraceReader.cpp.o"
+  "CMakeFiles/core-lib.dir/src/TraceReader.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/core-lib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
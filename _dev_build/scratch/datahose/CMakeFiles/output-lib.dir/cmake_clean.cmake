@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/lib/liboutput-lib.a"
+  "../../out/lib/liboutput-lib.pdb"
+  "CMakeFiles/output-lib.dir/lib/ue-to-ue-pkt-txrx-output-stats.cc.o"
+  "CMakeFiles/output-lib.dir/lib/ue-to-ue-pkt-txrx-output-stats.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/output-lib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/scratch/datahose/datahose.cc" "scratch/datahose/CMakeFiles/scratch_datahose_run.dir/datahose.cc.o" "gcc" "scratch/datahose/CMakeFiles/scratch_datahose_run.dir/datahose.cc.o.d"
+  "/root/repo/_dev_build/CMakeFiles/stdlib_pch_exec.dir/cmake_pch.hxx" "scratch/datahose/CMakeFiles/scratch_datahose_run.dir/datahose.cc.o" "gcc" "scratch/datahose/CMakeFiles/scratch_datahose_run.dir/datahose.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dev_build/scratch/datahose/CMakeFiles/core-lib.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/scratch/datahose/CMakeFiles/output-lib.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/wifi/CMakeFiles/libwifi.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/internet/CMakeFiles/libinternet.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/energy/CMakeFiles/libenergy.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/spectrum/CMakeFiles/libspectrum.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/propagation/CMakeFiles/libpropagation.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/antenna/CMakeFiles/libantenna.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/mobility/CMakeFiles/libmobility.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/bridge/CMakeFiles/libbridge.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/traffic-control/CMakeFiles/libtraffic-control.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/config-store/CMakeFiles/libconfig-store.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/network/CMakeFiles/libnetwork.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/stats/CMakeFiles/libstats.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/core/CMakeFiles/libcore.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/ns3-dev-run-default"
+  "../../out/ns3-dev-run-default.pdb"
+  "CMakeFiles/scratch_datahose_run.dir/datahose.cc.o"
+  "CMakeFiles/scratch_datahose_run.dir/datahose.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scratch_datahose_run.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/scratch/datahose
+# Build directory: /root/repo/_dev_build/scratch/datahose
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ctest-scratch_datahose_run "ns3-dev-run-default")
+set_tests_properties(ctest-scratch_datahose_run PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/out/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1337;add_test;/root/repo/build-support/macros-and-definitions.cmake;1884;set_runtime_outputdirectory;/root/repo/scratch/datahose/CMakeLists.txt;38;build_exec;/root/repo/scratch/datahose/CMakeLists.txt;0;")
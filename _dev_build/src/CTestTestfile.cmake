@@ -0,0 +1,21 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src
+# Build directory: /root/repo/_dev_build/src
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("applications")
+subdirs("internet")
+subdirs("wifi")
+subdirs("network")
+subdirs("core")
+subdirs("stats")
+subdirs("bridge")
+subdirs("traffic-control")
+subdirs("config-store")
+subdirs("propagation")
+subdirs("mobility")
+subdirs("energy")
+subdirs("spectrum")
+subdirs("antenna")
+subdirs("test")
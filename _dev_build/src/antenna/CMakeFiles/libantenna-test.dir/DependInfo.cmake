@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/antenna/test/test-angles.cc" "src/antenna/CMakeFiles/libantenna-test.dir/test/test-angles.cc.o" "gcc" "src/antenna/CMakeFiles/libantenna-test.dir/test/test-angles.cc.o.d"
+  "/root/repo/src/antenna/test/test-cosine-antenna.cc" "src/antenna/CMakeFiles/libantenna-test.dir/test/test-cosine-antenna.cc.o" "gcc" "src/antenna/CMakeFiles/libantenna-test.dir/test/test-cosine-antenna.cc.o.d"
+  "/root/repo/src/antenna/test/test-degrees-radians.cc" "src/antenna/CMakeFiles/libantenna-test.dir/test/test-degrees-radians.cc.o" "gcc" "src/antenna/CMakeFiles/libantenna-test.dir/test/test-degrees-radians.cc.o.d"
+  "/root/repo/src/antenna/test/test-isotropic-antenna.cc" "src/antenna/CMakeFiles/libantenna-test.dir/test/test-isotropic-antenna.cc.o" "gcc" "src/antenna/CMakeFiles/libantenna-test.dir/test/test-isotropic-antenna.cc.o.d"
+  "/root/repo/src/antenna/test/test-parabolic-antenna.cc" "src/antenna/CMakeFiles/libantenna-test.dir/test/test-parabolic-antenna.cc.o" "gcc" "src/antenna/CMakeFiles/libantenna-test.dir/test/test-parabolic-antenna.cc.o.d"
+  "/root/repo/src/antenna/test/test-uniform-planar-array.cc" "src/antenna/CMakeFiles/libantenna-test.dir/test/test-uniform-planar-array.cc.o" "gcc" "src/antenna/CMakeFiles/libantenna-test.dir/test/test-uniform-planar-array.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dev_build/src/antenna/CMakeFiles/libantenna.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/core/CMakeFiles/libcore.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
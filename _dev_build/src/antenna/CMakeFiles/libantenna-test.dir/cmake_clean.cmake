@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-antenna-test-default.pdb"
+  "../../out/lib/libns3-dev-antenna-test-default.so"
+  "CMakeFiles/libantenna-test.dir/test/test-angles.cc.o"
+  "CMakeFiles/libantenna-test.dir/test/test-angles.cc.o.d"
+  "CMakeFiles/libantenna-test.dir/test/test-cosine-antenna.cc.o"
+  "CMakeFiles/libantenna-test.dir/test/test-cosine-antenna.cc.o.d"
+  "CMakeFiles/libantenna-test.dir/test/test-degrees-radians.cc.o"
+  "CMakeFiles/libantenna-test.dir/test/test-degrees-radians.cc.o.d"
+  "CMakeFiles/libantenna-test.dir/test/test-isotropic-antenna.cc.o"
+  "CMakeFiles/libantenna-test.dir/test/test-isotropic-antenna.cc.o.d"
+  "CMakeFiles/libantenna-test.dir/test/test-parabolic-antenna.cc.o"
+  "CMakeFiles/libantenna-test.dir/test/test-parabolic-antenna.cc.o.d"
+  "CMakeFiles/libantenna-test.dir/test/test-uniform-planar-array.cc.o"
+  "CMakeFiles/libantenna-test.dir/test/test-uniform-planar-array.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libantenna-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-antenna-default.pdb"
+  "../../out/lib/libns3-dev-antenna-default.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libantenna.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
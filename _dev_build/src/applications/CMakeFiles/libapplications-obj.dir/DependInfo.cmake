@@ -0,0 +1,41 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/applications/helper/bulk-send-helper.cc" "src/applications/CMakeFiles/libapplications-obj.dir/helper/bulk-send-helper.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/helper/bulk-send-helper.cc.o.d"
+  "/root/repo/src/applications/helper/on-off-helper.cc" "src/applications/CMakeFiles/libapplications-obj.dir/helper/on-off-helper.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/helper/on-off-helper.cc.o.d"
+  "/root/repo/src/applications/helper/packet-sink-helper.cc" "src/applications/CMakeFiles/libapplications-obj.dir/helper/packet-sink-helper.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/helper/packet-sink-helper.cc.o.d"
+  "/root/repo/src/applications/helper/three-gpp-http-helper.cc" "src/applications/CMakeFiles/libapplications-obj.dir/helper/three-gpp-http-helper.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/helper/three-gpp-http-helper.cc.o.d"
+  "/root/repo/src/applications/helper/udp-client-server-helper.cc" "src/applications/CMakeFiles/libapplications-obj.dir/helper/udp-client-server-helper.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/helper/udp-client-server-helper.cc.o.d"
+  "/root/repo/src/applications/helper/udp-echo-helper.cc" "src/applications/CMakeFiles/libapplications-obj.dir/helper/udp-echo-helper.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/helper/udp-echo-helper.cc.o.d"
+  "/root/repo/src/applications/model/application-packet-probe.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/application-packet-probe.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/application-packet-probe.cc.o.d"
+  "/root/repo/src/applications/model/bulk-send-application.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/bulk-send-application.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/bulk-send-application.cc.o.d"
+  "/root/repo/src/applications/model/onoff-application.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/onoff-application.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/onoff-application.cc.o.d"
+  "/root/repo/src/applications/model/packet-loss-counter.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/packet-loss-counter.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/packet-loss-counter.cc.o.d"
+  "/root/repo/src/applications/model/packet-sink.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/packet-sink.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/packet-sink.cc.o.d"
+  "/root/repo/src/applications/model/seq-ts-echo-header.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/seq-ts-echo-header.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/seq-ts-echo-header.cc.o.d"
+  "/root/repo/src/applications/model/seq-ts-header.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/seq-ts-header.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/seq-ts-header.cc.o.d"
+  "/root/repo/src/applications/model/seq-ts-size-header.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/seq-ts-size-header.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/seq-ts-size-header.cc.o.d"
+  "/root/repo/src/applications/model/three-gpp-http-client.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/three-gpp-http-client.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/three-gpp-http-client.cc.o.d"
+  "/root/repo/src/applications/model/three-gpp-http-header.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/three-gpp-http-header.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/three-gpp-http-header.cc.o.d"
+  "/root/repo/src/applications/model/three-gpp-http-server.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/three-gpp-http-server.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/three-gpp-http-server.cc.o.d"
+  "/root/repo/src/applications/model/three-gpp-http-variables.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/three-gpp-http-variables.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/three-gpp-http-variables.cc.o.d"
+  "/root/repo/src/applications/model/udp-client.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/udp-client.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/udp-client.cc.o.d"
+  "/root/repo/src/applications/model/udp-echo-client.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/udp-echo-client.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/udp-echo-client.cc.o.d"
+  "/root/repo/src/applications/model/udp-echo-server.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/udp-echo-server.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/udp-echo-server.cc.o.d"
+  "/root/repo/src/applications/model/udp-server.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/udp-server.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/udp-server.cc.o.d"
+  "/root/repo/src/applications/model/udp-trace-client.cc" "src/applications/CMakeFiles/libapplications-obj.dir/model/udp-trace-client.cc.o" "gcc" "src/applications/CMakeFiles/libapplications-obj.dir/model/udp-trace-client.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libapplications-obj.dir/helper/bulk-send-helper.cc.o"
+  "CMakeFiles/libapplications-obj.dir/helper/bulk-send-helper.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/helper/on-off-helper.cc.o"
+  "CMakeFiles/libapplications-obj.dir/helper/on-off-helper.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/helper/packet-sink-helper.cc.o"
+  "CMakeFiles/libapplications-obj.dir/helper/packet-sink-helper.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/helper/three-gpp-http-helper.cc.o"
+  "CMakeFiles/libapplications-obj.dir/helper/three-gpp-http-helper.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/helper/udp-client-server-helper.cc.o"
+  "CMakeFiles/libapplications-obj.dir/helper/udp-client-server-helper.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/helper/udp-echo-helper.cc.o"
+  "CMakeFiles/libapplications-obj.dir/helper/udp-echo-helper.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/application-packet-probe.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/application-packet-probe.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/bulk-send-application.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/bulk-send-application.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/onoff-application.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/onoff-application.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/packet-loss-counter.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/packet-loss-counter.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/packet-sink.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/packet-sink.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/seq-ts-echo-header.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/seq-ts-echo-header.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/seq-ts-header.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/seq-ts-header.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/seq-ts-size-header.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/seq-ts-size-header.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/three-gpp-http-client.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/three-gpp-http-client.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/three-gpp-http-header.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/three-gpp-http-header.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/three-gpp-http-server.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/three-gpp-http-server.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/three-gpp-http-variables.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/three-gpp-http-variables.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/udp-client.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/udp-client.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/udp-echo-client.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/udp-echo-client.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/udp-echo-server.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/udp-echo-server.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/udp-server.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/udp-server.cc.o.d"
+  "CMakeFiles/libapplications-obj.dir/model/udp-trace-client.cc.o"
+  "CMakeFiles/libapplications-obj.dir/model/udp-trace-client.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libapplications-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
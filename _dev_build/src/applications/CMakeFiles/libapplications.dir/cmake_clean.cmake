@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-applications-default.pdb"
+  "../../out/lib/libns3-dev-applications-default.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libapplications.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libbridge-obj.dir/helper/bridge-helper.cc.o"
+  "CMakeFiles/libbridge-obj.dir/helper/bridge-helper.cc.o.d"
+  "CMakeFiles/libbridge-obj.dir/model/bridge-channel.cc.o"
+  "CMakeFiles/libbridge-obj.dir/model/bridge-channel.cc.o.d"
+  "CMakeFiles/libbridge-obj.dir/model/bridge-net-device.cc.o"
+  "CMakeFiles/libbridge-obj.dir/model/bridge-net-device.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libbridge-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
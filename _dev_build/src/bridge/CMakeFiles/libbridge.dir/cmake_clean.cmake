@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-bridge-default.pdb"
+  "../../out/lib/libns3-dev-bridge-default.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libbridge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/config-store/model/attribute-default-iterator.cc" "src/config-store/CMakeFiles/libconfig-store-obj.dir/model/attribute-default-iterator.cc.o" "gcc" "src/config-store/CMakeFiles/libconfig-store-obj.dir/model/attribute-default-iterator.cc.o.d"
+  "/root/repo/src/config-store/model/attribute-iterator.cc" "src/config-store/CMakeFiles/libconfig-store-obj.dir/model/attribute-iterator.cc.o" "gcc" "src/config-store/CMakeFiles/libconfig-store-obj.dir/model/attribute-iterator.cc.o.d"
+  "/root/repo/src/config-store/model/config-store.cc" "src/config-store/CMakeFiles/libconfig-store-obj.dir/model/config-store.cc.o" "gcc" "src/config-store/CMakeFiles/libconfig-store-obj.dir/model/config-store.cc.o.d"
+  "/root/repo/src/config-store/model/file-config.cc" "src/config-store/CMakeFiles/libconfig-store-obj.dir/model/file-config.cc.o" "gcc" "src/config-store/CMakeFiles/libconfig-store-obj.dir/model/file-config.cc.o.d"
+  "/root/repo/src/config-store/model/raw-text-config.cc" "src/config-store/CMakeFiles/libconfig-store-obj.dir/model/raw-text-config.cc.o" "gcc" "src/config-store/CMakeFiles/libconfig-store-obj.dir/model/raw-text-config.cc.o.d"
+  "/root/repo/src/config-store/model/xml-config.cc" "src/config-store/CMakeFiles/libconfig-store-obj.dir/model/xml-config.cc.o" "gcc" "src/config-store/CMakeFiles/libconfig-store-obj.dir/model/xml-config.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
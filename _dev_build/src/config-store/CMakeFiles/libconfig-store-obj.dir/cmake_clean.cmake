@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libconfig-store-obj.dir/model/attribute-default-iterator.cc.o"
+  "CMakeFiles/libconfig-store-obj.dir/model/attribute-default-iterator.cc.o.d"
+  "CMakeFiles/libconfig-store-obj.dir/model/attribute-iterator.cc.o"
+  "CMakeFiles/libconfig-store-obj.dir/model/attribute-iterator.cc.o.d"
+  "CMakeFiles/libconfig-store-obj.dir/model/config-store.cc.o"
+  "CMakeFiles/libconfig-store-obj.dir/model/config-store.cc.o.d"
+  "CMakeFiles/libconfig-store-obj.dir/model/file-config.cc.o"
+  "CMakeFiles/libconfig-store-obj.dir/model/file-config.cc.o.d"
+  "CMakeFiles/libconfig-store-obj.dir/model/raw-text-config.cc.o"
+  "CMakeFiles/libconfig-store-obj.dir/model/raw-text-config.cc.o.d"
+  "CMakeFiles/libconfig-store-obj.dir/model/xml-config.cc.o"
+  "CMakeFiles/libconfig-store-obj.dir/model/xml-config.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libconfig-store-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
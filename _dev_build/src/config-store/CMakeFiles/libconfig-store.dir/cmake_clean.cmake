@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-config-store-default.pdb"
+  "../../out/lib/libns3-dev-config-store-default.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libconfig-store.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,141 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libcore-obj.dir/helper/csv-reader.cc.o"
+  "CMakeFiles/libcore-obj.dir/helper/csv-reader.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/helper/event-garbage-collector.cc.o"
+  "CMakeFiles/libcore-obj.dir/helper/event-garbage-collector.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/helper/random-variable-stream-helper.cc.o"
+  "CMakeFiles/libcore-obj.dir/helper/random-variable-stream-helper.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/ascii-file.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/ascii-file.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/attribute-construction-list.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/attribute-construction-list.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/attribute.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/attribute.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/boolean.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/boolean.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/breakpoint.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/breakpoint.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/calendar-scheduler.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/calendar-scheduler.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/callback.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/callback.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/command-line.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/command-line.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/config.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/config.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/default-simulator-impl.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/default-simulator-impl.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/des-metrics.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/des-metrics.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/double.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/double.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/enum.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/enum.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/event-id.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/event-id.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/event-impl.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/event-impl.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/fatal-impl.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/fatal-impl.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/global-value.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/global-value.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/hash-fnv.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/hash-fnv.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/hash-function.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/hash-function.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/hash-murmur3.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/hash-murmur3.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/hash.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/hash.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/heap-scheduler.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/heap-scheduler.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/int64x64-128.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/int64x64-128.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/int64x64.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/int64x64.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/integer.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/integer.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/length.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/length.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/list-scheduler.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/list-scheduler.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/log.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/log.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/make-event.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/make-event.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/map-scheduler.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/map-scheduler.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/names.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/names.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/node-printer.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/node-printer.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/object-base.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/object-base.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/object-factory.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/object-factory.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/object-ptr-container.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/object-ptr-container.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/object.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/object.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/pointer.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/pointer.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/priority-queue-scheduler.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/priority-queue-scheduler.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/random-variable-stream.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/random-variable-stream.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/realtime-simulator-impl.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/realtime-simulator-impl.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/ref-count-base.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/ref-count-base.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/rng-seed-manager.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/rng-seed-manager.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/rng-stream.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/rng-stream.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/scheduler.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/scheduler.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/show-progress.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/show-progress.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/simulator-impl.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/simulator-impl.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/simulator.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/simulator.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/string.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/string.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/synchronizer.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/synchronizer.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/system-path.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/system-path.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/system-wall-clock-timestamp.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/system-wall-clock-timestamp.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/test.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/test.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/time-printer.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/time-printer.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/time.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/time.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/timer.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/timer.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/trace-source-accessor.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/trace-source-accessor.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/trickle-timer.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/trickle-timer.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/type-id.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/type-id.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/uinteger.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/uinteger.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/unix-fd-reader.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/unix-fd-reader.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/unix-system-wall-clock-ms.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/unix-system-wall-clock-ms.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/vector.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/vector.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/wall-clock-synchronizer.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/wall-clock-synchronizer.cc.o.d"
+  "CMakeFiles/libcore-obj.dir/model/watchdog.cc.o"
+  "CMakeFiles/libcore-obj.dir/model/watchdog.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libcore-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
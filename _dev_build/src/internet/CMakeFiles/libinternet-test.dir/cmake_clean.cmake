@@ -0,0 +1,163 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-internet-test-default.pdb"
+  "../../out/lib/libns3-dev-internet-test-default.so"
+  "CMakeFiles/libinternet-test.dir/test/end-point-demux-test-suite.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/end-point-demux-test-suite.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/fluid-traffic-model-test-suite.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/fluid-traffic-model-test-suite.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/global-route-manager-impl-test-suite.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/global-route-manager-impl-test-suite.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/icmp-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/icmp-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-address-generator-test-suite.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-address-generator-test-suite.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-address-helper-test-suite.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-address-helper-test-suite.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-deduplication-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-deduplication-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-forwarding-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-forwarding-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-fragmentation-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-fragmentation-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-global-routing-test-suite.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-global-routing-test-suite.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-header-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-header-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-list-routing-test-suite.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-list-routing-test-suite.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-packet-info-tag-test-suite.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-packet-info-tag-test-suite.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-raw-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-raw-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-rip-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-rip-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-static-routing-test-suite.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-static-routing-test-suite.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv4-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-address-duplication-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-address-duplication-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-address-generator-test-suite.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-address-generator-test-suite.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-address-helper-test-suite.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-address-helper-test-suite.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-dual-stack-test-suite.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-dual-stack-test-suite.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-extension-header-test-suite.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-extension-header-test-suite.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-forwarding-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-forwarding-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-fragmentation-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-fragmentation-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-list-routing-test-suite.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-list-routing-test-suite.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-packet-info-tag-test-suite.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-packet-info-tag-test-suite.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-raw-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-raw-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-ripng-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-ripng-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/ipv6-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/neighbor-cache-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/neighbor-cache-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/prefix-trie-test-suite.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/prefix-trie-test-suite.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/rtt-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/rtt-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-advertised-window-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-advertised-window-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-bbr-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-bbr-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-bic-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-bic-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-bytes-in-flight-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-bytes-in-flight-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-classic-recovery-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-classic-recovery-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-close-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-close-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-cong-avoid-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-cong-avoid-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-datasentcb-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-datasentcb-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-dctcp-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-dctcp-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-ecn-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-ecn-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-endpoint-bug2211.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-endpoint-bug2211.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-error-model.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-error-model.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-fast-retr-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-fast-retr-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-general-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-general-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-header-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-header-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-highspeed-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-highspeed-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-htcp-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-htcp-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-hybla-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-hybla-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-illinois-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-illinois-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-ledbat-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-ledbat-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-linux-reno-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-linux-reno-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-loss-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-loss-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-lp-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-lp-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-option-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-option-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-pacing-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-pacing-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-pkts-acked-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-pkts-acked-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-prr-recovery-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-prr-recovery-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-rate-ops-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-rate-ops-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-rto-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-rto-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-rtt-estimation.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-rtt-estimation.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-rx-buffer-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-rx-buffer-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-sack-permitted-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-sack-permitted-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-scalable-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-scalable-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-slow-start-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-slow-start-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-syn-connection-failed-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-syn-connection-failed-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-timestamp-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-timestamp-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-tso-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-tso-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-tx-buffer-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-tx-buffer-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-vegas-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-vegas-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-veno-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-veno-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-wscaling-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-wscaling-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-yeah-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-yeah-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/tcp-zero-window-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/tcp-zero-window-test.cc.o.d"
+  "CMakeFiles/libinternet-test.dir/test/udp-test.cc.o"
+  "CMakeFiles/libinternet-test.dir/test/udp-test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libinternet-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
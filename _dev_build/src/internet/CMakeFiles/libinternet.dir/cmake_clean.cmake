@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-internet-default.pdb"
+  "../../out/lib/libns3-dev-internet-default.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libinternet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/mobility/helper/group-mobility-helper.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/helper/group-mobility-helper.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/helper/group-mobility-helper.cc.o.d"
+  "/root/repo/src/mobility/helper/mobility-helper.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/helper/mobility-helper.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/helper/mobility-helper.cc.o.d"
+  "/root/repo/src/mobility/helper/ns2-mobility-helper.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/helper/ns2-mobility-helper.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/helper/ns2-mobility-helper.cc.o.d"
+  "/root/repo/src/mobility/model/box.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/box.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/box.cc.o.d"
+  "/root/repo/src/mobility/model/constant-acceleration-mobility-model.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/constant-acceleration-mobility-model.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/constant-acceleration-mobility-model.cc.o.d"
+  "/root/repo/src/mobility/model/constant-position-mobility-model.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/constant-position-mobility-model.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/constant-position-mobility-model.cc.o.d"
+  "/root/repo/src/mobility/model/constant-velocity-helper.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/constant-velocity-helper.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/constant-velocity-helper.cc.o.d"
+  "/root/repo/src/mobility/model/constant-velocity-mobility-model.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/constant-velocity-mobility-model.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/constant-velocity-mobility-model.cc.o.d"
+  "/root/repo/src/mobility/model/gauss-markov-mobility-model.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/gauss-markov-mobility-model.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/gauss-markov-mobility-model.cc.o.d"
+  "/root/repo/src/mobility/model/geographic-positions.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/geographic-positions.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/geographic-positions.cc.o.d"
+  "/root/repo/src/mobility/model/hierarchical-mobility-model.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/hierarchical-mobility-model.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/hierarchical-mobility-model.cc.o.d"
+  "/root/repo/src/mobility/model/mobility-model.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/mobility-model.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/mobility-model.cc.o.d"
+  "/root/repo/src/mobility/model/position-allocator.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/position-allocator.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/position-allocator.cc.o.d"
+  "/root/repo/src/mobility/model/random-direction-2d-mobility-model.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/random-direction-2d-mobility-model.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/random-direction-2d-mobility-model.cc.o.d"
+  "/root/repo/src/mobility/model/random-walk-2d-mobility-model.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/random-walk-2d-mobility-model.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/random-walk-2d-mobility-model.cc.o.d"
+  "/root/repo/src/mobility/model/random-waypoint-mobility-model.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/random-waypoint-mobility-model.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/random-waypoint-mobility-model.cc.o.d"
+  "/root/repo/src/mobility/model/rectangle.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/rectangle.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/rectangle.cc.o.d"
+  "/root/repo/src/mobility/model/steady-state-random-waypoint-mobility-model.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/steady-state-random-waypoint-mobility-model.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/steady-state-random-waypoint-mobility-model.cc.o.d"
+  "/root/repo/src/mobility/model/waypoint-mobility-model.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/waypoint-mobility-model.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/waypoint-mobility-model.cc.o.d"
+  "/root/repo/src/mobility/model/waypoint.cc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/waypoint.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-obj.dir/model/waypoint.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/mobility/test/box-line-intersection-test.cc" "src/mobility/CMakeFiles/libmobility-test.dir/test/box-line-intersection-test.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-test.dir/test/box-line-intersection-test.cc.o.d"
+  "/root/repo/src/mobility/test/geo-to-cartesian-test.cc" "src/mobility/CMakeFiles/libmobility-test.dir/test/geo-to-cartesian-test.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-test.dir/test/geo-to-cartesian-test.cc.o.d"
+  "/root/repo/src/mobility/test/mobility-test-suite.cc" "src/mobility/CMakeFiles/libmobility-test.dir/test/mobility-test-suite.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-test.dir/test/mobility-test-suite.cc.o.d"
+  "/root/repo/src/mobility/test/mobility-trace-test-suite.cc" "src/mobility/CMakeFiles/libmobility-test.dir/test/mobility-trace-test-suite.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-test.dir/test/mobility-trace-test-suite.cc.o.d"
+  "/root/repo/src/mobility/test/ns2-mobility-helper-test-suite.cc" "src/mobility/CMakeFiles/libmobility-test.dir/test/ns2-mobility-helper-test-suite.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-test.dir/test/ns2-mobility-helper-test-suite.cc.o.d"
+  "/root/repo/src/mobility/test/rand-cart-around-geo-test.cc" "src/mobility/CMakeFiles/libmobility-test.dir/test/rand-cart-around-geo-test.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-test.dir/test/rand-cart-around-geo-test.cc.o.d"
+  "/root/repo/src/mobility/test/steady-state-random-waypoint-mobility-model-test.cc" "src/mobility/CMakeFiles/libmobility-test.dir/test/steady-state-random-waypoint-mobility-model-test.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-test.dir/test/steady-state-random-waypoint-mobility-model-test.cc.o.d"
+  "/root/repo/src/mobility/test/waypoint-mobility-model-test.cc" "src/mobility/CMakeFiles/libmobility-test.dir/test/waypoint-mobility-model-test.cc.o" "gcc" "src/mobility/CMakeFiles/libmobility-test.dir/test/waypoint-mobility-model-test.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dev_build/src/mobility/CMakeFiles/libmobility.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/network/CMakeFiles/libnetwork.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/stats/CMakeFiles/libstats.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/core/CMakeFiles/libcore.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-mobility-test-default.pdb"
+  "../../out/lib/libns3-dev-mobility-test-default.so"
+  "CMakeFiles/libmobility-test.dir/test/box-line-intersection-test.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/box-line-intersection-test.cc.o.d"
+  "CMakeFiles/libmobility-test.dir/test/geo-to-cartesian-test.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/geo-to-cartesian-test.cc.o.d"
+  "CMakeFiles/libmobility-test.dir/test/mobility-test-suite.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/mobility-test-suite.cc.o.d"
+  "CMakeFiles/libmobility-test.dir/test/mobility-trace-test-suite.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/mobility-trace-test-suite.cc.o.d"
+  "CMakeFiles/libmobility-test.dir/test/ns2-mobility-helper-test-suite.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/ns2-mobility-helper-test-suite.cc.o.d"
+  "CMakeFiles/libmobility-test.dir/test/rand-cart-around-geo-test.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/rand-cart-around-geo-test.cc.o.d"
+  "CMakeFiles/libmobility-test.dir/test/steady-state-random-waypoint-mobility-model-test.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/steady-state-random-waypoint-mobility-model-test.cc.o.d"
+  "CMakeFiles/libmobility-test.dir/test/waypoint-mobility-model-test.cc.o"
+  "CMakeFiles/libmobility-test.dir/test/waypoint-mobility-model-test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libmobility-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
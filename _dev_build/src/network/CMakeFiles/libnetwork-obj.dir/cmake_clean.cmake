@@ -0,0 +1,153 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libnetwork-obj.dir/helper/application-container.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/helper/application-container.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/helper/delay-jitter-estimation.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/helper/delay-jitter-estimation.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/helper/net-device-container.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/helper/net-device-container.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/helper/node-container.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/helper/node-container.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/helper/packet-socket-helper.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/helper/packet-socket-helper.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/helper/simple-net-device-helper.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/helper/simple-net-device-helper.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/helper/trace-helper.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/helper/trace-helper.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/address.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/address.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/application.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/application.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/buffer.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/buffer.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/byte-tag-list.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/byte-tag-list.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/channel-list.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/channel-list.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/channel.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/channel.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/chunk.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/chunk.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/header.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/header.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/net-device.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/net-device.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/nix-vector.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/nix-vector.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/node-list.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/node-list.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/node.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/node.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/packet-metadata.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/packet-metadata.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/packet-tag-list.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/packet-tag-list.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/packet.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/packet.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/socket-factory.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/socket-factory.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/socket.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/socket.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/tag-buffer.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/tag-buffer.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/tag.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/tag.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/model/trailer.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/model/trailer.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/address-utils.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/address-utils.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/binary-trace-file.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/binary-trace-file.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/bit-deserializer.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/bit-deserializer.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/bit-serializer.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/bit-serializer.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/crc32.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/crc32.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/data-rate.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/data-rate.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/drop-tail-queue.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/drop-tail-queue.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/dynamic-queue-limits.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/dynamic-queue-limits.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/error-channel.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/error-channel.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/error-model.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/error-model.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/ethernet-header.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/ethernet-header.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/ethernet-trailer.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/ethernet-trailer.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/flow-id-tag.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/flow-id-tag.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/inet-socket-address.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/inet-socket-address.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/inet6-socket-address.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/inet6-socket-address.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/ipv4-address.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/ipv4-address.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/ipv6-address.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/ipv6-address.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/llc-snap-header.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/llc-snap-header.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/mac16-address.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/mac16-address.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/mac48-address.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/mac48-address.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/mac64-address.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/mac64-address.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/mac8-address.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/mac8-address.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/net-device-queue-interface.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/net-device-queue-interface.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/output-stream-wrapper.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/output-stream-wrapper.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/packet-burst.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/packet-burst.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/packet-data-calculators.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/packet-data-calculators.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/packet-probe.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/packet-probe.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/packet-socket-address.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/packet-socket-address.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/packet-socket-client.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/packet-socket-client.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/packet-socket-factory.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/packet-socket-factory.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/packet-socket-server.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/packet-socket-server.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/packet-socket.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/packet-socket.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/packetbb.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/packetbb.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/pcap-file-wrapper.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/pcap-file-wrapper.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/pcap-file.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/pcap-file.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/pcap-write-buffer.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/pcap-write-buffer.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/pcapng-file.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/pcapng-file.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/queue-item.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/queue-item.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/queue-limits.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/queue-limits.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/queue-size.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/queue-size.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/queue.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/queue.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/radiotap-header.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/radiotap-header.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/segmentation-offload-tag.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/segmentation-offload-tag.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/simple-channel.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/simple-channel.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/simple-net-device.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/simple-net-device.cc.o.d"
+  "CMakeFiles/libnetwork-obj.dir/utils/sll-header.cc.o"
+  "CMakeFiles/libnetwork-obj.dir/utils/sll-header.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libnetwork-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libpropagation-obj.dir/model/channel-condition-model.cc.o"
+  "CMakeFiles/libpropagation-obj.dir/model/channel-condition-model.cc.o.d"
+  "CMakeFiles/libpropagation-obj.dir/model/cost231-propagation-loss-model.cc.o"
+  "CMakeFiles/libpropagation-obj.dir/model/cost231-propagation-loss-model.cc.o.d"
+  "CMakeFiles/libpropagation-obj.dir/model/itu-r-1411-los-propagation-loss-model.cc.o"
+  "CMakeFiles/libpropagation-obj.dir/model/itu-r-1411-los-propagation-loss-model.cc.o.d"
+  "CMakeFiles/libpropagation-obj.dir/model/itu-r-1411-nlos-over-rooftop-propagation-loss-model.cc.o"
+  "CMakeFiles/libpropagation-obj.dir/model/itu-r-1411-nlos-over-rooftop-propagation-loss-model.cc.o.d"
+  "CMakeFiles/libpropagation-obj.dir/model/jakes-process.cc.o"
+  "CMakeFiles/libpropagation-obj.dir/model/jakes-process.cc.o.d"
+  "CMakeFiles/libpropagation-obj.dir/model/jakes-propagation-loss-model.cc.o"
+  "CMakeFiles/libpropagation-obj.dir/model/jakes-propagation-loss-model.cc.o.d"
+  "CMakeFiles/libpropagation-obj.dir/model/kun-2600-mhz-propagation-loss-model.cc.o"
+  "CMakeFiles/libpropagation-obj.dir/model/kun-2600-mhz-propagation-loss-model.cc.o.d"
+  "CMakeFiles/libpropagation-obj.dir/model/okumura-hata-propagation-loss-model.cc.o"
+  "CMakeFiles/libpropagation-obj.dir/model/okumura-hata-propagation-loss-model.cc.o.d"
+  "CMakeFiles/libpropagation-obj.dir/model/probabilistic-v2v-channel-condition-model.cc.o"
+  "CMakeFiles/libpropagation-obj.dir/model/probabilistic-v2v-channel-condition-model.cc.o.d"
+  "CMakeFiles/libpropagation-obj.dir/model/propagation-delay-model.cc.o"
+  "CMakeFiles/libpropagation-obj.dir/model/propagation-delay-model.cc.o.d"
+  "CMakeFiles/libpropagation-obj.dir/model/propagation-loss-model.cc.o"
+  "CMakeFiles/libpropagation-obj.dir/model/propagation-loss-model.cc.o.d"
+  "CMakeFiles/libpropagation-obj.dir/model/three-gpp-propagation-loss-model.cc.o"
+  "CMakeFiles/libpropagation-obj.dir/model/three-gpp-propagation-loss-model.cc.o.d"
+  "CMakeFiles/libpropagation-obj.dir/model/three-gpp-v2v-propagation-loss-model.cc.o"
+  "CMakeFiles/libpropagation-obj.dir/model/three-gpp-v2v-propagation-loss-model.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libpropagation-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
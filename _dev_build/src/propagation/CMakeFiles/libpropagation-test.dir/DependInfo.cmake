@@ -0,0 +1,32 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/propagation/test/channel-condition-model-test-suite.cc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/channel-condition-model-test-suite.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/channel-condition-model-test-suite.cc.o.d"
+  "/root/repo/src/propagation/test/itu-r-1411-los-test-suite.cc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/itu-r-1411-los-test-suite.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/itu-r-1411-los-test-suite.cc.o.d"
+  "/root/repo/src/propagation/test/itu-r-1411-nlos-over-rooftop-test-suite.cc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/itu-r-1411-nlos-over-rooftop-test-suite.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/itu-r-1411-nlos-over-rooftop-test-suite.cc.o.d"
+  "/root/repo/src/propagation/test/kun-2600-mhz-test-suite.cc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/kun-2600-mhz-test-suite.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/kun-2600-mhz-test-suite.cc.o.d"
+  "/root/repo/src/propagation/test/okumura-hata-test-suite.cc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/okumura-hata-test-suite.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/okumura-hata-test-suite.cc.o.d"
+  "/root/repo/src/propagation/test/probabilistic-v2v-channel-condition-model-test.cc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/probabilistic-v2v-channel-condition-model-test.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/probabilistic-v2v-channel-condition-model-test.cc.o.d"
+  "/root/repo/src/propagation/test/propagation-loss-model-test-suite.cc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/propagation-loss-model-test-suite.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/propagation-loss-model-test-suite.cc.o.d"
+  "/root/repo/src/propagation/test/spatial-index-test-suite.cc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/spatial-index-test-suite.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/spatial-index-test-suite.cc.o.d"
+  "/root/repo/src/propagation/test/three-gpp-propagation-loss-model-test-suite.cc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/three-gpp-propagation-loss-model-test-suite.cc.o" "gcc" "src/propagation/CMakeFiles/libpropagation-test.dir/test/three-gpp-propagation-loss-model-test-suite.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dev_build/src/propagation/CMakeFiles/libpropagation.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/mobility/CMakeFiles/libmobility.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/network/CMakeFiles/libnetwork.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/stats/CMakeFiles/libstats.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/core/CMakeFiles/libcore.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-propagation-test-default.pdb"
+  "../../out/lib/libns3-dev-propagation-test-default.so"
+  "CMakeFiles/libpropagation-test.dir/test/channel-condition-model-test-suite.cc.o"
+  "CMakeFiles/libpropagation-test.dir/test/channel-condition-model-test-suite.cc.o.d"
+  "CMakeFiles/libpropagation-test.dir/test/itu-r-1411-los-test-suite.cc.o"
+  "CMakeFiles/libpropagation-test.dir/test/itu-r-1411-los-test-suite.cc.o.d"
+  "CMakeFiles/libpropagation-test.dir/test/itu-r-1411-nlos-over-rooftop-test-suite.cc.o"
+  "CMakeFiles/libpropagation-test.dir/test/itu-r-1411-nlos-over-rooftop-test-suite.cc.o.d"
+  "CMakeFiles/libpropagation-test.dir/test/kun-2600-mhz-test-suite.cc.o"
+  "CMakeFiles/libpropagation-test.dir/test/kun-2600-mhz-test-suite.cc.o.d"
+  "CMakeFiles/libpropagation-test.dir/test/okumura-hata-test-suite.cc.o"
+  "CMakeFiles/libpropagation-test.dir/test/okumura-hata-test-suite.cc.o.d"
+  "CMakeFiles/libpropagation-test.dir/test/probabilistic-v2v-channel-condition-model-test.cc.o"
+  "CMakeFiles/libpropagation-test.dir/test/probabilistic-v2v-channel-condition-model-test.cc.o.d"
+  "CMakeFiles/libpropagation-test.dir/test/propagation-loss-model-test-suite.cc.o"
+  "CMakeFiles/libpropagation-test.dir/test/propagation-loss-model-test-suite.cc.o.d"
+  "CMakeFiles/libpropagation-test.dir/test/spatial-index-test-suite.cc.o"
+  "CMakeFiles/libpropagation-test.dir/test/spatial-index-test-suite.cc.o.d"
+  "CMakeFiles/libpropagation-test.dir/test/three-gpp-propagation-loss-model-test-suite.cc.o"
+  "CMakeFiles/libpropagation-test.dir/test/three-gpp-propagation-loss-model-test-suite.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libpropagation-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
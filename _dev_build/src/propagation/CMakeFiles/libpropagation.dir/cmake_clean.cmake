@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-propagation-default.pdb"
+  "../../out/lib/libns3-dev-propagation-default.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libpropagation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,53 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/spectrum/helper/adhoc-aloha-noack-ideal-phy-helper.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/helper/adhoc-aloha-noack-ideal-phy-helper.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/helper/adhoc-aloha-noack-ideal-phy-helper.cc.o.d"
+  "/root/repo/src/spectrum/helper/spectrum-analyzer-helper.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/helper/spectrum-analyzer-helper.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/helper/spectrum-analyzer-helper.cc.o.d"
+  "/root/repo/src/spectrum/helper/spectrum-helper.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/helper/spectrum-helper.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/helper/spectrum-helper.cc.o.d"
+  "/root/repo/src/spectrum/helper/tv-spectrum-transmitter-helper.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/helper/tv-spectrum-transmitter-helper.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/helper/tv-spectrum-transmitter-helper.cc.o.d"
+  "/root/repo/src/spectrum/helper/waveform-generator-helper.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/helper/waveform-generator-helper.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/helper/waveform-generator-helper.cc.o.d"
+  "/root/repo/src/spectrum/model/aloha-noack-mac-header.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/aloha-noack-mac-header.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/aloha-noack-mac-header.cc.o.d"
+  "/root/repo/src/spectrum/model/aloha-noack-net-device.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/aloha-noack-net-device.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/aloha-noack-net-device.cc.o.d"
+  "/root/repo/src/spectrum/model/constant-spectrum-propagation-loss.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/constant-spectrum-propagation-loss.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/constant-spectrum-propagation-loss.cc.o.d"
+  "/root/repo/src/spectrum/model/friis-spectrum-propagation-loss.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/friis-spectrum-propagation-loss.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/friis-spectrum-propagation-loss.cc.o.d"
+  "/root/repo/src/spectrum/model/half-duplex-ideal-phy-signal-parameters.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/half-duplex-ideal-phy-signal-parameters.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/half-duplex-ideal-phy-signal-parameters.cc.o.d"
+  "/root/repo/src/spectrum/model/half-duplex-ideal-phy.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/half-duplex-ideal-phy.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/half-duplex-ideal-phy.cc.o.d"
+  "/root/repo/src/spectrum/model/matrix-based-channel-model.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/matrix-based-channel-model.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/matrix-based-channel-model.cc.o.d"
+  "/root/repo/src/spectrum/model/microwave-oven-spectrum-value-helper.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/microwave-oven-spectrum-value-helper.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/microwave-oven-spectrum-value-helper.cc.o.d"
+  "/root/repo/src/spectrum/model/multi-model-spectrum-channel.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/multi-model-spectrum-channel.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/multi-model-spectrum-channel.cc.o.d"
+  "/root/repo/src/spectrum/model/non-communicating-net-device.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/non-communicating-net-device.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/non-communicating-net-device.cc.o.d"
+  "/root/repo/src/spectrum/model/phased-array-spectrum-propagation-loss-model.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/phased-array-spectrum-propagation-loss-model.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/phased-array-spectrum-propagation-loss-model.cc.o.d"
+  "/root/repo/src/spectrum/model/single-model-spectrum-channel.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/single-model-spectrum-channel.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/single-model-spectrum-channel.cc.o.d"
+  "/root/repo/src/spectrum/model/spectrum-analyzer.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-analyzer.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-analyzer.cc.o.d"
+  "/root/repo/src/spectrum/model/spectrum-channel.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-channel.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-channel.cc.o.d"
+  "/root/repo/src/spectrum/model/spectrum-converter.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-converter.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-converter.cc.o.d"
+  "/root/repo/src/spectrum/model/spectrum-error-model.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-error-model.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-error-model.cc.o.d"
+  "/root/repo/src/spectrum/model/spectrum-interference.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-interference.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-interference.cc.o.d"
+  "/root/repo/src/spectrum/model/spectrum-model-300kHz-300GHz-log.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-model-300kHz-300GHz-log.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-model-300kHz-300GHz-log.cc.o.d"
+  "/root/repo/src/spectrum/model/spectrum-model-ism2400MHz-res1MHz.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-model-ism2400MHz-res1MHz.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-model-ism2400MHz-res1MHz.cc.o.d"
+  "/root/repo/src/spectrum/model/spectrum-model.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-model.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-model.cc.o.d"
+  "/root/repo/src/spectrum/model/spectrum-phy.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-phy.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-phy.cc.o.d"
+  "/root/repo/src/spectrum/model/spectrum-propagation-loss-model.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-propagation-loss-model.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-propagation-loss-model.cc.o.d"
+  "/root/repo/src/spectrum/model/spectrum-signal-parameters.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-signal-parameters.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-signal-parameters.cc.o.d"
+  "/root/repo/src/spectrum/model/spectrum-value.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-value.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/spectrum-value.cc.o.d"
+  "/root/repo/src/spectrum/model/three-gpp-channel-model.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/three-gpp-channel-model.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/three-gpp-channel-model.cc.o.d"
+  "/root/repo/src/spectrum/model/three-gpp-spectrum-propagation-loss-model.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/three-gpp-spectrum-propagation-loss-model.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/three-gpp-spectrum-propagation-loss-model.cc.o.d"
+  "/root/repo/src/spectrum/model/trace-fading-loss-model.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/trace-fading-loss-model.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/trace-fading-loss-model.cc.o.d"
+  "/root/repo/src/spectrum/model/tv-spectrum-transmitter.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/tv-spectrum-transmitter.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/tv-spectrum-transmitter.cc.o.d"
+  "/root/repo/src/spectrum/model/waveform-generator.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/waveform-generator.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/waveform-generator.cc.o.d"
+  "/root/repo/src/spectrum/model/wifi-spectrum-value-helper.cc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/wifi-spectrum-value-helper.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-obj.dir/model/wifi-spectrum-value-helper.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/spectrum/test/spectrum-channel-culling-test.cc" "src/spectrum/CMakeFiles/libspectrum-test.dir/test/spectrum-channel-culling-test.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-test.dir/test/spectrum-channel-culling-test.cc.o.d"
+  "/root/repo/src/spectrum/test/spectrum-ideal-phy-test.cc" "src/spectrum/CMakeFiles/libspectrum-test.dir/test/spectrum-ideal-phy-test.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-test.dir/test/spectrum-ideal-phy-test.cc.o.d"
+  "/root/repo/src/spectrum/test/spectrum-interference-test.cc" "src/spectrum/CMakeFiles/libspectrum-test.dir/test/spectrum-interference-test.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-test.dir/test/spectrum-interference-test.cc.o.d"
+  "/root/repo/src/spectrum/test/spectrum-value-test.cc" "src/spectrum/CMakeFiles/libspectrum-test.dir/test/spectrum-value-test.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-test.dir/test/spectrum-value-test.cc.o.d"
+  "/root/repo/src/spectrum/test/spectrum-waveform-generator-test.cc" "src/spectrum/CMakeFiles/libspectrum-test.dir/test/spectrum-waveform-generator-test.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-test.dir/test/spectrum-waveform-generator-test.cc.o.d"
+  "/root/repo/src/spectrum/test/three-gpp-channel-test-suite.cc" "src/spectrum/CMakeFiles/libspectrum-test.dir/test/three-gpp-channel-test-suite.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-test.dir/test/three-gpp-channel-test-suite.cc.o.d"
+  "/root/repo/src/spectrum/test/tv-helper-distribution-test.cc" "src/spectrum/CMakeFiles/libspectrum-test.dir/test/tv-helper-distribution-test.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-test.dir/test/tv-helper-distribution-test.cc.o.d"
+  "/root/repo/src/spectrum/test/tv-spectrum-transmitter-test.cc" "src/spectrum/CMakeFiles/libspectrum-test.dir/test/tv-spectrum-transmitter-test.cc.o" "gcc" "src/spectrum/CMakeFiles/libspectrum-test.dir/test/tv-spectrum-transmitter-test.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dev_build/src/spectrum/CMakeFiles/libspectrum.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/propagation/CMakeFiles/libpropagation.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/antenna/CMakeFiles/libantenna.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/mobility/CMakeFiles/libmobility.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/network/CMakeFiles/libnetwork.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/stats/CMakeFiles/libstats.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/core/CMakeFiles/libcore.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libtest.dir/__/__/build-support/empty.cc.o"
+  "CMakeFiles/libtest.dir/__/__/build-support/empty.cc.o.d"
+  "CMakeFiles/libtest.dir/ns3tc/fq-cobalt-queue-disc-test-suite.cc.o"
+  "CMakeFiles/libtest.dir/ns3tc/fq-cobalt-queue-disc-test-suite.cc.o.d"
+  "CMakeFiles/libtest.dir/ns3tc/fq-codel-queue-disc-test-suite.cc.o"
+  "CMakeFiles/libtest.dir/ns3tc/fq-codel-queue-disc-test-suite.cc.o.d"
+  "CMakeFiles/libtest.dir/ns3tc/fq-pie-queue-disc-test-suite.cc.o"
+  "CMakeFiles/libtest.dir/ns3tc/fq-pie-queue-disc-test-suite.cc.o.d"
+  "CMakeFiles/libtest.dir/ns3tc/pfifo-fast-queue-disc-test-suite.cc.o"
+  "CMakeFiles/libtest.dir/ns3tc/pfifo-fast-queue-disc-test-suite.cc.o.d"
+  "CMakeFiles/libtest.dir/ns3tcp/ns3tcp-socket-writer.cc.o"
+  "CMakeFiles/libtest.dir/ns3tcp/ns3tcp-socket-writer.cc.o.d"
+  "CMakeFiles/libtest.dir/ns3wifi/wifi-ac-mapping-test-suite.cc.o"
+  "CMakeFiles/libtest.dir/ns3wifi/wifi-ac-mapping-test-suite.cc.o.d"
+  "CMakeFiles/libtest.dir/ns3wifi/wifi-issue-211-test-suite.cc.o"
+  "CMakeFiles/libtest.dir/ns3wifi/wifi-issue-211-test-suite.cc.o.d"
+  "CMakeFiles/libtest.dir/ns3wifi/wifi-msdu-aggregator-test-suite.cc.o"
+  "CMakeFiles/libtest.dir/ns3wifi/wifi-msdu-aggregator-test-suite.cc.o.d"
+  "CMakeFiles/libtest.dir/traced/traced-value-callback-typedef-test-suite.cc.o"
+  "CMakeFiles/libtest.dir/traced/traced-value-callback-typedef-test-suite.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/traffic-control/helper/queue-disc-container.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/helper/queue-disc-container.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/helper/queue-disc-container.cc.o.d"
+  "/root/repo/src/traffic-control/helper/traffic-control-helper.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/helper/traffic-control-helper.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/helper/traffic-control-helper.cc.o.d"
+  "/root/repo/src/traffic-control/model/cobalt-queue-disc.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/cobalt-queue-disc.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/cobalt-queue-disc.cc.o.d"
+  "/root/repo/src/traffic-control/model/codel-queue-disc.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/codel-queue-disc.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/codel-queue-disc.cc.o.d"
+  "/root/repo/src/traffic-control/model/fifo-queue-disc.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/fifo-queue-disc.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/fifo-queue-disc.cc.o.d"
+  "/root/repo/src/traffic-control/model/fq-cobalt-queue-disc.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/fq-cobalt-queue-disc.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/fq-cobalt-queue-disc.cc.o.d"
+  "/root/repo/src/traffic-control/model/fq-codel-queue-disc.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/fq-codel-queue-disc.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/fq-codel-queue-disc.cc.o.d"
+  "/root/repo/src/traffic-control/model/fq-pie-queue-disc.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/fq-pie-queue-disc.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/fq-pie-queue-disc.cc.o.d"
+  "/root/repo/src/traffic-control/model/mq-queue-disc.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/mq-queue-disc.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/mq-queue-disc.cc.o.d"
+  "/root/repo/src/traffic-control/model/packet-filter.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/packet-filter.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/packet-filter.cc.o.d"
+  "/root/repo/src/traffic-control/model/pfifo-fast-queue-disc.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/pfifo-fast-queue-disc.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/pfifo-fast-queue-disc.cc.o.d"
+  "/root/repo/src/traffic-control/model/pie-queue-disc.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/pie-queue-disc.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/pie-queue-disc.cc.o.d"
+  "/root/repo/src/traffic-control/model/prio-queue-disc.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/prio-queue-disc.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/prio-queue-disc.cc.o.d"
+  "/root/repo/src/traffic-control/model/queue-disc.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/queue-disc.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/queue-disc.cc.o.d"
+  "/root/repo/src/traffic-control/model/red-queue-disc.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/red-queue-disc.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/red-queue-disc.cc.o.d"
+  "/root/repo/src/traffic-control/model/tbf-queue-disc.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/tbf-queue-disc.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/tbf-queue-disc.cc.o.d"
+  "/root/repo/src/traffic-control/model/traffic-control-layer.cc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/traffic-control-layer.cc.o" "gcc" "src/traffic-control/CMakeFiles/libtraffic-control-obj.dir/model/traffic-control-layer.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
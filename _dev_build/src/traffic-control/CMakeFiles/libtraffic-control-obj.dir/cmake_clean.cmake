@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libtraffic-control-obj.dir/helper/queue-disc-container.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/helper/queue-disc-container.cc.o.d"
+  "CMakeFiles/libtraffic-control-obj.dir/helper/traffic-control-helper.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/helper/traffic-control-helper.cc.o.d"
+  "CMakeFiles/libtraffic-control-obj.dir/model/cobalt-queue-disc.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/model/cobalt-queue-disc.cc.o.d"
+  "CMakeFiles/libtraffic-control-obj.dir/model/codel-queue-disc.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/model/codel-queue-disc.cc.o.d"
+  "CMakeFiles/libtraffic-control-obj.dir/model/fifo-queue-disc.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/model/fifo-queue-disc.cc.o.d"
+  "CMakeFiles/libtraffic-control-obj.dir/model/fq-cobalt-queue-disc.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/model/fq-cobalt-queue-disc.cc.o.d"
+  "CMakeFiles/libtraffic-control-obj.dir/model/fq-codel-queue-disc.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/model/fq-codel-queue-disc.cc.o.d"
+  "CMakeFiles/libtraffic-control-obj.dir/model/fq-pie-queue-disc.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/model/fq-pie-queue-disc.cc.o.d"
+  "CMakeFiles/libtraffic-control-obj.dir/model/mq-queue-disc.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/model/mq-queue-disc.cc.o.d"
+  "CMakeFiles/libtraffic-control-obj.dir/model/packet-filter.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/model/packet-filter.cc.o.d"
+  "CMakeFiles/libtraffic-control-obj.dir/model/pfifo-fast-queue-disc.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/model/pfifo-fast-queue-disc.cc.o.d"
+  "CMakeFiles/libtraffic-control-obj.dir/model/pie-queue-disc.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/model/pie-queue-disc.cc.o.d"
+  "CMakeFiles/libtraffic-control-obj.dir/model/prio-queue-disc.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/model/prio-queue-disc.cc.o.d"
+  "CMakeFiles/libtraffic-control-obj.dir/model/queue-disc.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/model/queue-disc.cc.o.d"
+  "CMakeFiles/libtraffic-control-obj.dir/model/red-queue-disc.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/model/red-queue-disc.cc.o.d"
+  "CMakeFiles/libtraffic-control-obj.dir/model/tbf-queue-disc.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/model/tbf-queue-disc.cc.o.d"
+  "CMakeFiles/libtraffic-control-obj.dir/model/traffic-control-layer.cc.o"
+  "CMakeFiles/libtraffic-control-obj.dir/model/traffic-control-layer.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libtraffic-control-obj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
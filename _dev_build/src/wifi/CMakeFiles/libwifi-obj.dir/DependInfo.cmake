@@ -0,0 +1,149 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/wifi/helper/athstats-helper.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/helper/athstats-helper.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/helper/athstats-helper.cc.o.d"
+  "/root/repo/src/wifi/helper/spectrum-wifi-helper.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/helper/spectrum-wifi-helper.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/helper/spectrum-wifi-helper.cc.o.d"
+  "/root/repo/src/wifi/helper/wifi-helper.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/helper/wifi-helper.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/helper/wifi-helper.cc.o.d"
+  "/root/repo/src/wifi/helper/wifi-mac-helper.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/helper/wifi-mac-helper.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/helper/wifi-mac-helper.cc.o.d"
+  "/root/repo/src/wifi/helper/wifi-radio-energy-model-helper.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/helper/wifi-radio-energy-model-helper.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/helper/wifi-radio-energy-model-helper.cc.o.d"
+  "/root/repo/src/wifi/helper/yans-wifi-helper.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/helper/yans-wifi-helper.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/helper/yans-wifi-helper.cc.o.d"
+  "/root/repo/src/wifi/model/adhoc-wifi-mac.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/adhoc-wifi-mac.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/adhoc-wifi-mac.cc.o.d"
+  "/root/repo/src/wifi/model/ampdu-subframe-header.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ampdu-subframe-header.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ampdu-subframe-header.cc.o.d"
+  "/root/repo/src/wifi/model/ampdu-tag.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ampdu-tag.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ampdu-tag.cc.o.d"
+  "/root/repo/src/wifi/model/amsdu-subframe-header.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/amsdu-subframe-header.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/amsdu-subframe-header.cc.o.d"
+  "/root/repo/src/wifi/model/ap-wifi-mac.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ap-wifi-mac.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ap-wifi-mac.cc.o.d"
+  "/root/repo/src/wifi/model/block-ack-agreement.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/block-ack-agreement.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/block-ack-agreement.cc.o.d"
+  "/root/repo/src/wifi/model/block-ack-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/block-ack-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/block-ack-manager.cc.o.d"
+  "/root/repo/src/wifi/model/block-ack-type.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/block-ack-type.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/block-ack-type.cc.o.d"
+  "/root/repo/src/wifi/model/block-ack-window.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/block-ack-window.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/block-ack-window.cc.o.d"
+  "/root/repo/src/wifi/model/capability-information.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/capability-information.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/capability-information.cc.o.d"
+  "/root/repo/src/wifi/model/channel-access-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/channel-access-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/channel-access-manager.cc.o.d"
+  "/root/repo/src/wifi/model/ctrl-headers.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ctrl-headers.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ctrl-headers.cc.o.d"
+  "/root/repo/src/wifi/model/edca-parameter-set.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/edca-parameter-set.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/edca-parameter-set.cc.o.d"
+  "/root/repo/src/wifi/model/error-rate-model.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/error-rate-model.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/error-rate-model.cc.o.d"
+  "/root/repo/src/wifi/model/extended-capabilities.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/extended-capabilities.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/extended-capabilities.cc.o.d"
+  "/root/repo/src/wifi/model/frame-capture-model.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/frame-capture-model.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/frame-capture-model.cc.o.d"
+  "/root/repo/src/wifi/model/frame-exchange-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/frame-exchange-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/frame-exchange-manager.cc.o.d"
+  "/root/repo/src/wifi/model/he/constant-obss-pd-algorithm.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/constant-obss-pd-algorithm.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/constant-obss-pd-algorithm.cc.o.d"
+  "/root/repo/src/wifi/model/he/he-capabilities.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/he-capabilities.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/he-capabilities.cc.o.d"
+  "/root/repo/src/wifi/model/he/he-configuration.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/he-configuration.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/he-configuration.cc.o.d"
+  "/root/repo/src/wifi/model/he/he-frame-exchange-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/he-frame-exchange-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/he-frame-exchange-manager.cc.o.d"
+  "/root/repo/src/wifi/model/he/he-operation.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/he-operation.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/he-operation.cc.o.d"
+  "/root/repo/src/wifi/model/he/he-phy.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/he-phy.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/he-phy.cc.o.d"
+  "/root/repo/src/wifi/model/he/he-ppdu.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/he-ppdu.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/he-ppdu.cc.o.d"
+  "/root/repo/src/wifi/model/he/he-ru.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/he-ru.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/he-ru.cc.o.d"
+  "/root/repo/src/wifi/model/he/mu-edca-parameter-set.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/mu-edca-parameter-set.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/mu-edca-parameter-set.cc.o.d"
+  "/root/repo/src/wifi/model/he/mu-snr-tag.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/mu-snr-tag.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/mu-snr-tag.cc.o.d"
+  "/root/repo/src/wifi/model/he/multi-user-scheduler.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/multi-user-scheduler.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/multi-user-scheduler.cc.o.d"
+  "/root/repo/src/wifi/model/he/obss-pd-algorithm.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/obss-pd-algorithm.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/obss-pd-algorithm.cc.o.d"
+  "/root/repo/src/wifi/model/he/rr-multi-user-scheduler.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/rr-multi-user-scheduler.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/he/rr-multi-user-scheduler.cc.o.d"
+  "/root/repo/src/wifi/model/ht/ht-capabilities.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ht/ht-capabilities.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ht/ht-capabilities.cc.o.d"
+  "/root/repo/src/wifi/model/ht/ht-configuration.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ht/ht-configuration.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ht/ht-configuration.cc.o.d"
+  "/root/repo/src/wifi/model/ht/ht-frame-exchange-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ht/ht-frame-exchange-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ht/ht-frame-exchange-manager.cc.o.d"
+  "/root/repo/src/wifi/model/ht/ht-operation.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ht/ht-operation.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ht/ht-operation.cc.o.d"
+  "/root/repo/src/wifi/model/ht/ht-phy.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ht/ht-phy.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ht/ht-phy.cc.o.d"
+  "/root/repo/src/wifi/model/ht/ht-ppdu.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ht/ht-ppdu.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ht/ht-ppdu.cc.o.d"
+  "/root/repo/src/wifi/model/interference-helper.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/interference-helper.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/interference-helper.cc.o.d"
+  "/root/repo/src/wifi/model/mac-rx-middle.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/mac-rx-middle.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/mac-rx-middle.cc.o.d"
+  "/root/repo/src/wifi/model/mac-tx-middle.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/mac-tx-middle.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/mac-tx-middle.cc.o.d"
+  "/root/repo/src/wifi/model/mgt-headers.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/mgt-headers.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/mgt-headers.cc.o.d"
+  "/root/repo/src/wifi/model/mpdu-aggregator.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/mpdu-aggregator.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/mpdu-aggregator.cc.o.d"
+  "/root/repo/src/wifi/model/msdu-aggregator.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/msdu-aggregator.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/msdu-aggregator.cc.o.d"
+  "/root/repo/src/wifi/model/nist-error-rate-model.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/nist-error-rate-model.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/nist-error-rate-model.cc.o.d"
+  "/root/repo/src/wifi/model/non-ht/dsss-error-rate-model.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/dsss-error-rate-model.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/dsss-error-rate-model.cc.o.d"
+  "/root/repo/src/wifi/model/non-ht/dsss-parameter-set.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/dsss-parameter-set.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/dsss-parameter-set.cc.o.d"
+  "/root/repo/src/wifi/model/non-ht/dsss-phy.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/dsss-phy.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/dsss-phy.cc.o.d"
+  "/root/repo/src/wifi/model/non-ht/dsss-ppdu.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/dsss-ppdu.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/dsss-ppdu.cc.o.d"
+  "/root/repo/src/wifi/model/non-ht/erp-information.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/erp-information.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/erp-information.cc.o.d"
+  "/root/repo/src/wifi/model/non-ht/erp-ofdm-phy.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/erp-ofdm-phy.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/erp-ofdm-phy.cc.o.d"
+  "/root/repo/src/wifi/model/non-ht/erp-ofdm-ppdu.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/erp-ofdm-ppdu.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/erp-ofdm-ppdu.cc.o.d"
+  "/root/repo/src/wifi/model/non-ht/ofdm-phy.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/ofdm-phy.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/ofdm-phy.cc.o.d"
+  "/root/repo/src/wifi/model/non-ht/ofdm-ppdu.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/ofdm-ppdu.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/non-ht/ofdm-ppdu.cc.o.d"
+  "/root/repo/src/wifi/model/originator-block-ack-agreement.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/originator-block-ack-agreement.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/originator-block-ack-agreement.cc.o.d"
+  "/root/repo/src/wifi/model/phy-entity.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/phy-entity.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/phy-entity.cc.o.d"
+  "/root/repo/src/wifi/model/preamble-detection-model.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/preamble-detection-model.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/preamble-detection-model.cc.o.d"
+  "/root/repo/src/wifi/model/qos-blocked-destinations.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/qos-blocked-destinations.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/qos-blocked-destinations.cc.o.d"
+  "/root/repo/src/wifi/model/qos-frame-exchange-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/qos-frame-exchange-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/qos-frame-exchange-manager.cc.o.d"
+  "/root/repo/src/wifi/model/qos-txop.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/qos-txop.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/qos-txop.cc.o.d"
+  "/root/repo/src/wifi/model/qos-utils.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/qos-utils.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/qos-utils.cc.o.d"
+  "/root/repo/src/wifi/model/rate-control/aarf-wifi-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/aarf-wifi-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/aarf-wifi-manager.cc.o.d"
+  "/root/repo/src/wifi/model/rate-control/aarfcd-wifi-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/aarfcd-wifi-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/aarfcd-wifi-manager.cc.o.d"
+  "/root/repo/src/wifi/model/rate-control/amrr-wifi-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/amrr-wifi-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/amrr-wifi-manager.cc.o.d"
+  "/root/repo/src/wifi/model/rate-control/aparf-wifi-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/aparf-wifi-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/aparf-wifi-manager.cc.o.d"
+  "/root/repo/src/wifi/model/rate-control/arf-wifi-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/arf-wifi-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/arf-wifi-manager.cc.o.d"
+  "/root/repo/src/wifi/model/rate-control/cara-wifi-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/cara-wifi-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/cara-wifi-manager.cc.o.d"
+  "/root/repo/src/wifi/model/rate-control/constant-rate-wifi-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/constant-rate-wifi-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/constant-rate-wifi-manager.cc.o.d"
+  "/root/repo/src/wifi/model/rate-control/ideal-wifi-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/ideal-wifi-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/ideal-wifi-manager.cc.o.d"
+  "/root/repo/src/wifi/model/rate-control/minstrel-ht-wifi-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/minstrel-ht-wifi-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/minstrel-ht-wifi-manager.cc.o.d"
+  "/root/repo/src/wifi/model/rate-control/minstrel-wifi-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/minstrel-wifi-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/minstrel-wifi-manager.cc.o.d"
+  "/root/repo/src/wifi/model/rate-control/onoe-wifi-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/onoe-wifi-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/onoe-wifi-manager.cc.o.d"
+  "/root/repo/src/wifi/model/rate-control/parf-wifi-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/parf-wifi-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/parf-wifi-manager.cc.o.d"
+  "/root/repo/src/wifi/model/rate-control/rraa-wifi-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/rraa-wifi-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/rraa-wifi-manager.cc.o.d"
+  "/root/repo/src/wifi/model/rate-control/rrpaa-wifi-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/rrpaa-wifi-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/rrpaa-wifi-manager.cc.o.d"
+  "/root/repo/src/wifi/model/rate-control/thompson-sampling-wifi-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/thompson-sampling-wifi-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/rate-control/thompson-sampling-wifi-manager.cc.o.d"
+  "/root/repo/src/wifi/model/recipient-block-ack-agreement.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/recipient-block-ack-agreement.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/recipient-block-ack-agreement.cc.o.d"
+  "/root/repo/src/wifi/model/simple-frame-capture-model.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/simple-frame-capture-model.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/simple-frame-capture-model.cc.o.d"
+  "/root/repo/src/wifi/model/snr-tag.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/snr-tag.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/snr-tag.cc.o.d"
+  "/root/repo/src/wifi/model/spectrum-wifi-phy.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/spectrum-wifi-phy.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/spectrum-wifi-phy.cc.o.d"
+  "/root/repo/src/wifi/model/ssid.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ssid.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/ssid.cc.o.d"
+  "/root/repo/src/wifi/model/sta-wifi-mac.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/sta-wifi-mac.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/sta-wifi-mac.cc.o.d"
+  "/root/repo/src/wifi/model/status-code.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/status-code.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/status-code.cc.o.d"
+  "/root/repo/src/wifi/model/supported-rates.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/supported-rates.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/supported-rates.cc.o.d"
+  "/root/repo/src/wifi/model/table-based-error-rate-model.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/table-based-error-rate-model.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/table-based-error-rate-model.cc.o.d"
+  "/root/repo/src/wifi/model/threshold-preamble-detection-model.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/threshold-preamble-detection-model.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/threshold-preamble-detection-model.cc.o.d"
+  "/root/repo/src/wifi/model/txop.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/txop.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/txop.cc.o.d"
+  "/root/repo/src/wifi/model/vht/vht-capabilities.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/vht/vht-capabilities.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/vht/vht-capabilities.cc.o.d"
+  "/root/repo/src/wifi/model/vht/vht-configuration.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/vht/vht-configuration.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/vht/vht-configuration.cc.o.d"
+  "/root/repo/src/wifi/model/vht/vht-frame-exchange-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/vht/vht-frame-exchange-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/vht/vht-frame-exchange-manager.cc.o.d"
+  "/root/repo/src/wifi/model/vht/vht-operation.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/vht/vht-operation.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/vht/vht-operation.cc.o.d"
+  "/root/repo/src/wifi/model/vht/vht-phy.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/vht/vht-phy.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/vht/vht-phy.cc.o.d"
+  "/root/repo/src/wifi/model/vht/vht-ppdu.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/vht/vht-ppdu.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/vht/vht-ppdu.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-ack-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-ack-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-ack-manager.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-acknowledgment.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-acknowledgment.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-acknowledgment.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-default-ack-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-default-ack-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-default-ack-manager.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-default-protection-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-default-protection-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-default-protection-manager.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-information-element-vector.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-information-element-vector.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-information-element-vector.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-information-element.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-information-element.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-information-element.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-mac-header.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-mac-header.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-mac-header.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-mac-queue-item.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-mac-queue-item.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-mac-queue-item.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-mac-queue.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-mac-queue.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-mac-queue.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-mac-trailer.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-mac-trailer.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-mac-trailer.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-mac.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-mac.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-mac.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-mode.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-mode.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-mode.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-net-device.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-net-device.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-net-device.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-phy-common.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-phy-common.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-phy-common.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-phy-operating-channel.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-phy-operating-channel.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-phy-operating-channel.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-phy-state-helper.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-phy-state-helper.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-phy-state-helper.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-phy.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-phy.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-phy.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-ppdu.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-ppdu.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-ppdu.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-protection-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-protection-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-protection-manager.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-protection.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-protection.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-protection.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-psdu.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-psdu.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-psdu.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-radio-energy-model.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-radio-energy-model.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-radio-energy-model.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-remote-station-info.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-remote-station-info.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-remote-station-info.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-remote-station-manager.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-remote-station-manager.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-remote-station-manager.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-spectrum-phy-interface.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-spectrum-phy-interface.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-spectrum-phy-interface.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-spectrum-signal-parameters.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-spectrum-signal-parameters.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-spectrum-signal-parameters.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-tx-current-model.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-tx-current-model.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-tx-current-model.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-tx-parameters.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-tx-parameters.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-tx-parameters.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-tx-timer.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-tx-timer.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-tx-timer.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-tx-vector.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-tx-vector.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-tx-vector.cc.o.d"
+  "/root/repo/src/wifi/model/wifi-utils.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-utils.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/wifi-utils.cc.o.d"
+  "/root/repo/src/wifi/model/yans-error-rate-model.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/yans-error-rate-model.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/yans-error-rate-model.cc.o.d"
+  "/root/repo/src/wifi/model/yans-wifi-channel.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/yans-wifi-channel.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/yans-wifi-channel.cc.o.d"
+  "/root/repo/src/wifi/model/yans-wifi-phy.cc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/yans-wifi-phy.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-obj.dir/model/yans-wifi-phy.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
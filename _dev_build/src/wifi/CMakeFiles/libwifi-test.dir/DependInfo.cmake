@@ -0,0 +1,45 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/wifi/test/block-ack-test-suite.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/block-ack-test-suite.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/block-ack-test-suite.cc.o.d"
+  "/root/repo/src/wifi/test/channel-access-manager-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/channel-access-manager-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/channel-access-manager-test.cc.o.d"
+  "/root/repo/src/wifi/test/inter-bss-test-suite.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/inter-bss-test-suite.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/inter-bss-test-suite.cc.o.d"
+  "/root/repo/src/wifi/test/power-rate-adaptation-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/power-rate-adaptation-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/power-rate-adaptation-test.cc.o.d"
+  "/root/repo/src/wifi/test/spectrum-wifi-phy-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/spectrum-wifi-phy-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/spectrum-wifi-phy-test.cc.o.d"
+  "/root/repo/src/wifi/test/tx-duration-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/tx-duration-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/tx-duration-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-aggregation-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-aggregation-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-aggregation-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-channel-switching-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-channel-switching-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-channel-switching-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-error-rate-models-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-error-rate-models-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-error-rate-models-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-mac-ofdma-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-mac-ofdma-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-mac-ofdma-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-mac-queue-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-mac-queue-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-mac-queue-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-phy-ofdma-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-phy-ofdma-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-phy-ofdma-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-phy-reception-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-phy-reception-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-phy-reception-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-phy-thresholds-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-phy-thresholds-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-phy-thresholds-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-primary-channels-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-primary-channels-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-primary-channels-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-transmit-mask-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-transmit-mask-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-transmit-mask-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-txop-test.cc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-txop-test.cc.o" "gcc" "src/wifi/CMakeFiles/libwifi-test.dir/test/wifi-txop-test.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dev_build/src/wifi/CMakeFiles/libwifi.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/energy/CMakeFiles/libenergy.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/spectrum/CMakeFiles/libspectrum.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/antenna/CMakeFiles/libantenna.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/propagation/CMakeFiles/libpropagation.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/mobility/CMakeFiles/libmobility.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/network/CMakeFiles/libnetwork.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/stats/CMakeFiles/libstats.dir/DependInfo.cmake"
+  "/root/repo/_dev_build/src/core/CMakeFiles/libcore.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,210 @@
+# Install script for directory: /root/repo/src/wifi
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "default")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-wifi-default.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-wifi-default.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-wifi-default.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_dev_build/out/lib/libns3-dev-wifi-default.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-wifi-default.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-wifi-default.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-wifi-default.so"
+         OLD_RPATH "/root/repo/_dev_build/out/lib:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-wifi-default.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/ns3" TYPE FILE FILES
+    "/root/repo/src/wifi/helper/athstats-helper.h"
+    "/root/repo/src/wifi/helper/spectrum-wifi-helper.h"
+    "/root/repo/src/wifi/helper/wifi-helper.h"
+    "/root/repo/src/wifi/helper/wifi-mac-helper.h"
+    "/root/repo/src/wifi/helper/wifi-radio-energy-model-helper.h"
+    "/root/repo/src/wifi/helper/yans-wifi-helper.h"
+    "/root/repo/src/wifi/model/adhoc-wifi-mac.h"
+    "/root/repo/src/wifi/model/ampdu-subframe-header.h"
+    "/root/repo/src/wifi/model/ampdu-tag.h"
+    "/root/repo/src/wifi/model/amsdu-subframe-header.h"
+    "/root/repo/src/wifi/model/ap-wifi-mac.h"
+    "/root/repo/src/wifi/model/block-ack-agreement.h"
+    "/root/repo/src/wifi/model/block-ack-manager.h"
+    "/root/repo/src/wifi/model/block-ack-type.h"
+    "/root/repo/src/wifi/model/block-ack-window.h"
+    "/root/repo/src/wifi/model/capability-information.h"
+    "/root/repo/src/wifi/model/channel-access-manager.h"
+    "/root/repo/src/wifi/model/ctrl-headers.h"
+    "/root/repo/src/wifi/model/edca-parameter-set.h"
+    "/root/repo/src/wifi/model/error-rate-model.h"
+    "/root/repo/src/wifi/model/extended-capabilities.h"
+    "/root/repo/src/wifi/model/frame-capture-model.h"
+    "/root/repo/src/wifi/model/frame-exchange-manager.h"
+    "/root/repo/src/wifi/model/he/constant-obss-pd-algorithm.h"
+    "/root/repo/src/wifi/model/he/he-capabilities.h"
+    "/root/repo/src/wifi/model/he/he-configuration.h"
+    "/root/repo/src/wifi/model/he/he-frame-exchange-manager.h"
+    "/root/repo/src/wifi/model/he/he-operation.h"
+    "/root/repo/src/wifi/model/he/he-phy.h"
+    "/root/repo/src/wifi/model/he/he-ppdu.h"
+    "/root/repo/src/wifi/model/he/he-ru.h"
+    "/root/repo/src/wifi/model/he/mu-edca-parameter-set.h"
+    "/root/repo/src/wifi/model/he/mu-snr-tag.h"
+    "/root/repo/src/wifi/model/he/multi-user-scheduler.h"
+    "/root/repo/src/wifi/model/he/obss-pd-algorithm.h"
+    "/root/repo/src/wifi/model/he/rr-multi-user-scheduler.h"
+    "/root/repo/src/wifi/model/ht/ht-capabilities.h"
+    "/root/repo/src/wifi/model/ht/ht-configuration.h"
+    "/root/repo/src/wifi/model/ht/ht-frame-exchange-manager.h"
+    "/root/repo/src/wifi/model/ht/ht-operation.h"
+    "/root/repo/src/wifi/model/ht/ht-phy.h"
+    "/root/repo/src/wifi/model/ht/ht-ppdu.h"
+    "/root/repo/src/wifi/model/interference-helper.h"
+    "/root/repo/src/wifi/model/mac-rx-middle.h"
+    "/root/repo/src/wifi/model/mac-tx-middle.h"
+    "/root/repo/src/wifi/model/mgt-headers.h"
+    "/root/repo/src/wifi/model/mpdu-aggregator.h"
+    "/root/repo/src/wifi/model/msdu-aggregator.h"
+    "/root/repo/src/wifi/model/nist-error-rate-model.h"
+    "/root/repo/src/wifi/model/non-ht/dsss-error-rate-model.h"
+    "/root/repo/src/wifi/model/non-ht/dsss-parameter-set.h"
+    "/root/repo/src/wifi/model/non-ht/dsss-phy.h"
+    "/root/repo/src/wifi/model/non-ht/dsss-ppdu.h"
+    "/root/repo/src/wifi/model/non-ht/erp-information.h"
+    "/root/repo/src/wifi/model/non-ht/erp-ofdm-phy.h"
+    "/root/repo/src/wifi/model/non-ht/erp-ofdm-ppdu.h"
+    "/root/repo/src/wifi/model/non-ht/ofdm-phy.h"
+    "/root/repo/src/wifi/model/non-ht/ofdm-ppdu.h"
+    "/root/repo/src/wifi/model/originator-block-ack-agreement.h"
+    "/root/repo/src/wifi/model/phy-entity.h"
+    "/root/repo/src/wifi/model/preamble-detection-model.h"
+    "/root/repo/src/wifi/model/qos-blocked-destinations.h"
+    "/root/repo/src/wifi/model/qos-frame-exchange-manager.h"
+    "/root/repo/src/wifi/model/qos-txop.h"
+    "/root/repo/src/wifi/model/qos-utils.h"
+    "/root/repo/src/wifi/model/rate-control/aarf-wifi-manager.h"
+    "/root/repo/src/wifi/model/rate-control/aarfcd-wifi-manager.h"
+    "/root/repo/src/wifi/model/rate-control/amrr-wifi-manager.h"
+    "/root/repo/src/wifi/model/rate-control/aparf-wifi-manager.h"
+    "/root/repo/src/wifi/model/rate-control/arf-wifi-manager.h"
+    "/root/repo/src/wifi/model/rate-control/cara-wifi-manager.h"
+    "/root/repo/src/wifi/model/rate-control/constant-rate-wifi-manager.h"
+    "/root/repo/src/wifi/model/rate-control/ideal-wifi-manager.h"
+    "/root/repo/src/wifi/model/rate-control/minstrel-ht-wifi-manager.h"
+    "/root/repo/src/wifi/model/rate-control/minstrel-wifi-manager.h"
+    "/root/repo/src/wifi/model/rate-control/onoe-wifi-manager.h"
+    "/root/repo/src/wifi/model/rate-control/parf-wifi-manager.h"
+    "/root/repo/src/wifi/model/rate-control/rraa-wifi-manager.h"
+    "/root/repo/src/wifi/model/rate-control/rrpaa-wifi-manager.h"
+    "/root/repo/src/wifi/model/rate-control/thompson-sampling-wifi-manager.h"
+    "/root/repo/src/wifi/model/recipient-block-ack-agreement.h"
+    "/root/repo/src/wifi/model/reference/error-rate-tables.h"
+    "/root/repo/src/wifi/model/simple-frame-capture-model.h"
+    "/root/repo/src/wifi/model/snr-tag.h"
+    "/root/repo/src/wifi/model/spectrum-wifi-phy.h"
+    "/root/repo/src/wifi/model/ssid.h"
+    "/root/repo/src/wifi/model/sta-wifi-mac.h"
+    "/root/repo/src/wifi/model/status-code.h"
+    "/root/repo/src/wifi/model/supported-rates.h"
+    "/root/repo/src/wifi/model/table-based-error-rate-model.h"
+    "/root/repo/src/wifi/model/threshold-preamble-detection-model.h"
+    "/root/repo/src/wifi/model/txop.h"
+    "/root/repo/src/wifi/model/vht/vht-capabilities.h"
+    "/root/repo/src/wifi/model/vht/vht-configuration.h"
+    "/root/repo/src/wifi/model/vht/vht-frame-exchange-manager.h"
+    "/root/repo/src/wifi/model/vht/vht-operation.h"
+    "/root/repo/src/wifi/model/vht/vht-phy.h"
+    "/root/repo/src/wifi/model/vht/vht-ppdu.h"
+    "/root/repo/src/wifi/model/wifi-ack-manager.h"
+    "/root/repo/src/wifi/model/wifi-acknowledgment.h"
+    "/root/repo/src/wifi/model/wifi-default-ack-manager.h"
+    "/root/repo/src/wifi/model/wifi-default-protection-manager.h"
+    "/root/repo/src/wifi/model/wifi-information-element-vector.h"
+    "/root/repo/src/wifi/model/wifi-information-element.h"
+    "/root/repo/src/wifi/model/wifi-mac-header.h"
+    "/root/repo/src/wifi/model/wifi-mac-queue-item.h"
+    "/root/repo/src/wifi/model/wifi-mac-queue.h"
+    "/root/repo/src/wifi/model/wifi-mac-trailer.h"
+    "/root/repo/src/wifi/model/wifi-mac.h"
+    "/root/repo/src/wifi/model/wifi-mode.h"
+    "/root/repo/src/wifi/model/wifi-mpdu-type.h"
+    "/root/repo/src/wifi/model/wifi-net-device.h"
+    "/root/repo/src/wifi/model/wifi-phy-band.h"
+    "/root/repo/src/wifi/model/wifi-phy-common.h"
+    "/root/repo/src/wifi/model/wifi-phy-listener.h"
+    "/root/repo/src/wifi/model/wifi-phy-operating-channel.h"
+    "/root/repo/src/wifi/model/wifi-phy-state-helper.h"
+    "/root/repo/src/wifi/model/wifi-phy-state.h"
+    "/root/repo/src/wifi/model/wifi-phy.h"
+    "/root/repo/src/wifi/model/wifi-ppdu.h"
+    "/root/repo/src/wifi/model/wifi-protection-manager.h"
+    "/root/repo/src/wifi/model/wifi-protection.h"
+    "/root/repo/src/wifi/model/wifi-psdu.h"
+    "/root/repo/src/wifi/model/wifi-radio-energy-model.h"
+    "/root/repo/src/wifi/model/wifi-remote-station-info.h"
+    "/root/repo/src/wifi/model/wifi-remote-station-manager.h"
+    "/root/repo/src/wifi/model/wifi-spectrum-phy-interface.h"
+    "/root/repo/src/wifi/model/wifi-spectrum-signal-parameters.h"
+    "/root/repo/src/wifi/model/wifi-standards.h"
+    "/root/repo/src/wifi/model/wifi-tx-current-model.h"
+    "/root/repo/src/wifi/model/wifi-tx-parameters.h"
+    "/root/repo/src/wifi/model/wifi-tx-timer.h"
+    "/root/repo/src/wifi/model/wifi-tx-vector.h"
+    "/root/repo/src/wifi/model/wifi-utils.h"
+    "/root/repo/src/wifi/model/yans-error-rate-model.h"
+    "/root/repo/src/wifi/model/yans-wifi-channel.h"
+    "/root/repo/src/wifi/model/yans-wifi-phy.h"
+    "/root/repo/_dev_build/out/include/ns3/wifi-module.h"
+    )
+endif()
+
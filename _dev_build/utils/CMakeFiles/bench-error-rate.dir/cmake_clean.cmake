@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../out/utils/ns3-dev-bench-error-rate-default"
+  "../out/utils/ns3-dev-bench-error-rate-default.pdb"
+  "CMakeFiles/bench-error-rate.dir/bench-error-rate.cc.o"
+  "CMakeFiles/bench-error-rate.dir/bench-error-rate.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench-error-rate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
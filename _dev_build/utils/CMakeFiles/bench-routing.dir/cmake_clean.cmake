@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../out/utils/ns3-dev-bench-routing-default"
+  "../out/utils/ns3-dev-bench-routing-default.pdb"
+  "CMakeFiles/bench-routing.dir/bench-routing.cc.o"
+  "CMakeFiles/bench-routing.dir/bench-routing.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench-routing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../out/utils/ns3-dev-bench-simulator-default"
+  "../out/utils/ns3-dev-bench-simulator-default.pdb"
+  "CMakeFiles/bench-simulator.dir/bench-simulator.cc.o"
+  "CMakeFiles/bench-simulator.dir/bench-simulator.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bench-simulator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../out/utils/ns3-dev-binary-trace-to-ascii-default"
+  "../out/utils/ns3-dev-binary-trace-to-ascii-default.pdb"
+  "CMakeFiles/binary-trace-to-ascii.dir/binary-trace-to-ascii.cc.o"
+  "CMakeFiles/binary-trace-to-ascii.dir/binary-trace-to-ascii.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/binary-trace-to-ascii.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
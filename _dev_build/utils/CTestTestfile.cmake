@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/utils
+# Build directory: /root/repo/_dev_build/utils
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ctest-test-runner "ns3-dev-test-runner-default")
+set_tests_properties(ctest-test-runner PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/out/utils/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1337;add_test;/root/repo/utils/CMakeLists.txt;15;set_runtime_outputdirectory;/root/repo/utils/CMakeLists.txt;0;")
+add_test(ctest-bench-simulator "ns3-dev-bench-simulator-default")
+set_tests_properties(ctest-bench-simulator PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/out/utils/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1337;add_test;/root/repo/utils/CMakeLists.txt;23;set_runtime_outputdirectory;/root/repo/utils/CMakeLists.txt;0;")
+add_test(ctest-bench-packets "ns3-dev-bench-packets-default")
+set_tests_properties(ctest-bench-packets PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/out/utils/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1337;add_test;/root/repo/utils/CMakeLists.txt;30;set_runtime_outputdirectory;/root/repo/utils/CMakeLists.txt;0;")
+add_test(ctest-binary-trace-to-ascii "ns3-dev-binary-trace-to-ascii-default")
+set_tests_properties(ctest-binary-trace-to-ascii PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/out/utils/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1337;add_test;/root/repo/utils/CMakeLists.txt;36;set_runtime_outputdirectory;/root/repo/utils/CMakeLists.txt;0;")
+add_test(ctest-print-introspected-doxygen "ns3-dev-print-introspected-doxygen-default")
+set_tests_properties(ctest-print-introspected-doxygen PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/out/utils/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1337;add_test;/root/repo/utils/CMakeLists.txt;46;set_runtime_outputdirectory;/root/repo/utils/CMakeLists.txt;0;")
+add_test(ctest-bench-routing "ns3-dev-bench-routing-default")
+set_tests_properties(ctest-bench-routing PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/out/utils/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1337;add_test;/root/repo/utils/CMakeLists.txt;54;set_runtime_outputdirectory;/root/repo/utils/CMakeLists.txt;0;")
+add_test(ctest-bench-error-rate "ns3-dev-bench-error-rate-default")
+set_tests_properties(ctest-bench-error-rate PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/out/utils/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1337;add_test;/root/repo/utils/CMakeLists.txt;62;set_runtime_outputdirectory;/root/repo/utils/CMakeLists.txt;0;")
+add_test(ctest-perf-io "ns3-dev-perf-io-default")
+set_tests_properties(ctest-perf-io PROPERTIES  WORKING_DIRECTORY "/root/repo/_dev_build/out/utils/perf/" _BACKTRACE_TRIPLES "/root/repo/build-support/macros-and-definitions.cmake;1337;add_test;/root/repo/utils/CMakeLists.txt;70;set_runtime_outputdirectory;/root/repo/utils/CMakeLists.txt;0;")
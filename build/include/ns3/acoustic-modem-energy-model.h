@@ -0,0 +1 @@
+/root/repo/src/uan/model/acoustic-modem-energy-model.h
\ No newline at end of file
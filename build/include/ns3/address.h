@@ -0,0 +1 @@
+/root/repo/src/network/model/address.h
\ No newline at end of file
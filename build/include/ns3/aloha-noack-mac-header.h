@@ -0,0 +1 @@
+/root/repo/src/spectrum/model/aloha-noack-mac-header.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/ampdu-tag.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/aodv/model/aodv-neighbor.h
\ No newline at end of file
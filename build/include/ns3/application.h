@@ -0,0 +1 @@
+/root/repo/src/network/model/application.h
\ No newline at end of file
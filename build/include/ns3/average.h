@@ -0,0 +1 @@
+/root/repo/src/stats/model/average.h
\ No newline at end of file
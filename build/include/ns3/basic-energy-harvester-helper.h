@@ -0,0 +1 @@
+/root/repo/src/energy/helper/basic-energy-harvester-helper.h
\ No newline at end of file
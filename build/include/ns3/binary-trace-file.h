@@ -0,0 +1 @@
+/root/repo/src/network/utils/binary-trace-file.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/utils/bit-deserializer.h
\ No newline at end of file
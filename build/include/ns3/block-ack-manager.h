@@ -0,0 +1 @@
+/root/repo/src/wifi/model/block-ack-manager.h
\ No newline at end of file
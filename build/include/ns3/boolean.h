@@ -0,0 +1 @@
+/root/repo/src/core/model/boolean.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/bridge/model/bridge-channel.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wimax/model/bs-scheduler-rtps.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wimax/model/bs-scheduler.h
\ No newline at end of file
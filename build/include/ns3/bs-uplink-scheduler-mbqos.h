@@ -0,0 +1 @@
+/root/repo/src/wimax/model/bs-uplink-scheduler-mbqos.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/buildings/model/building.h
\ No newline at end of file
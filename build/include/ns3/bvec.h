@@ -0,0 +1 @@
+/root/repo/src/wimax/model/bvec.h
\ No newline at end of file
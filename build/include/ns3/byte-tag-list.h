@@ -0,0 +1 @@
+/root/repo/src/network/model/byte-tag-list.h
\ No newline at end of file
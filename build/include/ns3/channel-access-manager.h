@@ -0,0 +1 @@
+/root/repo/src/wifi/model/channel-access-manager.h
\ No newline at end of file
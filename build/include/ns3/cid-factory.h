@@ -0,0 +1 @@
+/root/repo/src/wimax/model/cid-factory.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wimax/model/cid.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wimax/model/connection-manager.h
\ No newline at end of file
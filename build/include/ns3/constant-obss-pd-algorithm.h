@@ -0,0 +1 @@
+/root/repo/src/wifi/model/he/constant-obss-pd-algorithm.h
\ No newline at end of file
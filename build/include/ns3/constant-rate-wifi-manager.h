@@ -0,0 +1 @@
+/root/repo/src/wifi/model/rate-control/constant-rate-wifi-manager.h
\ No newline at end of file
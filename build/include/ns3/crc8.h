@@ -0,0 +1 @@
+/root/repo/src/wimax/model/crc8.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wimax/model/cs-parameters.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/csma/helper/csma-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/csma-layout/model/csma-star-helper.h
\ No newline at end of file
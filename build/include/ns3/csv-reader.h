@@ -0,0 +1 @@
+/root/repo/src/core/helper/csv-reader.h
\ No newline at end of file
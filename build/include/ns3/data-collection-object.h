@@ -0,0 +1 @@
+/root/repo/src/stats/model/data-collection-object.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/energy/model/device-energy-model-container.h
\ No newline at end of file
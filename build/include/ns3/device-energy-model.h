@@ -0,0 +1 @@
+/root/repo/src/energy/model/device-energy-model.h
\ No newline at end of file
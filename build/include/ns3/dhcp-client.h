@@ -0,0 +1 @@
+/root/repo/src/internet-apps/model/dhcp-client.h
\ No newline at end of file
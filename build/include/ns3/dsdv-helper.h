@@ -0,0 +1 @@
+/root/repo/src/dsdv/helper/dsdv-helper.h
\ No newline at end of file
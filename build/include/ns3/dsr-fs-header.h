@@ -0,0 +1 @@
+/root/repo/src/dsr/model/dsr-fs-header.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dsr/model/dsr-option-header.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dsr/model/dsr-options.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/dsr/model/dsr-passive-buff.h
\ No newline at end of file
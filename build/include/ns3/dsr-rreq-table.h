@@ -0,0 +1 @@
+/root/repo/src/dsr/model/dsr-rreq-table.h
\ No newline at end of file
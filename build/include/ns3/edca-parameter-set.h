@@ -0,0 +1 @@
+/root/repo/src/wifi/model/edca-parameter-set.h
\ No newline at end of file
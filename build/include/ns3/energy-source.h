@@ -0,0 +1 @@
+/root/repo/src/energy/model/energy-source.h
\ No newline at end of file
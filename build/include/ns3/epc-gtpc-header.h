@@ -0,0 +1 @@
+/root/repo/src/lte/model/epc-gtpc-header.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lte/model/epc-s11-sap.h
\ No newline at end of file
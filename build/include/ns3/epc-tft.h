@@ -0,0 +1 @@
+/root/repo/src/lte/model/epc-tft.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lte/model/eps-bearer.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/reference/error-rate-tables.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/extended-capabilities.h
\ No newline at end of file
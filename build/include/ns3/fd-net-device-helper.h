@@ -0,0 +1 @@
+/root/repo/src/fd-net-device/helper/fd-net-device-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/stats/model/file-aggregator.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/mesh/model/flame/flame-protocol-mac.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/flow-monitor/model/flow-probe.h
\ No newline at end of file
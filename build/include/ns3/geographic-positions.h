@@ -0,0 +1 @@
+/root/repo/src/mobility/model/geographic-positions.h
\ No newline at end of file
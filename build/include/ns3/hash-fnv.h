@@ -0,0 +1 @@
+/root/repo/src/core/model/hash-fnv.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/he/he-capabilities.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/he/he-frame-exchange-manager.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wave/model/higher-tx-tag.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/mesh/model/dot11s/hwmp-rtable.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/icmpv6-header.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/int64x64-double.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/ip-l4-protocol.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wimax/model/ipcs-classifier-record.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nix-vector-routing/model/ipv4-nix-vector-routing.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/ipv4-raw-socket-factory.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/ipv6-pmtu-cache.h
\ No newline at end of file
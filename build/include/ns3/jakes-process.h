@@ -0,0 +1 @@
+/root/repo/src/propagation/model/jakes-process.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/propagation/model/kun-2600-mhz-propagation-loss-model.h
\ No newline at end of file
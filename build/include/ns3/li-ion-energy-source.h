@@ -0,0 +1 @@
+/root/repo/src/energy/model/li-ion-energy-source.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lr-wpan/helper/lr-wpan-helper.h
\ No newline at end of file
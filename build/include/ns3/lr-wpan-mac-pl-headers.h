@@ -0,0 +1 @@
+/root/repo/src/lr-wpan/model/lr-wpan-mac-pl-headers.h
\ No newline at end of file
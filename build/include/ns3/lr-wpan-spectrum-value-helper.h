@@ -0,0 +1 @@
+/root/repo/src/lr-wpan/model/lr-wpan-spectrum-value-helper.h
\ No newline at end of file
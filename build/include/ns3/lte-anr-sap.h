@@ -0,0 +1 @@
+/root/repo/src/lte/model/lte-anr-sap.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lte/model/lte-common.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lte/model/lte-fr-strict-algorithm.h
\ No newline at end of file
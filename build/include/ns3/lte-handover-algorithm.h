@@ -0,0 +1 @@
+/root/repo/src/lte/model/lte-handover-algorithm.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lte/helper/lte-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lte/model/lte-pdcp.h
\ No newline at end of file
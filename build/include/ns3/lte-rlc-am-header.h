@@ -0,0 +1 @@
+/root/repo/src/lte/model/lte-rlc-am-header.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lte/model/lte-rrc-protocol-ideal.h
\ No newline at end of file
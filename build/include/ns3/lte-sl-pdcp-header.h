@@ -0,0 +1 @@
+/root/repo/src/lte/model/lte-sl-pdcp-header.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lte/model/lte-sl-tft.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lte/model/lte-ue-cmac-sap.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lte/model/lte-ue-component-carrier-manager.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/mac-rx-middle.h
\ No newline at end of file
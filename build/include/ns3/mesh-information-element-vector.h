@@ -0,0 +1 @@
+/root/repo/src/mesh/model/mesh-information-element-vector.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/mesh/model/mesh-point-device.h
\ No newline at end of file
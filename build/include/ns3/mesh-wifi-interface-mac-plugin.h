@@ -0,0 +1 @@
+/root/repo/src/mesh/model/mesh-wifi-interface-mac-plugin.h
\ No newline at end of file
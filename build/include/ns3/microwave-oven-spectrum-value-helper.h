@@ -0,0 +1 @@
+/root/repo/src/spectrum/model/microwave-oven-spectrum-value-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/mobility/helper/mobility-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/traffic-control/model/mq-queue-disc.h
\ No newline at end of file
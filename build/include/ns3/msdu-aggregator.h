@@ -0,0 +1 @@
+/root/repo/src/wifi/model/msdu-aggregator.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/he/mu-edca-parameter-set.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/he/mu-snr-tag.h
\ No newline at end of file
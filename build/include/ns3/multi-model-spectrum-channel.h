@@ -0,0 +1 @@
+/root/repo/src/spectrum/model/multi-model-spectrum-channel.h
\ No newline at end of file
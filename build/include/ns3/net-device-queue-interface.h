@@ -0,0 +1 @@
+/root/repo/src/network/utils/net-device-queue-interface.h
\ No newline at end of file
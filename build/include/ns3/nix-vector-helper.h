@@ -0,0 +1 @@
+/root/repo/src/nix-vector-routing/helper/nix-vector-helper.h
\ No newline at end of file
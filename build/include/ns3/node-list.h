@@ -0,0 +1 @@
+/root/repo/src/network/model/node-list.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lte/model/nr-sl-comm-resource-pool.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lte/model/nr-sl-mac-sap.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lte/model/nr-sl-pdcp-sap.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lte/model/nr-sl-ue-rrc.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/he/obss-pd-algorithm.h
\ No newline at end of file
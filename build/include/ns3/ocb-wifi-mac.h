@@ -0,0 +1 @@
+/root/repo/src/wave/model/ocb-wifi-mac.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/buildings/model/oh-buildings-propagation-loss-model.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/olsr/model/olsr-header.h
\ No newline at end of file
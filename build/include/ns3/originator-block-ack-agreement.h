@@ -0,0 +1 @@
+/root/repo/src/wifi/model/originator-block-ack-agreement.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/utils/packet-burst.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/utils/packet-data-calculators.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/traffic-control/model/packet-filter.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/utils/pcapng-file.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/mesh/model/dot11s/peer-link-frame.h
\ No newline at end of file
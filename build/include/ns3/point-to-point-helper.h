@@ -0,0 +1 @@
+/root/repo/src/point-to-point/helper/point-to-point-helper.h
\ No newline at end of file
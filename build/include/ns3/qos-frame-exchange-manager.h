@@ -0,0 +1 @@
+/root/repo/src/wifi/model/qos-frame-exchange-manager.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/qos-utils.h
\ No newline at end of file
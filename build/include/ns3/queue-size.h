@@ -0,0 +1 @@
+/root/repo/src/network/utils/queue-size.h
\ No newline at end of file
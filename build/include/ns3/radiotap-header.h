@@ -0,0 +1 @@
+/root/repo/src/network/utils/radiotap-header.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet-apps/helper/radvd-helper.h
\ No newline at end of file
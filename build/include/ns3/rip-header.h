@@ -0,0 +1 @@
+/root/repo/src/internet/model/rip-header.h
\ No newline at end of file
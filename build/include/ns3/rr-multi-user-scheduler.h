@@ -0,0 +1 @@
+/root/repo/src/wifi/model/he/rr-multi-user-scheduler.h
\ No newline at end of file
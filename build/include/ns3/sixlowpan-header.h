@@ -0,0 +1 @@
+/root/repo/src/sixlowpan/model/sixlowpan-header.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/snr-tag.h
\ No newline at end of file
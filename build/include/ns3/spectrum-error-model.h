@@ -0,0 +1 @@
+/root/repo/src/spectrum/model/spectrum-error-model.h
\ No newline at end of file
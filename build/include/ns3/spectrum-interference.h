@@ -0,0 +1 @@
+/root/repo/src/spectrum/model/spectrum-interference.h
\ No newline at end of file
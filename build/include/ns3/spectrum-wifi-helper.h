@@ -0,0 +1 @@
+/root/repo/src/wifi/helper/spectrum-wifi-helper.h
\ No newline at end of file
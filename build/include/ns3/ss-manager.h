@@ -0,0 +1 @@
+/root/repo/src/wimax/model/ss-manager.h
\ No newline at end of file
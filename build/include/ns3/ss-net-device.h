@@ -0,0 +1 @@
+/root/repo/src/wimax/model/ss-net-device.h
\ No newline at end of file
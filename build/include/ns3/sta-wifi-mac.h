@@ -0,0 +1 @@
+/root/repo/src/wifi/model/sta-wifi-mac.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/synchronizer.h
\ No newline at end of file
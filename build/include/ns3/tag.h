@@ -0,0 +1 @@
+/root/repo/src/network/model/tag.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/tap-bridge/helper/tap-bridge-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/tcp-yeah.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/buildings/model/three-gpp-v2v-channel-condition-model.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/propagation/model/three-gpp-v2v-propagation-loss-model.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/stats/model/time-probe.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/topology-read/helper/topology-reader-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/spectrum/model/trace-fading-loss-model.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/network/helper/trace-helper.h
\ No newline at end of file
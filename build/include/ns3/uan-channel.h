@@ -0,0 +1 @@
+/root/repo/src/uan/model/uan-channel.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/uan/helper/uan-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/uan/model/uan-mac-rc-gw.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/uan/model/uan-phy-gen.h
\ No newline at end of file
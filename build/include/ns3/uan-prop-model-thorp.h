@@ -0,0 +1 @@
+/root/repo/src/uan/model/uan-prop-model-thorp.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/uan/model/uan-transducer-hd.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/uan/model/uan-transducer.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/uan/model/uan-tx-mode.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/applications/helper/udp-client-server-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet/model/udp-socket.h
\ No newline at end of file
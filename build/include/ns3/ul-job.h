@@ -0,0 +1 @@
+/root/repo/src/wimax/model/ul-job.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/internet-apps/model/v4traceroute.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/core/model/wall-clock-synchronizer.h
\ No newline at end of file
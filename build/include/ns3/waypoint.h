@@ -0,0 +1 @@
+/root/repo/src/mobility/model/waypoint.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/wifi-mac-trailer.h
\ No newline at end of file
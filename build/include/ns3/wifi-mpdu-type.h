@@ -0,0 +1 @@
+/root/repo/src/wifi/model/wifi-mpdu-type.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/wifi-phy-band.h
\ No newline at end of file
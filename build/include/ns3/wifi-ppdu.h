@@ -0,0 +1 @@
+/root/repo/src/wifi/model/wifi-ppdu.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wifi/model/wifi-psdu.h
\ No newline at end of file
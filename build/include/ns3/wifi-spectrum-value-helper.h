@@ -0,0 +1 @@
+/root/repo/src/spectrum/model/wifi-spectrum-value-helper.h
\ No newline at end of file
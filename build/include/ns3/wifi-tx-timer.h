@@ -0,0 +1 @@
+/root/repo/src/wifi/model/wifi-tx-timer.h
\ No newline at end of file
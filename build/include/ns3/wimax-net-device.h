@@ -0,0 +1 @@
+/root/repo/src/wimax/model/wimax-net-device.h
\ No newline at end of file
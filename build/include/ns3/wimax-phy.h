@@ -0,0 +1 @@
+/root/repo/src/wimax/model/wimax-phy.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/wimax/model/wimax-tlv.h
\ No newline at end of file
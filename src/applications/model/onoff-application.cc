@@ -42,6 +42,7 @@
 #include "ns3/string.h"
 #include "ns3/pointer.h"
 #include "ns3/boolean.h"
+#include <algorithm>
 
 namespace ns3 {
 
@@ -64,6 +65,13 @@ OnOffApplication::GetTypeId (void)
                    UintegerValue (512),
                    MakeUintegerAccessor (&OnOffApplication::m_pktSize),
                    MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("BatchSize",
+                   "The number of packets sent at once with Socket::SendBatch, "
+                   "every BatchSize packet intervals. The average data rate "
+                   "is unchanged, but the packets leave in bursts.",
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&OnOffApplication::m_batchSize),
+                   MakeUintegerChecker<uint32_t> (1))
     .AddAttribute ("Remote", "The address of the destination",
                    AddressValue (),
                    MakeAddressAccessor (&OnOffApplication::m_peer),
@@ -118,8 +126,7 @@ OnOffApplication::OnOffApplication ()
     m_connected (false),
     m_residualBits (0),
     m_lastStartTime (Seconds (0)),
-    m_totBytes (0),
-    m_unsentPacket (0)
+    m_totBytes (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -159,7 +166,7 @@ OnOffApplication::DoDispose (void)
 
   CancelEvents ();
   m_socket = 0;
-  m_unsentPacket = 0;
+  m_unsentPackets.clear ();
   // chain up
   Application::DoDispose ();
 }
@@ -248,12 +255,12 @@ void OnOffApplication::CancelEvents ()
   Simulator::Cancel (m_sendEvent);
   Simulator::Cancel (m_startStopEvent);
   // Canceling events may cause discontinuity in sequence number if the
-  // SeqTsSizeHeader is header, and m_unsentPacket is true
-  if (m_unsentPacket)
+  // SeqTsSizeHeader is header, and there are unsent packets
+  if (!m_unsentPackets.empty ())
     {
       NS_LOG_DEBUG ("Discarding cached packet upon CancelEvents ()");
     }
-  m_unsentPacket = 0;
+  m_unsentPackets.clear ();
 }
 
 // Event handlers
@@ -280,8 +287,8 @@ void OnOffApplication::ScheduleNextTx ()
 
   if (m_maxBytes == 0 || m_totBytes < m_maxBytes)
     {
-      NS_ABORT_MSG_IF (m_residualBits > m_pktSize * 8, "Calculation to compute next send time will overflow");
-      uint32_t bits = m_pktSize * 8 - m_residualBits;
+      NS_ABORT_MSG_IF (m_residualBits > m_batchSize * m_pktSize * 8, "Calculation to compute next send time will overflow");
+      uint32_t bits = m_batchSize * m_pktSize * 8 - m_residualBits;
       NS_LOG_LOGIC ("bits = " << bits);
       Time nextTime (Seconds (bits /
                               static_cast<double>(m_cbrRate.GetBitRate ()))); // Time till next packet
@@ -320,12 +327,56 @@ void OnOffApplication::SendPacket ()
 
   NS_ASSERT (m_sendEvent.IsExpired ());
 
-  Ptr<Packet> packet;
-  if (m_unsentPacket)
+  // the last batch is cut to MaxBytes
+  uint64_t batchSize = m_batchSize;
+  if (m_maxBytes > 0)
+    {
+      batchSize = std::min (batchSize, (m_maxBytes - m_totBytes + m_pktSize - 1) / m_pktSize);
+    }
+  while (m_unsentPackets.size () < batchSize)
+    {
+      m_unsentPackets.push_back (CreatePacket ());
+    }
+
+  std::size_t sent = 0;
+  if (m_unsentPackets.size () == 1)
+    {
+      int actual = m_socket->Send (m_unsentPackets[0]);
+      if ((unsigned) actual == m_pktSize)
+        {
+          sent = 1;
+        }
+      else
+        {
+          NS_LOG_DEBUG ("Unable to send packet; actual " << actual << " size " << m_pktSize << "; caching for later attempt");
+        }
+    }
+  else
     {
-      packet = m_unsentPacket;
+      int actual = m_socket->SendBatch (m_unsentPackets, 0);
+      sent = std::max (actual, 0);
+      if (sent < m_unsentPackets.size ())
+        {
+          NS_LOG_DEBUG ("Unable to send " << m_unsentPackets.size () - sent << " packets; caching for later attempt");
+        }
     }
-  else if (m_enableSeqTsSizeHeader)
+  for (std::size_t i = 0; i < sent; i++)
+    {
+      PacketSent (m_unsentPackets[i]);
+    }
+  m_unsentPackets.erase (m_unsentPackets.begin (), m_unsentPackets.begin () + sent);
+  m_residualBits = 0;
+  m_lastStartTime = Simulator::Now ();
+  ScheduleNextTx ();
+}
+
+Ptr<Packet>
+OnOffApplication::CreatePacket ()
+{
+  NS_LOG_FUNCTION (this);
+
+  Ptr<Packet> packet;
+  if (m_enableSeqTsSizeHeader)
     {
       Address from, to;
       m_socket->GetSockName (from);
@@ -343,44 +394,38 @@ void OnOffApplication::SendPacket ()
     {
       packet = Create<Packet> (m_pktSize);
     }
+  return packet;
+}
+
+void
+OnOffApplication::PacketSent (Ptr<Packet> packet)
+{
+  NS_LOG_FUNCTION (this << packet);
 
-  int actual = m_socket->Send (packet);
-  if ((unsigned) actual == m_pktSize)
+  m_txTrace (packet);
+  m_totBytes += m_pktSize;
+  Address localAddress;
+  m_socket->GetSockName (localAddress);
+  if (InetSocketAddress::IsMatchingType (m_peer))
     {
-      m_txTrace (packet);
-      m_totBytes += m_pktSize;
-      m_unsentPacket = 0;
-      Address localAddress;
-      m_socket->GetSockName (localAddress);
-      if (InetSocketAddress::IsMatchingType (m_peer))
-        {
-          NS_LOG_INFO ("At time " << Simulator::Now ().As (Time::S)
-                       << " on-off application sent "
-                       <<  packet->GetSize () << " bytes to "
-                       << InetSocketAddress::ConvertFrom(m_peer).GetIpv4 ()
-                       << " port " << InetSocketAddress::ConvertFrom (m_peer).GetPort ()
-                       << " total Tx " << m_totBytes << " bytes");
-          m_txTraceWithAddresses (packet, localAddress, InetSocketAddress::ConvertFrom (m_peer));
-        }
-      else if (Inet6SocketAddress::IsMatchingType (m_peer))
-        {
-          NS_LOG_INFO ("At time " << Simulator::Now ().As (Time::S)
-                       << " on-off application sent "
-                       <<  packet->GetSize () << " bytes to "
-                       << Inet6SocketAddress::ConvertFrom(m_peer).GetIpv6 ()
-                       << " port " << Inet6SocketAddress::ConvertFrom (m_peer).GetPort ()
-                       << " total Tx " << m_totBytes << " bytes");
-          m_txTraceWithAddresses (packet, localAddress, Inet6SocketAddress::ConvertFrom(m_peer));
-        }
+      NS_LOG_INFO ("At time " << Simulator::Now ().As (Time::S)
+                   << " on-off application sent "
+                   <<  packet->GetSize () << " bytes to "
+                   << InetSocketAddress::ConvertFrom(m_peer).GetIpv4 ()
+                   << " port " << InetSocketAddress::ConvertFrom (m_peer).GetPort ()
+                   << " total Tx " << m_totBytes << " bytes");
+      m_txTraceWithAddresses (packet, localAddress, InetSocketAddress::ConvertFrom (m_peer));
     }
-  else
+  else if (Inet6SocketAddress::IsMatchingType (m_peer))
     {
-      NS_LOG_DEBUG ("Unable to send packet; actual " << actual << " size " << m_pktSize << "; caching for later attempt");
-      m_unsentPacket = packet;
+      NS_LOG_INFO ("At time " << Simulator::Now ().As (Time::S)
+                   << " on-off application sent "
+                   <<  packet->GetSize () << " bytes to "
+                   << Inet6SocketAddress::ConvertFrom(m_peer).GetIpv6 ()
+                   << " port " << Inet6SocketAddress::ConvertFrom (m_peer).GetPort ()
+                   << " total Tx " << m_totBytes << " bytes");
+      m_txTraceWithAddresses (packet, localAddress, Inet6SocketAddress::ConvertFrom(m_peer));
     }
-  m_residualBits = 0;
-  m_lastStartTime = Simulator::Now ();
-  ScheduleNextTx ();
 }
 
 
@@ -32,6 +32,7 @@
 #include "ns3/data-rate.h"
 #include "ns3/traced-callback.h"
 #include "ns3/seq-ts-size-header.h"
+#include <vector>
 
 namespace ns3 {
 
@@ -153,10 +154,22 @@ private:
    */
   void StopSending ();
   /**
-   * \brief Send a packet
+   * \brief Send a packet, or a batch of BatchSize packets
    */
   void SendPacket ();
 
+  /**
+   * \brief Create a new packet to send
+   * \returns the packet
+   */
+  Ptr<Packet> CreatePacket ();
+
+  /**
+   * \brief Account for and trace a packet sent
+   * \param packet the packet
+   */
+  void PacketSent (Ptr<Packet> packet);
+
   Ptr<Socket>     m_socket;       //!< Associated socket
   Address         m_peer;         //!< Peer address
   Address         m_local;        //!< Local address to bind to
@@ -166,6 +179,7 @@ private:
   DataRate        m_cbrRate;      //!< Rate that data is generated
   DataRate        m_cbrRateFailSafe;      //!< Rate that data is generated (check copy)
   uint32_t        m_pktSize;      //!< Size of packets
+  uint32_t        m_batchSize;    //!< Number of packets sent per socket call
   uint32_t        m_residualBits; //!< Number of generated, but not sent, bits
   Time            m_lastStartTime; //!< Time last packet sent
   uint64_t        m_maxBytes;     //!< Limit total number of bytes sent
@@ -174,7 +188,7 @@ private:
   EventId         m_sendEvent;    //!< Event id of pending "send packet" event
   TypeId          m_tid;          //!< Type of the socket used
   uint32_t        m_seq {0};      //!< Sequence
-  Ptr<Packet>     m_unsentPacket; //!< Unsent packet cached for future attempt
+  std::vector<Ptr<Packet> > m_unsentPackets; //!< Unsent packets cached for future attempt
   bool            m_enableSeqTsSizeHeader {false}; //!< Enable or disable the use of SeqTsSizeHeader
 
 
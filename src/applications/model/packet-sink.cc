@@ -34,6 +34,8 @@
 #include "ns3/boolean.h"
 #include "ns3/ipv4-packet-info-tag.h"
 #include "ns3/ipv6-packet-info-tag.h"
+#include "ns3/uinteger.h"
+#include <vector>
 
 namespace ns3 {
 
@@ -63,6 +65,11 @@ PacketSink::GetTypeId (void)
                    BooleanValue (false),
                    MakeBooleanAccessor (&PacketSink::m_enableSeqTsSizeHeader),
                    MakeBooleanChecker ())
+    .AddAttribute ("BatchSize",
+                   "The maximum number of packets read at once with Socket::RecvBatch.",
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&PacketSink::m_batchSize),
+                   MakeUintegerChecker<uint32_t> (1))
     .AddTraceSource ("Rx",
                      "A packet has been received",
                      MakeTraceSourceAccessor (&PacketSink::m_rxTrace),
@@ -191,61 +198,90 @@ void PacketSink::StopApplication ()     // Called at time specified by Stop
 void PacketSink::HandleRead (Ptr<Socket> socket)
 {
   NS_LOG_FUNCTION (this << socket);
+  if (m_batchSize > 1)
+    {
+      std::vector<Ptr<Packet> > packets;
+      std::vector<Address> fromAddresses;
+      while (socket->RecvBatch (packets, fromAddresses, m_batchSize, 0) > 0)
+        {
+          for (std::size_t i = 0; i < packets.size (); i++)
+            {
+              if (!HandlePacket (socket, packets[i], fromAddresses[i]))
+                {
+                  return;
+                }
+            }
+          packets.clear ();
+          fromAddresses.clear ();
+        }
+      return;
+    }
   Ptr<Packet> packet;
   Address from;
-  Address localAddress;
   while ((packet = socket->RecvFrom (from)))
     {
-      if (packet->GetSize () == 0)
-        { //EOF
+      if (!HandlePacket (socket, packet, from))
+        {
           break;
         }
-      m_totalRx += packet->GetSize ();
-      if (InetSocketAddress::IsMatchingType (from))
+    }
+}
+
+bool
+PacketSink::HandlePacket (Ptr<Socket> socket, Ptr<Packet> packet, const Address &from)
+{
+  NS_LOG_FUNCTION (this << socket << packet << from);
+  Address localAddress;
+  if (packet->GetSize () == 0)
+    { //EOF
+      return false;
+    }
+  m_totalRx += packet->GetSize ();
+  if (InetSocketAddress::IsMatchingType (from))
+    {
+      NS_LOG_INFO ("At time " << Simulator::Now ().As (Time::S)
+                   << " packet sink received "
+                   <<  packet->GetSize () << " bytes from "
+                   << InetSocketAddress::ConvertFrom(from).GetIpv4 ()
+                   << " port " << InetSocketAddress::ConvertFrom (from).GetPort ()
+                   << " total Rx " << m_totalRx << " bytes");
+    }
+  else if (Inet6SocketAddress::IsMatchingType (from))
+    {
+      NS_LOG_INFO ("At time " << Simulator::Now ().As (Time::S)
+                   << " packet sink received "
+                   <<  packet->GetSize () << " bytes from "
+                   << Inet6SocketAddress::ConvertFrom(from).GetIpv6 ()
+                   << " port " << Inet6SocketAddress::ConvertFrom (from).GetPort ()
+                   << " total Rx " << m_totalRx << " bytes");
+    }
+
+  if (!m_rxTrace.IsEmpty () || !m_rxTraceWithAddresses.IsEmpty () ||
+      (!m_rxTraceWithSeqTsSize.IsEmpty () && m_enableSeqTsSizeHeader))
+    {
+      Ipv4PacketInfoTag interfaceInfo;
+      Ipv6PacketInfoTag interface6Info;
+      if (packet->RemovePacketTag (interfaceInfo))
         {
-          NS_LOG_INFO ("At time " << Simulator::Now ().As (Time::S)
-                       << " packet sink received "
-                       <<  packet->GetSize () << " bytes from "
-                       << InetSocketAddress::ConvertFrom(from).GetIpv4 ()
-                       << " port " << InetSocketAddress::ConvertFrom (from).GetPort ()
-                       << " total Rx " << m_totalRx << " bytes");
+          localAddress = InetSocketAddress (interfaceInfo.GetAddress (), m_localPort);
         }
-      else if (Inet6SocketAddress::IsMatchingType (from))
+      else if (packet->RemovePacketTag (interface6Info))
         {
-          NS_LOG_INFO ("At time " << Simulator::Now ().As (Time::S)
-                       << " packet sink received "
-                       <<  packet->GetSize () << " bytes from "
-                       << Inet6SocketAddress::ConvertFrom(from).GetIpv6 ()
-                       << " port " << Inet6SocketAddress::ConvertFrom (from).GetPort ()
-                       << " total Rx " << m_totalRx << " bytes");
+          localAddress = Inet6SocketAddress (interface6Info.GetAddress (), m_localPort);
         }
-
-      if (!m_rxTrace.IsEmpty () || !m_rxTraceWithAddresses.IsEmpty () ||
-          (!m_rxTraceWithSeqTsSize.IsEmpty () && m_enableSeqTsSizeHeader))
+      else
         {
-          Ipv4PacketInfoTag interfaceInfo;
-          Ipv6PacketInfoTag interface6Info;
-          if (packet->RemovePacketTag (interfaceInfo))
-            {
-              localAddress = InetSocketAddress (interfaceInfo.GetAddress (), m_localPort);
-            }
-          else if (packet->RemovePacketTag (interface6Info))
-            {
-              localAddress = Inet6SocketAddress (interface6Info.GetAddress (), m_localPort);
-            }
-          else
-            {
-              socket->GetSockName (localAddress);
-            }
-          m_rxTrace (packet, from);
-          m_rxTraceWithAddresses (packet, from, localAddress);
+          socket->GetSockName (localAddress);
+        }
+      m_rxTrace (packet, from);
+      m_rxTraceWithAddresses (packet, from, localAddress);
 
-          if (!m_rxTraceWithSeqTsSize.IsEmpty () && m_enableSeqTsSizeHeader)
-            {
-              PacketReceived (packet, from, localAddress);
-            }
+      if (!m_rxTraceWithSeqTsSize.IsEmpty () && m_enableSeqTsSizeHeader)
+        {
+          PacketReceived (packet, from, localAddress);
         }
     }
+  return true;
 }
 
 void
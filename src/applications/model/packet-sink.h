@@ -118,6 +118,14 @@ private:
    * \param socket the receiving socket
    */
   void HandleRead (Ptr<Socket> socket);
+  /**
+   * \brief Account for and trace a packet read from a socket
+   * \param socket the receiving socket
+   * \param packet the packet
+   * \param from the address the packet is from
+   * \return false if the packet marks the end of the stream
+   */
+  bool HandlePacket (Ptr<Socket> socket, Ptr<Packet> packet, const Address &from);
   /**
    * \brief Handle an incoming connection
    * \param socket the incoming connection socket
@@ -180,6 +188,7 @@ private:
   uint16_t        m_localPort;    //!< Local port to bind to
   uint64_t        m_totalRx;      //!< Total bytes received
   TypeId          m_tid;          //!< Protocol TypeId
+  uint32_t        m_batchSize;    //!< Maximum number of packets read at once
 
   bool            m_enableSeqTsSizeHeader {false}; //!< Enable or disable the export of SeqTsSize header 
 
@@ -32,6 +32,8 @@
 #include "seq-ts-header.h"
 #include <cstdlib>
 #include <cstdio>
+#include <algorithm>
+#include <vector>
 
 namespace ns3 {
 
@@ -69,6 +71,11 @@ UdpClient::GetTypeId (void)
                    UintegerValue (1024),
                    MakeUintegerAccessor (&UdpClient::m_size),
                    MakeUintegerChecker<uint32_t> (12,65507))
+    .AddAttribute ("BatchSize",
+                   "The number of packets sent at once with Socket::SendBatch, every BatchSize intervals.",
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&UdpClient::m_batchSize),
+                   MakeUintegerChecker<uint32_t> (1))
   ;
   return tid;
 }
@@ -194,6 +201,11 @@ UdpClient::Send (void)
 {
   NS_LOG_FUNCTION (this);
   NS_ASSERT (m_sendEvent.IsExpired ());
+  if (m_batchSize > 1)
+    {
+      SendBatch ();
+      return;
+    }
   SeqTsHeader seqTs;
   seqTs.SetSeq (m_sent);
   Ptr<Packet> p = Create<Packet> (m_size-(8+4)); // 8+4 : the size of the seqTs header
@@ -224,6 +236,48 @@ UdpClient::Send (void)
     }
 }
 
+void
+UdpClient::SendBatch (void)
+{
+  NS_LOG_FUNCTION (this);
+  uint32_t batchSize = std::min (m_batchSize, m_count - m_sent);
+  std::vector<Ptr<Packet> > packets;
+  packets.reserve (batchSize);
+  for (uint32_t i = 0; i < batchSize; i++)
+    {
+      SeqTsHeader seqTs;
+      seqTs.SetSeq (m_sent + i);
+      Ptr<Packet> p = Create<Packet> (m_size-(8+4)); // 8+4 : the size of the seqTs header
+      p->AddHeader (seqTs);
+      packets.push_back (p);
+    }
+
+  int sent = m_socket->SendBatch (packets, 0);
+  for (int i = 0; i < sent; i++)
+    {
+      ++m_sent;
+      m_totalTx += packets[i]->GetSize ();
+#ifdef NS3_LOG_ENABLE
+      NS_LOG_INFO ("TraceDelay TX " << m_size << " bytes to "
+                                    << m_peerAddressString << " Uid: "
+                                    << packets[i]->GetUid () << " Time: "
+                                    << (Simulator::Now ()).As (Time::S));
+#endif // NS3_LOG_ENABLE
+    }
+#ifdef NS3_LOG_ENABLE
+  if (sent < static_cast<int> (batchSize))
+    {
+      NS_LOG_INFO ("Error while sending " << (batchSize - std::max (sent, 0))
+                                          << " packets to " << m_peerAddressString);
+    }
+#endif // NS3_LOG_ENABLE
+
+  if (m_sent < m_count)
+    {
+      m_sendEvent = Simulator::Schedule (m_interval * m_batchSize, &UdpClient::Send, this);
+    }
+}
+
 
 uint64_t
 UdpClient::GetTotalTx () const
@@ -83,9 +83,15 @@ private:
    */
   void Send (void);
 
+  /**
+   * \brief Send up to BatchSize packets with Socket::SendBatch
+   */
+  void SendBatch (void);
+
   uint32_t m_count; //!< Maximum number of packets the application will send
   Time m_interval; //!< Packet inter-send time
   uint32_t m_size; //!< Size of the sent packet (including the SeqTsHeader)
+  uint32_t m_batchSize; //!< Number of packets sent at once
 
   uint32_t m_sent; //!< Counter for sent packets
   uint64_t m_totalTx; //!< Total bytes sent
@@ -28,8 +28,11 @@
 #include "ns3/inet-socket-address.h"
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-address-helper.h"
+#include "ns3/neighbor-cache-helper.h"
 #include "ns3/udp-client-server-helper.h"
 #include "ns3/udp-echo-helper.h"
+#include "ns3/packet-sink-helper.h"
+#include "ns3/packet-sink.h"
 #include "ns3/simple-net-device.h"
 #include "ns3/simple-channel.h"
 #include "ns3/test.h"
@@ -188,6 +191,85 @@ void UdpTraceClientServerTestCase::DoRun (void)
 }
 
 
+/**
+ * \ingroup applications-test
+ * \ingroup tests
+ *
+ * Test that the UDP packets sent in batches by UdpClient applications are
+ * all received by an UdpServer and by a PacketSink reading in batches
+ */
+class UdpClientBatchTestCase : public TestCase
+{
+public:
+  UdpClientBatchTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+UdpClientBatchTestCase::UdpClientBatchTestCase ()
+  : TestCase ("Test that the udp packets sent in batches by udpClient applications are correctly received")
+{
+}
+
+void UdpClientBatchTestCase::DoRun (void)
+{
+  NodeContainer n;
+  n.Create (2);
+
+  InternetStackHelper internet;
+  internet.Install (n);
+
+  // link the two nodes
+  Ptr<SimpleNetDevice> txDev = CreateObject<SimpleNetDevice> ();
+  Ptr<SimpleNetDevice> rxDev = CreateObject<SimpleNetDevice> ();
+  n.Get (0)->AddDevice (txDev);
+  n.Get (1)->AddDevice (rxDev);
+  Ptr<SimpleChannel> channel1 = CreateObject<SimpleChannel> ();
+  rxDev->SetChannel (channel1);
+  txDev->SetChannel (channel1);
+  NetDeviceContainer d;
+  d.Add (txDev);
+  d.Add (rxDev);
+
+  Ipv4AddressHelper ipv4;
+  ipv4.SetBase ("10.1.1.0", "255.255.255.0");
+  Ipv4InterfaceContainer i = ipv4.Assign (d);
+  // a batch would overflow the ARP pending queue
+  NeighborCacheHelper neighbors;
+  neighbors.PopulateNeighborCache (d);
+
+  uint16_t port = 4000;
+  UdpServerHelper server (port);
+  ApplicationContainer apps = server.Install (n.Get (1));
+  PacketSinkHelper sink ("ns3::UdpSocketFactory", InetSocketAddress (Ipv4Address::GetAny (), port + 1));
+  sink.SetAttribute ("BatchSize", UintegerValue (3));
+  apps.Add (sink.Install (n.Get (1)));
+  apps.Start (Seconds (1.0));
+  apps.Stop (Seconds (10.0));
+
+  // 10 packets in batches of 4, 4 and 2, every 4 intervals
+  for (uint16_t p = port; p <= port + 1; p++)
+    {
+      UdpClientHelper client (i.GetAddress (1), p);
+      client.SetAttribute ("MaxPackets", UintegerValue (10));
+      client.SetAttribute ("Interval", TimeValue (MilliSeconds (100)));
+      client.SetAttribute ("PacketSize", UintegerValue (1024));
+      client.SetAttribute ("BatchSize", UintegerValue (4));
+      ApplicationContainer clientApps = client.Install (n.Get (0));
+      clientApps.Start (Seconds (2.0));
+      clientApps.Stop (Seconds (10.0));
+    }
+
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (server.GetServer ()->GetLost (), 0, "Packets were lost !");
+  NS_TEST_ASSERT_MSG_EQ (server.GetServer ()->GetReceived (), 10, "Did not receive expected number of packets !");
+  NS_TEST_ASSERT_MSG_EQ (DynamicCast<PacketSink> (apps.Get (1))->GetTotalRx (), 10 * 1024, "Did not receive expected number of bytes !");
+
+  Simulator::Destroy ();
+}
+
 /**
  * Test that all the PacketLossCounter class checks loss correctly in different cases
  */
@@ -357,6 +439,7 @@ UdpClientServerTestSuite::UdpClientServerTestSuite ()
 {
   AddTestCase (new UdpTraceClientServerTestCase, TestCase::QUICK);
   AddTestCase (new UdpClientServerTestCase, TestCase::QUICK);
+  AddTestCase (new UdpClientBatchTestCase, TestCase::QUICK);
   AddTestCase (new PacketLossCounterTestCase, TestCase::QUICK);
   AddTestCase (new UdpEchoClientSetFillTestCase, TestCase::QUICK);
 }
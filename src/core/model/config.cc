@@ -25,7 +25,11 @@
 #include "names.h"
 #include "pointer.h"
 #include "log.h"
+#include "trace-source-accessor.h"
 
+#include <algorithm>
+#include <map>
+#include <limits>
 #include <sstream>
 
 /**
@@ -90,26 +94,157 @@ MatchContainer::GetPath (void) const
   return m_path;
 }
 
+/**
+ * \ingroup config-impl
+ * Helper to set an attribute on many objects, looking the attribute
+ * up and validating the value once per type of object.
+ */
+class AttributeSetter
+{
+public:
+  /**
+   * Construct from the attribute name and value.
+   *
+   * \param [in] name The name of the attribute.
+   * \param [in] value The value to set.
+   */
+  AttributeSetter (std::string name, const AttributeValue &value);
+  /**
+   * Set the attribute of an object.
+   *
+   * \param [in] object The object.
+   * \returns \c true if the attribute could be set, as
+   *   ObjectBase::SetAttributeFailSafe.
+   */
+  bool Set (Ptr<Object> object);
+
+private:
+  /** The attribute of a type, ready to be set. */
+  struct Target
+  {
+    /** The attribute accessor, null if the attribute cannot be set. */
+    Ptr<const AttributeAccessor> accessor;
+    /** The value, validated by the attribute checker. */
+    Ptr<AttributeValue> value;
+  };
+  /** The name of the attribute. */
+  std::string m_name;
+  /** The value to set. */
+  const AttributeValue &m_value;
+  /** The attribute of each type seen so far, by TypeId uid. */
+  std::map<uint16_t, Target> m_targets;
+
+};  // class AttributeSetter
+
+AttributeSetter::AttributeSetter (std::string name, const AttributeValue &value)
+  : m_name (name),
+    m_value (value)
+{
+  NS_LOG_FUNCTION (this << name << &value);
+}
+bool
+AttributeSetter::Set (Ptr<Object> object)
+{
+  NS_LOG_FUNCTION (this << object);
+  TypeId tid = object->GetInstanceTypeId ();
+  std::map<uint16_t, Target>::iterator it = m_targets.find (tid.GetUid ());
+  if (it == m_targets.end ())
+    {
+      Target target;
+      struct TypeId::AttributeInformation info;
+      if (tid.LookupAttributeByName (m_name, &info)
+          && (info.flags & TypeId::ATTR_SET)
+          && info.accessor->HasSetter ())
+        {
+          target.value = info.checker->CreateValidValue (m_value);
+          if (target.value != 0)
+            {
+              target.accessor = info.accessor;
+            }
+        }
+      it = m_targets.insert (std::make_pair (tid.GetUid (), target)).first;
+    }
+  if (it->second.accessor == 0)
+    {
+      return false;
+    }
+  return it->second.accessor->Set (PeekPointer (object), *it->second.value);
+}
+
+/**
+ * \ingroup config-impl
+ * Helper to find a trace source on many objects, looking it up once per
+ * type of object.
+ */
+class TraceSourceFinder
+{
+public:
+  /**
+   * Construct from the trace source name.
+   *
+   * \param [in] name The name of the trace source.
+   */
+  TraceSourceFinder (std::string name);
+  /**
+   * Find the trace source of an object.
+   *
+   * \param [in] object The object.
+   * \returns The trace source accessor, or null if the object
+   *   has no such trace source.
+   */
+  Ptr<const TraceSourceAccessor> Find (Ptr<Object> object);
+
+private:
+  /** The name of the trace source. */
+  std::string m_name;
+  /** The trace source of each type seen so far, by TypeId uid. */
+  std::map<uint16_t, Ptr<const TraceSourceAccessor> > m_accessors;
+
+};  // class TraceSourceFinder
+
+TraceSourceFinder::TraceSourceFinder (std::string name)
+  : m_name (name)
+{
+  NS_LOG_FUNCTION (this << name);
+}
+Ptr<const TraceSourceAccessor>
+TraceSourceFinder::Find (Ptr<Object> object)
+{
+  NS_LOG_FUNCTION (this << object);
+  TypeId tid = object->GetInstanceTypeId ();
+  std::map<uint16_t, Ptr<const TraceSourceAccessor> >::iterator it = m_accessors.find (tid.GetUid ());
+  if (it == m_accessors.end ())
+    {
+      it = m_accessors.insert (std::make_pair (tid.GetUid (), tid.LookupTraceSourceByName (m_name))).first;
+    }
+  return it->second;
+}
+
 void
 MatchContainer::Set (std::string name, const AttributeValue &value)
 {
   NS_LOG_FUNCTION (this << name << &value);
+  AttributeSetter setter (name, value);
   for (Iterator tmp = Begin (); tmp != End (); ++tmp)
     {
       Ptr<Object> object = *tmp;
-      // Let ObjectBase::SetAttribute raise any errors
-      object->SetAttribute (name, value);
+      if (!setter.Set (object))
+        {
+          // Let ObjectBase::SetAttribute raise any errors
+          object->SetAttribute (name, value);
+        }
     }
 }
 bool
 MatchContainer::SetFailSafe (std::string name, const AttributeValue &value)
 {
   NS_LOG_FUNCTION (this << name << &value);
+  AttributeSetter setter (name, value);
   bool ok = false;
   for (Iterator tmp = Begin (); tmp != End (); ++tmp)
     {
       Ptr<Object> object = *tmp;
-      ok |= object->SetAttributeFailSafe (name, value);
+      ok |= setter.Set (object);
     }
   return ok;
 }
@@ -126,12 +261,17 @@ MatchContainer::ConnectFailSafe (std::string name, const CallbackBase &cb)
 {
   NS_LOG_FUNCTION (this << name << &cb);
   NS_ASSERT (m_objects.size () == m_contexts.size ());
+  TraceSourceFinder finder (name);
   bool ok = false;
   for (uint32_t i = 0; i < m_objects.size (); ++i)
     {
       Ptr<Object> object = m_objects[i];
-      std::string ctx = m_contexts[i] + name;
-      ok |= object->TraceConnect (name, ctx, cb);
+      Ptr<const TraceSourceAccessor> accessor = finder.Find (object);
+      if (accessor != 0)
+        {
+          std::string ctx = m_contexts[i] + name;
+          ok |= accessor->Connect (PeekPointer (object), ctx, cb);
+        }
     }
   return ok;
 }
@@ -147,11 +287,16 @@ bool
 MatchContainer::ConnectWithoutContextFailSafe (std::string name, const CallbackBase &cb)
 {
   NS_LOG_FUNCTION (this << name << &cb);
+  TraceSourceFinder finder (name);
   bool ok = false;
   for (Iterator tmp = Begin (); tmp != End (); ++tmp)
     {
       Ptr<Object> object = *tmp;
-      ok |= object->TraceConnectWithoutContext (name, cb);
+      Ptr<const TraceSourceAccessor> accessor = finder.Find (object);
+      if (accessor != 0)
+        {
+          ok |= accessor->ConnectWithoutContext (PeekPointer (object), cb);
+        }
     }
   return ok;
 }
@@ -160,21 +305,31 @@ MatchContainer::Disconnect (std::string name, const CallbackBase &cb)
 {
   NS_LOG_FUNCTION (this << name << &cb);
   NS_ASSERT (m_objects.size () == m_contexts.size ());
+  TraceSourceFinder finder (name);
   for (uint32_t i = 0; i < m_objects.size (); ++i)
     {
       Ptr<Object> object = m_objects[i];
-      std::string ctx = m_contexts[i] + name;
-      object->TraceDisconnect (name, ctx, cb);
+      Ptr<const TraceSourceAccessor> accessor = finder.Find (object);
+      if (accessor != 0)
+        {
+          std::string ctx = m_contexts[i] + name;
+          accessor->Disconnect (PeekPointer (object), ctx, cb);
+        }
     }
 }
 void
 MatchContainer::DisconnectWithoutContext (std::string name, const CallbackBase &cb)
 {
   NS_LOG_FUNCTION (this << name << &cb);
+  TraceSourceFinder finder (name);
   for (Iterator tmp = Begin (); tmp != End (); ++tmp)
     {
       Ptr<Object> object = *tmp;
-      object->TraceDisconnectWithoutContext (name, cb);
+      Ptr<const TraceSourceAccessor> accessor = finder.Find (object);
+      if (accessor != 0)
+        {
+          accessor->DisconnectWithoutContext (PeekPointer (object), cb);
+        }
     }
 }
 
@@ -182,10 +337,17 @@ MatchContainer::DisconnectWithoutContext (std::string name, const CallbackBase &
 /**
  * \ingroup config-impl
  * Helper to test if an array entry matches a config path specification.
+ *
+ * The specification is parsed once, into the list of index ranges it
+ * matches, so that large arrays can be matched without parsing it again
+ * for every entry.
  */
 class ArrayMatcher
 {
 public:
+  /** A range of matching indices, bounds included. */
+  typedef std::pair<std::size_t, std::size_t> Range;
+
   /**
    * Construct from a Config path specification.
    *
@@ -199,8 +361,25 @@ public:
    * \returns \c true if the index matches the Config Path.
    */
   bool Matches (std::size_t i) const;
+  /**
+   * \returns \c true if every index matches the Config Path.
+   */
+  bool MatchesAll (void) const;
+  /**
+   * Get the indices matching the Config Path, unless MatchesAll().
+   *
+   * \returns The sorted, disjoint ranges of matching indices.
+   */
+  const std::vector<Range> & GetRanges (void) const;
 
 private:
+  /**
+   * Add the indices matched by a Config path specification.
+   *
+   * \param [in] element The Config path specification, or a
+   *   part of it.
+   */
+  void Parse (std::string element);
   /**
    * Convert a string to an \c uint32_t.
    *
@@ -211,71 +390,89 @@ private:
   bool StringToUint32 (std::string str, uint32_t *value) const;
   /** The Config path element. */
   std::string m_element;
+  /** Whether the element is or contains "*". */
+  bool m_all;
+  /** The sorted, disjoint ranges of matching indices. */
+  std::vector<Range> m_ranges;
 
 };  // class ArrayMatcher
 
 
 ArrayMatcher::ArrayMatcher (std::string element)
-  : m_element (element)
+  : m_element (element),
+    m_all (false)
 {
   NS_LOG_FUNCTION (this << element);
+  Parse (element);
+  std::sort (m_ranges.begin (), m_ranges.end ());
+  std::vector<Range> merged;
+  for (std::vector<Range>::const_iterator i = m_ranges.begin (); i != m_ranges.end (); ++i)
+    {
+      if (!merged.empty () && i->first <= merged.back ().second + 1)
+        {
+          merged.back ().second = std::max (merged.back ().second, i->second);
+        }
+      else
+        {
+          merged.push_back (*i);
+        }
+    }
+  m_ranges.swap (merged);
 }
-bool
-ArrayMatcher::Matches (std::size_t i) const
+void
+ArrayMatcher::Parse (std::string element)
 {
-  NS_LOG_FUNCTION (this << i);
-  if (m_element == "*")
+  NS_LOG_FUNCTION (this << element);
+  if (element == "*")
     {
-      NS_LOG_DEBUG ("Array " << i << " matches *");
-      return true;
+      m_all = true;
+      return;
     }
   std::string::size_type tmp;
-  tmp = m_element.find ("|");
+  tmp = element.find ("|");
   if (tmp != std::string::npos)
     {
-      std::string left = m_element.substr (0, tmp - 0);
-      std::string right = m_element.substr (tmp + 1, m_element.size () - (tmp + 1));
-      ArrayMatcher matcher = ArrayMatcher (left);
-      if (matcher.Matches (i))
-        {
-          NS_LOG_DEBUG ("Array " << i << " matches " << left);
-          return true;
-        }
-      matcher = ArrayMatcher (right);
-      if (matcher.Matches (i))
-        {
-          NS_LOG_DEBUG ("Array " << i << " matches " << right);
-          return true;
-        }
-      NS_LOG_DEBUG ("Array " << i << " does not match " << m_element);
-      return false;
+      Parse (element.substr (0, tmp - 0));
+      Parse (element.substr (tmp + 1, element.size () - (tmp + 1)));
+      return;
     }
-  std::string::size_type leftBracket = m_element.find ("[");
-  std::string::size_type rightBracket = m_element.find ("]");
-  std::string::size_type dash = m_element.find ("-");
-  if (leftBracket == 0 && rightBracket == m_element.size () - 1
+  std::string::size_type leftBracket = element.find ("[");
+  std::string::size_type rightBracket = element.find ("]");
+  std::string::size_type dash = element.find ("-");
+  if (leftBracket == 0 && rightBracket == element.size () - 1
       && dash > leftBracket && dash < rightBracket)
     {
-      std::string lowerBound = m_element.substr (leftBracket + 1, dash - (leftBracket + 1));
-      std::string upperBound = m_element.substr (dash + 1, rightBracket - (dash + 1));
+      std::string lowerBound = element.substr (leftBracket + 1, dash - (leftBracket + 1));
+      std::string upperBound = element.substr (dash + 1, rightBracket - (dash + 1));
       uint32_t min;
       uint32_t max;
       if (StringToUint32 (lowerBound, &min)
           && StringToUint32 (upperBound, &max)
-          && i >= min && i <= max)
-        {
-          NS_LOG_DEBUG ("Array " << i << " matches " << m_element);
-          return true;
-        }
-      else
+          && min <= max)
         {
-          NS_LOG_DEBUG ("Array " << i << " does not " << m_element);
-          return false;
+          m_ranges.push_back (Range (min, max));
         }
+      return;
     }
   uint32_t value;
-  if (StringToUint32 (m_element, &value)
-      && i == value)
+  if (StringToUint32 (element, &value))
+    {
+      m_ranges.push_back (Range (value, value));
+    }
+}
+bool
+ArrayMatcher::Matches (std::size_t i) const
+{
+  NS_LOG_FUNCTION (this << i);
+  if (m_all)
+    {
+      NS_LOG_DEBUG ("Array " << i << " matches " << m_element);
+      return true;
+    }
+  std::vector<Range>::const_iterator range =
+    std::upper_bound (m_ranges.begin (), m_ranges.end (),
+                      Range (i, std::numeric_limits<std::size_t>::max ()));
+  if (range != m_ranges.begin () && i <= (--range)->second)
     {
       NS_LOG_DEBUG ("Array " << i << " matches " << m_element);
       return true;
@@ -283,6 +480,18 @@ ArrayMatcher::Matches (std::size_t i) const
   NS_LOG_DEBUG ("Array " << i << " does not match " << m_element);
   return false;
 }
+bool
+ArrayMatcher::MatchesAll (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_all;
+}
+const std::vector<ArrayMatcher::Range> &
+ArrayMatcher::GetRanges (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_ranges;
+}
 
 bool
 ArrayMatcher::StringToUint32 (std::string str, uint32_t *value) const
@@ -294,6 +503,247 @@ ArrayMatcher::StringToUint32 (std::string str, uint32_t *value) const
   return !iss.bad () && !iss.fail ();
 }
 
+/**
+ * \ingroup config-impl
+ * An element of a parsed Config path, with the lookups made while
+ * resolving it.
+ */
+struct PathSegment
+{
+  /**
+   * An attribute leading from an object to the next objects on the path.
+   */
+  struct Attribute
+  {
+    /** The attribute. */
+    struct TypeId::AttributeInformation info;
+    /** Whether the attribute is a pointer, or else a container. */
+    bool isPointer;
+  };
+  /** The matching attributes of a type. */
+  typedef std::vector<Attribute> Attributes;
+
+  /**
+   * Construct from a Config path element.
+   *
+   * \param [in] item The Config path element.
+   */
+  PathSegment (std::string item);
+
+  /**
+   * Get the pointer and container attributes of a type matching this
+   * element, looking them up on first use.
+   *
+   * \param [in] tid The type.
+   * \returns The matching attributes, in lookup order.
+   */
+  const Attributes & GetAttributes (TypeId tid);
+  /**
+   * Get the type named by a "$" element, looking it up on first use.
+   *
+   * \returns The type.
+   */
+  TypeId GetTypeId (void);
+
+  /** The Config path element. */
+  std::string item;
+  /** The element, as an index into a container. */
+  ArrayMatcher matcher;
+  /** Whether \c tid holds the type named by a "$" element. */
+  bool tidFound;
+  /** The type named by a "$" element. */
+  TypeId tid;
+  /** The matching attributes of the types seen so far, by TypeId uid. */
+  std::map<uint16_t, Attributes> attributes;
+};
+
+PathSegment::PathSegment (std::string item)
+  : item (item),
+    matcher (item),
+    tidFound (false)
+{
+  NS_LOG_FUNCTION (this << item);
+}
+
+const PathSegment::Attributes &
+PathSegment::GetAttributes (TypeId instanceTid)
+{
+  NS_LOG_FUNCTION (this << instanceTid);
+  std::map<uint16_t, Attributes>::iterator it = attributes.find (instanceTid.GetUid ());
+  if (it != attributes.end ())
+    {
+      return it->second;
+    }
+  Attributes &found = attributes[instanceTid.GetUid ()];
+  TypeId tid;
+  TypeId nextTid = instanceTid;
+  do
+    {
+      tid = nextTid;
+
+      for (uint32_t i = 0; i < tid.GetAttributeN (); i++)
+        {
+          Attribute attribute;
+          attribute.info = tid.GetAttribute (i);
+          if (attribute.info.name != item && item != "*")
+            {
+              continue;
+            }
+          // attempt to cast to a pointer checker.
+          if (dynamic_cast<const PointerChecker *> (PeekPointer (attribute.info.checker)) != 0)
+            {
+              attribute.isPointer = true;
+              found.push_back (attribute);
+            }
+          // attempt to cast to an object vector.
+          if (dynamic_cast<const ObjectPtrContainerChecker *> (PeekPointer (attribute.info.checker)) != 0)
+            {
+              attribute.isPointer = false;
+              found.push_back (attribute);
+            }
+          // this could be anything else and we don't know what to do with it.
+          // So, we just ignore it.
+        }
+
+      nextTid = tid.GetParent ();
+    }
+  while (nextTid != tid);
+  return found;
+}
+
+TypeId
+PathSegment::GetTypeId (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (!tidFound)
+    {
+      tid = TypeId::LookupByName (item.substr (1, item.size () - 1));
+      tidFound = true;
+    }
+  return tid;
+}
+
+/**
+ * \ingroup config-impl
+ * The implementation of Path: a parsed Config path.
+ */
+class PathImpl : public SimpleRefCount<PathImpl>
+{
+public:
+  /** The elements of a Config path. */
+  typedef std::vector<PathSegment> Segments;
+
+  /**
+   * Parse a Config path.
+   *
+   * \param [in] path The Config path.
+   */
+  PathImpl (std::string path);
+
+  /** The Config path, as given to the constructor. */
+  std::string m_path;
+  /** The elements of the whole path. */
+  Segments m_segments;
+  /** Whether the path holds a '/', so that m_root and m_leaf are set. */
+  bool m_hasLeaf;
+  /** The leading part of the path, up to the final slash. */
+  std::string m_root;
+  /** The elements of the leading part of the path. */
+  Segments m_rootSegments;
+  /** The trailing part of the path, after the final slash. */
+  std::string m_leaf;
+
+private:
+  /**
+   * Split a Config path into its elements.
+   *
+   * \param [in] path The Config path.
+   * \param [out] segments The elements of the path.
+   */
+  static void Split (std::string path, Segments *segments);
+};
+
+PathImpl::PathImpl (std::string path)
+  : m_path (path),
+    m_hasLeaf (false)
+{
+  NS_LOG_FUNCTION (this << path);
+  Split (path, &m_segments);
+  std::string::size_type slash = path.find_last_of ("/");
+  if (slash != std::string::npos)
+    {
+      m_hasLeaf = true;
+      m_root = path.substr (0, slash);
+      m_leaf = path.substr (slash + 1, path.size () - (slash + 1));
+      Split (m_root, &m_rootSegments);
+    }
+}
+
+void
+PathImpl::Split (std::string path, Segments *segments)
+{
+  NS_LOG_FUNCTION (path << segments);
+
+  // ensure that we start and end with a '/'
+  std::string::size_type tmp = path.find ("/");
+  if (tmp != 0)
+    {
+      // no slash at start
+      path = "/" + path;
+    }
+  tmp = path.find_last_of ("/");
+  if (tmp != (path.size () - 1))
+    {
+      // no slash at end
+      path = path + "/";
+    }
+
+  std::string::size_type start = 0;
+  std::string::size_type next = path.find ("/", 1);
+  while (next != std::string::npos)
+    {
+      segments->push_back (PathSegment (path.substr (start + 1, next - (start + 1))));
+      start = next;
+      next = path.find ("/", start + 1);
+    }
+}
+
+Path::Path ()
+{
+  NS_LOG_FUNCTION (this);
+}
+Path::Path (std::string path)
+  : m_impl (Create<PathImpl> (path))
+{
+  NS_LOG_FUNCTION (this << path);
+}
+Path::Path (const Path &o)
+  : m_impl (o.m_impl)
+{
+  NS_LOG_FUNCTION (this << &o);
+}
+Path &
+Path::operator = (const Path &o)
+{
+  NS_LOG_FUNCTION (this << &o);
+  m_impl = o.m_impl;
+  return *this;
+}
+Path::~Path ()
+{
+  NS_LOG_FUNCTION (this);
+}
+std::string
+Path::GetPath (void) const
+{
+  NS_LOG_FUNCTION (this);
+  if (m_impl == 0)
+    {
+      return "";
+    }
+  return m_impl->m_path;
+}
+
 /**
  * \ingroup config-impl
  * Abstract class to parse Config paths into object references.
@@ -302,11 +752,11 @@ class Resolver
 {
 public:
   /**
-   * Construct from a base Config path.
+   * Construct from a parsed Config path.
    *
-   * \param [in] path The Config path.
+   * \param [in] segments The elements of the Config path.
    */
-  Resolver (std::string path);
+  Resolver (PathImpl::Segments &segments);
   /** Destructor. */
   virtual ~Resolver ();
 
@@ -320,23 +770,32 @@ public:
   void Resolve (Ptr<Object> root);
 
 private:
-  /** Ensure the Config path starts and ends with a '/'. */
-  void Canonicalize (void);
   /**
    * Parse the next element in the Config path.
    *
-   * \param [in] path The remaining portion of the Config path.
+   * \param [in] segment The first element of the remaining portion
+   *                     of the Config path.
    * \param [in] root The object corresponding to the current position
    *                  in the Config path.
    */
-  void DoResolve (std::string path, Ptr<Object> root);
+  void DoResolve (std::size_t segment, Ptr<Object> root);
   /**
    * Parse an index on the Config path.
    *
-   * \param [in] path The remaining Config path.
-   * \param [in,out] vector The resulting list of matching objects.
+   * \param [in] segment The element of the Config path holding the index.
+   * \param [in] root The object holding the container attribute.
+   * \param [in] info The container attribute.
    */
-  void DoArrayResolve (std::string path, const ObjectPtrContainerValue &vector);
+  void DoArrayResolve (std::size_t segment, Ptr<Object> root,
+                       const struct TypeId::AttributeInformation &info);
+  /**
+   * Continue parsing the Config path past an array entry.
+   *
+   * \param [in] segment The element of the Config path past the index.
+   * \param [in] index The index of the array entry.
+   * \param [in] object The array entry.
+   */
+  void DoArrayResolveOne (std::size_t segment, std::size_t index, Ptr<Object> object);
   /**
    * Handle one object found on the path.
    *
@@ -359,47 +818,27 @@ private:
 
   /** Current list of path tokens. */
   std::vector<std::string> m_workStack;
-  /** The Config path. */
-  std::string m_path;
+  /** The elements of the Config path. */
+  PathImpl::Segments &m_segments;
 
 };  // class Resolver
 
-Resolver::Resolver (std::string path)
-  : m_path (path)
+Resolver::Resolver (PathImpl::Segments &segments)
+  : m_segments (segments)
 {
-  NS_LOG_FUNCTION (this << path);
-  Canonicalize ();
+  NS_LOG_FUNCTION (this << &segments);
 }
 Resolver::~Resolver ()
 {
   NS_LOG_FUNCTION (this);
 }
-void
-Resolver::Canonicalize (void)
-{
-  NS_LOG_FUNCTION (this);
-
-  // ensure that we start and end with a '/'
-  std::string::size_type tmp = m_path.find ("/");
-  if (tmp != 0)
-    {
-      // no slash at start
-      m_path = "/" + m_path;
-    }
-  tmp = m_path.find_last_of ("/");
-  if (tmp != (m_path.size () - 1))
-    {
-      // no slash at end
-      m_path = m_path + "/";
-    }
-}
 
 void
 Resolver::Resolve (Ptr<Object> root)
 {
   NS_LOG_FUNCTION (this << root);
 
-  DoResolve (m_path, root);
+  DoResolve (0, root);
 }
 
 std::string
@@ -425,13 +864,11 @@ Resolver::DoResolveOne (Ptr<Object> object)
 }
 
 void
-Resolver::DoResolve (std::string path, Ptr<Object> root)
+Resolver::DoResolve (std::size_t segment, Ptr<Object> root)
 {
-  NS_LOG_FUNCTION (this << path << root);
-  NS_ASSERT ((path.find ("/")) == 0);
-  std::string::size_type next = path.find ("/", 1);
+  NS_LOG_FUNCTION (this << segment << root);
 
-  if (next == std::string::npos)
+  if (segment == m_segments.size ())
     {
       //
       // If root is zero, we're beginning to see if we can use the object name
@@ -447,8 +884,8 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
         }
       return;
     }
-  std::string item = path.substr (1, next - 1);
-  std::string pathLeft = path.substr (next, path.size () - next);
+  PathSegment &current = m_segments[segment];
+  const std::string &item = current.item;
 
   //
   // If root is zero, we're beginning to see if we can use the object name
@@ -459,11 +896,10 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
   //
   if (root == 0)
     {
-      std::string::size_type offset = path.find ("/Names");
-      if (offset == 0)
+      if (item.compare (0, 5, "Names") == 0)
         {
           m_workStack.push_back (item);
-          DoResolve (pathLeft, root);
+          DoResolve (segment + 1, root);
           m_workStack.pop_back ();
           return;
         }
@@ -480,7 +916,7 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
     {
       NS_LOG_DEBUG ("Name system resolved item = " << item << " to " << namedObject);
       m_workStack.push_back (item);
-      DoResolve (pathLeft, namedObject);
+      DoResolve (segment + 1, namedObject);
       m_workStack.pop_back ();
       return;
     }
@@ -500,78 +936,59 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
   if (dollarPos == 0)
     {
       // This is a call to GetObject
-      std::string tidString = item.substr (1, item.size () - 1);
-      NS_LOG_DEBUG ("GetObject=" << tidString << " on path=" << GetResolvedPath ());
-      TypeId tid = TypeId::LookupByName (tidString);
-      Ptr<Object> object = root->GetObject<Object> (tid);
+      NS_LOG_DEBUG ("GetObject=" << item << " on path=" << GetResolvedPath ());
+      TypeId tid = current.GetTypeId ();
+      Ptr<Object> object = root->GetAggregate (tid);
       if (object == 0)
         {
-          NS_LOG_DEBUG ("GetObject (" << tidString << ") failed on path=" << GetResolvedPath ());
+          NS_LOG_DEBUG ("GetObject (" << item << ") failed on path=" << GetResolvedPath ());
           return;
         }
       m_workStack.push_back (item);
-      DoResolve (pathLeft, object);
+      DoResolve (segment + 1, object);
       m_workStack.pop_back ();
     }
   else
     {
       // this is a normal attribute.
-      TypeId tid;
-      TypeId nextTid = root->GetInstanceTypeId ();
+      const PathSegment::Attributes &attributes = current.GetAttributes (root->GetInstanceTypeId ());
       bool foundMatch = false;
-
-      do
+      for (PathSegment::Attributes::const_iterator i = attributes.begin (); i != attributes.end (); ++i)
         {
-          tid = nextTid;
-
-          for (uint32_t i = 0; i < tid.GetAttributeN (); i++)
+          const struct TypeId::AttributeInformation &info = i->info;
+          if (i->isPointer)
             {
-              struct TypeId::AttributeInformation info;
-              info = tid.GetAttribute (i);
-              if (info.name != item && item != "*")
+              NS_LOG_DEBUG ("GetAttribute(ptr)=" << info.name << " on path=" << GetResolvedPath ());
+              PointerValue pValue;
+              if (!(info.flags & TypeId::ATTR_GET)
+                  || !info.accessor->HasGetter ()
+                  || !info.accessor->Get (PeekPointer (root), pValue))
                 {
-                  continue;
-                }
-              // attempt to cast to a pointer checker.
-              const PointerChecker *pChecker = dynamic_cast<const PointerChecker *> (PeekPointer (info.checker));
-              if (pChecker != 0)
-                {
-                  NS_LOG_DEBUG ("GetAttribute(ptr)=" << info.name << " on path=" << GetResolvedPath ());
-                  PointerValue pValue;
+                  // Let ObjectBase::GetAttribute raise any errors
                   root->GetAttribute (info.name, pValue);
-                  Ptr<Object> object = pValue.Get<Object> ();
-                  if (object == 0)
-                    {
-                      NS_LOG_ERROR ("Requested object name=\"" << item <<
-                                    "\" exists on path=\"" << GetResolvedPath () << "\""
-                                    " but is null.");
-                      continue;
-                    }
-                  foundMatch = true;
-                  m_workStack.push_back (info.name);
-                  DoResolve (pathLeft, object);
-                  m_workStack.pop_back ();
                 }
-              // attempt to cast to an object vector.
-              const ObjectPtrContainerChecker *vectorChecker =
-                dynamic_cast<const ObjectPtrContainerChecker *> (PeekPointer (info.checker));
-              if (vectorChecker != 0)
+              Ptr<Object> object = pValue.Get<Object> ();
+              if (object == 0)
                 {
-                  NS_LOG_DEBUG ("GetAttribute(vector)=" << info.name << " on path=" << GetResolvedPath () << pathLeft);
-                  foundMatch = true;
-                  ObjectPtrContainerValue vector;
-                  root->GetAttribute (info.name, vector);
-                  m_workStack.push_back (info.name);
-                  DoArrayResolve (pathLeft, vector);
-                  m_workStack.pop_back ();
+                  NS_LOG_ERROR ("Requested object name=\"" << item <<
+                                "\" exists on path=\"" << GetResolvedPath () << "\""
+                                " but is null.");
+                  continue;
                 }
-              // this could be anything else and we don't know what to do with it.
-              // So, we just ignore it.
+              foundMatch = true;
+              m_workStack.push_back (info.name);
+              DoResolve (segment + 1, object);
+              m_workStack.pop_back ();
+            }
+          else
+            {
+              NS_LOG_DEBUG ("GetAttribute(vector)=" << info.name << " on path=" << GetResolvedPath ());
+              foundMatch = true;
+              m_workStack.push_back (info.name);
+              DoArrayResolve (segment + 1, root, info);
+              m_workStack.pop_back ();
             }
-
-          nextTid = tid.GetParent ();
         }
-      while (nextTid != tid);
 
       if (!foundMatch)
         {
@@ -582,34 +999,72 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
 }
 
 void
-Resolver::DoArrayResolve (std::string path, const ObjectPtrContainerValue &container)
+Resolver::DoArrayResolve (std::size_t segment, Ptr<Object> root,
+                          const struct TypeId::AttributeInformation &info)
 {
-  NS_LOG_FUNCTION (this << path << &container);
-  NS_ASSERT (path != "");
-  NS_ASSERT ((path.find ("/")) == 0);
-  std::string::size_type next = path.find ("/", 1);
-  if (next == std::string::npos)
+  NS_LOG_FUNCTION (this << segment << root << info.name);
+  if (segment == m_segments.size ())
     {
       return;
     }
-  std::string item = path.substr (1, next - 1);
-  std::string pathLeft = path.substr (next, path.size () - next);
 
-  ArrayMatcher matcher = ArrayMatcher (item);
+  const ArrayMatcher &matcher = m_segments[segment].matcher;
+  const ObjectPtrContainerAccessor *accessor =
+    dynamic_cast<const ObjectPtrContainerAccessor *> (PeekPointer (info.accessor));
+  std::size_t n;
+  if (accessor != 0 && (info.flags & TypeId::ATTR_GET)
+      && accessor->IsIndexedByPosition ()
+      && accessor->GetN (PeekPointer (root), &n))
+    {
+      // Fetch the matching entries straight from the container rather
+      // than copying all of them into an ObjectPtrContainerValue: with
+      // an explicit index, as in "/NodeList/12/", this is constant time.
+      std::size_t index;
+      if (matcher.MatchesAll ())
+        {
+          for (std::size_t i = 0; i < n; ++i)
+            {
+              Ptr<Object> object = accessor->GetItem (PeekPointer (root), i, &index);
+              DoArrayResolveOne (segment + 1, index, object);
+            }
+          return;
+        }
+      const std::vector<ArrayMatcher::Range> &ranges = matcher.GetRanges ();
+      for (std::vector<ArrayMatcher::Range>::const_iterator range = ranges.begin ();
+           range != ranges.end (); ++range)
+        {
+          for (std::size_t i = range->first; i < n && i <= range->second; ++i)
+            {
+              Ptr<Object> object = accessor->GetItem (PeekPointer (root), i, &index);
+              DoArrayResolveOne (segment + 1, index, object);
+            }
+        }
+      return;
+    }
+
+  ObjectPtrContainerValue container;
+  root->GetAttribute (info.name, container);
   ObjectPtrContainerValue::Iterator it;
   for (it = container.Begin (); it != container.End (); ++it)
     {
       if (matcher.Matches ((*it).first))
         {
-          std::ostringstream oss;
-          oss << (*it).first;
-          m_workStack.push_back (oss.str ());
-          DoResolve (pathLeft, (*it).second);
-          m_workStack.pop_back ();
+          DoArrayResolveOne (segment + 1, (*it).first, (*it).second);
         }
     }
 }
 
+void
+Resolver::DoArrayResolveOne (std::size_t segment, std::size_t index, Ptr<Object> object)
+{
+  NS_LOG_FUNCTION (this << segment << index << object);
+  std::ostringstream oss;
+  oss << index;
+  m_workStack.push_back (oss.str ());
+  DoResolve (segment, object);
+  m_workStack.pop_back ();
+}
+
 /**
  * \ingroup config-impl
  * Config system implementation class.
@@ -619,20 +1074,20 @@ class ConfigImpl : public Singleton<ConfigImpl>
 public:
   // Keep Set and SetFailSafe since their errors are triggered
   // by the underlying ObjecBase functions.
-  /** \copydoc ns3::Config::Set() */
-  void Set (std::string path, const AttributeValue &value);
-  /** \copydoc ns3::Config::SetFailSafe() */
-  bool SetFailSafe (std::string path, const AttributeValue &value);
-  /** \copydoc ns3::Config::ConnectWithoutContextFailSafe() */
-  bool ConnectWithoutContextFailSafe (std::string path, const CallbackBase &cb);
-  /** \copydoc ns3::Config::ConnectFailSafe() */
-  bool ConnectFailSafe (std::string path, const CallbackBase &cb);
-  /** \copydoc ns3::Config::DisconnectWithoutContext() */
-  void DisconnectWithoutContext (std::string path, const CallbackBase &cb);
-  /** \copydoc ns3::Config::Disconnect() */
-  void Disconnect (std::string path, const CallbackBase &cb);
-  /** \copydoc ns3::Config::LookupMatches() */
-  MatchContainer LookupMatches (std::string path);
+  /** \copydoc ns3::Config::Set(const Path&,const AttributeValue&) */
+  void Set (const Path &path, const AttributeValue &value);
+  /** \copydoc ns3::Config::SetFailSafe(const Path&,const AttributeValue&) */
+  bool SetFailSafe (const Path &path, const AttributeValue &value);
+  /** \copydoc ns3::Config::ConnectWithoutContextFailSafe(const Path&,const CallbackBase&) */
+  bool ConnectWithoutContextFailSafe (const Path &path, const CallbackBase &cb);
+  /** \copydoc ns3::Config::ConnectFailSafe(const Path&,const CallbackBase&) */
+  bool ConnectFailSafe (const Path &path, const CallbackBase &cb);
+  /** \copydoc ns3::Config::DisconnectWithoutContext(const Path&,const CallbackBase&) */
+  void DisconnectWithoutContext (const Path &path, const CallbackBase &cb);
+  /** \copydoc ns3::Config::Disconnect(const Path&,const CallbackBase&) */
+  void Disconnect (const Path &path, const CallbackBase &cb);
+  /** \copydoc ns3::Config::LookupMatches(const Path&) */
+  MatchContainer LookupMatches (const Path &path);
 
   /** \copydoc ns3::Config::RegisterRootNamespaceObject() */
   void RegisterRootNamespaceObject (Ptr<Object> obj);
@@ -646,13 +1101,18 @@ public:
 
 private:
   /**
-   * Break a Config path into the leading path and the last leaf token.
+   * Get the implementation of a path holding a leaf token.
    * \param [in] path The Config path.
-   * \param [in,out] root The leading part of the \pname{path},
-   *   up to the final slash.
-   * \param [in,out] leaf The trailing part of the \pname{path}.
+   * \returns The parsed path.
    */
-  void ParsePath (std::string path, std::string *root, std::string *leaf) const;
+  PathImpl & GetLeafPath (const Path &path) const;
+  /**
+   * Find the objects matching a parsed path.
+   * \param [in] path The Config path, as a string.
+   * \param [in] segments The elements of the path.
+   * \returns The matching objects.
+   */
+  MatchContainer DoLookupMatches (std::string path, PathImpl::Segments &segments);
 
   /** Container type to hold the root Config path tokens. */
   typedef std::vector<Ptr<Object> > Roots;
@@ -662,100 +1122,103 @@ private:
 
 };  // class ConfigImpl
 
-void
-ConfigImpl::ParsePath (std::string path, std::string *root, std::string *leaf) const
+PathImpl &
+ConfigImpl::GetLeafPath (const Path &path) const
 {
-  NS_LOG_FUNCTION (this << path << root << leaf);
-
-  std::string::size_type slash = path.find_last_of ("/");
-  NS_ASSERT (slash != std::string::npos);
-  *root = path.substr (0, slash);
-  *leaf = path.substr (slash + 1, path.size () - (slash + 1));
-  NS_LOG_FUNCTION (path << *root << *leaf);
+  NS_LOG_FUNCTION (this << path.GetPath ());
+  NS_ASSERT (path.m_impl != 0 && path.m_impl->m_hasLeaf);
+  NS_LOG_FUNCTION (path.m_impl->m_path << path.m_impl->m_root << path.m_impl->m_leaf);
+  return *path.m_impl;
 }
 
 void
-ConfigImpl::Set (std::string path, const AttributeValue &value)
+ConfigImpl::Set (const Path &path, const AttributeValue &value)
 {
-  NS_LOG_FUNCTION (this << path << &value);
+  NS_LOG_FUNCTION (this << path.GetPath () << &value);
 
-  std::string root, leaf;
-  ParsePath (path, &root, &leaf);
-  MatchContainer container = LookupMatches (root);
-  container.Set (leaf, value);
+  PathImpl &impl = GetLeafPath (path);
+  MatchContainer container = DoLookupMatches (impl.m_root, impl.m_rootSegments);
+  container.Set (impl.m_leaf, value);
 }
 bool
-ConfigImpl::SetFailSafe (std::string path, const AttributeValue &value)
+ConfigImpl::SetFailSafe (const Path &path, const AttributeValue &value)
 {
-  NS_LOG_FUNCTION (this << path << &value);
+  NS_LOG_FUNCTION (this << path.GetPath () << &value);
 
-  std::string root, leaf;
-  ParsePath (path, &root, &leaf);
-  MatchContainer container = LookupMatches (root);
-  return container.SetFailSafe (leaf, value);
+  PathImpl &impl = GetLeafPath (path);
+  MatchContainer container = DoLookupMatches (impl.m_root, impl.m_rootSegments);
+  return container.SetFailSafe (impl.m_leaf, value);
 }
 bool
-ConfigImpl::ConnectWithoutContextFailSafe (std::string path, const CallbackBase &cb)
+ConfigImpl::ConnectWithoutContextFailSafe (const Path &path, const CallbackBase &cb)
 {
-  NS_LOG_FUNCTION (this << path << &cb);
-  std::string root, leaf;
-  ParsePath (path, &root, &leaf);
-  MatchContainer container = LookupMatches (root);
-  return container.ConnectWithoutContextFailSafe (leaf, cb);
+  NS_LOG_FUNCTION (this << path.GetPath () << &cb);
+  PathImpl &impl = GetLeafPath (path);
+  MatchContainer container = DoLookupMatches (impl.m_root, impl.m_rootSegments);
+  return container.ConnectWithoutContextFailSafe (impl.m_leaf, cb);
 }
 void
-ConfigImpl::DisconnectWithoutContext (std::string path, const CallbackBase &cb)
+ConfigImpl::DisconnectWithoutContext (const Path &path, const CallbackBase &cb)
 {
-  NS_LOG_FUNCTION (this << path << &cb);
-  std::string root, leaf;
-  ParsePath (path, &root, &leaf);
-  MatchContainer container = LookupMatches (root);
+  NS_LOG_FUNCTION (this << path.GetPath () << &cb);
+  PathImpl &impl = GetLeafPath (path);
+  MatchContainer container = DoLookupMatches (impl.m_root, impl.m_rootSegments);
   if (container.GetN () == 0)
     {
-      std::size_t lastFwdSlash = root.rfind ("/");
-      NS_LOG_WARN ("Failed to disconnect " << leaf
-                                           << ", the Requested object name = " << root.substr (lastFwdSlash + 1)
-                                           << " does not exits on path " << root.substr (0, lastFwdSlash));
+      std::size_t lastFwdSlash = impl.m_root.rfind ("/");
+      NS_LOG_WARN ("Failed to disconnect " << impl.m_leaf
+                                           << ", the Requested object name = " << impl.m_root.substr (lastFwdSlash + 1)
+                                           << " does not exits on path " << impl.m_root.substr (0, lastFwdSlash));
     }
-  container.DisconnectWithoutContext (leaf, cb);
+  container.DisconnectWithoutContext (impl.m_leaf, cb);
 }
 bool
-ConfigImpl::ConnectFailSafe (std::string path, const CallbackBase &cb)
+ConfigImpl::ConnectFailSafe (const Path &path, const CallbackBase &cb)
 {
-  NS_LOG_FUNCTION (this << path << &cb);
+  NS_LOG_FUNCTION (this << path.GetPath () << &cb);
 
-  std::string root, leaf;
-  ParsePath (path, &root, &leaf);
-  MatchContainer container = LookupMatches (root);
-  return container.ConnectFailSafe (leaf, cb);
+  PathImpl &impl = GetLeafPath (path);
+  MatchContainer container = DoLookupMatches (impl.m_root, impl.m_rootSegments);
+  return container.ConnectFailSafe (impl.m_leaf, cb);
 }
 void
-ConfigImpl::Disconnect (std::string path, const CallbackBase &cb)
+ConfigImpl::Disconnect (const Path &path, const CallbackBase &cb)
 {
-  NS_LOG_FUNCTION (this << path << &cb);
+  NS_LOG_FUNCTION (this << path.GetPath () << &cb);
 
-  std::string root, leaf;
-  ParsePath (path, &root, &leaf);
-  MatchContainer container = LookupMatches (root);
+  PathImpl &impl = GetLeafPath (path);
+  MatchContainer container = DoLookupMatches (impl.m_root, impl.m_rootSegments);
   if (container.GetN () == 0)
     {
-      std::size_t lastFwdSlash = root.rfind ("/");
-      NS_LOG_WARN ("Failed to disconnect " << leaf
-                                           << ", the Requested object name = " << root.substr (lastFwdSlash + 1)
-                                           << " does not exits on path " << root.substr (0, lastFwdSlash));
+      std::size_t lastFwdSlash = impl.m_root.rfind ("/");
+      NS_LOG_WARN ("Failed to disconnect " << impl.m_leaf
+                                           << ", the Requested object name = " << impl.m_root.substr (lastFwdSlash + 1)
+                                           << " does not exits on path " << impl.m_root.substr (0, lastFwdSlash));
     }
-  container.Disconnect (leaf, cb);
+  container.Disconnect (impl.m_leaf, cb);
 }
 
 MatchContainer
-ConfigImpl::LookupMatches (std::string path)
+ConfigImpl::LookupMatches (const Path &path)
 {
-  NS_LOG_FUNCTION (this << path);
+  NS_LOG_FUNCTION (this << path.GetPath ());
+  if (path.m_impl == 0)
+    {
+      Path empty ("");
+      return DoLookupMatches ("", empty.m_impl->m_segments);
+    }
+  return DoLookupMatches (path.m_impl->m_path, path.m_impl->m_segments);
+}
+
+MatchContainer
+ConfigImpl::DoLookupMatches (std::string path, PathImpl::Segments &segments)
+{
+  NS_LOG_FUNCTION (this << path << &segments);
   class LookupMatchesResolver : public Resolver
   {
 public:
-    LookupMatchesResolver (std::string path)
-      : Resolver (path)
+    LookupMatchesResolver (PathImpl::Segments &segments)
+      : Resolver (segments)
     {
     }
     virtual void DoOne (Ptr<Object> object, std::string path)
@@ -765,7 +1228,7 @@ public:
     }
     std::vector<Ptr<Object> > m_objects;
     std::vector<std::string> m_contexts;
-  } resolver = LookupMatchesResolver (path);
+  } resolver = LookupMatchesResolver (segments);
   for (Roots::const_iterator i = m_roots.begin (); i != m_roots.end (); i++)
     {
       resolver.Resolve (*i);
@@ -817,6 +1280,67 @@ ConfigImpl::GetRootNamespaceObject (std::size_t i) const
 }
 
 
+void
+Path::Set (const AttributeValue &value) const
+{
+  NS_LOG_FUNCTION (this << GetPath () << &value);
+  ConfigImpl::Get ()->Set (*this, value);
+}
+bool
+Path::SetFailSafe (const AttributeValue &value) const
+{
+  NS_LOG_FUNCTION (this << GetPath () << &value);
+  return ConfigImpl::Get ()->SetFailSafe (*this, value);
+}
+void
+Path::ConnectWithoutContext (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << GetPath () << &cb);
+  if (!ConnectWithoutContextFailSafe (cb))
+    {
+      NS_FATAL_ERROR ("Could not connect callback to " << GetPath ());
+    }
+}
+bool
+Path::ConnectWithoutContextFailSafe (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << GetPath () << &cb);
+  return ConfigImpl::Get ()->ConnectWithoutContextFailSafe (*this, cb);
+}
+void
+Path::DisconnectWithoutContext (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << GetPath () << &cb);
+  ConfigImpl::Get ()->DisconnectWithoutContext (*this, cb);
+}
+void
+Path::Connect (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << GetPath () << &cb);
+  if (!ConnectFailSafe (cb))
+    {
+      NS_FATAL_ERROR ("Could not connect callback to " << GetPath ());
+    }
+}
+bool
+Path::ConnectFailSafe (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << GetPath () << &cb);
+  return ConfigImpl::Get ()->ConnectFailSafe (*this, cb);
+}
+void
+Path::Disconnect (const CallbackBase &cb) const
+{
+  NS_LOG_FUNCTION (this << GetPath () << &cb);
+  ConfigImpl::Get ()->Disconnect (*this, cb);
+}
+MatchContainer
+Path::LookupMatches (void) const
+{
+  NS_LOG_FUNCTION (this << GetPath ());
+  return ConfigImpl::Get ()->LookupMatches (*this);
+}
+
 void Reset (void)
 {
   NS_LOG_FUNCTION_NOARGS ();
@@ -839,12 +1363,12 @@ void Reset (void)
 void Set (std::string path, const AttributeValue &value)
 {
   NS_LOG_FUNCTION (path << &value);
-  ConfigImpl::Get ()->Set (path, value);
+  ConfigImpl::Get ()->Set (Path (path), value);
 }
 bool SetFailSafe (std::string path, const AttributeValue &value)
 {
   NS_LOG_FUNCTION (path << &value);
-  return ConfigImpl::Get ()->SetFailSafe (path, value);
+  return ConfigImpl::Get ()->SetFailSafe (Path (path), value);
 }
 void SetDefault (std::string name, const AttributeValue &value)
 {
@@ -874,7 +1398,7 @@ bool SetDefaultFailSafe (std::string fullName, const AttributeValue &value)
   tid.LookupAttributeByName(paramName, &info);
   for (uint32_t j = 0; j < tid.GetAttributeN (); j++)
     {
-      struct TypeId::AttributeInformation tmp = tid.GetAttribute (j);
+      const struct TypeId::AttributeInformation &tmp = tid.GetAttribute (j);
       if (tmp.name == paramName)
         {
           Ptr<AttributeValue> v = tmp.checker->CreateValidValue (value);
@@ -901,46 +1425,40 @@ bool SetGlobalFailSafe (std::string name, const AttributeValue &value)
 void ConnectWithoutContext (std::string path, const CallbackBase &cb)
 {
   NS_LOG_FUNCTION (path << &cb);
-  if (!ConnectWithoutContextFailSafe (path, cb))
-    {
-      NS_FATAL_ERROR ("Could not connect callback to " << path);
-    }
+  Path (path).ConnectWithoutContext (cb);
 }
 bool ConnectWithoutContextFailSafe (std::string path, const CallbackBase &cb)
 {
   NS_LOG_FUNCTION (path << &cb);
-  return ConfigImpl::Get ()->ConnectWithoutContextFailSafe (path, cb);
+  return ConfigImpl::Get ()->ConnectWithoutContextFailSafe (Path (path), cb);
 }
 void DisconnectWithoutContext (std::string path, const CallbackBase &cb)
 {
   NS_LOG_FUNCTION (path << &cb);
-  ConfigImpl::Get ()->DisconnectWithoutContext (path, cb);
+  ConfigImpl::Get ()->DisconnectWithoutContext (Path (path), cb);
 }
 void
 Connect (std::string path, const CallbackBase &cb)
 {
   NS_LOG_FUNCTION (path << &cb);
-  if (!ConnectFailSafe (path, cb))
-    {
-      NS_FATAL_ERROR ("Could not connect callback to " << path);
-    }
+  Path (path).Connect (cb);
 }
 bool
 ConnectFailSafe (std::string path, const CallbackBase &cb)
 {
   NS_LOG_FUNCTION (path << &cb);
-  return ConfigImpl::Get ()->ConnectFailSafe (path, cb);
+  return ConfigImpl::Get ()->ConnectFailSafe (Path (path), cb);
 }
 void
 Disconnect (std::string path, const CallbackBase &cb)
 {
   NS_LOG_FUNCTION (path << &cb);
-  ConfigImpl::Get ()->Disconnect (path, cb);
+  ConfigImpl::Get ()->Disconnect (Path (path), cb);
 }
 MatchContainer LookupMatches (std::string path)
 {
   NS_LOG_FUNCTION (path);
-  return ConfigImpl::Get ()->LookupMatches (path);
+  return ConfigImpl::Get ()->LookupMatches (Path (path));
 }
 
 void RegisterRootNamespaceObject (Ptr<Object> obj)
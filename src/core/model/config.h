@@ -48,6 +48,101 @@ class CallbackBase;
  */
 namespace Config {
 
+class PathImpl;
+class MatchContainer;
+
+/**
+ * \ingroup config
+ * \brief A Config path, parsed once for repeated use.
+ *
+ * The functions of the Config namespace taking the path as a string
+ * parse it anew at every call, and look up again the TypeIds and
+ * attributes named along the path for every object they traverse.
+ * A Path is parsed when it is constructed, and caches these lookups
+ * while it is resolved, so that setting or connecting the same path many
+ * times, or through wildcards matching many objects, is cheaper:
+ *
+ * \code
+ *   Config::Path txPower ("/NodeList/[0-999]/DeviceList/0/$ns3::WifiNetDevice/Phy/TxPowerStart");
+ *   txPower.Set (DoubleValue (10));
+ * \endcode
+ *
+ * Copies of a Path share the parsed path and its caches.
+ */
+class Path
+{
+public:
+  /** Create an empty path. */
+  Path ();
+  /**
+   * Parse a Config path.
+   *
+   * \param [in] path The Config path, as accepted by the functions of
+   *   the Config namespace.
+   */
+  explicit Path (std::string path);
+  /**
+   * Copy constructor.
+   * \param [in] o The path to copy.
+   */
+  Path (const Path &o);
+  /**
+   * Assignment operator.
+   * \param [in] o The path to copy.
+   * \returns This path.
+   */
+  Path & operator = (const Path &o);
+  /** Destructor. */
+  ~Path ();
+
+  /**
+   * \returns The Config path, as given to the constructor.
+   */
+  std::string GetPath (void) const;
+
+  /**
+   * \copydoc Config::Set(std::string,const AttributeValue&)
+   */
+  void Set (const AttributeValue &value) const;
+  /**
+   * \copydoc Config::SetFailSafe(std::string,const AttributeValue&)
+   */
+  bool SetFailSafe (const AttributeValue &value) const;
+  /**
+   * \copydoc Config::ConnectWithoutContext(std::string,const CallbackBase&)
+   */
+  void ConnectWithoutContext (const CallbackBase &cb) const;
+  /**
+   * \copydoc Config::ConnectWithoutContextFailSafe(std::string,const CallbackBase&)
+   */
+  bool ConnectWithoutContextFailSafe (const CallbackBase &cb) const;
+  /**
+   * \copydoc Config::DisconnectWithoutContext(std::string,const CallbackBase&)
+   */
+  void DisconnectWithoutContext (const CallbackBase &cb) const;
+  /**
+   * \copydoc Config::Connect(std::string,const CallbackBase&)
+   */
+  void Connect (const CallbackBase &cb) const;
+  /**
+   * \copydoc Config::ConnectFailSafe(std::string,const CallbackBase&)
+   */
+  bool ConnectFailSafe (const CallbackBase &cb) const;
+  /**
+   * \copydoc Config::Disconnect(std::string,const CallbackBase&)
+   */
+  void Disconnect (const CallbackBase &cb) const;
+  /**
+   * \copydoc Config::LookupMatches(std::string)
+   */
+  MatchContainer LookupMatches (void) const;
+
+private:
+  friend class ConfigImpl;
+  /** The parsed path and its lookup caches. */
+  Ptr<PathImpl> m_impl;
+};
+
 /**
  * \ingroup config
  * Reset the initial value of every attribute as well as the value of every
@@ -187,7 +282,10 @@ void Disconnect (std::string path, const CallbackBase &cb);
  *
  * This class also allows you to perform a set of configuration operations
  * on the set of matching objects stored in the container. Specifically,
- * it is possible to perform bulk Connects and Sets.
+ * it is possible to perform bulk Connects and Sets.  The path is resolved
+ * only once for all these operations, and each of them looks the attribute
+ * or trace source up once per type of the matching objects rather than
+ * once per object.
  */
 class MatchContainer
 {
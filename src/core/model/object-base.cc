@@ -44,13 +44,14 @@ NS_OBJECT_ENSURE_REGISTERED (ObjectBase);
 namespace {
 
 /**
- * Get key, value pairs from the "NS_ATTRIBUTE_DEFAULT" environment variable.
+ * Get the key, value pairs of the "NS_ATTRIBUTE_DEFAULT" environment
+ * variable, parsing it on the first call.
  *
- * \param [in] key The key to search for.
- * \return \c true if the key was found, and the associated value.
+ * \return The dictionary; the empty key is present if the variable is
+ * not set.
  */
-std::pair<bool, std::string>
-EnvDictionary (std::string key)
+const std::unordered_map<std::string, std::string> &
+EnvDictionary (void)
 {
   static std::unordered_map<std::string, std::string> dict;
 
@@ -82,6 +83,19 @@ EnvDictionary (std::string key)
           dict.insert ({"", ""});
         }
     }
+  return dict;
+}
+
+/**
+ * Get key, value pairs from the "NS_ATTRIBUTE_DEFAULT" environment variable.
+ *
+ * \param [in] key The key to search for.
+ * \return \c true if the key was found, and the associated value.
+ */
+std::pair<bool, std::string>
+EnvDictionary (std::string key)
+{
+  const std::unordered_map<std::string, std::string> &dict = EnvDictionary ();
 
   std::string value;
   bool found {false};
@@ -161,14 +175,19 @@ ObjectBase::ConstructSelf (const AttributeConstructionList &attributes)
   // loop over the inheritance tree back to the Object base class.
   NS_LOG_FUNCTION (this << &attributes);
   TypeId tid = GetInstanceTypeId ();
+  // Only build the full attribute names if some defaults come from the
+  // environment: the dictionary then holds more than the empty key.
+  const std::unordered_map<std::string, std::string> &env = EnvDictionary ();
+  bool envDefaults = env.size () != 1 || env.count ("") == 0;
   do    // Do this tid and all parents
     {
       // loop over all attributes in object type
+      std::size_t n = tid.GetAttributeN ();
       NS_LOG_DEBUG ("construct tid=" << tid.GetName () << 
-                    ", params=" << tid.GetAttributeN ());
-      for (uint32_t i = 0; i < tid.GetAttributeN (); i++)
+                    ", params=" << n);
+      for (std::size_t i = 0; i < n; i++)
         {
-          struct TypeId::AttributeInformation info = tid.GetAttribute (i);
+          const struct TypeId::AttributeInformation &info = tid.GetAttribute (i);
           NS_LOG_DEBUG ("try to construct \"" << tid.GetName () << "::" <<
                         info.name << "\"");
 
@@ -198,7 +217,7 @@ ObjectBase::ConstructSelf (const AttributeConstructionList &attributes)
                 }
             }
 
-          if (!value)
+          if (!value && envDefaults)
             {
               auto [found, val] = EnvDictionary (tid.GetAttributeFullName (i));
               if (found)
@@ -229,6 +229,34 @@ public:
   virtual bool HasGetter (void) const;
   virtual bool HasSetter (void) const;
 
+  /**
+   * Get the number of instances in the container, without copying
+   * them into an ObjectPtrContainerValue.
+   *
+   * \param [in] object The container object.
+   * \param [out] n The number of instances in the container.
+   * \returns true if the value could be obtained successfully.
+   */
+  bool GetN (const ObjectBase *object, std::size_t *n) const;
+  /**
+   * Get a single instance from the container, without copying
+   * the others into an ObjectPtrContainerValue.
+   *
+   * \param [in] object The container object.
+   * \param [in] i The position of the instance, less than GetN().
+   * \param [out] index The index of the instance.
+   * \returns The instance.
+   */
+  Ptr<Object> GetItem (const ObjectBase *object, std::size_t i, std::size_t *index) const;
+  /**
+   * Whether the index of every instance is its position in the
+   * container, as for vectors, so that the instance of a given index
+   * can be fetched directly with GetItem().
+   *
+   * \returns true if the instance at position \c i always has index \c i.
+   */
+  virtual bool IsIndexedByPosition (void) const;
+
 private:
   /**
    * Get the number of instances in the container.
@@ -272,6 +300,10 @@ MakeObjectPtrContainerAccessor (Ptr<U> (T::*get)(INDEX) const,
       *index = i;
       return (obj->*m_get)(i);
     }
+    virtual bool IsIndexedByPosition (void) const
+    {
+      return true;
+    }
     Ptr<U> (T::*m_get)(INDEX) const;
     INDEX (T::*m_getN)(void) const;
   } *spec = new MemberGetters ();
@@ -204,6 +204,13 @@ restart:
         }
     }
 }
+Ptr<Object>
+Object::GetAggregate (TypeId tid) const
+{
+  NS_LOG_FUNCTION (this << tid);
+  return GetObject<Object> (tid);
+}
+
 bool
 Object::IsInitialized (void) const
 {
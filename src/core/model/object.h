@@ -210,6 +210,19 @@ public:
    */
   AggregateIterator GetAggregateIterator (void) const;
 
+  /**
+   * Get the Object of a given type aggregated to this one.
+   *
+   * This is equivalent to GetObject (tid), and is what Config path
+   * resolution uses for the "$" elements of the paths.  Subclasses which
+   * keep an index of their aggregated Objects, such as ns3::Node, can
+   * override it to look them up faster.
+   *
+   * \param [in] tid The TypeId of the requested Object.
+   * eturns The aggregated Object, or 0 if there is none.
+   */
+  virtual Ptr<Object> GetAggregate (TypeId tid) const;
+
   /**
    * Invoke DoInitialize on all Objects aggregated to this one.
    *
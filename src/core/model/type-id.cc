@@ -24,6 +24,7 @@
 #include "trace-source-accessor.h"
 
 #include <map>
+#include <deque>
 #include <vector>
 #include <sstream>
 #include <iomanip>
@@ -50,8 +51,20 @@ NS_LOG_COMPONENT_DEFINE ("TypeId");
  * \ingroup object
  * \brief TypeId information manager
  *
- * Information records are stored in a vector.  Name and hash lookup
- * are performed by maps to the vector index.
+ * Information records are stored in a deque, so that references to
+ * them, and to their attribute and trace source records, stay valid as
+ * new types are registered.  Name lookup uses an open addressing
+ * table of type ids keyed by the hash of the name, and hash lookup a
+ * map to the type id.
+ *
+ * Each type also has lazily built open addressing indexes of the
+ * attributes and trace sources declared by the type and its parents,
+ * keyed by the hash of the member name.  Any registration changing the
+ * members of a type or its parents invalidates all these indexes, by
+ * bumping a generation counter; they are therefore built once, on the
+ * first lookup after the types are registered, and a lookup by name
+ * costs one hash of the name, a few integer compares and a single
+ * string compare.
  *
  * \internal
  * <b>Hash Chaining</b>
@@ -228,7 +241,14 @@ public:
    * \param [in] i Index into attribute array
    * \returns The information associated to attribute whose index is \pname{i}.
    */
-  struct TypeId::AttributeInformation GetAttribute (uint16_t uid, std::size_t i) const;
+  const struct TypeId::AttributeInformation & GetAttribute (uint16_t uid, std::size_t i) const;
+  /**
+   * Find an Attribute of a type or of its parents by name.
+   * \param [in] uid The id.
+   * \param [in] name The Attribute name.
+   * \returns The Attribute information, or null if not found.
+   */
+  const struct TypeId::AttributeInformation * FindAttribute (uint16_t uid, const std::string &name);
   /**
    * Record a new TraceSource.
    * \param [in] uid The id.
@@ -262,7 +282,14 @@ public:
    * \param [in] i Index into trace source array.
    * \returns Detailed information about the requested trace source.
    */
-  struct TypeId::TraceSourceInformation GetTraceSource (uint16_t uid, std::size_t i) const;
+  const struct TypeId::TraceSourceInformation & GetTraceSource (uint16_t uid, std::size_t i) const;
+  /**
+   * Find a TraceSource of a type or of its parents by name.
+   * \param [in] uid The id.
+   * \param [in] name The TraceSource name.
+   * \returns The TraceSource information, or null if not found.
+   */
+  const struct TypeId::TraceSourceInformation * FindTraceSource (uint16_t uid, const std::string &name);
   /**
    * Check if this TypeId should not be listed in documentation.
    * \param [in] uid The id.
@@ -292,11 +319,35 @@ private:
    */
   static TypeId::hash_t Hasher (const std::string name);
 
+  /** An entry of a MemberIndex. */
+  struct MemberSlot
+  {
+    /** The hash of the member name. */
+    uint32_t hash;
+    /** The type declaring the member; 0 if the slot is empty. */
+    uint16_t owner;
+    /** The index of the member in the declaring type. */
+    uint16_t index;
+  };
+  /**
+   * Open addressing index, by name, of the attributes or of the trace
+   * sources of a type and of its parents.
+   */
+  struct MemberIndex
+  {
+    /** The value of m_generation when the index was built. */
+    uint32_t generation;
+    /** The slots; their number is a power of two. */
+    std::vector<struct MemberSlot> slots;
+  };
+
   /** The information record about a single type id. */
   struct IidInformation
   {
     /** The type id name. */
     std::string name;
+    /** The hash of the name, unaffected by chaining. */
+    uint32_t nameHash;
     /** The type id hash value. */
     TypeId::hash_t hash;
     /** The parent type id. */
@@ -319,9 +370,13 @@ private:
     TypeId::SupportLevel supportLevel;
     /** Support message. */
     std::string supportMsg;
+    /** The index of the attributes of this type and its parents. */
+    struct MemberIndex attributeIndex;
+    /** The index of the trace sources of this type and its parents. */
+    struct MemberIndex traceSourceIndex;
   };
   /** Iterator type. */
-  typedef std::vector<struct IidInformation>::const_iterator Iterator;
+  typedef std::deque<struct IidInformation>::const_iterator Iterator;
 
   /**
    * Retrieve the information record for a type.
@@ -330,13 +385,44 @@ private:
    */
   struct IidManager::IidInformation * LookupInformation (uint16_t uid) const;
 
+  /**
+   * Add a type id to the by-name index, growing it if needed.
+   * \param [in] uid The id.
+   */
+  void InsertName (uint16_t uid);
+
+  /**
+   * Find a member (attribute or trace source) of a type or of its
+   * parents by name, (re)building the member index of the type if
+   * needed.
+   * \tparam T \ingroup object
+   *           The member information type.
+   * \param [in] uid The id.
+   * \param [in] name The member name.
+   * \param [in] members The container of members of IidInformation.
+   * \param [in] index The MemberIndex of IidInformation for these members.
+   * \returns The member information, or null if not found.
+   */
+  template <typename T>
+  const T * FindMember (uint16_t uid, const std::string &name,
+                        std::vector<T> IidInformation::*members,
+                        struct MemberIndex IidInformation::*index);
+
   /** The container of all type id records. */
-  std::vector<struct IidInformation> m_information;
+  std::deque<struct IidInformation> m_information;
 
-  /** Type of the by-name index. */
-  typedef std::map<std::string, uint16_t> namemap_t;
-  /** The by-name index. */
-  namemap_t m_namemap;
+  /**
+   * The by-name index: open addressing table of type ids, keyed by
+   * IidInformation::nameHash, 0 marking empty slots.  Its size is a
+   * power of two, at least twice the number of types.
+   */
+  std::vector<uint16_t> m_nameIndex;
+
+  /**
+   * Generation of the member indexes, bumped by any change of the
+   * attributes, trace sources or parent of a type.
+   */
+  uint32_t m_generation = 1;
 
   /** Type of the by-hash index. */
   typedef std::map<TypeId::hash_t, uint16_t> hashmap_t;
@@ -384,10 +470,11 @@ IidManager::AllocateUid (std::string name)
 {
   NS_LOG_FUNCTION (IID << name);
   // Type names are definitive: equal names are equal types
-  NS_ASSERT_MSG (m_namemap.count (name) == 0,
+  NS_ASSERT_MSG (GetUid (name) == 0,
                  "Trying to allocate twice the same uid: " << name);
 
-  TypeId::hash_t hash = Hasher (name) & (~HashChainFlag);
+  uint32_t nameHash = Hasher (name);
+  TypeId::hash_t hash = nameHash & (~HashChainFlag);
   if (m_hashmap.count (hash) == 1)
     {
       NS_LOG_ERROR ("Hash chaining TypeId for '" << name << "'.  "
@@ -435,6 +522,7 @@ IidManager::AllocateUid (std::string name)
 
   struct IidInformation information;
   information.name = name;
+  information.nameHash = nameHash;
   information.hash = hash;
   information.parent = 0;
   information.groupName = "";
@@ -442,18 +530,121 @@ IidManager::AllocateUid (std::string name)
   information.hasConstructor = false;
   information.mustHideFromDocumentation = false;
   information.supportLevel = TypeId::SUPPORTED;
+  information.attributeIndex.generation = 0;
+  information.traceSourceIndex.generation = 0;
   m_information.push_back (information);
   std::size_t tuid = m_information.size ();
   NS_ASSERT (tuid <= 0xffff);
   uint16_t uid = static_cast<uint16_t> (tuid);
 
-  // Add to both maps:
-  m_namemap.insert (std::make_pair (name, uid));
+  // Add to both indexes:
+  InsertName (uid);
   m_hashmap.insert (std::make_pair (hash, uid));
   NS_LOG_LOGIC (IIDL << uid);
   return uid;
 }
 
+void
+IidManager::InsertName (uint16_t uid)
+{
+  NS_LOG_FUNCTION (IID << uid);
+  if (m_nameIndex.size () < 2 * m_information.size ())
+    {
+      // Grow, and reinsert all the types but the new one
+      std::size_t size = m_nameIndex.empty () ? 64 : 2 * m_nameIndex.size ();
+      m_nameIndex.assign (size, 0);
+      for (std::size_t i = 0; i < m_information.size (); ++i)
+        {
+          if (i + 1 != uid)
+            {
+              InsertName (static_cast<uint16_t> (i + 1));
+            }
+        }
+    }
+  std::size_t mask = m_nameIndex.size () - 1;
+  std::size_t slot = LookupInformation (uid)->nameHash & mask;
+  while (m_nameIndex[slot] != 0)
+    {
+      slot = (slot + 1) & mask;
+    }
+  m_nameIndex[slot] = uid;
+}
+
+template <typename T>
+const T *
+IidManager::FindMember (uint16_t uid, const std::string &name,
+                        std::vector<T> IidInformation::*members,
+                        struct MemberIndex IidInformation::*index)
+{
+  struct MemberIndex &idx = LookupInformation (uid)->*index;
+  if (idx.generation != m_generation)
+    {
+      NS_LOG_LOGIC (IIDL << "building member index of " << LookupInformation (uid)->name);
+      std::size_t n = 0;
+      uint16_t cur = uid;
+      while (cur != 0)
+        {
+          struct IidInformation *information = LookupInformation (cur);
+          n += (information->*members).size ();
+          cur = information->parent == cur ? 0 : information->parent;
+        }
+      std::size_t size = 4;
+      while (size < 2 * n)
+        {
+          size *= 2;
+        }
+      struct MemberSlot empty = {0, 0, 0};
+      idx.slots.assign (size, empty);
+      std::size_t mask = size - 1;
+      // Walk from the type up to its root, so that the members of a
+      // type hide those of its parents with the same name.
+      cur = uid;
+      while (cur != 0)
+        {
+          struct IidInformation *information = LookupInformation (cur);
+          const std::vector<T> &declared = information->*members;
+          for (std::size_t i = 0; i < declared.size (); ++i)
+            {
+              uint32_t hash = Hasher (declared[i].name);
+              std::size_t slot = hash & mask;
+              bool hidden = false;
+              while (idx.slots[slot].owner != 0 && !hidden)
+                {
+                  const struct MemberSlot &s = idx.slots[slot];
+                  hidden = s.hash == hash
+                    && (LookupInformation (s.owner)->*members)[s.index].name == declared[i].name;
+                  slot = (slot + 1) & mask;
+                }
+              if (!hidden)
+                {
+                  NS_ASSERT (i <= 0xffff);
+                  idx.slots[slot].hash = hash;
+                  idx.slots[slot].owner = cur;
+                  idx.slots[slot].index = static_cast<uint16_t> (i);
+                }
+            }
+          cur = information->parent == cur ? 0 : information->parent;
+        }
+      idx.generation = m_generation;
+    }
+
+  uint32_t hash = Hasher (name);
+  std::size_t mask = idx.slots.size () - 1;
+  for (std::size_t slot = hash & mask; idx.slots[slot].owner != 0; slot = (slot + 1) & mask)
+    {
+      const struct MemberSlot &s = idx.slots[slot];
+      if (s.hash == hash)
+        {
+          const T &member = (LookupInformation (s.owner)->*members)[s.index];
+          if (member.name == name)
+            {
+              return &member;
+            }
+        }
+    }
+  return 0;
+}
+
 struct IidManager::IidInformation *
 IidManager::LookupInformation (uint16_t uid) const
 {
@@ -470,6 +661,7 @@ IidManager::SetParent (uint16_t uid, uint16_t parent)
   NS_ASSERT (parent <= m_information.size ());
   struct IidInformation *information = LookupInformation (uid);
   information->parent = parent;
+  ++m_generation;
 }
 void
 IidManager::SetGroupName (uint16_t uid, std::string groupName)
@@ -511,10 +703,19 @@ IidManager::GetUid (std::string name) const
 {
   NS_LOG_FUNCTION (IID << name);
   uint16_t uid = 0;
-  namemap_t::const_iterator it = m_namemap.find (name);
-  if (it != m_namemap.end ())
+  if (!m_nameIndex.empty ())
     {
-      uid = it->second;
+      uint32_t hash = Hasher (name);
+      std::size_t mask = m_nameIndex.size () - 1;
+      for (std::size_t slot = hash & mask; m_nameIndex[slot] != 0; slot = (slot + 1) & mask)
+        {
+          const struct IidInformation &information = m_information[m_nameIndex[slot] - 1];
+          if (information.nameHash == hash && information.name == name)
+            {
+              uid = m_nameIndex[slot];
+              break;
+            }
+        }
     }
   NS_LOG_LOGIC (IIDL << uid);
   return uid;
@@ -680,6 +881,7 @@ IidManager::AddAttribute (uint16_t uid,
   info.supportLevel = supportLevel;
   info.supportMsg = supportMsg;
   information->attributes.push_back (info);
+  ++m_generation;
   NS_LOG_LOGIC (IIDL << information->attributes.size () - 1);
 }
 void
@@ -704,7 +906,7 @@ IidManager::GetAttributeN (uint16_t uid) const
   NS_LOG_LOGIC (IIDL << size);
   return size;
 }
-struct TypeId::AttributeInformation
+const struct TypeId::AttributeInformation &
 IidManager::GetAttribute (uint16_t uid, std::size_t i) const
 {
   NS_LOG_FUNCTION (IID << uid << i);
@@ -713,6 +915,12 @@ IidManager::GetAttribute (uint16_t uid, std::size_t i) const
   NS_LOG_LOGIC (IIDL << information->name);
   return information->attributes[i];
 }
+const struct TypeId::AttributeInformation *
+IidManager::FindAttribute (uint16_t uid, const std::string &name)
+{
+  NS_LOG_FUNCTION (IID << uid << name);
+  return FindMember (uid, name, &IidInformation::attributes, &IidInformation::attributeIndex);
+}
 
 bool
 IidManager::HasTraceSource (uint16_t uid,
@@ -772,6 +980,7 @@ IidManager::AddTraceSource (uint16_t uid,
   source.supportLevel = supportLevel;
   source.supportMsg = supportMsg;
   information->traceSources.push_back (source);
+  ++m_generation;
   NS_LOG_LOGIC (IIDL << information->traceSources.size () - 1);
 }
 std::size_t
@@ -783,7 +992,7 @@ IidManager::GetTraceSourceN (uint16_t uid) const
   NS_LOG_LOGIC (IIDL << size);
   return size;
 }
-struct TypeId::TraceSourceInformation
+const struct TypeId::TraceSourceInformation &
 IidManager::GetTraceSource (uint16_t uid, std::size_t i) const
 {
   NS_LOG_FUNCTION (IID << uid << i);
@@ -792,6 +1001,12 @@ IidManager::GetTraceSource (uint16_t uid, std::size_t i) const
   NS_LOG_LOGIC (IIDL << information->name);
   return information->traceSources[i];
 }
+const struct TypeId::TraceSourceInformation *
+IidManager::FindTraceSource (uint16_t uid, const std::string &name)
+{
+  NS_LOG_FUNCTION (IID << uid << name);
+  return FindMember (uid, name, &IidInformation::traceSources, &IidInformation::traceSourceIndex);
+}
 bool
 IidManager::MustHideFromDocumentation (uint16_t uid) const
 {
@@ -882,40 +1097,24 @@ bool
 TypeId::LookupAttributeByName (std::string name, struct TypeId::AttributeInformation *info) const
 {
   NS_LOG_FUNCTION (this << name << info);
-  TypeId tid;
-  TypeId nextTid = *this;
-  do
+  const struct TypeId::AttributeInformation *tmp = IidManager::Get ()->FindAttribute (m_tid, name);
+  if (tmp == 0)
     {
-      tid = nextTid;
-      for (std::size_t i = 0; i < tid.GetAttributeN (); i++)
-        {
-          struct TypeId::AttributeInformation tmp = tid.GetAttribute (i);
-          if (tmp.name == name)
-            {
-              if (tmp.supportLevel == TypeId::SUPPORTED)
-                {
-                  *info = tmp;
-                  return true;
-                }
-              else if (tmp.supportLevel == TypeId::DEPRECATED)
-                {
-                  std::cerr << "Attribute '" << name << "' is deprecated: "
-                            << tmp.supportMsg << std::endl;
-                  *info = tmp;
-                  return true;
-                }
-              else if (tmp.supportLevel == TypeId::OBSOLETE)
-                {
-                  NS_FATAL_ERROR ("Attribute '" << name <<
-                                  "' is obsolete, with no fallback: " <<
-                                  tmp.supportMsg);
-                }
-            }
-        }
-      nextTid = tid.GetParent ();
+      return false;
     }
-  while (nextTid != tid);
-  return false;
+  if (tmp->supportLevel == TypeId::DEPRECATED)
+    {
+      std::cerr << "Attribute '" << name << "' is deprecated: "
+                << tmp->supportMsg << std::endl;
+    }
+  else if (tmp->supportLevel == TypeId::OBSOLETE)
+    {
+      NS_FATAL_ERROR ("Attribute '" << name <<
+                      "' is obsolete, with no fallback: " <<
+                      tmp->supportMsg);
+    }
+  *info = *tmp;
+  return true;
 }
 
 TypeId
@@ -1079,7 +1278,7 @@ TypeId::GetAttributeN (void) const
   std::size_t n = IidManager::Get ()->GetAttributeN (m_tid);
   return n;
 }
-struct TypeId::AttributeInformation
+const struct TypeId::AttributeInformation &
 TypeId::GetAttribute (std::size_t i) const
 {
   NS_LOG_FUNCTION (this << i);
@@ -1089,8 +1288,7 @@ std::string
 TypeId::GetAttributeFullName (std::size_t i) const
 {
   NS_LOG_FUNCTION (this << i);
-  struct TypeId::AttributeInformation info = GetAttribute (i);
-  return GetName () + "::" + info.name;
+  return GetName () + "::" + GetAttribute (i).name;
 }
 
 std::size_t
@@ -1099,7 +1297,7 @@ TypeId::GetTraceSourceN (void) const
   NS_LOG_FUNCTION (this);
   return IidManager::Get ()->GetTraceSourceN (m_tid);
 }
-struct TypeId::TraceSourceInformation
+const struct TypeId::TraceSourceInformation &
 TypeId::GetTraceSource (std::size_t i) const
 {
   NS_LOG_FUNCTION (this << i);
@@ -1136,41 +1334,24 @@ TypeId::LookupTraceSourceByName (std::string name,
                                  struct TraceSourceInformation *info) const
 {
   NS_LOG_FUNCTION (this << name);
-  TypeId tid;
-  TypeId nextTid = *this;
-  struct TypeId::TraceSourceInformation tmp;
-  do
+  const struct TypeId::TraceSourceInformation *tmp = IidManager::Get ()->FindTraceSource (m_tid, name);
+  if (tmp == 0)
     {
-      tid = nextTid;
-      for (std::size_t i = 0; i < tid.GetTraceSourceN (); i++)
-        {
-          tmp = tid.GetTraceSource (i);
-          if (tmp.name == name)
-            {
-              if (tmp.supportLevel == TypeId::SUPPORTED)
-                {
-                  *info = tmp;
-                  return tmp.accessor;
-                }
-              else if (tmp.supportLevel == TypeId::DEPRECATED)
-                {
-                  std::cerr << "TraceSource '" << name << "' is deprecated: "
-                            << tmp.supportMsg << std::endl;
-                  *info = tmp;
-                  return tmp.accessor;
-                }
-              else if (tmp.supportLevel == TypeId::OBSOLETE)
-                {
-                  NS_FATAL_ERROR ("TraceSource '" << name <<
-                                  "' is obsolete, with no fallback: " <<
-                                  tmp.supportMsg);
-                }
-            }
-        }
-      nextTid = tid.GetParent ();
+      return 0;
     }
-  while (nextTid != tid);
-  return 0;
+  if (tmp->supportLevel == TypeId::DEPRECATED)
+    {
+      std::cerr << "TraceSource '" << name << "' is deprecated: "
+                << tmp->supportMsg << std::endl;
+    }
+  else if (tmp->supportLevel == TypeId::OBSOLETE)
+    {
+      NS_FATAL_ERROR ("TraceSource '" << name <<
+                      "' is obsolete, with no fallback: " <<
+                      tmp->supportMsg);
+    }
+  *info = *tmp;
+  return tmp->accessor;
 }
 
 Ptr<const TraceSourceAccessor>
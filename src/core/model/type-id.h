@@ -254,10 +254,12 @@ public:
   /**
    * Get Attribute information by index.
    *
+   * The returned reference stays valid for the lifetime of the program.
+   *
    * \param [in] i Index into attribute array
    * \returns The information associated to attribute whose index is \pname{i}.
    */
-  struct TypeId::AttributeInformation GetAttribute (std::size_t i) const;
+  const struct TypeId::AttributeInformation & GetAttribute (std::size_t i) const;
   /**
    * Get the Attribute name by index.
    *
@@ -294,7 +296,7 @@ public:
    * \param [in] i Index into trace source array.
    * \returns Detailed information about the requested trace source.
    */
-  struct TypeId::TraceSourceInformation GetTraceSource (std::size_t i) const;
+  const struct TypeId::TraceSourceInformation & GetTraceSource (std::size_t i) const;
 
   /**
    * Set the parent TypeId.
@@ -465,6 +467,10 @@ public:
   /**
    * Find an Attribute by name, retrieving the associated AttributeInformation.
    *
+   * The Attributes of the parent types are searched as well, through a
+   * hash index of the Attributes of this type and its parents built on
+   * the first lookup.
+   *
    * \param [in]  name The name of the requested attribute
    * \param [in,out] info A pointer to the TypeId::AttributeInformation
    *              data structure where the result value of this method
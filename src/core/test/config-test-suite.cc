@@ -607,6 +607,17 @@ ObjectVectorConfigTestCase::DoRun (void)
 
   obj3->GetAttribute ("A", iv);
   NS_TEST_ASSERT_MSG_EQ (iv.Get (), -16, "Object Attribute \"A\" not set as expected");
+
+  //
+  // Matches are returned in index order, whatever the order of the
+  // expression, and indices past the end of the vector are ignored
+  //
+  Config::MatchContainer matches = Config::LookupMatches ("/NodeA/NodeB/NodesB/3|[7-9]|1|[1-1]");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 2, "Unexpected number of matches");
+  NS_TEST_ASSERT_MSG_EQ (matches.Get (0), obj1, "Unexpected first match");
+  NS_TEST_ASSERT_MSG_EQ (matches.Get (1), obj3, "Unexpected second match");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetMatchedPath (1), "/NodeA/NodeB/NodesB/3/",
+                         "Unexpected matched path");
 }
 
 /**
@@ -832,6 +843,120 @@ SearchAttributesOfParentObjectsTestCase::DoRun (void)
 
 }
 
+/**
+ * \ingroup config-tests
+ * Test for the parsed Config::Path and the bulk operations of
+ * Config::MatchContainer.
+ */
+class PathConfigTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  PathConfigTestCase ();
+  /** Destructor. */
+  virtual ~PathConfigTestCase ()
+  {}
+
+  /**
+   * Trace callback with context path.
+   * \param [in] path The context path.
+   * \param [in] old The old value.
+   * \param [in] newValue The new value.
+   */
+  void TraceWithPath (std::string path, [[maybe_unused]] int16_t old, int16_t newValue)
+  {
+    m_newValue = newValue;
+    m_path = path;
+  }
+
+private:
+  virtual void DoRun (void);
+
+  int16_t m_newValue; //!< Flag to detect tracing result.
+  std::string m_path; //!< The context path.
+
+};
+
+PathConfigTestCase::PathConfigTestCase ()
+  : TestCase ("Check that a Config::Path can be reused to set and connect")
+{}
+
+void
+PathConfigTestCase::DoRun (void)
+{
+  IntegerValue iv;
+
+  //
+  // Reach the objects through the name service, to keep clear of the
+  // root namespace objects registered by the other test cases.
+  //
+  Ptr<ConfigTestObject> root = CreateObject<ConfigTestObject> ();
+  Names::Add ("PathConfigRoot", root);
+  Ptr<ConfigTestObject> b = CreateObject<ConfigTestObject> ();
+  root->SetNodeB (b);
+  Ptr<ConfigTestObject> obj0 = CreateObject<ConfigTestObject> ();
+  Ptr<ConfigTestObject> obj1 = CreateObject<DerivedConfigTestObject> ();
+  b->AddNodeB (obj0);
+  b->AddNodeB (obj1);
+
+  //
+  // Set through a path holding a wildcard, on objects of two types
+  //
+  Config::Path path ("/Names/PathConfigRoot/NodeB/NodesB/*/A");
+  NS_TEST_ASSERT_MSG_EQ (path.GetPath (), "/Names/PathConfigRoot/NodeB/NodesB/*/A", "Unexpected path");
+  path.Set (IntegerValue (-20));
+  obj0->GetAttribute ("A", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), -20, "Object Attribute \"A\" not set as expected");
+  obj1->GetAttribute ("A", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), -20, "Object Attribute \"A\" not set as expected");
+
+  //
+  // The path caches lookups, not objects: reusing it reaches new objects
+  //
+  Ptr<ConfigTestObject> obj2 = CreateObject<ConfigTestObject> ();
+  b->AddNodeB (obj2);
+  path.Set (IntegerValue (-21));
+  obj0->GetAttribute ("A", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), -21, "Object Attribute \"A\" not set as expected");
+  obj2->GetAttribute ("A", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), -21, "Object Attribute \"A\" not set as expected");
+
+  NS_TEST_ASSERT_MSG_EQ (Config::Path ("/Names/PathConfigRoot/NodeB/NodesB/*/NoSuchAttribute").SetFailSafe (IntegerValue (0)),
+                         false, "Unexpected attribute");
+
+  //
+  // Connect and disconnect through the same path
+  //
+  Config::Path source ("/Names/PathConfigRoot/NodeB/NodesB/1|2/Source");
+  source.Connect (MakeCallback (&PathConfigTestCase::TraceWithPath, this));
+  m_newValue = 0;
+  obj0->SetAttribute ("Source", IntegerValue (-1));
+  NS_TEST_ASSERT_MSG_EQ (m_newValue, 0, "Trace 0 fired unexpectedly");
+  obj1->SetAttribute ("Source", IntegerValue (-2));
+  NS_TEST_ASSERT_MSG_EQ (m_newValue, -2, "Trace 1 did not fire as expected");
+  NS_TEST_ASSERT_MSG_EQ (m_path, "/Names/PathConfigRoot/NodeB/NodesB/1/Source", "Trace 1 did not provide expected context");
+  source.Disconnect (MakeCallback (&PathConfigTestCase::TraceWithPath, this));
+  m_newValue = 0;
+  obj2->SetAttribute ("Source", IntegerValue (-3));
+  NS_TEST_ASSERT_MSG_EQ (m_newValue, 0, "Trace 2 fired after disconnection");
+
+  //
+  // Bulk operations on the matches of a path
+  //
+  Config::MatchContainer matches = Config::Path ("/Names/PathConfigRoot/NodeB/NodesB/[0-1]").LookupMatches ();
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 2, "Unexpected number of matches");
+  matches.Set ("A", IntegerValue (-22));
+  matches.Set ("B", IntegerValue (-23));
+  obj1->GetAttribute ("A", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), -22, "Object Attribute \"A\" not set as expected");
+  obj1->GetAttribute ("B", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), -23, "Object Attribute \"B\" not set as expected");
+  obj2->GetAttribute ("A", iv);
+  NS_TEST_ASSERT_MSG_EQ (iv.Get (), -21, "Object Attribute \"A\" unexpectedly set");
+
+  Names::Clear ();
+}
+
 /**
  * \ingroup config-tests
  * The Test Suite that glues all of the Test Cases together.
@@ -850,6 +975,7 @@ ConfigTestSuite::ConfigTestSuite ()
   AddTestCase (new UnderRootNamespaceConfigTestCase);
   AddTestCase (new ObjectVectorConfigTestCase);
   AddTestCase (new SearchAttributesOfParentObjectsTestCase);
+  AddTestCase (new PathConfigTestCase);
 }
 
 /**
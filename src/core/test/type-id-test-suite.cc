@@ -354,6 +354,114 @@ DeprecatedAttributeTestCase::DoRun (void)
 }
 
 
+/**
+ * \ingroup typeid-tests
+ *
+ * Check the lookups of TypeIds, Attributes and TraceSources by name.
+ */
+class MemberLookupTestCase : public TestCase
+{
+public:
+  MemberLookupTestCase ();
+  virtual ~MemberLookupTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+};
+
+MemberLookupTestCase::MemberLookupTestCase ()
+  : TestCase ("Check the lookups by name")
+{}
+
+MemberLookupTestCase::~MemberLookupTestCase ()
+{}
+
+void
+MemberLookupTestCase::DoRun (void)
+{
+  uint16_t nids = TypeId::GetRegisteredN ();
+  for (uint16_t i = 0; i < nids; ++i)
+    {
+      TypeId tid = TypeId::GetRegistered (i);
+      TypeId found;
+      NS_TEST_ASSERT_MSG_EQ (TypeId::LookupByNameFailSafe (tid.GetName (), &found), true,
+                             "lookup of " << tid.GetName ());
+      NS_TEST_ASSERT_MSG_EQ (found, tid, "lookup of " << tid.GetName ());
+      for (std::size_t j = 0; j < tid.GetAttributeN (); ++j)
+        {
+          const struct TypeId::AttributeInformation &attribute = tid.GetAttribute (j);
+          if (attribute.supportLevel != TypeId::SUPPORTED)
+            {
+              continue;
+            }
+          struct TypeId::AttributeInformation info;
+          NS_TEST_ASSERT_MSG_EQ (tid.LookupAttributeByName (attribute.name, &info), true,
+                                 "lookup of " << tid.GetAttributeFullName (j));
+          NS_TEST_ASSERT_MSG_EQ (info.checker, attribute.checker,
+                                 "lookup of " << tid.GetAttributeFullName (j));
+        }
+    }
+  TypeId found;
+  NS_TEST_ASSERT_MSG_EQ (TypeId::LookupByNameFailSafe ("ns3::NoSuchType", &found), false,
+                         "lookup of an unknown type");
+
+  TypeId parent = TypeId ("MemberLookupParent")
+    .SetParent<Object> ()
+    .AddAttribute ("parentAttribute", "an attribute of the parent",
+                   IntegerValue (1),
+                   MakeEmptyAttributeAccessor (),
+                   MakeIntegerChecker<int> ())
+    .AddTraceSource ("parentTrace", "a trace source of the parent",
+                     MakeEmptyTraceSourceAccessor (),
+                     "ns3::TracedValueCallback::Void");
+  TypeId child = TypeId ("MemberLookupChild")
+    .SetParent (parent)
+    .AddAttribute ("childAttribute", "an attribute of the child",
+                   DoubleValue (2),
+                   MakeEmptyAttributeAccessor (),
+                   MakeDoubleChecker<double> ());
+
+  struct TypeId::AttributeInformation info;
+  NS_TEST_ASSERT_MSG_EQ (child.LookupAttributeByName ("childAttribute", &info), true,
+                         "lookup of an attribute of the type");
+  NS_TEST_EXPECT_MSG_EQ (info.name, "childAttribute", "wrong attribute");
+  NS_TEST_ASSERT_MSG_EQ (child.LookupAttributeByName ("parentAttribute", &info), true,
+                         "lookup of an attribute of the parent");
+  NS_TEST_EXPECT_MSG_EQ (info.name, "parentAttribute", "wrong attribute");
+  NS_TEST_EXPECT_MSG_EQ (parent.LookupAttributeByName ("childAttribute", &info), false,
+                         "lookup of an attribute of a child");
+  NS_TEST_EXPECT_MSG_EQ (child.LookupAttributeByName ("noSuchAttribute", &info), false,
+                         "lookup of an unknown attribute");
+  NS_TEST_EXPECT_MSG_EQ (child.LookupAttributeByName ("Attribute", &info), false,
+                         "lookup of an unknown attribute");
+  // The trace sources have no accessor: check the returned information
+  struct TypeId::TraceSourceInformation tinfo;
+  child.LookupTraceSourceByName ("parentTrace", &tinfo);
+  NS_TEST_EXPECT_MSG_EQ (tinfo.name, "parentTrace", "lookup of a trace source of the parent");
+  tinfo.name = "";
+  child.LookupTraceSourceByName ("childTrace", &tinfo);
+  NS_TEST_EXPECT_MSG_EQ (tinfo.name, "", "lookup of an unknown trace source");
+
+  // Members registered after a lookup must be found as well
+  parent.AddAttribute ("lateAttribute", "an attribute added after a lookup",
+                       IntegerValue (3),
+                       MakeEmptyAttributeAccessor (),
+                       MakeIntegerChecker<int> ());
+  child.AddTraceSource ("childTrace", "a trace source added after a lookup",
+                        MakeEmptyTraceSourceAccessor (),
+                        "ns3::TracedValueCallback::Void");
+  NS_TEST_ASSERT_MSG_EQ (child.LookupAttributeByName ("lateAttribute", &info), true,
+                         "lookup of an attribute added after a lookup");
+  NS_TEST_EXPECT_MSG_EQ (info.name, "lateAttribute", "wrong attribute");
+  child.LookupTraceSourceByName ("childTrace", &tinfo);
+  NS_TEST_EXPECT_MSG_EQ (tinfo.name, "childTrace", "lookup of a trace source added after a lookup");
+  NS_TEST_EXPECT_MSG_EQ (child.LookupAttributeByName ("childAttribute", &info), true,
+                         "lookup of an attribute of the type");
+  NS_TEST_EXPECT_MSG_EQ (info.name, "childAttribute", "wrong attribute");
+}
+
+
 /**
  * \ingroup typeid-tests
  * 
@@ -420,6 +528,19 @@ LookupTimeTestCase::DoRun (void)
   stop = clock ();
   Report ("hash", stop - start);
 
+  start = clock ();
+  for (uint32_t j = 0; j < REPETITIONS; ++j)
+    {
+      for (uint16_t i = 0; i < nids; ++i)
+        {
+          const TypeId tid = TypeId::GetRegistered (i);
+          struct TypeId::AttributeInformation info;
+          tid.LookupAttributeByName ("NoSuchAttribute", &info);
+        }
+    }
+  stop = clock ();
+  Report ("attribute name", stop - start);
+
 }
 
 void
@@ -474,6 +595,7 @@ TypeIdTestSuite::TypeIdTestSuite ()
   AddTestCase (new UniqueTypeIdTestCase, QUICK);
   AddTestCase (new CollisionTestCase, QUICK);
   AddTestCase (new DeprecatedAttributeTestCase, QUICK);
+  AddTestCase (new MemberLookupTestCase, QUICK);
 }
 
 /// Static variable for test initialization.
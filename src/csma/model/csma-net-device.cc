@@ -30,6 +30,7 @@
 #include "ns3/uinteger.h"
 #include "ns3/pointer.h"
 #include "ns3/trace-source-accessor.h"
+#include "ns3/segmentation-offload-tag.h"
 #include "csma-net-device.h"
 #include "csma-channel.h"
 
@@ -374,7 +375,8 @@ CsmaNetDevice::AddHeader (Ptr<Packet> p,   Mac48Address source,  Mac48Address de
             p->AddAtEnd (padd);
           }
 
-        NS_ASSERT_MSG (p->GetSize () <= GetMtu (),
+        SegmentationOffloadTag offloadTag;
+        NS_ASSERT_MSG (p->GetSize () <= GetMtu () || p->PeekPacketTag (offloadTag),
                        "CsmaNetDevice::AddHeader(): 802.3 Length/Type field with LLC/SNAP: "
                        "length interpretation must not exceed device frame size minus overhead");
       }
@@ -436,6 +438,23 @@ CsmaNetDevice::ProcessHeader (Ptr<Packet> p, uint16_t & param)
 }
 #endif
 
+uint32_t
+CsmaNetDevice::GetWireSize (Ptr<const Packet> p) const
+{
+  NS_LOG_FUNCTION (this << p);
+  SegmentationOffloadTag offloadTag;
+  if (!p->PeekPacketTag (offloadTag))
+    {
+      return p->GetSize ();
+    }
+  uint32_t framing = EthernetHeader (false).GetSerializedSize () + EthernetTrailer ().GetSerializedSize ();
+  if (m_encapMode == LLC)
+    {
+      framing += LlcSnapHeader ().GetSerializedSize ();
+    }
+  return offloadTag.GetWireSize (p->GetSize (), framing);
+}
+
 void
 CsmaNetDevice::TransmitStart (void)
 {
@@ -522,7 +541,7 @@ CsmaNetDevice::TransmitStart (void)
           m_backoff.ResetBackoffTime ();
           m_txMachineState = BUSY;
 
-          Time tEvent = m_bps.CalculateBytesTxTime (m_currentPkt->GetSize ());
+          Time tEvent = m_bps.CalculateBytesTxTime (GetWireSize (m_currentPkt));
           NS_LOG_LOGIC ("Schedule TransmitCompleteEvent in " << tEvent.As (Time::S));
           Simulator::Schedule (tEvent, &CsmaNetDevice::TransmitCompleteEvent, this);
         }
@@ -1048,6 +1067,13 @@ CsmaNetDevice::SupportsSendFrom () const
   return true;
 }
 
+bool
+CsmaNetDevice::SupportsSegmentationOffload (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return true;
+}
+
 int64_t
 CsmaNetDevice::AssignStreams (int64_t stream)
 {
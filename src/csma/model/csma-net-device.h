@@ -326,6 +326,7 @@ public:
 
   virtual void SetPromiscReceiveCallback (PromiscReceiveCallback cb);
   virtual bool SupportsSendFrom (void) const;
+  virtual bool SupportsSegmentationOffload (void) const;
 
  /**
   * Assign a fixed random variable stream number to the random variables
@@ -399,6 +400,17 @@ private:
    */
   void TransmitStart ();
 
+  /**
+   * Compute the number of bytes a frame takes on the wire.
+   *
+   * A super-segment (see SegmentationOffloadTag) takes the time of its
+   * segments sent back-to-back, each with its own framing.
+   *
+   * \param p the frame, including its header and trailer
+   * \returns the number of bytes to transmit
+   */
+  uint32_t GetWireSize (Ptr<const Packet> p) const;
+
   /**
    * Stop Sending a Packet Down the Wire and Begin the Interframe Gap.
    *
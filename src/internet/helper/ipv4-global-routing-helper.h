@@ -85,6 +85,19 @@ public:
    *
    */
   static void RecomputeRoutingTables (void);
+  /**
+   * \brief Update the routes previously installed in a prior call to
+   * PopulateRoutingTables(), RecomputeRoutingTables() or
+   * UpdateRoutingTables(), after a change of the topology.
+   *
+   * Like RecomputeRoutingTables(), this method updates the representation
+   * of the global topology, but it only deletes and computes again the
+   * routes of the nodes that may be affected by the changes: the nodes whose
+   * addresses changed, and those connected to a router or network whose
+   * link state advertisement changed.  The routes of the other nodes,
+   * including any route added to them by hand, are left untouched.
+   */
+  static void UpdateRoutingTables (void);
 private:
   /**
    * \brief Assignment operator declared private and not implemented to disallow
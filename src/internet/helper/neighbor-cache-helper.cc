@@ -0,0 +1,239 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <set>
+#include <vector>
+#include "ns3/log.h"
+#include "ns3/node.h"
+#include "ns3/channel-list.h"
+#include "ns3/ipv4-l3-protocol.h"
+#include "ns3/ipv4-interface.h"
+#include "ns3/ipv6-l3-protocol.h"
+#include "ns3/ipv6-interface.h"
+#include "ns3/arp-cache.h"
+#include "ns3/ndisc-cache.h"
+#include "neighbor-cache-helper.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("NeighborCacheHelper");
+
+/**
+ * \brief Add a permanent entry to an ARP cache, or make its entry for the
+ * address permanent.
+ * \param cache the cache
+ * \param address the IPv4 address
+ * \param mac the MAC address
+ */
+static void
+AddPermanentEntry (Ptr<ArpCache> cache, Ipv4Address address, Address mac)
+{
+  ArpCache::Entry *entry = cache->Lookup (address);
+  Ptr<ArpCache> shared = cache->GetSharedCache ();
+  if (entry != 0 && shared != 0 && entry == shared->Lookup (address))
+    {
+      // the entry of the shared table is not ours to change
+      entry = 0;
+    }
+  if (entry == 0)
+    {
+      entry = cache->Add (address);
+    }
+  entry->ClearPendingPacket ();
+  entry->SetMacAddress (mac);
+  entry->MarkPermanent ();
+}
+
+/**
+ * \brief Add a permanent entry to an NDISC cache, or make its entry for the
+ * address permanent.
+ * \param cache the cache
+ * \param address the IPv6 address
+ * \param mac the MAC address
+ */
+static void
+AddPermanentEntry (Ptr<NdiscCache> cache, Ipv6Address address, Address mac)
+{
+  NdiscCache::Entry *entry = cache->Lookup (address);
+  Ptr<NdiscCache> shared = cache->GetSharedCache ();
+  if (entry != 0 && shared != 0 && entry == shared->Lookup (address))
+    {
+      // the entry of the shared table is not ours to change
+      entry = 0;
+    }
+  if (entry == 0)
+    {
+      entry = cache->Add (address);
+    }
+  entry->ClearWaitingPacket ();
+  entry->SetMacAddress (mac);
+  entry->MarkPermanent ();
+}
+
+NeighborCacheHelper::NeighborCacheHelper ()
+  : m_sharedTable (true)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+NeighborCacheHelper::SetSharedTable (bool shared)
+{
+  NS_LOG_FUNCTION (this << shared);
+  m_sharedTable = shared;
+}
+
+void
+NeighborCacheHelper::PopulateNeighborCache (void) const
+{
+  NS_LOG_FUNCTION (this);
+  for (ChannelList::Iterator i = ChannelList::Begin (); i != ChannelList::End (); i++)
+    {
+      PopulateNeighborCache (*i);
+    }
+}
+
+void
+NeighborCacheHelper::PopulateNeighborCache (const NetDeviceContainer &devices) const
+{
+  NS_LOG_FUNCTION (this);
+  std::set<Ptr<Channel> > channels;
+  for (NetDeviceContainer::Iterator i = devices.Begin (); i != devices.End (); i++)
+    {
+      Ptr<Channel> channel = (*i)->GetChannel ();
+      if (channel != 0 && channels.insert (channel).second)
+        {
+          PopulateNeighborCache (channel);
+        }
+    }
+}
+
+void
+NeighborCacheHelper::PopulateNeighborCache (Ptr<Channel> channel) const
+{
+  NS_LOG_FUNCTION (this << channel);
+
+  // The interfaces attached to the channel
+  std::vector<Ptr<Ipv4Interface> > ipv4Interfaces;
+  std::vector<Ptr<Ipv6Interface> > ipv6Interfaces;
+  for (std::size_t i = 0; i < channel->GetNDevices (); i++)
+    {
+      Ptr<NetDevice> device = channel->GetDevice (i);
+      Ptr<Ipv4L3Protocol> ipv4 = device->GetNode ()->GetObject<Ipv4L3Protocol> ();
+      int32_t ifIndex = ipv4 ? ipv4->GetInterfaceForDevice (device) : -1;
+      if (ifIndex >= 0)
+        {
+          ipv4Interfaces.push_back (ipv4->GetInterface (ifIndex));
+        }
+      Ptr<Ipv6L3Protocol> ipv6 = device->GetNode ()->GetObject<Ipv6L3Protocol> ();
+      ifIndex = ipv6 ? ipv6->GetInterfaceForDevice (device) : -1;
+      if (ifIndex >= 0)
+        {
+          ipv6Interfaces.push_back (ipv6->GetInterface (ifIndex));
+        }
+    }
+
+  Ptr<ArpCache> arpTable = m_sharedTable ? CreateObject<ArpCache> () : 0;
+  for (std::size_t i = 0; i < ipv4Interfaces.size (); i++)
+    {
+      Ptr<NetDevice> device = ipv4Interfaces[i]->GetDevice ();
+      for (uint32_t a = 0; a < ipv4Interfaces[i]->GetNAddresses (); a++)
+        {
+          Ipv4Address address = ipv4Interfaces[i]->GetAddress (a).GetLocal ();
+          if (arpTable != 0)
+            {
+              AddPermanentEntry (arpTable, address, device->GetAddress ());
+              continue;
+            }
+          for (std::size_t j = 0; j < ipv4Interfaces.size (); j++)
+            {
+              Ptr<ArpCache> cache = ipv4Interfaces[j]->GetArpCache ();
+              if (j != i && cache != 0)
+                {
+                  AddPermanentEntry (cache, address, device->GetAddress ());
+                }
+            }
+        }
+    }
+
+  Ptr<NdiscCache> ndiscTable = m_sharedTable ? CreateObject<NdiscCache> () : 0;
+  for (std::size_t i = 0; i < ipv6Interfaces.size (); i++)
+    {
+      Ptr<NetDevice> device = ipv6Interfaces[i]->GetDevice ();
+      for (uint32_t a = 0; a < ipv6Interfaces[i]->GetNAddresses (); a++)
+        {
+          Ipv6Address address = ipv6Interfaces[i]->GetAddress (a).GetAddress ();
+          if (ndiscTable != 0)
+            {
+              AddPermanentEntry (ndiscTable, address, device->GetAddress ());
+              continue;
+            }
+          for (std::size_t j = 0; j < ipv6Interfaces.size (); j++)
+            {
+              Ptr<NdiscCache> cache = ipv6Interfaces[j]->GetNdiscCache ();
+              if (j != i && cache != 0)
+                {
+                  AddPermanentEntry (cache, address, device->GetAddress ());
+                }
+            }
+        }
+    }
+
+  if (m_sharedTable)
+    {
+      // The local entries for the addresses of the table would hide it
+      for (std::size_t i = 0; i < ipv4Interfaces.size (); i++)
+        {
+          Ptr<ArpCache> cache = ipv4Interfaces[i]->GetArpCache ();
+          if (cache != 0)
+            {
+              cache->SetSharedCache (arpTable);
+              for (uint32_t j = 0; j < ipv4Interfaces.size (); j++)
+                {
+                  for (uint32_t a = 0; a < ipv4Interfaces[j]->GetNAddresses (); a++)
+                    {
+                      ArpCache::Entry *entry = cache->Lookup (ipv4Interfaces[j]->GetAddress (a).GetLocal ());
+                      if (entry != 0 && entry != arpTable->Lookup (ipv4Interfaces[j]->GetAddress (a).GetLocal ()))
+                        {
+                          cache->Remove (entry);
+                        }
+                    }
+                }
+            }
+        }
+      for (std::size_t i = 0; i < ipv6Interfaces.size (); i++)
+        {
+          Ptr<NdiscCache> cache = ipv6Interfaces[i]->GetNdiscCache ();
+          if (cache != 0)
+            {
+              cache->SetSharedCache (ndiscTable);
+              for (uint32_t j = 0; j < ipv6Interfaces.size (); j++)
+                {
+                  for (uint32_t a = 0; a < ipv6Interfaces[j]->GetNAddresses (); a++)
+                    {
+                      NdiscCache::Entry *entry = cache->Lookup (ipv6Interfaces[j]->GetAddress (a).GetAddress ());
+                      if (entry != 0 && entry != ndiscTable->Lookup (ipv6Interfaces[j]->GetAddress (a).GetAddress ()))
+                        {
+                          cache->Remove (entry);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,79 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef NEIGHBOR_CACHE_HELPER_H
+#define NEIGHBOR_CACHE_HELPER_H
+
+#include "ns3/channel.h"
+#include "ns3/net-device-container.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup internet
+ *
+ * \brief Helper class that fills the ARP and NDISC caches from the topology.
+ *
+ * Each IPv4 and IPv6 interface gets a permanent entry for every address of
+ * the other interfaces attached to the same channel, so that no address
+ * resolution traffic, pending queue or timer is needed to reach them. The
+ * caches must be populated once the addresses have been assigned, and
+ * before any traffic.
+ *
+ * With a shared table (the default), all the interfaces of a channel look
+ * up one table of the addresses of the channel, instead of each holding
+ * one entry per neighbor: the memory grows with the number of interfaces,
+ * not with its square. Entries resolved at run time (e.g., for addresses
+ * added later) are still stored in the cache of each interface.
+ */
+class NeighborCacheHelper
+{
+public:
+  NeighborCacheHelper ();
+
+  /**
+   * \brief Choose whether the interfaces of a channel share one table of
+   * permanent entries.
+   * \param shared true to share a table, false to add the entries to the
+   *        cache of each interface
+   */
+  void SetSharedTable (bool shared);
+
+  /**
+   * \brief Populate the caches of the interfaces of all the channels.
+   */
+  void PopulateNeighborCache (void) const;
+
+  /**
+   * \brief Populate the caches of the interfaces attached to a channel.
+   * \param channel the channel
+   */
+  void PopulateNeighborCache (Ptr<Channel> channel) const;
+
+  /**
+   * \brief Populate the caches of the interfaces attached to the channels
+   * of some devices.
+   * \param devices the devices
+   */
+  void PopulateNeighborCache (const NetDeviceContainer &devices) const;
+
+private:
+  bool m_sharedTable; //!< whether the interfaces of a channel share a table
+};
+
+} // namespace ns3
+
+#endif /* NEIGHBOR_CACHE_HELPER_H */
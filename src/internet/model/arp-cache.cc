@@ -94,6 +94,11 @@ ArpCache::ArpCache ()
 ArpCache::~ArpCache ()
 {
   NS_LOG_FUNCTION (this);
+  // a shared cache may be released without being disposed
+  for (CacheI i = m_arpCache.begin (); i != m_arpCache.end (); i++)
+    {
+      delete (*i).second;
+    }
 }
 
 void
@@ -103,6 +108,7 @@ ArpCache::DoDispose (void)
   Flush ();
   m_device = 0;
   m_interface = 0;
+  m_sharedCache = 0;
   if (!m_waitReplyTimer.IsRunning ())
     {
       m_waitReplyTimer.Cancel ();
@@ -256,17 +262,32 @@ ArpCache::Flush (void)
     }
 }
 
+void
+ArpCache::SetSharedCache (Ptr<ArpCache> cache)
+{
+  NS_LOG_FUNCTION (this << cache);
+  NS_ASSERT (cache != this);
+  m_sharedCache = cache;
+}
+
+Ptr<ArpCache>
+ArpCache::GetSharedCache (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_sharedCache;
+}
+
 void
 ArpCache::PrintArpCache (Ptr<OutputStreamWrapper> stream)
 {
   NS_LOG_FUNCTION (this << stream);
   std::ostream* os = stream->GetStream ();
 
+  std::string found = Names::FindName (m_device);
   for (CacheI i = m_arpCache.begin (); i != m_arpCache.end (); i++)
     {
       *os << i->first << " dev ";
-      std::string found = Names::FindName (m_device);
-      if (Names::FindName (m_device) != "")
+      if (found != "")
         {
           *os << found;
         }
@@ -294,6 +315,27 @@ ArpCache::PrintArpCache (Ptr<OutputStreamWrapper> stream)
           *os << " STALE\n";
         }
     }
+
+  if (m_sharedCache != 0)
+    {
+      for (CacheI i = m_sharedCache->m_arpCache.begin (); i != m_sharedCache->m_arpCache.end (); i++)
+        {
+          if (m_arpCache.find (i->first) != m_arpCache.end ())
+            {
+              continue;
+            }
+          *os << i->first << " dev ";
+          if (found != "")
+            {
+              *os << found;
+            }
+          else
+            {
+              *os << static_cast<int> (m_device->GetIfIndex ());
+            }
+          *os << " lladdr " << i->second->GetMacAddress () << " PERMANENT\n";
+        }
+    }
 }
 
 std::list<ArpCache::Entry *>
@@ -310,6 +352,16 @@ ArpCache::LookupInverse (Address to)
           entryList.push_back (entry);
         }
     }
+  if (m_sharedCache != 0)
+    {
+      for (CacheI i = m_sharedCache->m_arpCache.begin (); i != m_sharedCache->m_arpCache.end (); i++)
+        {
+          if (i->second->GetMacAddress () == to && m_arpCache.find (i->first) == m_arpCache.end ())
+            {
+              entryList.push_back (i->second);
+            }
+        }
+    }
   return entryList;
 }
 
@@ -323,6 +375,10 @@ ArpCache::Lookup (Ipv4Address to)
     {
       return it->second;
     }
+  if (m_sharedCache != 0)
+    {
+      return m_sharedCache->Lookup (to);
+    }
   return 0;
 }
 
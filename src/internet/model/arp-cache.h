@@ -132,6 +132,9 @@ public:
   void StartWaitReplyTimer (void);
   /**
    * \brief Do lookup in the ARP cache against an IP address
+   *
+   * If this cache has no entry for the address, the shared cache is looked up.
+   *
    * \param destination The destination IPv4 address to lookup the MAC address
    * of
    * \return An ArpCache::Entry with info about layer 2
@@ -157,9 +160,29 @@ public:
   void Remove (ArpCache::Entry *entry);
   /**
    * \brief Clear the ArpCache of all entries
+   *
+   * The entries of the shared cache, if any, are kept.
    */
   void Flush (void);
 
+  /**
+   * \brief Set a cache of permanent entries shared with other ArpCaches
+   *
+   * The entries of the shared cache are looked up when this cache has no
+   * entry for an address. The shared cache holds one permanent entry per
+   * neighbor of a link, e.g., as populated by NeighborCacheHelper, instead
+   * of one entry per neighbor in the cache of each interface of the link.
+   * Its entries are not modified by this cache.
+   *
+   * \param cache the shared cache, or null to stop using it
+   */
+  void SetSharedCache (Ptr<ArpCache> cache);
+  /**
+   * \brief Returns the cache of permanent entries shared with other ArpCaches
+   * \return the shared cache, or null
+   */
+  Ptr<ArpCache> GetSharedCache (void) const;
+
   /**
    * \brief Print the ARP cache entries
    *
@@ -328,6 +351,7 @@ private:
   void HandleWaitReplyTimeout (void);
   uint32_t m_pendingQueueSize; //!< number of packets waiting for a resolution
   Cache m_arpCache; //!< the ARP cache
+  Ptr<ArpCache> m_sharedCache; //!< the cache of permanent entries shared with other caches
   TracedCallback<Ptr<const Packet> > m_dropTrace; //!< trace for packets dropped by the ARP cache queue
 };
 
@@ -0,0 +1,616 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <algorithm>
+#include <limits>
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/enum.h"
+#include "ns3/uinteger.h"
+#include "ns3/double.h"
+#include "ns3/pointer.h"
+#include "ns3/channel.h"
+#include "ns3/queue.h"
+#include "ns3/queue-disc.h"
+#include "ns3/net-device-queue-interface.h"
+#include "ns3/traffic-control-layer.h"
+#include "ns3/trace-source-accessor.h"
+#include "ipv4.h"
+#include "ipv4-header.h"
+#include "ipv4-route.h"
+#include "ipv4-routing-protocol.h"
+#include "fluid-traffic-model.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("FluidTrafficModel");
+
+NS_OBJECT_ENSURE_REGISTERED (FluidTrafficModel);
+
+/// Maximum number of hops of the path of a flow
+static const uint32_t FLUID_MAX_HOPS = 64;
+
+/**
+ * \brief Get the propagation delay of the channel of a device.
+ * \param device the device
+ * \returns the "Delay" attribute of the channel, in s, or zero
+ */
+static double
+GetChannelDelay (Ptr<NetDevice> device)
+{
+  TimeValue delay;
+  Ptr<Channel> channel = device->GetChannel ();
+  if (channel && channel->GetAttributeFailSafe ("Delay", delay))
+    {
+      return delay.Get ().GetSeconds ();
+    }
+  return 0;
+}
+
+TypeId
+FluidTrafficModel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::FluidTrafficModel")
+    .SetParent<Object> ()
+    .SetGroupName ("Internet")
+    .AddConstructor<FluidTrafficModel> ()
+    .AddAttribute ("Model",
+                   "The model of the rates of the flows.",
+                   EnumValue (FluidTrafficModel::TCP),
+                   MakeEnumAccessor (&FluidTrafficModel::m_model),
+                   MakeEnumChecker (FluidTrafficModel::MAX_MIN, "MaxMin",
+                                    FluidTrafficModel::TCP, "Tcp"))
+    .AddAttribute ("TimeStep",
+                   "The interval between two updates of the rates.",
+                   TimeValue (MilliSeconds (1)),
+                   MakeTimeAccessor (&FluidTrafficModel::m_timeStep),
+                   MakeTimeChecker (TimeStep (1)))
+    .AddAttribute ("PacketSize",
+                   "The size of the packets of the flows, used to convert "
+                   "windows and queue sizes in packets to bytes.",
+                   UintegerValue (1500),
+                   MakeUintegerAccessor (&FluidTrafficModel::m_packetSize),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("InitialWindow",
+                   "The initial congestion window of the flows (TCP model), in packets.",
+                   DoubleValue (10),
+                   MakeDoubleAccessor (&FluidTrafficModel::m_initialWindow),
+                   MakeDoubleChecker<double> (1))
+    .AddAttribute ("MaxWindow",
+                   "The maximum congestion window of the flows (TCP model), in "
+                   "packets, e.g., the receiver window.",
+                   DoubleValue (1000),
+                   MakeDoubleAccessor (&FluidTrafficModel::m_maxWindow),
+                   MakeDoubleChecker<double> (1))
+    .AddTraceSource ("FlowCompleted",
+                     "A flow has delivered all its bytes.",
+                     MakeTraceSourceAccessor (&FluidTrafficModel::m_flowCompletedTrace),
+                     "ns3::FluidTrafficModel::FlowCompletedTracedCallback")
+  ;
+  return tid;
+}
+
+FluidTrafficModel::FluidTrafficModel ()
+  : m_lastStep (Seconds (0))
+{
+  NS_LOG_FUNCTION (this);
+}
+
+FluidTrafficModel::~FluidTrafficModel ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+FluidTrafficModel::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_stepEvent.Cancel ();
+  m_links.clear ();
+  m_linkIndex.clear ();
+  m_flows.clear ();
+  Object::DoDispose ();
+}
+
+uint32_t
+FluidTrafficModel::AddFlow (Ptr<Node> src, Ipv4Address dst, Time start, Time stop, uint64_t maxBytes)
+{
+  NS_LOG_FUNCTION (this << src << dst << start << stop << maxBytes);
+  NS_ASSERT_MSG (start >= Simulator::Now (), "Cannot start a flow in the past");
+
+  Flow flow;
+  flow.src = src;
+  flow.dst = dst;
+  flow.start = start;
+  flow.stop = stop;
+  flow.maxBytes = maxBytes;
+  flow.state = PENDING;
+  flow.baseRtt = 0;
+  flow.window = 0;
+  flow.rate = 0;
+  flow.totalBytes = 0;
+  m_flows.push_back (flow);
+
+  if (!m_stepEvent.IsRunning ())
+    {
+      m_lastStep = Simulator::Now ();
+      m_stepEvent = Simulator::Schedule (start - Simulator::Now (), &FluidTrafficModel::Step, this);
+    }
+  else if (Simulator::GetDelayLeft (m_stepEvent) > start - Simulator::Now ())
+    {
+      m_stepEvent.Cancel ();
+      m_stepEvent = Simulator::Schedule (start - Simulator::Now (), &FluidTrafficModel::Step, this);
+    }
+  return static_cast<uint32_t> (m_flows.size () - 1);
+}
+
+DataRate
+FluidTrafficModel::GetFlowRate (uint32_t flowId) const
+{
+  NS_LOG_FUNCTION (this << flowId);
+  NS_ASSERT (flowId < m_flows.size ());
+  return DataRate (static_cast<uint64_t> (m_flows[flowId].rate * 8));
+}
+
+uint64_t
+FluidTrafficModel::GetFlowTotalBytes (uint32_t flowId) const
+{
+  NS_LOG_FUNCTION (this << flowId);
+  NS_ASSERT (flowId < m_flows.size ());
+  return static_cast<uint64_t> (m_flows[flowId].totalBytes);
+}
+
+bool
+FluidTrafficModel::IsFlowFinished (uint32_t flowId) const
+{
+  NS_LOG_FUNCTION (this << flowId);
+  NS_ASSERT (flowId < m_flows.size ());
+  return m_flows[flowId].state == FINISHED;
+}
+
+int32_t
+FluidTrafficModel::GetLink (Ptr<NetDevice> device)
+{
+  NS_LOG_FUNCTION (this << device);
+  std::map<Ptr<NetDevice>, uint32_t>::const_iterator it = m_linkIndex.find (device);
+  if (it != m_linkIndex.end ())
+    {
+      return it->second;
+    }
+
+  DataRateValue rate;
+  if (!device->GetAttributeFailSafe ("DataRate", rate) || rate.Get ().GetBitRate () == 0)
+    {
+      return -1;
+    }
+
+  Link link;
+  link.device = device;
+  link.capacity = rate.Get ().GetBitRate () / 8.0;
+  link.delay = GetChannelDelay (device);
+  PointerValue txQueue;
+  if (device->GetAttributeFailSafe ("TxQueue", txQueue))
+    {
+      link.txQueue = txQueue.Get<QueueBase> ();
+    }
+  Ptr<NetDeviceQueueInterface> ndqi = device->GetObject<NetDeviceQueueInterface> ();
+  if (ndqi && ndqi->GetNTxQueues () == 1)
+    {
+      link.deviceQueue = ndqi->GetTxQueue (0);
+    }
+
+  // The backlog builds in the root queue disc, if it has a size limit,
+  // or else in the transmission queue of the device
+  Ptr<TrafficControlLayer> tc = device->GetNode ()->GetObject<TrafficControlLayer> ();
+  Ptr<QueueDisc> queueDisc = tc ? tc->GetRootQueueDiscOnDevice (device) : 0;
+  link.buffer = 0;
+  if (queueDisc && queueDisc->GetSizePolicy () != QueueDiscSizePolicy::NO_LIMITS)
+    {
+      link.queueDisc = queueDisc;
+      QueueSize size = queueDisc->GetMaxSize ();
+      link.buffer = size.GetValue () * (size.GetUnit () == QueueSizeUnit::PACKETS ? m_packetSize : 1.0);
+    }
+  else if (link.txQueue)
+    {
+      QueueSize size = link.txQueue->GetMaxSize ();
+      link.buffer = size.GetValue () * (size.GetUnit () == QueueSizeUnit::PACKETS ? m_packetSize : 1.0);
+    }
+
+  link.backlog = 0;
+  link.fluidRate = 0;
+  link.packetRate = 0;
+  link.loss = 0;
+  link.lastRxBytes = link.txQueue ? link.txQueue->GetTotalReceivedBytes () : 0;
+  link.nFlows = 0;
+  m_links.push_back (link);
+  m_linkIndex[device] = static_cast<uint32_t> (m_links.size () - 1);
+  return static_cast<int32_t> (m_links.size () - 1);
+}
+
+void
+FluidTrafficModel::ComputePath (Flow &flow)
+{
+  NS_LOG_FUNCTION (this << flow.src << flow.dst);
+  flow.path.clear ();
+  flow.baseRtt = 0;
+
+  Ipv4Header header;
+  header.SetDestination (flow.dst);
+  Ptr<Node> node = flow.src;
+  for (uint32_t hop = 0; hop < FLUID_MAX_HOPS; hop++)
+    {
+      Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
+      if (ipv4 == 0)
+        {
+          break;
+        }
+      if (ipv4->GetInterfaceForAddress (flow.dst) >= 0)
+        {
+          return;
+        }
+      Socket::SocketErrno err;
+      Ptr<Ipv4Route> route = ipv4->GetRoutingProtocol ()->RouteOutput (0, header, 0, err);
+      if (route == 0)
+        {
+          break;
+        }
+      Ptr<NetDevice> device = route->GetOutputDevice ();
+      int32_t link = GetLink (device);
+      if (link >= 0)
+        {
+          flow.path.push_back (link);
+          flow.baseRtt += 2 * m_links[link].delay + m_packetSize / m_links[link].capacity;
+        }
+      else
+        {
+          flow.baseRtt += 2 * GetChannelDelay (device);
+        }
+
+      // The next node is the one owning the next hop address on the channel
+      Ipv4Address nextHop = route->GetGateway ();
+      if (nextHop == Ipv4Address::GetAny ())
+        {
+          nextHop = flow.dst;
+        }
+      Ptr<Channel> channel = device->GetChannel ();
+      Ptr<Node> next = 0;
+      for (std::size_t i = 0; channel && i < channel->GetNDevices () && next == 0; i++)
+        {
+          Ptr<NetDevice> peer = channel->GetDevice (i);
+          Ptr<Ipv4> peerIpv4 = peer->GetNode ()->GetObject<Ipv4> ();
+          if (peer != device && peerIpv4 && peerIpv4->GetInterfaceForAddress (nextHop) >= 0)
+            {
+              next = peer->GetNode ();
+            }
+        }
+      if (next == 0)
+        {
+          break;
+        }
+      node = next;
+    }
+  NS_LOG_WARN ("No path found from node " << flow.src->GetId () << " to " << flow.dst);
+}
+
+void
+FluidTrafficModel::UpdateMaxMin (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  // Water-filling: the flows crossing the link with the smallest fair share
+  // get this share, which is removed from the links of their path, until
+  // all the flows have a rate. The packets crossing a link count as one
+  // more flow of the link.
+  std::vector<double> residual (m_links.size ());
+  std::vector<uint32_t> nUnfrozen (m_links.size ());
+  for (uint32_t l = 0; l < m_links.size (); l++)
+    {
+      residual[l] = m_links[l].capacity;
+      nUnfrozen[l] = m_links[l].nFlows + (m_links[l].packetRate > 0 ? 1 : 0);
+      m_links[l].fluidRate = 0;
+      m_links[l].backlog = 0;
+      m_links[l].loss = 0;
+    }
+  std::vector<bool> frozen (m_flows.size (), true);
+  for (uint32_t f = 0; f < m_flows.size (); f++)
+    {
+      m_flows[f].rate = 0;
+      frozen[f] = m_flows[f].state != ACTIVE || m_flows[f].path.empty ();
+    }
+
+  while (true)
+    {
+      int32_t bottleneck = -1;
+      double share = std::numeric_limits<double>::max ();
+      for (uint32_t l = 0; l < m_links.size (); l++)
+        {
+          if (nUnfrozen[l] > 0 && residual[l] / nUnfrozen[l] < share)
+            {
+              bottleneck = l;
+              share = residual[l] / nUnfrozen[l];
+            }
+        }
+      if (bottleneck < 0)
+        {
+          break;
+        }
+      for (uint32_t f = 0; f < m_flows.size (); f++)
+        {
+          Flow &flow = m_flows[f];
+          if (frozen[f]
+              || std::find (flow.path.begin (), flow.path.end (), bottleneck) == flow.path.end ())
+            {
+              continue;
+            }
+          frozen[f] = true;
+          flow.rate = share;
+          for (std::vector<uint32_t>::const_iterator l = flow.path.begin (); l != flow.path.end (); l++)
+            {
+              residual[*l] = std::max (residual[*l] - share, 0.0);
+              nUnfrozen[*l]--;
+              m_links[*l].fluidRate += share;
+            }
+        }
+      // the packets of the bottleneck get their share too
+      if (nUnfrozen[bottleneck] > 0)
+        {
+          residual[bottleneck] = std::max (residual[bottleneck] - share, 0.0);
+          nUnfrozen[bottleneck]--;
+        }
+    }
+}
+
+void
+FluidTrafficModel::UpdateTcp (double dt)
+{
+  NS_LOG_FUNCTION (this << dt);
+
+  // Sending rates from the windows and the RTTs, queueing delay included
+  std::vector<double> rtt (m_flows.size (), 0);
+  for (uint32_t l = 0; l < m_links.size (); l++)
+    {
+      m_links[l].fluidRate = 0;
+    }
+  for (uint32_t f = 0; f < m_flows.size (); f++)
+    {
+      Flow &flow = m_flows[f];
+      if (flow.state != ACTIVE || flow.path.empty ())
+        {
+          flow.rate = 0;
+          continue;
+        }
+      rtt[f] = flow.baseRtt;
+      for (std::vector<uint32_t>::const_iterator l = flow.path.begin (); l != flow.path.end (); l++)
+        {
+          rtt[f] += m_links[*l].backlog / m_links[*l].capacity;
+        }
+      flow.rate = flow.window * m_packetSize / rtt[f];
+      for (std::vector<uint32_t>::const_iterator l = flow.path.begin (); l != flow.path.end (); l++)
+        {
+          m_links[*l].fluidRate += flow.rate;
+        }
+    }
+
+  // Queues, and drop tail losses once the buffer is full
+  for (uint32_t l = 0; l < m_links.size (); l++)
+    {
+      Link &link = m_links[l];
+      double arrival = link.fluidRate + link.packetRate;
+      link.backlog = std::min (std::max (link.backlog + dt * (arrival - link.capacity), 0.0), link.buffer);
+      link.loss = 0;
+      if (link.backlog >= link.buffer && arrival > link.capacity)
+        {
+          link.loss = (arrival - link.capacity) / arrival;
+        }
+    }
+
+  // Windows: additive increase of one packet per RTT, multiplicative
+  // decrease by half per loss
+  for (uint32_t f = 0; f < m_flows.size (); f++)
+    {
+      Flow &flow = m_flows[f];
+      if (flow.state != ACTIVE || flow.path.empty ())
+        {
+          continue;
+        }
+      // the flow is delivered at the rate the links serve it
+      double success = 1;
+      double served = 1;
+      for (std::vector<uint32_t>::const_iterator l = flow.path.begin (); l != flow.path.end (); l++)
+        {
+          const Link &link = m_links[*l];
+          double arrival = link.fluidRate + link.packetRate;
+          success *= 1 - link.loss;
+          if (arrival > link.capacity)
+            {
+              served *= link.capacity / arrival;
+            }
+        }
+      double loss = 1 - success;
+      flow.window += dt * (1 - flow.window * flow.window * loss / 2) / rtt[f];
+      flow.window = std::min (std::max (flow.window, 1.0), m_maxWindow);
+      flow.rate *= served;
+    }
+}
+
+void
+FluidTrafficModel::ApplyToLinks (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (uint32_t l = 0; l < m_links.size (); l++)
+    {
+      Link &link = m_links[l];
+      double served = 0;
+      double backlog = 0;
+      if (link.nFlows > 0)
+        {
+          // the link serves the flows and the packets in proportion to
+          // their arrival rates, and so is the backlog shared
+          double arrival = link.fluidRate + link.packetRate;
+          served = link.fluidRate;
+          if (arrival > link.capacity)
+            {
+              served = link.fluidRate * link.capacity / arrival;
+            }
+          if (arrival > 0)
+            {
+              backlog = link.backlog * link.fluidRate / arrival;
+            }
+        }
+      else
+        {
+          link.backlog = 0;
+        }
+      link.device->SetAttributeFailSafe ("BackgroundDataRate",
+                                         DataRateValue (DataRate (static_cast<uint64_t> (served * 8))));
+      uint32_t nBytes = static_cast<uint32_t> (backlog);
+      uint32_t nPackets = nBytes / m_packetSize;
+      if (link.queueDisc)
+        {
+          link.queueDisc->SetVirtualBacklog (nPackets, nBytes);
+        }
+      else if (link.txQueue)
+        {
+          link.txQueue->SetVirtualBacklog (nPackets, nBytes);
+          // The device queue is stopped when the backlog leaves no room for
+          // a packet, and no dequeue would wake it when the backlog drops
+          if (link.deviceQueue)
+            {
+              if (link.txQueue->WouldOverflow (1, link.device->GetMtu ()))
+                {
+                  link.deviceQueue->Stop ();
+                }
+              else
+                {
+                  link.deviceQueue->Wake ();
+                }
+            }
+        }
+    }
+}
+
+void
+FluidTrafficModel::Step (void)
+{
+  NS_LOG_FUNCTION (this);
+  Time now = Simulator::Now ();
+  double dt = m_timeStep.GetSeconds ();
+
+  // Start and stop the flows
+  bool pending = false;
+  for (uint32_t f = 0; f < m_flows.size (); f++)
+    {
+      Flow &flow = m_flows[f];
+      if (flow.state == PENDING && now >= flow.start)
+        {
+          ComputePath (flow);
+          flow.window = m_initialWindow;
+          flow.state = ACTIVE;
+        }
+      if (flow.state == ACTIVE && !flow.stop.IsZero () && now >= flow.stop)
+        {
+          flow.state = FINISHED;
+          flow.rate = 0;
+        }
+      pending |= (flow.state == PENDING);
+    }
+
+  // Measure the arrival rate of the packets at each link
+  double elapsed = (now - m_lastStep).GetSeconds ();
+  for (uint32_t l = 0; l < m_links.size (); l++)
+    {
+      Link &link = m_links[l];
+      link.nFlows = 0;
+      if (link.txQueue)
+        {
+          uint32_t rxBytes = link.txQueue->GetTotalReceivedBytes ();
+          link.packetRate = elapsed > 0 ? (rxBytes - link.lastRxBytes) / elapsed : 0;
+          link.lastRxBytes = rxBytes;
+        }
+    }
+  m_lastStep = now;
+
+  for (uint32_t f = 0; f < m_flows.size (); f++)
+    {
+      if (m_flows[f].state == ACTIVE)
+        {
+          for (std::vector<uint32_t>::const_iterator l = m_flows[f].path.begin ();
+               l != m_flows[f].path.end (); l++)
+            {
+              m_links[*l].nFlows++;
+            }
+        }
+    }
+
+  if (m_model == MAX_MIN)
+    {
+      UpdateMaxMin ();
+    }
+  else
+    {
+      UpdateTcp (dt);
+    }
+
+  // The bytes delivered until the next step
+  for (uint32_t f = 0; f < m_flows.size (); f++)
+    {
+      Flow &flow = m_flows[f];
+      if (flow.state != ACTIVE)
+        {
+          continue;
+        }
+      flow.totalBytes += flow.rate * dt;
+      if (flow.maxBytes > 0 && flow.totalBytes >= flow.maxBytes)
+        {
+          NS_LOG_LOGIC ("Flow " << f << " completed");
+          flow.totalBytes = flow.maxBytes;
+          flow.state = FINISHED;
+          flow.rate = 0;
+          m_flowCompletedTrace (f);
+        }
+    }
+
+  // Once no flow is active, the links get back to the packets
+  bool active = false;
+  Time nextStart = Time::Max ();
+  for (uint32_t f = 0; f < m_flows.size (); f++)
+    {
+      active |= (m_flows[f].state == ACTIVE);
+      if (m_flows[f].state == PENDING)
+        {
+          nextStart = std::min (nextStart, m_flows[f].start);
+        }
+    }
+  if (!active)
+    {
+      for (uint32_t l = 0; l < m_links.size (); l++)
+        {
+          m_links[l].nFlows = 0;
+        }
+    }
+  ApplyToLinks ();
+
+  if (active)
+    {
+      m_stepEvent = Simulator::Schedule (m_timeStep, &FluidTrafficModel::Step, this);
+    }
+  else if (pending)
+    {
+      m_stepEvent = Simulator::Schedule (nextStart - now, &FluidTrafficModel::Step, this);
+    }
+}
+
+} // namespace ns3
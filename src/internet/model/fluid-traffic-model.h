@@ -0,0 +1,225 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef FLUID_TRAFFIC_MODEL_H
+#define FLUID_TRAFFIC_MODEL_H
+
+#include <map>
+#include <vector>
+#include "ns3/object.h"
+#include "ns3/node.h"
+#include "ns3/net-device.h"
+#include "ns3/nstime.h"
+#include "ns3/data-rate.h"
+#include "ns3/event-id.h"
+#include "ns3/traced-callback.h"
+#include "ns3/ipv4-address.h"
+
+namespace ns3 {
+
+class QueueBase;
+class QueueDisc;
+class NetDeviceQueue;
+
+/**
+ * \ingroup internet
+ *
+ * \brief A flow-level model of background bulk transfers.
+ *
+ * Background flows are declared with AddFlow () instead of being simulated
+ * packet by packet (e.g., by a BulkSendApplication). Each flow follows the
+ * route that the packets from its source to its destination would take
+ * when it starts, and the model computes every TimeStep the rate of each
+ * flow and the backlog it builds on each link of its path, either:
+ *
+ * - MAX_MIN: the max-min fair share of the links, whose queues stay empty;
+ * - TCP: the fluid model of TCP Reno of Misra, Gong and Towsley, in which
+ *   the window of a flow grows by one packet per RTT and shrinks with the
+ *   losses of the drop tail buffers of its path, and the queueing delay
+ *   adds to its RTT.
+ *
+ * The packets still simulated on the same links (the foreground traffic)
+ * take part in the sharing: their arrival rate at the transmission queue
+ * of a device is measured at every step, and the flows share what remains
+ * of the link (MAX_MIN) or overflow the buffer along with them (TCP). In
+ * turn, the model acts on the packets:
+ *
+ * - the rate served to the flows is set as the "BackgroundDataRate"
+ *   attribute of the device, so that packets are sent at the remaining
+ *   rate (only SimpleNetDevice and PointToPointNetDevice support it);
+ * - the backlog of the flows is set as the virtual backlog of the root
+ *   queue disc of the device (if it has a size limit), or else of the
+ *   transmission queue of the device, so that packets wait behind it and
+ *   are dropped when the buffer is full.
+ *
+ * The capacity of a link is the "DataRate" attribute of the device and its
+ * propagation delay the "Delay" attribute of its channel. Links of devices
+ * without a data rate are not modeled. Only IPv4 destinations are
+ * supported.
+ */
+class FluidTrafficModel : public Object
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  /// The model of the rates of the flows
+  enum Model
+  {
+    MAX_MIN,  //!< Max-min fair sharing
+    TCP       //!< Fluid model of TCP Reno
+  };
+
+  FluidTrafficModel ();
+  virtual ~FluidTrafficModel ();
+
+  /**
+   * \brief Add a background flow.
+   *
+   * \param src the node sending the flow
+   * \param dst the destination of the flow
+   * \param start the time the flow starts
+   * \param stop the time the flow stops, or zero if it runs until it has
+   *        sent maxBytes
+   * \param maxBytes the number of bytes of the flow, or zero if unlimited
+   * \returns the identifier of the flow
+   */
+  uint32_t AddFlow (Ptr<Node> src, Ipv4Address dst, Time start, Time stop, uint64_t maxBytes);
+
+  /**
+   * \param flowId the identifier of a flow
+   * \returns the current rate of the flow
+   */
+  DataRate GetFlowRate (uint32_t flowId) const;
+
+  /**
+   * \param flowId the identifier of a flow
+   * \returns the number of bytes delivered by the flow so far
+   */
+  uint64_t GetFlowTotalBytes (uint32_t flowId) const;
+
+  /**
+   * \param flowId the identifier of a flow
+   * \returns true if the flow has sent all its bytes or has stopped
+   */
+  bool IsFlowFinished (uint32_t flowId) const;
+
+  /**
+   * TracedCallback signature for flow completion.
+   *
+   * \param [in] flowId The identifier of the flow.
+   */
+  typedef void (* FlowCompletedTracedCallback) (uint32_t flowId);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /// State of a flow
+  enum FlowState
+  {
+    PENDING,  //!< Not started yet
+    ACTIVE,   //!< Sending
+    FINISHED  //!< All bytes sent, or stopped
+  };
+
+  /// A link (a transmitting device) shared by flows
+  struct Link
+  {
+    Ptr<NetDevice> device;      //!< the transmitting device
+    Ptr<QueueBase> txQueue;     //!< the transmission queue of the device, if any
+    Ptr<QueueDisc> queueDisc;   //!< the root queue disc holding the backlog, if any
+    Ptr<NetDeviceQueue> deviceQueue; //!< the flow control of the transmission queue, if any
+    double capacity;            //!< the capacity, in bytes/s
+    double delay;               //!< the propagation delay, in s
+    double buffer;              //!< the buffer size, in bytes
+    double backlog;             //!< the queue length (TCP model), in bytes
+    double fluidRate;           //!< the arrival rate of the flows, in bytes/s
+    double packetRate;          //!< the arrival rate of the packets, in bytes/s
+    double loss;                //!< the loss probability (TCP model)
+    uint32_t lastRxBytes;       //!< bytes received by the transmission queue at the last step
+    uint32_t nFlows;            //!< number of active flows crossing the link
+  };
+
+  /// A background flow
+  struct Flow
+  {
+    Ptr<Node> src;              //!< the source node
+    Ipv4Address dst;            //!< the destination
+    Time start;                 //!< the start time
+    Time stop;                  //!< the stop time, or zero
+    uint64_t maxBytes;          //!< the flow size, or zero
+    FlowState state;            //!< the state of the flow
+    std::vector<uint32_t> path; //!< the indexes of the links of the path
+    double baseRtt;             //!< the RTT without queueing, in s
+    double window;              //!< the congestion window (TCP model), in packets
+    double rate;                //!< the current rate, in bytes/s
+    double totalBytes;          //!< the bytes delivered so far
+  };
+
+  /**
+   * \brief Advance the model by one step and apply it to the links.
+   */
+  void Step (void);
+
+  /**
+   * \brief Find the links from the source of a flow to its destination.
+   * \param flow the flow
+   */
+  void ComputePath (Flow &flow);
+
+  /**
+   * \brief Get the index of the link of a device, adding it if needed.
+   * \param device the transmitting device
+   * \returns the index of the link, or -1 if the device has no data rate
+   */
+  int32_t GetLink (Ptr<NetDevice> device);
+
+  /**
+   * \brief Compute the max-min fair rates of the active flows.
+   */
+  void UpdateMaxMin (void);
+
+  /**
+   * \brief Advance the TCP fluid model of the active flows.
+   * \param dt the step duration, in s
+   */
+  void UpdateTcp (double dt);
+
+  /**
+   * \brief Set the rate and the backlog of the flows on the devices.
+   */
+  void ApplyToLinks (void);
+
+  Model m_model;                       //!< the model of the rates
+  Time m_timeStep;                     //!< the step of the model
+  uint32_t m_packetSize;               //!< the packet size of the flows
+  double m_initialWindow;              //!< the initial window (TCP model), in packets
+  double m_maxWindow;                  //!< the maximum window (TCP model), in packets
+  std::vector<Link> m_links;           //!< the links crossed by flows
+  std::map<Ptr<NetDevice>, uint32_t> m_linkIndex; //!< the index of the link of each device
+  std::vector<Flow> m_flows;           //!< the flows
+  EventId m_stepEvent;                 //!< the next step
+  Time m_lastStep;                     //!< the time of the last step
+  TracedCallback<uint32_t> m_flowCompletedTrace; //!< trace of the completed flows
+};
+
+} // namespace ns3
+
+#endif /* FLUID_TRAFFIC_MODEL_H */
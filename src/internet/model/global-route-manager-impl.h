@@ -27,6 +27,7 @@
 #include <queue>
 #include <map>
 #include <vector>
+#include <unordered_map>
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 #include "ns3/ipv4-address.h"
@@ -576,6 +577,14 @@ private:
  *
  * This class implements a searchable database of LSAs gathered from every
  * router in the simulation.
+ *
+ * The router and network LSAs are stored in a flat array, in insertion
+ * order, and indexed by link state ID and by the link data of their transit
+ * network records.  Once all the LSAs are inserted, BuildAdjacencies ()
+ * resolves the neighbour of each link record, or attached router, into the
+ * array index of its LSA, so that the SPF calculations walk the graph without
+ * looking up addresses.  Nothing is modified during the SPF calculations, so
+ * that several of them can run concurrently over the same database.
  */
 class GlobalRouteManagerLSDB
 {
@@ -674,12 +683,68 @@ public:
    */
   uint32_t GetNumExtLSAs () const;
 
+  /// Index of a missing Link State Advertisement
+  static const uint32_t NO_LSA = 0xffffffff;
 
-private:
-  typedef std::map<Ipv4Address, GlobalRoutingLSA*> LSDBMap_t; //!< container of IPv4 addresses / Link State Advertisements
-  typedef std::pair<Ipv4Address, GlobalRoutingLSA*> LSDBPair_t; //!< pair of IPv4 addresses / Link State Advertisements
+  /**
+   * @brief Get the number of router and network Link State Advertisements.
+   *
+   * @returns the number of router and network Link State Advertisements.
+   */
+  uint32_t GetNumLSAs () const;
+
+  /**
+   * @brief Look up a router or network Link State Advertisement by its
+   * index, between 0 and GetNumLSAs () - 1.
+   *
+   * @param index the index of the LSA.
+   * @returns A pointer to the Link State Advertisement.
+   */
+  GlobalRoutingLSA* GetLSAByIndex (uint32_t index) const;
+
+  /**
+   * @brief Look up the index of the Link State Advertisement associated with
+   * the given link state ID (address).
+   *
+   * @param addr The IP address associated with the LSA.
+   * @returns the index of the LSA, or NO_LSA if there is none.
+   */
+  uint32_t GetLSAIndex (Ipv4Address addr) const;
 
-  LSDBMap_t m_database; //!< database of IPv4 addresses / Link State Advertisements
+  /**
+   * @brief Resolve the neighbours of all the router and network Link State
+   * Advertisements into LSA indexes.
+   *
+   * This must be called after the last Insert () and before
+   * GetAdjacency ().  It does nothing if the adjacencies are up to date.
+   */
+  void BuildAdjacencies ();
+
+  /**
+   * @brief Get the neighbour of a link record of a router LSA, or of an
+   * attached router of a network LSA.
+   *
+   * The neighbour of a point-to-point or transit network record is the LSA
+   * whose link state ID is the link ID of the record; the neighbour of an
+   * attached router is the LSA returned by GetLSAByLinkData ().
+   *
+   * @param index the index of the LSA.
+   * @param i the index of the link record, or of the attached router.
+   * @returns the index of the neighbour's LSA, or NO_LSA for a stub network
+   * record or an unknown neighbour.
+   */
+  uint32_t GetAdjacency (uint32_t index, uint32_t i) const;
+
+
+private:
+  /// container of LSA indexes, by address
+  typedef std::unordered_map<Ipv4Address, uint32_t, Ipv4AddressHash> LSDBIndex_t;
+
+  std::vector<GlobalRoutingLSA*> m_database; //!< database of router and network Link State Advertisements
+  LSDBIndex_t m_index; //!< indexes of the LSAs, by link state ID
+  LSDBIndex_t m_linkDataIndex; //!< indexes of the LSAs, by link data of their transit network records
+  std::vector<uint32_t> m_adjacencyStart; //!< start of the neighbours of each LSA in m_adjacency
+  std::vector<uint32_t> m_adjacency; //!< indexes of the neighbours of the LSAs, see GetAdjacency ()
   std::vector<GlobalRoutingLSA*> m_extdatabase; //!< database of External Link State Advertisements
 
 /**
@@ -708,6 +773,13 @@ private:
  * and finally configure each of the node's forwarding tables.
  *
  * The design is guided by OSPFv2 \RFC{2328} section 16.1.1 and quagga ospfd.
+ *
+ * The SPF calculations of the different roots only read the LSDB, and each
+ * of them writes only to the forwarding table of its root, so they are
+ * spread over the number of threads set by the "GlobalRoutingThreads"
+ * global value.  UpdateRoutes () compares a new LSDB with the previous one,
+ * and only runs again the SPF calculations that may depend on a changed
+ * LSA.
  */
 class GlobalRouteManagerImpl
 {
@@ -735,6 +807,20 @@ public:
  */
   virtual void InitializeRoutes ();
 
+/**
+ * @brief Rebuild the routing database, and compute again the routes of
+ * the routers whose shortest path tree may have changed since the previous
+ * call to InitializeRoutes () or UpdateRoutes ().
+ *
+ * The routes of a router are deleted and computed again if its interface
+ * addresses changed, if an LSA of the part of the topology it is connected
+ * to (before or after the change) was added, removed or modified, or if an
+ * external LSA changed.  A stub router, which only has a default route to
+ * its single neighbour, only depends on its own LSA and on that of its
+ * neighbour.  The routes of the other routers are left untouched.
+ */
+  virtual void UpdateRoutes ();
+
 /**
  * @brief Debugging routine; allow client code to supply a pre-built LSDB
  * @param lsdb the pre-built LSDB
@@ -767,8 +853,68 @@ private:
  */
   GlobalRouteManagerImpl& operator= (GlobalRouteManagerImpl& srmi);
 
+  /**
+   * \brief The router at the root of an SPF calculation.
+   *
+   * The interface addresses of the node are read before the calculation,
+   * so that it does not need to access the node.
+   */
+  struct SPFRoot
+  {
+    Ipv4Address routerId; //!< the router ID
+    Ipv4GlobalRouting *routing; //!< the routing protocol receiving the routes, or null
+    std::vector<std::pair<int32_t, Ipv4Address> > addresses; //!< the interface and local address of each address of the node
+    bool checkStub; //!< whether to check for a stub node
+    bool stub; //!< whether the last calculation found a stub node
+    Ipv4Address stubPeer; //!< the neighbour of the stub node
+  };
+
+  /**
+   * \brief Construct a worker sharing the LSDB of the main instance, to
+   * run SPF calculations in another thread.
+   *
+   * \param lsdb the LSDB, not owned by the worker
+   */
+  GlobalRouteManagerImpl (GlobalRouteManagerLSDB* lsdb);
+
+  /**
+   * \brief Get the roots of the SPF calculations: the routers of this
+   * system that exported at least one LSA.
+   *
+   * \returns the roots, in node order
+   */
+  std::vector<SPFRoot> GetRoots (void) const;
+
+  /**
+   * \brief Read the interface addresses of a node.
+   *
+   * \param node the node
+   * \param root the root to fill in
+   */
+  static void GetRootAddresses (Ptr<Node> node, SPFRoot &root);
+
+  /**
+   * \brief Run the SPF calculations of some roots, spreading them over the
+   * worker threads.
+   *
+   * \param roots the roots
+   */
+  void CalculateRoutes (const std::vector<SPFRoot*> &roots);
+
+  /**
+   * \brief Delete all the routes of a routing protocol.
+   *
+   * \param routing the routing protocol
+   */
+  static void DeleteRoutes (Ipv4GlobalRouting *routing);
+
   SPFVertex* m_spfroot; //!< the root node
   GlobalRouteManagerLSDB* m_lsdb; //!< the Link State DataBase (LSDB) of the Global Route Manager
+  bool m_ownsLsdb; //!< whether m_lsdb is deleted with this object
+  SPFRoot* m_root; //!< the root of the current SPF calculation
+  std::vector<GlobalRoutingLSA::SPFStatus> m_status; //!< the SPF status of each LSA, by LSA index
+  std::vector<SPFVertex*> m_candidates; //!< the candidate vertex of each LSA, by LSA index
+  std::vector<SPFRoot> m_roots; //!< the roots of the last calculations
 
   /**
    * \brief Test if a node is a stub, from an OSPF sense.
@@ -783,12 +929,13 @@ private:
   bool CheckForStubNode (Ipv4Address root);
 
   /**
-   * \brief Calculate the shortest path first (SPF) tree
+   * \brief Calculate the shortest path first (SPF) tree, and add the routes
+   * of the root
    *
    * Equivalent to quagga ospf_spf_calculate
    * \param root the root node
    */
-  void SPFCalculate (Ipv4Address root);
+  void SPFCalculate (SPFRoot &root);
 
   /**
    * \brief Process Stub nodes
@@ -936,8 +1083,8 @@ private:
   /**
    * \brief Return the interface number corresponding to a given IP address and mask
    *
-   * This is a wrapper around GetInterfaceForPrefix(), but we first
-   * have to find the right node pointer to pass to that function.
+   * This is equivalent to GetInterfaceForPrefix() on the root node, but
+   * looks up the interface addresses read before the SPF calculation.
    * If no such interface is found, return -1 (note:  unit test framework
    * for routing assumes -1 to be a legal return value)
    *
@@ -65,6 +65,13 @@ public:
  */
   static void InitializeRoutes ();
 
+/**
+ * @brief Rebuild the routing database, and compute again the routes of the
+ * routers whose shortest path tree may have changed since the previous
+ * call to InitializeRoutes () or UpdateRoutes ()
+ */
+  static void UpdateRoutes ();
+
 private:
 /**
  * @brief Global Route Manager copy construction is disallowed.  There's no 
@@ -399,6 +399,10 @@ void Icmpv6L4Protocol::ReceiveLLA (Icmpv6OptionLinkLayerAddress lla, Ipv6Address
       entry->MarkReachable ();
       entry->StartReachableTimer ();
     }
+  else if (entry->IsPermanent ())
+    {
+      NS_LOG_LOGIC ("Permanent entry for " << src << " left unchanged");
+    }
   else
     {
       std::list<NdiscCache::Ipv6PayloadHeaderPair> waiting;
@@ -478,7 +482,7 @@ void Icmpv6L4Protocol::HandleRS (Ptr<Packet> packet, Ipv6Address const &src, Ipv
           entry->SetRouter (false);
           entry->MarkStale (lla.GetAddress ());
         }
-      else if (entry->GetMacAddress () != lla.GetAddress ())
+      else if (!entry->IsPermanent () && entry->GetMacAddress () != lla.GetAddress ())
         {
           entry->MarkStale (lla.GetAddress ());
         }
@@ -573,7 +577,7 @@ void Icmpv6L4Protocol::HandleNS (Ptr<Packet> packet, Ipv6Address const &src, Ipv
           entry->MarkStale (sllaoHdr.GetAddress ());
           replyMacAddress = sllaoHdr.GetAddress ();
         }
-      else if (hasSllao && (entry->GetMacAddress () != sllaoHdr.GetAddress ()))
+      else if (hasSllao && !entry->IsPermanent () && (entry->GetMacAddress () != sllaoHdr.GetAddress ()))
         {
           entry->MarkStale (sllaoHdr.GetAddress ());
           replyMacAddress = sllaoHdr.GetAddress ();
@@ -722,6 +726,12 @@ void Icmpv6L4Protocol::HandleNA (Ptr<Packet> packet, Ipv6Address const &src, Ipv
     }
   packet->RemoveHeader (lla);
 
+  if (entry->IsPermanent ())
+    {
+      NS_LOG_LOGIC ("Permanent entry for " << target << " left unchanged");
+      return;
+    }
+
   if (entry->IsIncomplete ())
     {
       /* we receive a NA so stop the retransmission timer */
@@ -844,7 +854,11 @@ void Icmpv6L4Protocol::HandleRedirection (Ptr<Packet> packet, Ipv6Address const
         }
       else
         {
-          if (entry->IsIncomplete () || entry->GetMacAddress () != llOptionHeader.GetAddress ())
+          if (entry->IsPermanent ())
+            {
+              /* permanent entries stay unchanged */
+            }
+          else if (entry->IsIncomplete () || entry->GetMacAddress () != llOptionHeader.GetAddress ())
             {
               /* update entry to STALE */
               if (entry->GetMacAddress () != llOptionHeader.GetAddress ())
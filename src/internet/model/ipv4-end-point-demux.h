@@ -23,6 +23,8 @@
 
 #include <stdint.h>
 #include <list>
+#include <unordered_map>
+#include <vector>
 #include "ns3/ipv4-address.h"
 #include "ipv4-interface.h"
 
@@ -39,7 +41,13 @@ class Ipv4EndPoint;
  * about a four-tuple to an ns3::Ipv4EndPoint.  It internally contains a list
  * of endpoints, and has APIs to add and find endpoints in this demux.  This
  * code is shared in common to TCP and UDP protocols in ns3.  This demux
- * sits between ns3's layer four and the socket layer
+ * sits between ns3's layer four and the socket layer.
+ *
+ * Besides the list, the endpoints are indexed by local and peer addresses
+ * and ports, and by local port, so that a lookup probes the few keys that
+ * can match a packet instead of comparing it with every endpoint.  The
+ * endpoints notify the demux that allocated them when their addresses or
+ * ports change.
  */
 
 class Ipv4EndPointDemux {
@@ -166,6 +174,98 @@ public:
   void DeAllocate (Ipv4EndPoint *endPoint);
 
 private:
+  /**
+   * \brief The local and peer addresses and ports of an endpoint.
+   */
+  struct EndPointKey
+  {
+    Ipv4Address localAddress; //!< the local address
+    uint16_t localPort;       //!< the local port
+    Ipv4Address peerAddress;  //!< the peer address
+    uint16_t peerPort;        //!< the peer port
+
+    /**
+     * \brief Comparison operator.
+     * \param other the other key
+     * \returns true if the keys are equal
+     */
+    bool operator== (const EndPointKey &other) const;
+  };
+
+  /**
+   * \brief Hash function of the endpoint keys.
+   */
+  struct EndPointKeyHash
+  {
+    /**
+     * \param key the key
+     * \returns the hash of the key
+     */
+    std::size_t operator() (const EndPointKey &key) const;
+  };
+
+  /**
+   * \brief Index of the endpoints by local and peer addresses and ports.
+   */
+  typedef std::unordered_multimap<EndPointKey, Ipv4EndPoint *, EndPointKeyHash> TupleIndex;
+
+  /**
+   * \brief Index of the endpoints by local port, in allocation order.
+   */
+  typedef std::unordered_map<uint16_t, std::vector<Ipv4EndPoint *> > PortIndex;
+
+  /**
+   * \brief Get the key of an endpoint.
+   * \param endPoint the endpoint
+   * \returns the local and peer addresses and ports of the endpoint
+   */
+  static EndPointKey GetKey (Ipv4EndPoint *endPoint);
+
+  /**
+   * \brief Add an endpoint to the list and the indexes.
+   * \param endPoint the endpoint
+   */
+  void AddEndPoint (Ipv4EndPoint *endPoint);
+
+  /**
+   * \brief Add an endpoint to the index by addresses and ports.
+   * \param endPoint the endpoint
+   */
+  void InsertTuple (Ipv4EndPoint *endPoint);
+
+  /**
+   * \brief Remove an endpoint from the index by addresses and ports.
+   * \param endPoint the endpoint
+   */
+  void RemoveTuple (Ipv4EndPoint *endPoint);
+
+  /**
+   * \brief Add an endpoint to the index by local port.
+   * \param endPoint the endpoint
+   */
+  void InsertPort (Ipv4EndPoint *endPoint);
+
+  /**
+   * \brief Remove an endpoint from the index by local port.
+   * \param endPoint the endpoint
+   */
+  void RemovePort (Ipv4EndPoint *endPoint);
+
+  /**
+   * \brief Find the endpoints with the given addresses and ports that can
+   * receive packets from an interface.
+   * \param localAddress local address
+   * \param localPort local port
+   * \param peerAddress peer address
+   * \param peerPort peer port
+   * \param incomingInterface the incoming interface
+   * \param found [out] list the endpoints are appended to
+   */
+  void FindEndPoints (Ipv4Address localAddress, uint16_t localPort,
+                      Ipv4Address peerAddress, uint16_t peerPort,
+                      Ptr<Ipv4Interface> incomingInterface, EndPoints &found);
+
+  friend class Ipv4EndPoint;
 
   /**
    * \brief Allocate an ephemeral port.
@@ -192,6 +292,16 @@ private:
    * \brief A list of IPv4 end points.
    */
   EndPoints m_endPoints;
+
+  /**
+   * \brief The end points, by local and peer addresses and ports.
+   */
+  TupleIndex m_tuples;
+
+  /**
+   * \brief The end points, by local port.
+   */
+  PortIndex m_ports;
 };
 
 } // namespace ns3
@@ -18,6 +18,8 @@
 
 #include <vector>
 #include <iomanip>
+#include <iterator>
+#include <algorithm>
 #include "ns3/names.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
@@ -37,6 +39,25 @@ NS_LOG_COMPONENT_DEFINE ("Ipv4GlobalRouting");
 
 NS_OBJECT_ENSURE_REGISTERED (Ipv4GlobalRouting);
 
+/**
+ * \brief Compute the key of a route in a forwarding table index.
+ * \param route the route
+ * \param key [out] the destination network, in network byte order
+ * \return the key length
+ */
+static uint8_t
+GetFibKey (const Ipv4RoutingTableEntry *route, uint8_t key[4])
+{
+  uint8_t mask[4];
+  uint32_t m = route->GetDestNetworkMask ().Get ();
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      mask[i] = static_cast<uint8_t> (m >> (24 - 8 * i));
+    }
+  route->GetDestNetwork ().Serialize (key);
+  return PrefixTrie<4, int>::GetMaskLength (mask);
+}
+
 TypeId 
 Ipv4GlobalRouting::GetTypeId (void)
 { 
@@ -59,7 +80,8 @@ Ipv4GlobalRouting::GetTypeId (void)
 
 Ipv4GlobalRouting::Ipv4GlobalRouting () 
   : m_randomEcmpRouting (false),
-    m_respondToInterfaceEvents (false)
+    m_respondToInterfaceEvents (false),
+    m_fibSequence (0)
 {
   NS_LOG_FUNCTION (this);
 
@@ -79,7 +101,7 @@ Ipv4GlobalRouting::AddHostRouteTo (Ipv4Address dest,
   NS_LOG_FUNCTION (this << dest << nextHop << interface);
   Ipv4RoutingTableEntry *route = new Ipv4RoutingTableEntry ();
   *route = Ipv4RoutingTableEntry::CreateHostRouteTo (dest, nextHop, interface);
-  m_hostRoutes.push_back (route);
+  AddRoute (m_hostRoutes, m_hostFib, route);
 }
 
 void 
@@ -89,7 +111,7 @@ Ipv4GlobalRouting::AddHostRouteTo (Ipv4Address dest,
   NS_LOG_FUNCTION (this << dest << interface);
   Ipv4RoutingTableEntry *route = new Ipv4RoutingTableEntry ();
   *route = Ipv4RoutingTableEntry::CreateHostRouteTo (dest, interface);
-  m_hostRoutes.push_back (route);
+  AddRoute (m_hostRoutes, m_hostFib, route);
 }
 
 void 
@@ -104,7 +126,7 @@ Ipv4GlobalRouting::AddNetworkRouteTo (Ipv4Address network,
                                                         networkMask,
                                                         nextHop,
                                                         interface);
-  m_networkRoutes.push_back (route);
+  AddRoute (m_networkRoutes, m_networkFib, route);
 }
 
 void 
@@ -117,7 +139,7 @@ Ipv4GlobalRouting::AddNetworkRouteTo (Ipv4Address network,
   *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo (network,
                                                         networkMask,
                                                         interface);
-  m_networkRoutes.push_back (route);
+  AddRoute (m_networkRoutes, m_networkFib, route);
 }
 
 void 
@@ -132,9 +154,42 @@ Ipv4GlobalRouting::AddASExternalRouteTo (Ipv4Address network,
                                                         networkMask,
                                                         nextHop,
                                                         interface);
-  m_ASexternalRoutes.push_back (route);
+  AddRoute (m_ASexternalRoutes, m_ASexternalFib, route);
+}
+
+
+void
+Ipv4GlobalRouting::AddRoute (std::list<Ipv4RoutingTableEntry *> &routes, Fib &fib, Ipv4RoutingTableEntry *route)
+{
+  routes.push_back (route);
+  uint8_t key[4];
+  uint8_t length = GetFibKey (route, key);
+  fib.Insert (key, length, FibEntry (m_fibSequence++, std::prev (routes.end ())));
 }
 
+void
+Ipv4GlobalRouting::RemoveRoute (std::list<Ipv4RoutingTableEntry *> &routes, Fib &fib,
+                                std::list<Ipv4RoutingTableEntry *>::iterator route)
+{
+  uint8_t key[4];
+  uint8_t length = GetFibKey (*route, key);
+  bool found = fib.Remove (key, length, [route] (const FibEntry &entry) { return entry.second == route; });
+  NS_ASSERT (found);
+  delete *route;
+  routes.erase (route);
+}
+
+void
+Ipv4GlobalRouting::MatchRoutes (const Fib &fib, Ipv4Address dest)
+{
+  uint8_t key[4];
+  dest.Serialize (key);
+  m_fibCandidates.clear ();
+  fib.Match (key, [this] (uint8_t, const std::vector<FibEntry> &routes)
+             { m_fibCandidates.insert (m_fibCandidates.end (), routes.begin (), routes.end ()); });
+  std::sort (m_fibCandidates.begin (), m_fibCandidates.end (),
+             [] (const FibEntry &a, const FibEntry &b) { return a.first < b.first; });
+}
 
 Ptr<Ipv4Route>
 Ipv4GlobalRouting::LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif)
@@ -147,10 +202,20 @@ Ipv4GlobalRouting::LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif)
   RouteVec_t allRoutes;
 
   NS_LOG_LOGIC ("Number of m_hostRoutes = " << m_hostRoutes.size ());
-  for (HostRoutesCI i = m_hostRoutes.begin (); 
-       i != m_hostRoutes.end (); 
-       i++) 
+  uint8_t key[4];
+  dest.Serialize (key);
+  // The host routes to dest all have its key, in the order of the list
+  m_fibCandidates.clear ();
+  const std::vector<FibEntry> *hostRoutes = m_hostFib.Find (key, 32);
+  if (hostRoutes != 0)
+    {
+      m_fibCandidates.assign (hostRoutes->begin (), hostRoutes->end ());
+    }
+  for (std::vector<FibEntry>::const_iterator h = m_fibCandidates.begin ();
+       h != m_fibCandidates.end ();
+       h++)
     {
+      HostRoutesCI i = h->second;
       NS_ASSERT ((*i)->IsHost ());
       if ((*i)->GetDest () == dest)
         {
@@ -169,10 +234,12 @@ Ipv4GlobalRouting::LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif)
   if (allRoutes.size () == 0) // if no host route is found
     {
       NS_LOG_LOGIC ("Number of m_networkRoutes" << m_networkRoutes.size ());
-      for (NetworkRoutesI j = m_networkRoutes.begin (); 
-           j != m_networkRoutes.end (); 
-           j++) 
+      MatchRoutes (m_networkFib, dest);
+      for (std::vector<FibEntry>::const_iterator n = m_fibCandidates.begin ();
+           n != m_fibCandidates.end ();
+           n++)
         {
+          NetworkRoutesI j = n->second;
           Ipv4Mask mask = (*j)->GetDestNetworkMask ();
           Ipv4Address entry = (*j)->GetDestNetwork ();
           if (mask.IsMatch (dest, entry)) 
@@ -192,10 +259,12 @@ Ipv4GlobalRouting::LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif)
     }
   if (allRoutes.size () == 0)  // consider external if no host/network found
     {
-      for (ASExternalRoutesI k = m_ASexternalRoutes.begin ();
-           k != m_ASexternalRoutes.end ();
-           k++)
+      MatchRoutes (m_ASexternalFib, dest);
+      for (std::vector<FibEntry>::const_iterator e = m_fibCandidates.begin ();
+           e != m_fibCandidates.end ();
+           e++)
         {
+          ASExternalRoutesI k = e->second;
           Ipv4Mask mask = (*k)->GetDestNetworkMask ();
           Ipv4Address entry = (*k)->GetDestNetwork ();
           if (mask.IsMatch (dest, entry))
@@ -319,8 +388,7 @@ Ipv4GlobalRouting::RemoveRoute (uint32_t index)
           if (tmp  == index)
             {
               NS_LOG_LOGIC ("Removing route " << index << "; size = " << m_hostRoutes.size ());
-              delete *i;
-              m_hostRoutes.erase (i);
+              RemoveRoute (m_hostRoutes, m_hostFib, i);
               NS_LOG_LOGIC ("Done removing host route " << index << "; host route remaining size = " << m_hostRoutes.size ());
               return;
             }
@@ -336,8 +404,7 @@ Ipv4GlobalRouting::RemoveRoute (uint32_t index)
       if (tmp == index)
         {
           NS_LOG_LOGIC ("Removing route " << index << "; size = " << m_networkRoutes.size ());
-          delete *j;
-          m_networkRoutes.erase (j);
+          RemoveRoute (m_networkRoutes, m_networkFib, j);
           NS_LOG_LOGIC ("Done removing network route " << index << "; network route remaining size = " << m_networkRoutes.size ());
           return;
         }
@@ -352,8 +419,7 @@ Ipv4GlobalRouting::RemoveRoute (uint32_t index)
       if (tmp == index)
         {
           NS_LOG_LOGIC ("Removing route " << index << "; size = " << m_ASexternalRoutes.size ());
-          delete *k;
-          m_ASexternalRoutes.erase (k);
+          RemoveRoute (m_ASexternalRoutes, m_ASexternalFib, k);
           NS_LOG_LOGIC ("Done removing network route " << index << "; network route remaining size = " << m_networkRoutes.size ());
           return;
         }
@@ -392,6 +458,9 @@ Ipv4GlobalRouting::DoDispose (void)
     {
       delete (*l);
     }
+  m_hostFib.Clear ();
+  m_networkFib.Clear ();
+  m_ASexternalFib.Clear ();
 
   Ipv4RoutingProtocol::DoDispose ();
 }
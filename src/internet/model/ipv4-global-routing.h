@@ -21,6 +21,7 @@
 #define IPV4_GLOBAL_ROUTING_H
 
 #include <list>
+#include <vector>
 #include <stdint.h>
 #include "ns3/ipv4-address.h"
 #include "ns3/ipv4-header.h"
@@ -28,6 +29,7 @@
 #include "ns3/ipv4.h"
 #include "ns3/ipv4-routing-protocol.h"
 #include "ns3/random-variable-stream.h"
+#include "ns3/prefix-trie.h"
 
 namespace ns3 {
 
@@ -260,6 +262,37 @@ private:
   /// iterator of container of Ipv4RoutingTableEntry (routes to external AS)
   typedef std::list<Ipv4RoutingTableEntry *>::iterator ASExternalRoutesI;
 
+  /// Entry of a forwarding table index: insertion order and route
+  typedef std::pair<uint64_t, std::list<Ipv4RoutingTableEntry *>::iterator> FibEntry;
+  /// Forwarding table index of a route list, by destination network
+  typedef PrefixTrie<4, FibEntry> Fib;
+
+  /**
+   * \brief Add a route to a route list and to its forwarding table index.
+   * \param routes the route list
+   * \param fib the index of the route list
+   * \param route the route
+   */
+  void AddRoute (std::list<Ipv4RoutingTableEntry *> &routes, Fib &fib, Ipv4RoutingTableEntry *route);
+
+  /**
+   * \brief Remove a route from the forwarding table index and the route
+   * list, and delete it.
+   * \param routes the route list
+   * \param fib the index of the route list
+   * \param route the route
+   */
+  void RemoveRoute (std::list<Ipv4RoutingTableEntry *> &routes, Fib &fib,
+                    std::list<Ipv4RoutingTableEntry *>::iterator route);
+
+  /**
+   * \brief Collect the routes of an index whose network contains an address,
+   * in the order of their route list, into m_fibCandidates.
+   * \param fib the index
+   * \param dest the address
+   */
+  void MatchRoutes (const Fib &fib, Ipv4Address dest);
+
   /**
    * \brief Lookup in the forwarding table for destination.
    * \param dest destination address
@@ -271,6 +304,11 @@ private:
   HostRoutes m_hostRoutes;             //!< Routes to hosts
   NetworkRoutes m_networkRoutes;       //!< Routes to networks
   ASExternalRoutes m_ASexternalRoutes; //!< External routes imported
+  Fib m_hostFib;                       //!< Index of m_hostRoutes
+  Fib m_networkFib;                    //!< Index of m_networkRoutes
+  Fib m_ASexternalFib;                 //!< Index of m_ASexternalRoutes
+  uint64_t m_fibSequence;              //!< Insertion order of the next route
+  std::vector<FibEntry> m_fibCandidates; //!< Routes matching the destination being looked up
 
   Ptr<Ipv4> m_ipv4; //!< associated IPv4 instance
 };
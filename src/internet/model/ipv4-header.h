@@ -146,6 +146,10 @@ public:
    */
   void SetFragmentOffset (uint16_t offsetBytes);
   /**
+   * If the header was deserialized with a correct checksum, the checksum is
+   * updated incrementally (RFC 1624) rather than computed again when the
+   * header is serialized.
+   *
    * \param ttl the ipv4 TTL
    */
   void SetTtl (uint8_t ttl);
@@ -259,6 +263,7 @@ private:
   Ipv4Address m_destination; //!< destination address
   uint16_t m_checksum; //!< checksum
   bool m_goodChecksum; //!< true if checksum is correct
+  bool m_checksumValid; //!< true if m_checksum matches the fields, and can be serialized as is
   uint16_t m_headerSize; //!< IP header size
 };
 
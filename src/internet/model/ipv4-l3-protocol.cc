@@ -18,6 +18,8 @@
 // Author: George F. Riley<riley@ece.gatech.edu>
 //
 
+#include <algorithm>
+
 #include "ns3/packet.h"
 #include "ns3/log.h"
 #include "ns3/callback.h"
@@ -35,6 +37,7 @@
 #include "ns3/boolean.h"
 #include "ns3/ipv4-routing-table-entry.h"
 #include "ns3/traffic-control-layer.h"
+#include "ns3/segmentation-offload-tag.h"
 
 #include "loopback-net-device.h"
 #include "arp-l3-protocol.h"
@@ -43,6 +46,7 @@
 #include "icmpv4-l4-protocol.h"
 #include "ipv4-interface.h"
 #include "ipv4-raw-socket-impl.h"
+#include "tcp-l4-protocol.h"
 
 namespace ns3 {
 
@@ -71,6 +75,13 @@ Ipv4L3Protocol::GetTypeId (void)
                    TimeValue (Seconds (30)),
                    MakeTimeAccessor (&Ipv4L3Protocol::m_fragmentExpirationTimeout),
                    MakeTimeChecker ())
+    .AddAttribute ("FragmentBufferSize",
+                   "The maximum number of bytes of fragments waiting for "
+                   "reassembly, 0 means no limit. When it is exceeded, the "
+                   "oldest packets being reassembled are dropped.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&Ipv4L3Protocol::m_fragmentBufferSize),
+                   MakeUintegerChecker<uint32_t> ())
     .AddAttribute ("EnableDuplicatePacketDetection",
                    "Enable multicast duplicate packet detection based on RFC 6621",
                    BooleanValue (false),
@@ -86,6 +97,13 @@ Ipv4L3Protocol::GetTypeId (void)
                    TimeValue (Seconds (1)),
                    MakeTimeAccessor (&Ipv4L3Protocol::m_purge),
                    MakeTimeChecker (Seconds (0)))
+    .AddAttribute ("MaxDuplicateEntries",
+                   "The maximum number of duplicate packet entries, "
+                   "0 means no limit. When it is reached, the oldest "
+                   "entry is removed to make room for a new one.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&Ipv4L3Protocol::m_maxDups),
+                   MakeUintegerChecker<uint32_t> ())
     .AddTraceSource ("Tx",
                      "Send ipv4 packet to outgoing interface.",
                      MakeTraceSourceAccessor (&Ipv4L3Protocol::m_txTrace),
@@ -124,12 +142,22 @@ Ipv4L3Protocol::GetTypeId (void)
                      "and it is being forward up the stack",
                      MakeTraceSourceAccessor (&Ipv4L3Protocol::m_localDeliverTrace),
                      "ns3::Ipv4L3Protocol::SentTracedCallback")
+    .AddTraceSource ("FragmentBytes",
+                     "The number of bytes of fragments waiting for reassembly",
+                     MakeTraceSourceAccessor (&Ipv4L3Protocol::m_fragmentBytes),
+                     "ns3::TracedValueCallback::Uint32")
+    .AddTraceSource ("DuplicateEntries",
+                     "The number of duplicate packet entries",
+                     MakeTraceSourceAccessor (&Ipv4L3Protocol::m_nDups),
+                     "ns3::TracedValueCallback::Uint32")
 
   ;
   return tid;
 }
 
 Ipv4L3Protocol::Ipv4L3Protocol()
+  : m_fragmentBytes (0),
+    m_nDups (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -330,6 +358,7 @@ Ipv4L3Protocol::DoDispose (void)
     }
 
   m_fragments.clear ();
+  m_fragmentBytes = 0;
   m_timeoutEventList.clear ();
   if (m_timeoutEvent.IsRunning ())
     {
@@ -341,6 +370,8 @@ Ipv4L3Protocol::DoDispose (void)
       m_cleanDpd.Cancel ();
     }
   m_dups.clear ();
+  m_dupQueue.clear ();
+  m_nDups = 0;
 
   Object::DoDispose ();
 }
@@ -980,6 +1011,29 @@ Ipv4L3Protocol::SendRealOut (Ptr<Ipv4Route> route,
   Ptr<Ipv4Interface> outInterface = GetInterface (interface);
   NS_LOG_LOGIC ("Send via NetDevice ifIndex " << outDev->GetIfIndex () << " ipv4InterfaceIndex " << interface);
 
+  SegmentationOffloadTag offloadTag;
+  if (packet->PeekPacketTag (offloadTag) && !outDev->SupportsSegmentationOffload ())
+    {
+      if (ipHeader.GetProtocol () == TcpL4Protocol::PROT_NUMBER)
+        {
+          // Send the segments the super-segment stands for, with consecutive
+          // identifications as a segmentation offload would
+          std::list<Ptr<Packet> > segments = TcpL4Protocol::SplitSuperSegment (packet,
+                                                                               ipHeader.GetSource (),
+                                                                               ipHeader.GetDestination ());
+          uint16_t identification = ipHeader.GetIdentification ();
+          for (Ptr<Packet> segment : segments)
+            {
+              Ipv4Header segmentHeader = ipHeader;
+              segmentHeader.SetPayloadSize (segment->GetSize ());
+              segmentHeader.SetIdentification (identification++);
+              SendRealOut (route, segment, segmentHeader);
+            }
+          return;
+        }
+      packet->RemovePacketTag (offloadTag);
+    }
+
   Ipv4Address target;
   std::string targetLabel;
   if (route->GetGateway ().IsAny ())
@@ -996,7 +1050,10 @@ Ipv4L3Protocol::SendRealOut (Ptr<Ipv4Route> route,
   if (outInterface->IsUp ())
     {
       NS_LOG_LOGIC ("Send to " << targetLabel << " " << target);
-      if ( packet->GetSize () + ipHeader.GetSerializedSize () > outInterface->GetDevice ()->GetMtu () )
+      // Super-segments are transmitted whole by the devices supporting
+      // segmentation offload
+      if ( packet->GetSize () + ipHeader.GetSerializedSize () > outInterface->GetDevice ()->GetMtu ()
+           && !packet->PeekPacketTag (offloadTag))
         {
           std::list<Ipv4PayloadHeaderPair> listFragments;
           DoFragmentation (packet, ipHeader, outInterface->GetDevice ()->GetMtu (), listFragments);
@@ -1062,6 +1119,7 @@ Ipv4L3Protocol::IpForward (Ptr<Ipv4Route> rtentry, Ptr<const Packet> p, const Ip
   Ipv4Header ipHeader = header;
   Ptr<Packet> packet = p->Copy ();
   int32_t interface = GetInterfaceForDevice (rtentry->GetOutputDevice ());
+  // the header checksum, if any, is updated incrementally
   ipHeader.SetTtl (ipHeader.GetTtl () - 1);
   if (ipHeader.GetTtl () == 0)
     {
@@ -1523,6 +1581,13 @@ Ipv4L3Protocol::DoFragmentation (Ptr<Packet> packet, const Ipv4Header & ipv4Head
   return;
 }
 
+std::size_t
+Ipv4L3Protocol::FragmentKeyHash::operator() (const FragmentKey_t &key) const
+{
+  std::size_t h = std::hash<uint64_t> () (key.first);
+  return h ^ (std::hash<uint32_t> () (key.second) + 0x9e3779b9 + (h << 6) + (h >> 2));
+}
+
 bool
 Ipv4L3Protocol::ProcessFragment (Ptr<Packet>& packet, Ipv4Header& ipHeader, uint32_t iif)
 {
@@ -1556,21 +1621,45 @@ Ipv4L3Protocol::ProcessFragment (Ptr<Packet>& packet, Ipv4Header& ipHeader, uint
   NS_LOG_LOGIC ("Adding fragment - Size: " << packet->GetSize ( ) << " - Offset: " << (ipHeader.GetFragmentOffset ()) );
 
   fragments->AddFragment (p, ipHeader.GetFragmentOffset (), !ipHeader.IsLastFragment () );
+  m_fragmentBytes += p->GetSize ();
 
   if ( fragments->IsEntire () )
     {
       packet = fragments->GetPacket ();
+      m_fragmentBytes -= fragments->GetSize ();
       m_timeoutEventList.erase (fragments->GetTimeoutIter ());
       fragments = 0;
       m_fragments.erase (key);
       ret = true;
     }
+  else if (m_fragmentBufferSize > 0 && m_fragmentBytes > m_fragmentBufferSize)
+    {
+      // drop the oldest packets being reassembled, which are the first
+      // in the timeout list
+      FragmentsTimeoutsListI_t oldest = m_timeoutEventList.begin ();
+      while (m_fragmentBytes > m_fragmentBufferSize && oldest != m_timeoutEventList.end ())
+        {
+          if (std::get<1> (*oldest) == key)
+            {
+              oldest++;
+              continue;
+            }
+          MapFragments_t::iterator evicted = m_fragments.find (std::get<1> (*oldest));
+          NS_LOG_LOGIC ("Fragment buffer full, dropping " << evicted->second->GetSize () << " bytes");
+          m_fragmentBytes -= evicted->second->GetSize ();
+          m_dropTrace (std::get<2> (*oldest), evicted->second->GetPartialPacket (),
+                       DROP_FRAGMENT_TIMEOUT, this, std::get<3> (*oldest));
+          m_fragments.erase (evicted);
+          oldest = m_timeoutEventList.erase (oldest);
+        }
+    }
 
   return ret;
 }
 
 Ipv4L3Protocol::Fragments::Fragments ()
-  : m_moreFragment (0)
+  : m_moreFragment (0),
+    m_size (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -1585,15 +1674,11 @@ Ipv4L3Protocol::Fragments::AddFragment (Ptr<Packet> fragment, uint16_t fragmentO
 {
   NS_LOG_FUNCTION (this << fragment << fragmentOffset << moreFragment);
 
-  std::list<std::pair<Ptr<Packet>, uint16_t> >::iterator it;
-
-  for (it = m_fragments.begin (); it != m_fragments.end (); it++)
-    {
-      if (it->second > fragmentOffset)
-        {
-          break;
-        }
-    }
+  // insert after the fragments with the same or a lower offset
+  std::vector<std::pair<Ptr<Packet>, uint16_t> >::iterator it;
+  it = std::upper_bound (m_fragments.begin (), m_fragments.end (), fragmentOffset,
+                         [] (uint16_t offset, const std::pair<Ptr<Packet>, uint16_t> &f)
+                         { return offset < f.second; });
 
   if (it == m_fragments.end ())
     {
@@ -1601,6 +1686,14 @@ Ipv4L3Protocol::Fragments::AddFragment (Ptr<Packet> fragment, uint16_t fragmentO
     }
 
   m_fragments.insert (it, std::pair<Ptr<Packet>, uint16_t> (fragment, fragmentOffset));
+  m_size += fragment->GetSize ();
+}
+
+uint32_t
+Ipv4L3Protocol::Fragments::GetSize () const
+{
+  NS_LOG_FUNCTION (this);
+  return m_size;
 }
 
 bool
@@ -1614,7 +1707,7 @@ Ipv4L3Protocol::Fragments::IsEntire () const
     {
       uint16_t lastEndOffset = 0;
 
-      for (std::list<std::pair<Ptr<Packet>, uint16_t> >::const_iterator it = m_fragments.begin (); it != m_fragments.end (); it++)
+      for (std::vector<std::pair<Ptr<Packet>, uint16_t> >::const_iterator it = m_fragments.begin (); it != m_fragments.end (); it++)
         {
           // overlapping fragments do exist
           NS_LOG_LOGIC ("Checking overlaps " << lastEndOffset << " - " << it->second );
@@ -1638,7 +1731,7 @@ Ipv4L3Protocol::Fragments::GetPacket () const
 {
   NS_LOG_FUNCTION (this);
 
-  std::list<std::pair<Ptr<Packet>, uint16_t> >::const_iterator it = m_fragments.begin ();
+  std::vector<std::pair<Ptr<Packet>, uint16_t> >::const_iterator it = m_fragments.begin ();
 
   Ptr<Packet> p = it->first->Copy ();
   uint16_t lastEndOffset = p->GetSize ();
@@ -1676,7 +1769,7 @@ Ipv4L3Protocol::Fragments::GetPartialPacket () const
 {
   NS_LOG_FUNCTION (this);
   
-  std::list<std::pair<Ptr<Packet>, uint16_t> >::const_iterator it = m_fragments.begin ();
+  std::vector<std::pair<Ptr<Packet>, uint16_t> >::const_iterator it = m_fragments.begin ();
 
   Ptr<Packet> p = Create<Packet> ();
   uint16_t lastEndOffset = 0;
@@ -1737,11 +1830,22 @@ Ipv4L3Protocol::HandleFragmentsTimeout (FragmentKey_t key, Ipv4Header & ipHeader
   m_dropTrace (ipHeader, packet, DROP_FRAGMENT_TIMEOUT, this, iif);
 
   // clear the buffers
+  m_fragmentBytes -= it->second->GetSize ();
   it->second = 0;
 
   m_fragments.erase (key);
 }
 
+std::size_t
+Ipv4L3Protocol::DupTupleHash::operator() (const DupTuple_t &key) const
+{
+  Ipv4AddressHash addressHash;
+  std::size_t h = std::hash<uint64_t> () (std::get<0> (key));
+  h ^= std::hash<uint8_t> () (std::get<1> (key)) + 0x9e3779b9 + (h << 6) + (h >> 2);
+  h ^= addressHash (std::get<2> (key)) + 0x9e3779b9 + (h << 6) + (h >> 2);
+  return h ^ (addressHash (std::get<3> (key)) + 0x9e3779b9 + (h << 6) + (h >> 2));
+}
+
 bool
 Ipv4L3Protocol::UpdateDuplicate (Ptr<const Packet> p, const Ipv4Header &header)
 {
@@ -1810,6 +1914,18 @@ Ipv4L3Protocol::UpdateDuplicate (Ptr<const Packet> p, const Ipv4Header &header)
 
   // set the expiration event
   iter->second = Simulator::Now () + m_expire;
+  if (inserted)
+    {
+      m_dupQueue.emplace_back (iter->second, key);
+      if (m_maxDups > 0 && m_dups.size () > m_maxDups)
+        {
+          // make room by removing the oldest entry
+          NS_LOG_LOGIC ("Duplicate table full, removing the oldest entry");
+          m_dups.erase (m_dupQueue.front ().second);
+          m_dupQueue.pop_front ();
+        }
+      m_nDups = m_dups.size ();
+    }
   return isDup;
 }
 
@@ -1818,11 +1934,17 @@ Ipv4L3Protocol::RemoveDuplicates (void)
 {
   NS_LOG_FUNCTION (this);
 
+  // The entries are queued in insertion order, that is in the order of
+  // their first expiration time, since they share the same lifetime: only
+  // the front of the queue is visited. An entry refreshed since it was
+  // queued is queued again with its new expiration time.
   DupMap_t::size_type n = 0;
   Time expire = Simulator::Now ();
-  auto iter = m_dups.cbegin ();
-  while (iter != m_dups.cend ())
+  while (!m_dupQueue.empty () && m_dupQueue.front ().first < expire)
     {
+      DupTuple_t key = m_dupQueue.front ().second;
+      m_dupQueue.pop_front ();
+      DupMap_t::iterator iter = m_dups.find (key);
       if (iter->second < expire)
         {
           NS_LOG_LOGIC ("Remove key = (" <<
@@ -1830,14 +1952,15 @@ Ipv4L3Protocol::RemoveDuplicates (void)
                         std::dec << +std::get<1> (iter->first) << ", " <<
                         std::get<2> (iter->first) << ", " <<
                         std::get<3> (iter->first) << ")");
-          iter = m_dups.erase (iter);
+          m_dups.erase (iter);
           ++n;
         }
       else
         {
-          ++iter;
+          m_dupQueue.emplace_back (iter->second, key);
         }
     }
+  m_nDups = m_dups.size ();
   
   NS_LOG_DEBUG ("Purged " << n << " expired duplicate entries out of " << (n + m_dups.size ()));
   
@@ -21,8 +21,10 @@
 #ifndef IPV4_L3_PROTOCOL_H
 #define IPV4_L3_PROTOCOL_H
 
+#include <deque>
 #include <list>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <stdint.h>
 #include "ns3/ipv4-address.h"
@@ -30,6 +32,7 @@
 #include "ns3/net-device.h"
 #include "ns3/ipv4.h"
 #include "ns3/traced-callback.h"
+#include "ns3/traced-value.h"
 #include "ns3/ipv4-header.h"
 #include "ns3/ipv4-routing-protocol.h"
 #include "ns3/nstime.h"
@@ -488,6 +491,18 @@ private:
   /// Key identifying a fragmented packet
   typedef std::pair<uint64_t, uint32_t> FragmentKey_t;
 
+  /**
+   * \brief Hash function of the fragment keys.
+   */
+  struct FragmentKeyHash
+  {
+    /**
+     * \param key the key
+     * \returns the hash of the key
+     */
+    std::size_t operator() (const FragmentKey_t &key) const;
+  };
+
   /// Container for fragment timeouts.
   typedef std::list< std::tuple <Time, FragmentKey_t, Ipv4Header, uint32_t > > FragmentsTimeoutsList_t;
   /// Container Iterator for fragment timeouts..
@@ -561,6 +576,12 @@ private:
      */
     Ptr<Packet> GetPartialPacket () const;
 
+    /**
+     * \brief Get the number of bytes of the fragments.
+     * \return the number of bytes held
+     */
+    uint32_t GetSize () const;
+
     /**
      * \brief Set the Timeout iterator.
      * \param iter The iterator.
@@ -580,9 +601,14 @@ private:
     bool m_moreFragment;
 
     /**
-     * \brief The current fragments.
+     * \brief The current fragments, sorted by offset.
      */
-    std::list<std::pair<Ptr<Packet>, uint16_t> > m_fragments;
+    std::vector<std::pair<Ptr<Packet>, uint16_t> > m_fragments;
+
+    /**
+     * \brief The number of bytes of the fragments.
+     */
+    uint32_t m_size;
 
     /**
      * \brief Timeout iterator to "event" handler
@@ -591,16 +617,33 @@ private:
   };
 
   /// Container of fragments, stored as pairs(src+dst addr, src+dst port) / fragment
-  typedef std::map< FragmentKey_t, Ptr<Fragments> > MapFragments_t;
+  typedef std::unordered_map< FragmentKey_t, Ptr<Fragments>, FragmentKeyHash > MapFragments_t;
 
   MapFragments_t       m_fragments; //!< Fragmented packets.
   Time                 m_fragmentExpirationTimeout; //!< Expiration timeout
+  uint32_t             m_fragmentBufferSize; //!< Maximum number of bytes of fragments held, 0 for no limit
+  TracedValue<uint32_t> m_fragmentBytes; //!< Number of bytes of fragments held
 
   /// IETF RFC 6621, Section 6.2 de-duplication w/o IPSec
   /// RFC 6621 recommended duplicate packet tuple: {IPV hash, IP protocol, IP source address, IP destination address}
   typedef std::tuple <uint64_t, uint8_t, Ipv4Address, Ipv4Address> DupTuple_t;
+
+  /**
+   * \brief Hash function of the packet duplicate tuples.
+   */
+  struct DupTupleHash
+  {
+    /**
+     * \param key the tuple
+     * \returns the hash of the tuple
+     */
+    std::size_t operator() (const DupTuple_t &key) const;
+  };
+
   /// Maps packet duplicate tuple to expiration time
-  typedef std::map<DupTuple_t, Time> DupMap_t;
+  typedef std::unordered_map<DupTuple_t, Time, DupTupleHash> DupMap_t;
+  /// Packet duplicate tuples in insertion order, with their expiration time when queued
+  typedef std::deque<std::pair<Time, DupTuple_t> > DupQueue_t;
 
   /**
    * Registers duplicate entry, return false if new
@@ -616,6 +659,9 @@ private:
 
   bool                m_enableDpd;    //!< Enable multicast duplicate packet detection
   DupMap_t            m_dups;         //!< map of packet duplicate tuples to expiry event
+  DupQueue_t          m_dupQueue;     //!< packet duplicate tuples, oldest first
+  uint32_t            m_maxDups;      //!< maximum number of duplicate entries, 0 for no limit
+  TracedValue<uint32_t> m_nDups;      //!< number of duplicate entries
   Time                m_expire;       //!< duplicate entry expiration delay
   Time                m_purge;        //!< time between purging expired duplicate entries
   EventId             m_cleanDpd;     //!< event to cleanup expired duplicate entries
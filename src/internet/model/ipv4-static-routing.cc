@@ -24,6 +24,8 @@
                 << " [node " << m_ipv4->GetObject<Node> ()->GetId () << "] "; }
 
 #include <iomanip>
+#include <iterator>
+#include <algorithm>
 #include "ns3/log.h"
 #include "ns3/names.h"
 #include "ns3/packet.h"
@@ -42,6 +44,25 @@ NS_LOG_COMPONENT_DEFINE ("Ipv4StaticRouting");
 
 NS_OBJECT_ENSURE_REGISTERED (Ipv4StaticRouting);
 
+/**
+ * \brief Compute the key of a route in the forwarding table index.
+ * \param route the route
+ * \param key [out] the destination network, in network byte order
+ * \return the key length
+ */
+static uint8_t
+GetFibKey (const Ipv4RoutingTableEntry *route, uint8_t key[4])
+{
+  uint8_t mask[4];
+  uint32_t m = route->GetDestNetworkMask ().Get ();
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      mask[i] = static_cast<uint8_t> (m >> (24 - 8 * i));
+    }
+  route->GetDestNetwork ().Serialize (key);
+  return PrefixTrie<4, int>::GetMaskLength (mask);
+}
+
 TypeId
 Ipv4StaticRouting::GetTypeId (void)
 {
@@ -54,7 +75,8 @@ Ipv4StaticRouting::GetTypeId (void)
 }
 
 Ipv4StaticRouting::Ipv4StaticRouting () 
-  : m_ipv4 (0)
+  : m_fibSequence (0),
+    m_ipv4 (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -76,7 +98,7 @@ Ipv4StaticRouting::AddNetworkRouteTo (Ipv4Address network,
   if (!LookupRoute (route, metric))
     {
       Ipv4RoutingTableEntry *routePtr = new Ipv4RoutingTableEntry (route);
-      m_networkRoutes.push_back (make_pair (routePtr, metric));
+      AddNetworkRoute (routePtr, metric);
     }
 }
 
@@ -95,7 +117,7 @@ Ipv4StaticRouting::AddNetworkRouteTo (Ipv4Address network,
     {
       Ipv4RoutingTableEntry *routePtr = new Ipv4RoutingTableEntry (route);
 
-      m_networkRoutes.push_back (make_pair (routePtr, metric));
+      AddNetworkRoute (routePtr, metric);
     }
 }
 
@@ -153,7 +175,7 @@ Ipv4StaticRouting::SetDefaultMulticastRoute (uint32_t outputInterface)
   *route = Ipv4RoutingTableEntry::CreateNetworkRouteTo (network,
                                                         networkMask,
                                                         outputInterface);
-  m_networkRoutes.push_back (make_pair (route,0));
+  AddNetworkRoute (route, 0);
 }
 
 uint32_t 
@@ -232,8 +254,17 @@ Ipv4StaticRouting::RemoveMulticastRoute (uint32_t index)
 bool
 Ipv4StaticRouting::LookupRoute (const Ipv4RoutingTableEntry &route, uint32_t metric)
 {
-  for (NetworkRoutesI j = m_networkRoutes.begin (); j != m_networkRoutes.end (); j++)
+  // Equal routes have the same key
+  uint8_t key[4];
+  uint8_t length = GetFibKey (&route, key);
+  const std::vector<FibEntry> *routes = m_fib.Find (key, length);
+  if (routes == 0)
     {
+      return false;
+    }
+  for (std::vector<FibEntry>::const_iterator i = routes->begin (); i != routes->end (); i++)
+    {
+      NetworkRoutesI j = i->second;
       Ipv4RoutingTableEntry* rtentry = j->first;
 
       if (rtentry->GetDest () == route.GetDest () &&
@@ -248,6 +279,26 @@ Ipv4StaticRouting::LookupRoute (const Ipv4RoutingTableEntry &route, uint32_t met
   return false;
 }
 
+void
+Ipv4StaticRouting::AddNetworkRoute (Ipv4RoutingTableEntry *route, uint32_t metric)
+{
+  m_networkRoutes.push_back (make_pair (route, metric));
+  uint8_t key[4];
+  uint8_t length = GetFibKey (route, key);
+  m_fib.Insert (key, length, FibEntry (m_fibSequence++, std::prev (m_networkRoutes.end ())));
+}
+
+Ipv4StaticRouting::NetworkRoutesI
+Ipv4StaticRouting::RemoveNetworkRoute (NetworkRoutesI route)
+{
+  uint8_t key[4];
+  uint8_t length = GetFibKey (route->first, key);
+  bool found = m_fib.Remove (key, length, [route] (const FibEntry &entry) { return entry.second == route; });
+  NS_ASSERT (found);
+  delete route->first;
+  return m_networkRoutes.erase (route);
+}
+
 Ptr<Ipv4Route>
 Ipv4StaticRouting::LookupStatic (Ipv4Address dest, Ptr<NetDevice> oif)
 {
@@ -268,11 +319,21 @@ Ipv4StaticRouting::LookupStatic (Ipv4Address dest, Ptr<NetDevice> oif)
       return rtentry;
     }
 
+  // Only the routes whose network contains dest can match: fetch them from
+  // the forwarding table index, and check them in the order of the list.
+  uint8_t key[4];
+  dest.Serialize (key);
+  m_fibCandidates.clear ();
+  m_fib.Match (key, [this] (uint8_t, const std::vector<FibEntry> &routes)
+               { m_fibCandidates.insert (m_fibCandidates.end (), routes.begin (), routes.end ()); });
+  std::sort (m_fibCandidates.begin (), m_fibCandidates.end (),
+             [] (const FibEntry &a, const FibEntry &b) { return a.first < b.first; });
 
-  for (NetworkRoutesI i = m_networkRoutes.begin (); 
-       i != m_networkRoutes.end (); 
-       i++) 
+  for (std::vector<FibEntry>::const_iterator k = m_fibCandidates.begin ();
+       k != m_fibCandidates.end ();
+       k++)
     {
+      NetworkRoutesI i = k->second;
       Ipv4RoutingTableEntry *j=i->first;
       uint32_t metric =i->second;
       Ipv4Mask mask = (j)->GetDestNetworkMask ();
@@ -476,8 +537,7 @@ Ipv4StaticRouting::RemoveRoute (uint32_t index)
     {
       if (tmp == index)
         {
-          delete j->first;
-          m_networkRoutes.erase (j);
+          RemoveNetworkRoute (j);
           return;
         }
       tmp++;
@@ -604,6 +664,7 @@ Ipv4StaticRouting::DoDispose (void)
     {
       delete (j->first);
     }
+  m_fib.Clear ();
   for (MulticastRoutesI i = m_multicastRoutes.begin (); 
        i != m_multicastRoutes.end (); 
        i = m_multicastRoutes.erase (i)) 
@@ -642,8 +703,7 @@ Ipv4StaticRouting::NotifyInterfaceDown (uint32_t i)
     {
       if (it->first->GetInterface () == i)
         {
-          delete it->first;
-          it = m_networkRoutes.erase (it);
+          it = RemoveNetworkRoute (it);
         }
       else
         {
@@ -689,8 +749,7 @@ Ipv4StaticRouting::NotifyRemoveAddress (uint32_t interface, Ipv4InterfaceAddress
           && it->first->GetDestNetwork () == networkAddress
           && it->first->GetDestNetworkMask () == networkMask)
         {
-          delete it->first;
-          it = m_networkRoutes.erase (it);
+          it = RemoveNetworkRoute (it);
         }
       else
         {
@@ -24,6 +24,7 @@
 
 #include <list>
 #include <utility>
+#include <vector>
 #include <stdint.h>
 #include "ns3/ipv4-address.h"
 #include "ns3/ipv4-header.h"
@@ -31,6 +32,7 @@
 #include "ns3/ptr.h"
 #include "ns3/ipv4.h"
 #include "ns3/ipv4-routing-protocol.h"
+#include "ns3/prefix-trie.h"
 
 namespace ns3 {
 
@@ -367,6 +369,9 @@ private:
   /// Iterator for container for the network routes
   typedef std::list<std::pair <Ipv4RoutingTableEntry *, uint32_t> >::iterator NetworkRoutesI;
 
+  /// Entry of the forwarding table index: insertion order and network route
+  typedef std::pair<uint64_t, NetworkRoutesI> FibEntry;
+
   /// Container for the multicast routes
   typedef std::list<Ipv4MulticastRoutingTableEntry *> MulticastRoutes;
 
@@ -384,6 +389,21 @@ private:
    */
   bool LookupRoute (const Ipv4RoutingTableEntry &route, uint32_t metric);
 
+  /**
+   * \brief Add a network route to the list and to the forwarding table index.
+   * \param route route
+   * \param metric metric of route
+   */
+  void AddNetworkRoute (Ipv4RoutingTableEntry *route, uint32_t metric);
+
+  /**
+   * \brief Remove a network route from the forwarding table index and the
+   * list, and delete it.
+   * \param route the route
+   * \return the route following the removed one in the list
+   */
+  NetworkRoutesI RemoveNetworkRoute (NetworkRoutesI route);
+
   /**
    * \brief Lookup in the forwarding table for destination.
    * \param dest destination address
@@ -407,6 +427,21 @@ private:
    */
   NetworkRoutes m_networkRoutes;
 
+  /**
+   * \brief index of m_networkRoutes by destination network.
+   */
+  PrefixTrie<4, FibEntry> m_fib;
+
+  /**
+   * \brief insertion order of the next network route.
+   */
+  uint64_t m_fibSequence;
+
+  /**
+   * \brief network routes matching the destination being looked up.
+   */
+  std::vector<FibEntry> m_fibCandidates;
+
   /**
    * \brief the forwarding table for multicast.
    */
@@ -23,6 +23,8 @@
 
 #include <stdint.h>
 #include <list>
+#include <unordered_map>
+#include <vector>
 #include "ns3/ipv6-address.h"
 #include "ipv6-interface.h"
 
@@ -34,6 +36,12 @@ class Ipv6EndPoint;
  * \ingroup ipv6
  *
  * \brief Demultiplexer for end points.
+ *
+ * The end points are kept in a list, and indexed by local and peer
+ * addresses and ports, and by local port, so that a lookup probes the few
+ * keys that can match a packet instead of comparing it with every end
+ * point.  The end points notify the demux that allocated them when their
+ * addresses or ports change.
  */
 class Ipv6EndPointDemux
 {
@@ -153,6 +161,99 @@ public:
   EndPoints GetEndPoints () const;
 
 private:
+  /**
+   * \brief The local and peer addresses and ports of an endpoint.
+   */
+  struct EndPointKey
+  {
+    Ipv6Address localAddress; //!< the local address
+    uint16_t localPort;       //!< the local port
+    Ipv6Address peerAddress;  //!< the peer address
+    uint16_t peerPort;        //!< the peer port
+
+    /**
+     * \brief Comparison operator.
+     * \param other the other key
+     * \returns true if the keys are equal
+     */
+    bool operator== (const EndPointKey &other) const;
+  };
+
+  /**
+   * \brief Hash function of the endpoint keys.
+   */
+  struct EndPointKeyHash
+  {
+    /**
+     * \param key the key
+     * \returns the hash of the key
+     */
+    std::size_t operator() (const EndPointKey &key) const;
+  };
+
+  /**
+   * \brief Index of the endpoints by local and peer addresses and ports.
+   */
+  typedef std::unordered_multimap<EndPointKey, Ipv6EndPoint *, EndPointKeyHash> TupleIndex;
+
+  /**
+   * \brief Index of the endpoints by local port, in allocation order.
+   */
+  typedef std::unordered_map<uint16_t, std::vector<Ipv6EndPoint *> > PortIndex;
+
+  /**
+   * \brief Get the key of an endpoint.
+   * \param endPoint the endpoint
+   * \returns the local and peer addresses and ports of the endpoint
+   */
+  static EndPointKey GetKey (Ipv6EndPoint *endPoint);
+
+  /**
+   * \brief Add an endpoint to the list and the indexes.
+   * \param endPoint the endpoint
+   */
+  void AddEndPoint (Ipv6EndPoint *endPoint);
+
+  /**
+   * \brief Add an endpoint to the index by addresses and ports.
+   * \param endPoint the endpoint
+   */
+  void InsertTuple (Ipv6EndPoint *endPoint);
+
+  /**
+   * \brief Remove an endpoint from the index by addresses and ports.
+   * \param endPoint the endpoint
+   */
+  void RemoveTuple (Ipv6EndPoint *endPoint);
+
+  /**
+   * \brief Add an endpoint to the index by local port.
+   * \param endPoint the endpoint
+   */
+  void InsertPort (Ipv6EndPoint *endPoint);
+
+  /**
+   * \brief Remove an endpoint from the index by local port.
+   * \param endPoint the endpoint
+   */
+  void RemovePort (Ipv6EndPoint *endPoint);
+
+  /**
+   * \brief Find the endpoints with the given addresses and ports that can
+   * receive packets from an interface.
+   * \param localAddress local address
+   * \param localPort local port
+   * \param peerAddress peer address
+   * \param peerPort peer port
+   * \param incomingInterface the incoming interface
+   * \param found [out] list the endpoints are appended to
+   */
+  void FindEndPoints (Ipv6Address localAddress, uint16_t localPort,
+                      Ipv6Address peerAddress, uint16_t peerPort,
+                      Ptr<Ipv6Interface> incomingInterface, EndPoints &found);
+
+  friend class Ipv6EndPoint;
+
   /**
    * \brief Allocate a ephemeral port.
    * \return a port
@@ -178,6 +279,16 @@ private:
    * \brief A list of IPv6 end points.
    */
   EndPoints m_endPoints;
+
+  /**
+   * \brief The end points, by local and peer addresses and ports.
+   */
+  TupleIndex m_tuples;
+
+  /**
+   * \brief The end points, by local port.
+   */
+  PortIndex m_ports;
 };
 
 } /* namespace ns3 */
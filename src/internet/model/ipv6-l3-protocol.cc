@@ -31,6 +31,7 @@
 #include "ns3/mac16-address.h"
 #include "ns3/mac64-address.h"
 #include "ns3/traffic-control-layer.h"
+#include "ns3/segmentation-offload-tag.h"
 
 #include "loopback-net-device.h"
 #include "ipv6-l3-protocol.h"
@@ -44,6 +45,7 @@
 #include "ipv6-option.h"
 #include "icmpv6-l4-protocol.h"
 #include "ndisc-cache.h"
+#include "tcp-l4-protocol.h"
 #include "ipv6-raw-socket-factory-impl.h"
 
 /// Minimum IPv6 MTU, as defined by \RFC{2460}
@@ -1113,6 +1115,26 @@ void Ipv6L3Protocol::SendRealOut (Ptr<Ipv6Route> route, Ptr<Packet> packet, Ipv6
   Ptr<Ipv6Interface> outInterface = GetInterface (interface);
   NS_LOG_LOGIC ("Send via NetDevice ifIndex " << dev->GetIfIndex () << " Ipv6InterfaceIndex " << interface);
 
+  SegmentationOffloadTag offloadTag;
+  if (packet->PeekPacketTag (offloadTag) && !dev->SupportsSegmentationOffload ())
+    {
+      if (ipHeader.GetNextHeader () == TcpL4Protocol::PROT_NUMBER)
+        {
+          // Send the segments the super-segment stands for
+          std::list<Ptr<Packet> > segments = TcpL4Protocol::SplitSuperSegment (packet,
+                                                                               ipHeader.GetSource (),
+                                                                               ipHeader.GetDestination ());
+          for (Ptr<Packet> segment : segments)
+            {
+              Ipv6Header segmentHeader = ipHeader;
+              segmentHeader.SetPayloadLength (segment->GetSize ());
+              SendRealOut (route, segment, segmentHeader);
+            }
+          return;
+        }
+      packet->RemovePacketTag (offloadTag);
+    }
+
   // Check packet size
   std::list<Ipv6ExtensionFragment::Ipv6PayloadHeaderPair> fragments;
 
@@ -1143,7 +1165,10 @@ void Ipv6L3Protocol::SendRealOut (Ptr<Ipv6Route> route, Ptr<Packet> packet, Ipv6
       targetMtu = dev->GetMtu ();
     }
 
-  if (packet->GetSize () + ipHeader.GetSerializedSize () > targetMtu)
+  // Super-segments are transmitted whole by the devices supporting
+  // segmentation offload
+  if (packet->GetSize () + ipHeader.GetSerializedSize () > targetMtu
+      && !packet->PeekPacketTag (offloadTag))
     {
       // Router => drop
       if (!fromMe)
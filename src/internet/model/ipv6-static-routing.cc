@@ -19,6 +19,8 @@
  */
 
 #include <iomanip>
+#include <iterator>
+#include <algorithm>
 #include "ns3/log.h"
 #include "ns3/node.h"
 #include "ns3/packet.h"
@@ -36,6 +38,21 @@ NS_LOG_COMPONENT_DEFINE ("Ipv6StaticRouting");
 
 NS_OBJECT_ENSURE_REGISTERED (Ipv6StaticRouting);
 
+/**
+ * \brief Compute the key of a route in the forwarding table index.
+ * \param route the route
+ * \param key [out] the destination network
+ * \return the key length
+ */
+static uint8_t
+GetFibKey (const Ipv6RoutingTableEntry *route, uint8_t key[16])
+{
+  uint8_t mask[16];
+  route->GetDestNetworkPrefix ().GetBytes (mask);
+  route->GetDestNetwork ().Serialize (key);
+  return PrefixTrie<16, int>::GetMaskLength (mask);
+}
+
 TypeId Ipv6StaticRouting::GetTypeId ()
 {
   static TypeId tid = TypeId ("ns3::Ipv6StaticRouting")
@@ -47,7 +64,8 @@ TypeId Ipv6StaticRouting::GetTypeId ()
 }
 
 Ipv6StaticRouting::Ipv6StaticRouting ()
-  : m_ipv6 (0)
+  : m_fibSequence (0),
+    m_ipv6 (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -162,7 +180,7 @@ void Ipv6StaticRouting::AddNetworkRouteTo (Ipv6Address network, Ipv6Prefix netwo
   if (!LookupRoute (route, metric))
     {
       Ipv6RoutingTableEntry* routePtr = new Ipv6RoutingTableEntry (route);
-      m_networkRoutes.push_back (std::make_pair (routePtr, metric));
+      AddNetworkRoute (routePtr, metric);
     }
 }
 
@@ -178,7 +196,7 @@ void Ipv6StaticRouting::AddNetworkRouteTo (Ipv6Address network, Ipv6Prefix netwo
   if (!LookupRoute (route, metric))
     {
       Ipv6RoutingTableEntry* routePtr = new Ipv6RoutingTableEntry (route);
-      m_networkRoutes.push_back (std::make_pair (routePtr, metric));
+      AddNetworkRoute (routePtr, metric);
     }
 }
 
@@ -190,7 +208,7 @@ void Ipv6StaticRouting::AddNetworkRouteTo (Ipv6Address network, Ipv6Prefix netwo
   if (!LookupRoute (route, metric))
     {
       Ipv6RoutingTableEntry* routePtr = new Ipv6RoutingTableEntry (route);
-      m_networkRoutes.push_back (std::make_pair (routePtr, metric));
+      AddNetworkRoute (routePtr, metric);
     }
 }
 
@@ -215,7 +233,7 @@ void Ipv6StaticRouting::SetDefaultMulticastRoute (uint32_t outputInterface)
   Ipv6Address network = Ipv6Address ("ff00::"); /* RFC 3513 */
   Ipv6Prefix networkMask = Ipv6Prefix (8);
   *route = Ipv6RoutingTableEntry::CreateNetworkRouteTo (network, networkMask, outputInterface);
-  m_networkRoutes.push_back (std::make_pair (route, 0));
+  AddNetworkRoute (route, 0);
 }
 
 uint32_t Ipv6StaticRouting::GetNMulticastRoutes () const
@@ -284,9 +302,10 @@ bool Ipv6StaticRouting::HasNetworkDest (Ipv6Address network, uint32_t interfaceI
   NS_LOG_FUNCTION (this << network << interfaceIndex);
 
   /* in the network table */
-  for (NetworkRoutesI j = m_networkRoutes.begin (); j != m_networkRoutes.end (); j++)
+  MatchNetworkRoutes (network);
+  for (std::vector<FibEntry>::const_iterator k = m_fibCandidates.begin (); k != m_fibCandidates.end (); k++)
     {
-      Ipv6RoutingTableEntry* rtentry = j->first;
+      Ipv6RoutingTableEntry* rtentry = k->second->first;
       Ipv6Prefix prefix = rtentry->GetDestNetworkPrefix ();
       Ipv6Address entry = rtentry->GetDestNetwork ();
 
@@ -302,8 +321,17 @@ bool Ipv6StaticRouting::HasNetworkDest (Ipv6Address network, uint32_t interfaceI
 
 bool Ipv6StaticRouting::LookupRoute (const Ipv6RoutingTableEntry &route, uint32_t metric)
 {
-  for (NetworkRoutesI j = m_networkRoutes.begin (); j != m_networkRoutes.end (); j++)
+  // Equal routes have the same key
+  uint8_t key[16];
+  uint8_t length = GetFibKey (&route, key);
+  const std::vector<FibEntry> *routes = m_fib.Find (key, length);
+  if (routes == 0)
     {
+      return false;
+    }
+  for (std::vector<FibEntry>::const_iterator i = routes->begin (); i != routes->end (); i++)
+    {
+      NetworkRoutesI j = i->second;
       Ipv6RoutingTableEntry* rtentry = j->first;
 
       if (rtentry->GetDest () == route.GetDest () &&
@@ -319,6 +347,35 @@ bool Ipv6StaticRouting::LookupRoute (const Ipv6RoutingTableEntry &route, uint32_
   return false;
 }
 
+void Ipv6StaticRouting::AddNetworkRoute (Ipv6RoutingTableEntry *route, uint32_t metric)
+{
+  m_networkRoutes.push_back (std::make_pair (route, metric));
+  uint8_t key[16];
+  uint8_t length = GetFibKey (route, key);
+  m_fib.Insert (key, length, FibEntry (m_fibSequence++, std::prev (m_networkRoutes.end ())));
+}
+
+Ipv6StaticRouting::NetworkRoutesI Ipv6StaticRouting::RemoveNetworkRoute (NetworkRoutesI route)
+{
+  uint8_t key[16];
+  uint8_t length = GetFibKey (route->first, key);
+  bool found = m_fib.Remove (key, length, [route] (const FibEntry &entry) { return entry.second == route; });
+  NS_ASSERT (found);
+  delete route->first;
+  return m_networkRoutes.erase (route);
+}
+
+void Ipv6StaticRouting::MatchNetworkRoutes (Ipv6Address dst)
+{
+  uint8_t key[16];
+  dst.Serialize (key);
+  m_fibCandidates.clear ();
+  m_fib.Match (key, [this] (uint8_t, const std::vector<FibEntry> &routes)
+               { m_fibCandidates.insert (m_fibCandidates.end (), routes.begin (), routes.end ()); });
+  std::sort (m_fibCandidates.begin (), m_fibCandidates.end (),
+             [] (const FibEntry &a, const FibEntry &b) { return a.first < b.first; });
+}
+
 Ptr<Ipv6Route> Ipv6StaticRouting::LookupStatic (Ipv6Address dst, Ptr<NetDevice> interface)
 {
   NS_LOG_FUNCTION (this << dst << interface);
@@ -338,8 +395,12 @@ Ptr<Ipv6Route> Ipv6StaticRouting::LookupStatic (Ipv6Address dst, Ptr<NetDevice>
       return rtentry;
     }
 
-  for (NetworkRoutesI it = m_networkRoutes.begin (); it != m_networkRoutes.end (); it++)
+  // Only the routes whose network contains dst can match: fetch them from
+  // the forwarding table index, and check them in the order of the list.
+  MatchNetworkRoutes (dst);
+  for (std::vector<FibEntry>::const_iterator k = m_fibCandidates.begin (); k != m_fibCandidates.end (); k++)
     {
+      NetworkRoutesI it = k->second;
       Ipv6RoutingTableEntry* j = it->first;
       uint32_t metric = it->second;
       Ipv6Prefix mask = j->GetDestNetworkPrefix ();
@@ -418,6 +479,7 @@ void Ipv6StaticRouting::DoDispose ()
       delete j->first;
     }
   m_networkRoutes.clear ();
+  m_fib.Clear ();
 
   for (MulticastRoutesI i = m_multicastRoutes.begin (); i != m_multicastRoutes.end (); i = m_multicastRoutes.erase (i))
     {
@@ -566,8 +628,7 @@ void Ipv6StaticRouting::RemoveRoute (uint32_t index)
     {
       if (tmp == index)
         {
-          delete it->first;
-          m_networkRoutes.erase (it);
+          RemoveNetworkRoute (it);
           return;
         }
       tmp++;
@@ -585,8 +646,7 @@ void Ipv6StaticRouting::RemoveRoute (Ipv6Address network, Ipv6Prefix prefix, uin
       if (network == rtentry->GetDest () && rtentry->GetInterface () == ifIndex
           && rtentry->GetPrefixToUse () == prefixToUse)
         {
-          delete it->first;
-          m_networkRoutes.erase (it);
+          RemoveNetworkRoute (it);
           return;
         }
     }
@@ -715,8 +775,7 @@ void Ipv6StaticRouting::NotifyInterfaceDown (uint32_t i)
     {
       if (it->first->GetInterface () == i)
         {
-          delete it->first;
-          it = m_networkRoutes.erase (it);
+          it = RemoveNetworkRoute (it);
         }
       else
         {
@@ -752,8 +811,7 @@ void Ipv6StaticRouting::NotifyRemoveAddress (uint32_t interface, Ipv6InterfaceAd
           && it->first->GetDestNetwork () == networkAddress
           && it->first->GetDestNetworkPrefix () == networkMask)
         {
-          delete it->first;
-          it = m_networkRoutes.erase (it);
+          it = RemoveNetworkRoute (it);
         }
       else
         {
@@ -800,8 +858,7 @@ void Ipv6StaticRouting::NotifyRemoveRoute (Ipv6Address dst, Ipv6Prefix mask, Ipv
 
           if (dst == entry && prefix == mask && rtentry->GetInterface () == interface)
             {
-              delete j->first;
-              j = m_networkRoutes.erase (j);
+              j = RemoveNetworkRoute (j);
             }
           else
             {
@@ -24,12 +24,14 @@
 #include <stdint.h>
 
 #include <list>
+#include <vector>
 
 #include "ns3/ptr.h"
 #include "ns3/ipv6-address.h"
 #include "ns3/ipv6.h"
 #include "ns3/ipv6-header.h"
 #include "ns3/ipv6-routing-protocol.h"
+#include "ns3/prefix-trie.h"
 
 namespace ns3 {
 
@@ -255,6 +257,9 @@ private:
   /// Iterator for container for the network routes
   typedef std::list<std::pair <Ipv6RoutingTableEntry *, uint32_t> >::iterator NetworkRoutesI;
 
+  /// Entry of the forwarding table index: insertion order and network route
+  typedef std::pair<uint64_t, NetworkRoutesI> FibEntry;
+
   /// Container for the multicast routes
   typedef std::list<Ipv6MulticastRoutingTableEntry *> MulticastRoutes;
 
@@ -272,6 +277,28 @@ private:
    */
   bool LookupRoute (const Ipv6RoutingTableEntry &route, uint32_t metric);
 
+  /**
+   * \brief Add a network route to the list and to the forwarding table index.
+   * \param route route
+   * \param metric metric of route
+   */
+  void AddNetworkRoute (Ipv6RoutingTableEntry *route, uint32_t metric);
+
+  /**
+   * \brief Remove a network route from the forwarding table index and the
+   * list, and delete it.
+   * \param route the route
+   * \return the route following the removed one in the list
+   */
+  NetworkRoutesI RemoveNetworkRoute (NetworkRoutesI route);
+
+  /**
+   * \brief Collect the network routes whose network contains an address, in
+   * the order of the list, into m_fibCandidates.
+   * \param dst the address
+   */
+  void MatchNetworkRoutes (Ipv6Address dst);
+
   /**
    * \brief Lookup in the forwarding table for destination.
    * \param dest destination address
@@ -294,6 +321,21 @@ private:
    */
   NetworkRoutes m_networkRoutes;
 
+  /**
+   * \brief index of m_networkRoutes by destination network.
+   */
+  PrefixTrie<16, FibEntry> m_fib;
+
+  /**
+   * \brief insertion order of the next network route.
+   */
+  uint64_t m_fibSequence;
+
+  /**
+   * \brief network routes matching the destination being looked up.
+   */
+  std::vector<FibEntry> m_fibCandidates;
+
   /**
    * \brief the forwarding table for multicast.
    */
@@ -67,6 +67,7 @@ void NdiscCache::DoDispose ()
   m_device = 0;
   m_interface = 0;
   m_icmpv6 = 0;
+  m_sharedCache = 0;
   Object::DoDispose ();
 }
 
@@ -101,6 +102,10 @@ NdiscCache::Entry* NdiscCache::Lookup (Ipv6Address dst)
 
       return entry;
     }
+  if (m_sharedCache)
+    {
+      return m_sharedCache->Lookup (dst);
+    }
   NS_LOG_LOGIC ("Nothing found");
   return 0;
 }
@@ -119,6 +124,16 @@ std::list<NdiscCache::Entry*> NdiscCache::LookupInverse (Address dst)
           entryList.push_back (entry);
         }
     }
+  if (m_sharedCache)
+    {
+      for (CacheI i = m_sharedCache->m_ndCache.begin (); i != m_sharedCache->m_ndCache.end (); i++)
+        {
+          if (i->second->GetMacAddress () == dst && m_ndCache.find (i->first) == m_ndCache.end ())
+            {
+              entryList.push_back (i->second);
+            }
+        }
+    }
   return entryList;
 }
 
@@ -174,16 +189,29 @@ uint32_t NdiscCache::GetUnresQlen ()
   return m_unresQlen;
 }
 
+void NdiscCache::SetSharedCache (Ptr<NdiscCache> cache)
+{
+  NS_LOG_FUNCTION (this << cache);
+  NS_ASSERT (cache != this);
+  m_sharedCache = cache;
+}
+
+Ptr<NdiscCache> NdiscCache::GetSharedCache () const
+{
+  NS_LOG_FUNCTION (this);
+  return m_sharedCache;
+}
+
 void NdiscCache::PrintNdiscCache (Ptr<OutputStreamWrapper> stream)
 {
   NS_LOG_FUNCTION (this << stream);
   std::ostream* os = stream->GetStream ();
 
+  std::string found = Names::FindName (m_device);
   for (CacheI i = m_ndCache.begin (); i != m_ndCache.end (); i++)
     {
       *os << i->first << " dev ";
-      std::string found = Names::FindName (m_device);
-      if (Names::FindName (m_device) != "")
+      if (found != "")
         {
           *os << found;
         }
@@ -223,6 +251,27 @@ void NdiscCache::PrintNdiscCache (Ptr<OutputStreamWrapper> stream)
           NS_FATAL_ERROR ("Test for possibly unreachable code-- please file a bug report, with a test case, if this is ever hit");
         }
     }
+
+  if (m_sharedCache)
+    {
+      for (CacheI i = m_sharedCache->m_ndCache.begin (); i != m_sharedCache->m_ndCache.end (); i++)
+        {
+          if (m_ndCache.find (i->first) != m_ndCache.end ())
+            {
+              continue;
+            }
+          *os << i->first << " dev ";
+          if (found != "")
+            {
+              *os << found;
+            }
+          else
+            {
+              *os << static_cast<int> (m_device->GetIfIndex ());
+            }
+          *os << " lladdr " << i->second->GetMacAddress () << " PERMANENT\n";
+        }
+    }
 }
 
 NdiscCache::Entry::Entry (NdiscCache* nd)
@@ -90,6 +90,9 @@ public:
 
   /**
    * \brief Lookup in the cache.
+   *
+   * If this cache has no entry for the address, the shared cache is looked up.
+   *
    * \param dst destination address.
    * \return the entry if found, 0 otherwise.
    */
@@ -117,9 +120,30 @@ public:
 
   /**
    * \brief Flush the cache.
+   *
+   * The entries of the shared cache, if any, are kept.
    */
   void Flush ();
 
+  /**
+   * \brief Set a cache of permanent entries shared with other caches.
+   *
+   * The entries of the shared cache are looked up when this cache has no
+   * entry for an address. The shared cache holds one permanent entry per
+   * neighbor of a link, e.g., as populated by NeighborCacheHelper, instead
+   * of one entry per neighbor in the cache of each interface of the link.
+   * Its entries are not modified by this cache.
+   *
+   * \param cache the shared cache, or null to stop using it
+   */
+  void SetSharedCache (Ptr<NdiscCache> cache);
+
+  /**
+   * \brief Get the cache of permanent entries shared with other caches.
+   * \return the shared cache, or null
+   */
+  Ptr<NdiscCache> GetSharedCache () const;
+
   /**
    * \brief Set the max number of waiting packet.
    * \param unresQlen value to set
@@ -462,6 +486,11 @@ private:
    * \brief Max number of packet stored in m_waiting.
    */
   uint32_t m_unresQlen;
+
+  /**
+   * \brief The cache of permanent entries shared with other caches.
+   */
+  Ptr<NdiscCache> m_sharedCache;
 };
 
 /**
@@ -0,0 +1,405 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef PREFIX_TRIE_H
+#define PREFIX_TRIE_H
+
+#include <stdint.h>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+#include "ns3/assert.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup ipv4Routing
+ *
+ * \brief A path-compressed binary trie of address prefixes, used as the
+ * forwarding table index of the routing protocols.
+ *
+ * Each prefix of up to 8 * N bits (the leading bits of an N-byte address
+ * in network byte order) holds a list of values, kept in insertion order.
+ * Nodes with a single child and no values are not stored, so the trie has
+ * at most two nodes per stored prefix, and finding the prefixes matching
+ * an address visits at most one node per bit of the longest of them.
+ *
+ * The routing protocols store in it the entries of their route lists, keyed
+ * by destination network and mask length, and use Match () to find the
+ * routes whose network contains a destination, instead of scanning the
+ * whole list.
+ *
+ * \tparam N The number of bytes of the addresses (4 for IPv4, 16 for IPv6).
+ * \tparam T The type of the values.
+ */
+template <std::size_t N, typename T>
+class PrefixTrie
+{
+public:
+  PrefixTrie ()
+  {
+    Clear ();
+  }
+
+  /**
+   * \brief Remove all the prefixes.
+   */
+  void Clear (void)
+  {
+    m_nodes.assign (1, Node ());
+    m_free.clear ();
+  }
+
+  /**
+   * \brief Count the leading one bits of a network mask.
+   *
+   * For a contiguous mask, this is the prefix length.  For other masks it
+   * is the length of the longest prefix of bits all covered by the mask,
+   * which can be used as the length of the key of a route: the route can
+   * only match addresses matching these leading bits.
+   *
+   * \param mask The N bytes of the mask, in network byte order.
+   * \returns the number of leading one bits
+   */
+  static uint8_t GetMaskLength (const uint8_t *mask)
+  {
+    uint8_t length = 0;
+    for (std::size_t i = 0; i < N; ++i)
+      {
+        uint8_t byte = mask[i];
+        while (byte & 0x80)
+          {
+            ++length;
+            byte <<= 1;
+          }
+        if (mask[i] != 0xff)
+          {
+            break;
+          }
+      }
+    return length;
+  }
+
+  /**
+   * \brief Add a value to a prefix, after its current values.
+   *
+   * \param key The N bytes of the address, in network byte order; the bits
+   * beyond the prefix length are ignored.
+   * \param length The prefix length in bits.
+   * \param value The value.
+   */
+  void Insert (const uint8_t *key, uint8_t length, const T &value)
+  {
+    NS_ASSERT (length <= 8 * N);
+    uint8_t k[N];
+    MaskKey (key, length, k);
+    uint32_t n = 0;
+    while (true)
+      {
+        if (m_nodes[n].length == length)
+          {
+            m_nodes[n].values.push_back (value);
+            return;
+          }
+        uint8_t b = GetBit (k, m_nodes[n].length);
+        uint32_t c = m_nodes[n].child[b];
+        if (c == 0)
+          {
+            uint32_t leaf = NewNode (k, length, n);
+            m_nodes[n].child[b] = leaf;
+            m_nodes[leaf].values.push_back (value);
+            return;
+          }
+        uint8_t limit = std::min (length, m_nodes[c].length);
+        uint8_t common = GetCommonLength (k, m_nodes[c].key, m_nodes[n].length, limit);
+        if (common == m_nodes[c].length)
+          {
+            n = c;
+            continue;
+          }
+        // Split the edge from n to c with a node at the common prefix
+        uint32_t m = NewNode (k, common, n);
+        m_nodes[n].child[b] = m;
+        m_nodes[c].parent = m;
+        m_nodes[m].child[GetBit (m_nodes[c].key, common)] = c;
+        if (common == length)
+          {
+            m_nodes[m].values.push_back (value);
+            return;
+          }
+        uint32_t leaf = NewNode (k, length, m);
+        m_nodes[m].child[GetBit (k, common)] = leaf;
+        m_nodes[leaf].values.push_back (value);
+        return;
+      }
+  }
+
+  /**
+   * \brief Remove the first value of a prefix satisfying a predicate.
+   *
+   * \tparam P \deduced The type of the predicate.
+   * \param key The N bytes of the address, in network byte order.
+   * \param length The prefix length in bits.
+   * \param predicate A callable taking a const T & and returning true for
+   * the value to remove.
+   * \returns true if a value was removed
+   */
+  template <typename P>
+  bool Remove (const uint8_t *key, uint8_t length, P predicate)
+  {
+    uint32_t n = FindNode (key, length);
+    if (n == NONE)
+      {
+        return false;
+      }
+    std::vector<T> &values = m_nodes[n].values;
+    for (typename std::vector<T>::iterator i = values.begin (); i != values.end (); ++i)
+      {
+        if (predicate (*i))
+          {
+            values.erase (i);
+            Prune (n);
+            return true;
+          }
+      }
+    return false;
+  }
+
+  /**
+   * \param key The N bytes of the address, in network byte order.
+   * \param length The prefix length in bits.
+   * \returns the values of the prefix, or null if it holds none
+   */
+  const std::vector<T> * Find (const uint8_t *key, uint8_t length) const
+  {
+    uint32_t n = FindNode (key, length);
+    if (n == NONE || m_nodes[n].values.empty ())
+      {
+        return 0;
+      }
+    return &m_nodes[n].values;
+  }
+
+  /**
+   * \brief Visit the values of all the prefixes containing an address.
+   *
+   * The prefixes are visited from the shortest to the longest.
+   *
+   * \tparam F \deduced The type of the visitor.
+   * \param key The N bytes of the address, in network byte order.
+   * \param visitor A callable taking the prefix length and a const
+   * std::vector<T> & holding the values of the prefix.
+   */
+  template <typename F>
+  void Match (const uint8_t *key, F visitor) const
+  {
+    uint32_t n = 0;
+    while (true)
+      {
+        const Node &node = m_nodes[n];
+        if (!node.values.empty ())
+          {
+            visitor (node.length, node.values);
+          }
+        if (node.length == 8 * N)
+          {
+            return;
+          }
+        uint32_t c = node.child[GetBit (key, node.length)];
+        if (c == 0
+            || GetCommonLength (key, m_nodes[c].key, node.length, m_nodes[c].length) != m_nodes[c].length)
+          {
+            return;
+          }
+        n = c;
+      }
+  }
+
+  /**
+   * \returns the number of nodes of the trie, including the root
+   */
+  std::size_t GetNNodes (void) const
+  {
+    return m_nodes.size () - m_free.size ();
+  }
+
+private:
+  /// Index of a missing node
+  static const uint32_t NONE = 0xffffffff;
+
+  /**
+   * \brief A node of the trie.
+   */
+  struct Node
+  {
+    Node ()
+      : length (0),
+        parent (0)
+    {
+      std::memset (key, 0, N);
+      child[0] = 0;
+      child[1] = 0;
+    }
+    uint8_t key[N];         //!< the prefix, bits beyond length cleared
+    uint8_t length;         //!< the prefix length
+    uint32_t parent;        //!< index of the parent node
+    uint32_t child[2];      //!< indexes of the children, by next bit; 0 if none
+    std::vector<T> values;  //!< values of the prefix
+  };
+
+  /**
+   * \param key An address.
+   * \param i A bit index, smaller than 8 * N.
+   * \returns the bit of the address at this index
+   */
+  static uint8_t GetBit (const uint8_t *key, uint32_t i)
+  {
+    return (key[i >> 3] >> (7 - (i & 7))) & 1;
+  }
+
+  /**
+   * \brief Copy the prefix of an address, clearing the following bits.
+   * \param key The address.
+   * \param length The prefix length.
+   * \param out [out] The masked address.
+   */
+  static void MaskKey (const uint8_t *key, uint8_t length, uint8_t *out)
+  {
+    for (std::size_t i = 0; i < N; ++i)
+      {
+        uint32_t bits = length > 8 * i ? length - 8 * i : 0;
+        out[i] = bits >= 8 ? key[i] : key[i] & static_cast<uint8_t> (0xff00 >> bits);
+      }
+  }
+
+  /**
+   * \brief Compute the length of the common prefix of two addresses known
+   * to share their first bits.
+   * \param a An address.
+   * \param b Another address.
+   * \param from Number of leading bits known to be equal.
+   * \param limit Maximum length to return.
+   * \returns the length of the common prefix, at most limit
+   */
+  static uint8_t GetCommonLength (const uint8_t *a, const uint8_t *b, uint8_t from, uint8_t limit)
+  {
+    for (std::size_t i = from >> 3; 8 * i < limit; ++i)
+      {
+        uint8_t diff = a[i] ^ b[i];
+        if (diff != 0)
+          {
+            uint32_t length = 8 * i;
+            while (!(diff & 0x80))
+              {
+                ++length;
+                diff <<= 1;
+              }
+            return static_cast<uint8_t> (std::min<uint32_t> (length, limit));
+          }
+      }
+    return limit;
+  }
+
+  /**
+   * \brief Find the node of a prefix.
+   * \param key The address.
+   * \param length The prefix length.
+   * \returns the index of the node, or NONE
+   */
+  uint32_t FindNode (const uint8_t *key, uint8_t length) const
+  {
+    uint8_t k[N];
+    MaskKey (key, length, k);
+    uint32_t n = 0;
+    while (m_nodes[n].length < length)
+      {
+        uint32_t c = m_nodes[n].child[GetBit (k, m_nodes[n].length)];
+        if (c == 0 || m_nodes[c].length > length
+            || GetCommonLength (k, m_nodes[c].key, m_nodes[n].length, m_nodes[c].length) != m_nodes[c].length)
+          {
+            return NONE;
+          }
+        n = c;
+      }
+    return m_nodes[n].length == length ? n : NONE;
+  }
+
+  /**
+   * \brief Allocate a node.
+   * \param key The address.
+   * \param length The prefix length.
+   * \param parent The index of the parent node.
+   * \returns the index of the node
+   */
+  uint32_t NewNode (const uint8_t *key, uint8_t length, uint32_t parent)
+  {
+    uint32_t n;
+    if (m_free.empty ())
+      {
+        n = static_cast<uint32_t> (m_nodes.size ());
+        m_nodes.push_back (Node ());
+      }
+    else
+      {
+        n = m_free.back ();
+        m_free.pop_back ();
+      }
+    MaskKey (key, length, m_nodes[n].key);
+    m_nodes[n].length = length;
+    m_nodes[n].parent = parent;
+    m_nodes[n].child[0] = 0;
+    m_nodes[n].child[1] = 0;
+    return n;
+  }
+
+  /**
+   * \brief Remove a node and its ancestors that no longer hold values nor
+   * separate two subtrees.
+   * \param n The index of the node.
+   */
+  void Prune (uint32_t n)
+  {
+    while (n != 0 && m_nodes[n].values.empty ()
+           && (m_nodes[n].child[0] == 0 || m_nodes[n].child[1] == 0))
+      {
+        uint32_t parent = m_nodes[n].parent;
+        uint32_t child = m_nodes[n].child[0] != 0 ? m_nodes[n].child[0] : m_nodes[n].child[1];
+        uint8_t side = m_nodes[parent].child[0] == n ? 0 : 1;
+        m_nodes[parent].child[side] = child;
+        if (child != 0)
+          {
+            m_nodes[child].parent = parent;
+          }
+        m_nodes[n].child[0] = 0;
+        m_nodes[n].child[1] = 0;
+        m_nodes[n].values.clear ();
+        m_free.push_back (n);
+        if (child != 0)
+          {
+            // the parent still has as many children
+            return;
+          }
+        n = parent;
+      }
+  }
+
+  std::vector<Node> m_nodes;    //!< the nodes; the root, of length 0, is the first
+  std::vector<uint32_t> m_free; //!< indexes of the unused nodes
+};
+
+} // namespace ns3
+
+#endif /* PREFIX_TRIE_H */
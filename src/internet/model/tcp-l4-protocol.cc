@@ -29,6 +29,7 @@
 #include "ns3/simulator.h"
 #include "ns3/ipv4-route.h"
 #include "ns3/ipv6-route.h"
+#include "ns3/segmentation-offload-tag.h"
 
 #include "tcp-l4-protocol.h"
 #include "tcp-header.h"
@@ -703,6 +704,44 @@ TcpL4Protocol::SendPacket (Ptr<Packet> pkt, const TcpHeader &outgoing,
   NS_FATAL_ERROR ("Trying to send a packet without IP addresses");
 }
 
+std::list<Ptr<Packet> >
+TcpL4Protocol::SplitSuperSegment (Ptr<const Packet> packet,
+                                  const Address &source,
+                                  const Address &destination)
+{
+  Ptr<Packet> payload = packet->Copy ();
+  SegmentationOffloadTag offloadTag;
+  bool found = payload->RemovePacketTag (offloadTag);
+  NS_ASSERT_MSG (found && offloadTag.GetSegmentSize () > 0, "Not a super-segment");
+  TcpHeader header;
+  payload->RemoveHeader (header);
+
+  std::list<Ptr<Packet> > segments;
+  uint32_t size = payload->GetSize ();
+  uint32_t offset = 0;
+  do
+    {
+      uint32_t segmentSize = std::min<uint32_t> (offloadTag.GetSegmentSize (), size - offset);
+      Ptr<Packet> segment = payload->CreateFragment (offset, segmentSize);
+      TcpHeader segmentHeader = header;
+      segmentHeader.SetSequenceNumber (header.GetSequenceNumber () + offset);
+      offset += segmentSize;
+      if (offset < size)
+        {
+          segmentHeader.SetFlags (header.GetFlags () & ~(TcpHeader::FIN | TcpHeader::PSH));
+        }
+      if (Node::ChecksumEnabled ())
+        {
+          segmentHeader.EnableChecksums ();
+          segmentHeader.InitializeChecksum (source, destination, PROT_NUMBER);
+        }
+      segment->AddHeader (segmentHeader);
+      segments.push_back (segment);
+    }
+  while (offset < size);
+  return segments;
+}
+
 void
 TcpL4Protocol::AddSocket (Ptr<TcpSocketBase> socket)
 {
@@ -22,6 +22,7 @@
 #define TCP_L4_PROTOCOL_H
 
 #include <stdint.h>
+#include <list>
 
 #include "ns3/ipv4-address.h"
 #include "ns3/ipv6-address.h"
@@ -250,6 +251,25 @@ public:
    */
   void DeAllocate (Ipv6EndPoint *endPoint);
 
+  /**
+   * \brief Split a super-segment into the segments it stands for
+   *
+   * The network layer calls this function to send a super-segment (see
+   * SegmentationOffloadTag) through a device that does not support
+   * segmentation offload. Every segment carries a copy of the TCP header
+   * of the super-segment with its own sequence number; the FIN and PSH
+   * flags are only kept in the last segment.
+   *
+   * \param packet the super-segment, with its TCP header and its
+   * SegmentationOffloadTag
+   * \param source source address (an underlying Ipv4Address or Ipv6Address)
+   * \param destination destination address (an underlying Ipv4Address or Ipv6Address)
+   * \return the segments, with their TCP header
+   */
+  static std::list<Ptr<Packet> > SplitSuperSegment (Ptr<const Packet> packet,
+                                                     const Address &source,
+                                                     const Address &destination);
+
   // From IpL4Protocol
   virtual enum IpL4Protocol::RxStatus Receive (Ptr<Packet> p,
                                                Ipv4Header const &incomingIpHeader,
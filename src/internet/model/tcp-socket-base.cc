@@ -43,6 +43,9 @@
 #include "ns3/trace-source-accessor.h"
 #include "ns3/data-rate.h"
 #include "ns3/object.h"
+#include "ns3/segmentation-offload-tag.h"
+#include "ns3/ipv4-header.h"
+#include "ns3/ipv6-header.h"
 #include "tcp-socket-base.h"
 #include "tcp-l4-protocol.h"
 #include "ipv4-end-point.h"
@@ -147,6 +150,12 @@ TcpSocketBase::GetTypeId (void)
                    BooleanValue (true),
                    MakeBooleanAccessor (&TcpSocketBase::m_limitedTx),
                    MakeBooleanChecker ())
+    .AddAttribute ("TsoMaxSegments",
+                   "Maximum number of segments of new data sent at once in a "
+                   "single super-segment (TCP segmentation offload); 1 disables it",
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&TcpSocketBase::m_tsoMaxSegments),
+                   MakeUintegerChecker<uint16_t> (1))
     .AddAttribute ("UseEcn", "Parameter to set ECN functionality",
                    EnumValue (TcpSocketState::Off),
                    MakeEnumAccessor (&TcpSocketBase::SetUseEcn),
@@ -350,6 +359,7 @@ TcpSocketBase::TcpSocketBase (const TcpSocketBase& sock)
     m_recoverActive (sock.m_recoverActive),
     m_retxThresh (sock.m_retxThresh),
     m_limitedTx (sock.m_limitedTx),
+    m_tsoMaxSegments (sock.m_tsoMaxSegments),
     m_isFirstPartialAck (sock.m_isFirstPartialAck),
     m_txTrace (sock.m_txTrace),
     m_rxTrace (sock.m_rxTrace),
@@ -3119,6 +3129,18 @@ TcpSocketBase::SendDataPacket (SequenceNumber32 seq, uint32_t maxSize, bool with
   header.SetWindowSize (AdvertisedWindowSize ());
   AddOptions (header);
 
+  if (sz > m_tcb->m_segmentSize)
+    {
+      // Super-segment: record the segments it stands for and the headers
+      // each of them would carry
+      uint32_t ipHeaderSize = m_endPoint ? Ipv4Header ().GetSerializedSize ()
+                                         : Ipv6Header ().GetSerializedSize ();
+      SegmentationOffloadTag offloadTag ((sz + m_tcb->m_segmentSize - 1) / m_tcb->m_segmentSize,
+                                         m_tcb->m_segmentSize,
+                                         header.GetSerializedSize () + ipHeaderSize);
+      p->AddPacketTag (offloadTag);
+    }
+
   if (m_retxEvent.IsExpired ())
     {
       // Schedules retransmit timeout. m_rto should be already doubled.
@@ -3167,6 +3189,55 @@ TcpSocketBase::SendDataPacket (SequenceNumber32 seq, uint32_t maxSize, bool with
   return sz;
 }
 
+uint32_t
+TcpSocketBase::GetTsoSize (SequenceNumber32 seq, uint32_t availableWindow) const
+{
+  NS_LOG_FUNCTION (this << seq << availableWindow);
+  uint32_t segmentSize = m_tcb->m_segmentSize;
+  uint32_t size = std::min (availableWindow, m_tsoMaxSegments * segmentSize);
+  // The super-segment must fit in the length field of the IP headers, with
+  // IPv4 and TCP headers of the largest size
+  size = std::min<uint32_t> (size, 65535 - 60 - 60);
+  // and in the window advertised by the peer
+  SequenceNumber32 rightEdge = m_highRxAckMark.Get () + SequenceNumber32 (m_rWnd.Get ());
+  size = std::min<uint32_t> (size, rightEdge > seq ? rightEdge - seq : 0);
+  // Only send whole segments
+  size -= size % segmentSize;
+  return std::max (size, segmentSize);
+}
+
+bool
+TcpSocketBase::OutputDeviceSupportsSegmentationOffload (void) const
+{
+  NS_LOG_FUNCTION (this);
+  Socket::SocketErrno errno_;
+  Ptr<NetDevice> oif = m_boundnetdevice;
+  Ptr<NetDevice> outputDevice;
+  if (m_endPoint != nullptr)
+    {
+      Ptr<Ipv4> ipv4 = m_node->GetObject<Ipv4> ();
+      Ipv4Header header;
+      header.SetDestination (m_endPoint->GetPeerAddress ());
+      Ptr<Ipv4Route> route = ipv4->GetRoutingProtocol ()->RouteOutput (Ptr<Packet> (), header, oif, errno_);
+      if (route != nullptr)
+        {
+          outputDevice = route->GetOutputDevice ();
+        }
+    }
+  else if (m_endPoint6 != nullptr)
+    {
+      Ptr<Ipv6L3Protocol> ipv6 = m_node->GetObject<Ipv6L3Protocol> ();
+      Ipv6Header header;
+      header.SetDestination (m_endPoint6->GetPeerAddress ());
+      Ptr<Ipv6Route> route = ipv6->GetRoutingProtocol ()->RouteOutput (Ptr<Packet> (), header, oif, errno_);
+      if (route != nullptr)
+        {
+          outputDevice = route->GetOutputDevice ();
+        }
+    }
+  return outputDevice != nullptr && outputDevice->SupportsSegmentationOffload ();
+}
+
 void
 TcpSocketBase::UpdateRttHistory (const SequenceNumber32 &seq, uint32_t sz,
                                  bool isRetransmission)
@@ -3281,6 +3352,14 @@ TcpSocketBase::SendPendingData (bool withAck)
           uint32_t maxSizeToSend = static_cast<uint32_t> (nextHigh - next);
           s = std::min (s, maxSizeToSend);
 
+          // With segmentation offload, send several segments of new data at once
+          if (m_tsoMaxSegments > 1 && s == m_tcb->m_segmentSize
+              && next >= m_tcb->m_highTxMark && !IsPacingEnabled ()
+              && OutputDeviceSupportsSegmentationOffload ())
+            {
+              s = GetTsoSize (next, availableWindow);
+            }
+
           // (C.2) If any of the data octets sent in (C.1) are below HighData,
           //       HighRxt MUST be set to the highest sequence number of the
           //       retransmitted segment unless NextSeg () rule (4) was
@@ -3434,6 +3513,14 @@ TcpSocketBase::ReceivedData (Ptr<Packet> p, const TcpHeader& tcpHeader)
   NS_LOG_DEBUG ("Data segment, seq=" << tcpHeader.GetSequenceNumber () <<
                 " pkt size=" << p->GetSize () );
 
+  // A super-segment is received as the coalesced segments it stands for
+  uint32_t segments = 1;
+  SegmentationOffloadTag offloadTag;
+  if (p->RemovePacketTag (offloadTag))
+    {
+      segments = offloadTag.GetSegments ();
+    }
+
   // Put into Rx buffer
   SequenceNumber32 expectedSeq = m_tcb->m_rxBuffer->NextRxSequence ();
   if (!m_tcb->m_rxBuffer->Add (p, tcpHeader))
@@ -3487,7 +3574,8 @@ TcpSocketBase::ReceivedData (Ptr<Packet> p, const TcpHeader& tcpHeader)
     }
   else
     { // In-sequence packet: ACK if delayed ack count allows
-      if (++m_delAckCount >= m_delAckMaxCount)
+      m_delAckCount += segments;
+      if (m_delAckCount >= m_delAckMaxCount)
         {
           m_delAckEvent.Cancel ();
           m_delAckCount = 0;
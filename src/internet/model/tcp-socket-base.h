@@ -1210,6 +1210,31 @@ protected:
    */
   void NotifyPacingPerformed (void);
 
+  /**
+   * \brief Compute the size of a super-segment of new data (segmentation
+   * offload).
+   *
+   * The size is a multiple of the segment size, bounded by the number of
+   * segments set by TsoMaxSegments, by the available window and by the
+   * window advertised by the peer.
+   *
+   * \param seq the sequence number of the first byte to send
+   * \param availableWindow the available congestion window
+   * \return the number of bytes to send, at least one segment
+   */
+  uint32_t GetTsoSize (SequenceNumber32 seq, uint32_t availableWindow) const;
+
+  /**
+   * \brief Check whether the device the segments are sent through supports
+   * segmentation offload.
+   *
+   * The route to the peer is looked up for every super-segment, so that a
+   * route change is taken into account.
+   *
+   * \return true if the output device to the peer supports segmentation offload
+   */
+  bool OutputDeviceSupportsSegmentationOffload (void) const;
+
   /**
    * \brief Return true if packets in the current window should be paced
    * \return true if pacing is currently enabled
@@ -1323,6 +1348,7 @@ protected:
                                                   //!< which was set for handling previous congestion event.
   uint32_t               m_retxThresh {3};   //!< Fast Retransmit threshold
   bool                   m_limitedTx  {true}; //!< perform limited transmit
+  uint16_t               m_tsoMaxSegments {1}; //!< Max segments of a super-segment (segmentation offload)
 
   // Transmission Control Block
   Ptr<TcpSocketState>    m_tcb;               //!< Congestion control information
@@ -296,7 +296,7 @@ TcpTxBuffer::GetNewSegment (uint32_t numBytes)
   NS_ASSERT (it != m_appList.end ());
 
   m_appList.erase (it);
-  m_sentList.insert (m_sentList.end (), item);
+  m_sentIndex[item->m_startSeq] = m_sentList.insert (m_sentList.end (), item);
   m_sentSize += item->m_packet->GetSize ();
 
   return item;
@@ -310,36 +310,33 @@ TcpTxBuffer::GetTransmittedSegment (uint32_t numBytes, const SequenceNumber32 &s
   NS_ASSERT (numBytes <= m_sentSize);
   NS_ASSERT (m_sentList.size () >= 1);
 
-  auto it = m_sentList.begin ();
+  SentIndex::const_iterator found = m_sentIndex.find (seq);
   bool listEdited = false;
   uint32_t s = numBytes;
 
   // Avoid to merge different packet for this retransmission if flags are
   // different.
-  for (; it != m_sentList.end(); ++it)
+  if (found != m_sentIndex.end ())
     {
-      if ((*it)->m_startSeq == seq)
+      PacketList::iterator it = found->second;
+      auto next = it;
+      next++;
+      if (next != m_sentList.end ())
         {
-          auto next = it;
-          next++;
-          if (next != m_sentList.end ())
+          // Next is not sacked and have the same value for m_lost ... there is the possibility to merge
+          if ((! (*next)->m_sacked) && ((*it)->m_lost == (*next)->m_lost))
             {
-              // Next is not sacked and have the same value for m_lost ... there is the possibility to merge
-              if ((! (*next)->m_sacked) && ((*it)->m_lost == (*next)->m_lost))
-                {
-                  s = std::min(s, (*it)->m_packet->GetSize () + (*next)->m_packet->GetSize ());
-                }
-              else
-                {
-                  // Next is sacked... better to retransmit only the first segment
-                  s = std::min(s, (*it)->m_packet->GetSize ());
-                }
+              s = std::min(s, (*it)->m_packet->GetSize () + (*next)->m_packet->GetSize ());
             }
           else
             {
+              // Next is sacked... better to retransmit only the first segment
               s = std::min(s, (*it)->m_packet->GetSize ());
             }
-          break;
+        }
+      else
+        {
+          s = std::min(s, (*it)->m_packet->GetSize ());
         }
     }
 
@@ -376,6 +373,36 @@ TcpTxBuffer::FindHighestSacked () const
   return ret;
 }
 
+TcpTxBuffer::PacketList::iterator
+TcpTxBuffer::FindSentItem (const SequenceNumber32 &seq) const
+{
+  NS_LOG_FUNCTION (this << seq);
+  PacketList::iterator end = const_cast<TcpTxBuffer*> (this)->m_sentList.end ();
+  SentIndex::const_iterator found = m_sentIndex.upper_bound (seq);
+  if (found == m_sentIndex.begin ())
+    {
+      return end;
+    }
+  --found;
+  TcpTxItem *item = *found->second;
+  if (seq >= item->m_startSeq + item->m_packet->GetSize ())
+    {
+      return end;
+    }
+  return found->second;
+}
+
+TcpTxBuffer::PacketList::iterator
+TcpTxBuffer::FindSentItemFrom (const SequenceNumber32 &seq) const
+{
+  NS_LOG_FUNCTION (this << seq);
+  SentIndex::const_iterator found = m_sentIndex.lower_bound (seq);
+  if (found == m_sentIndex.end ())
+    {
+      return const_cast<TcpTxBuffer*> (this)->m_sentList.end ();
+    }
+  return found->second;
+}
 
 void
 TcpTxBuffer::SplitItems (TcpTxItem *t1, TcpTxItem *t2, uint32_t size) const
@@ -400,7 +427,7 @@ TcpTxBuffer::SplitItems (TcpTxItem *t1, TcpTxItem *t2, uint32_t size) const
 TcpTxItem*
 TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listStartFrom,
                                 uint32_t numBytes, const SequenceNumber32 &seq,
-                                bool *listEdited) const
+                                bool *listEdited)
 {
   NS_LOG_FUNCTION (this << numBytes << seq);
 
@@ -436,6 +463,18 @@ TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listSt
   TcpTxItem *outItem = nullptr;
   PacketList::iterator it = list.begin ();
   SequenceNumber32 beginOfCurrentPacket = listStartFrom;
+  bool indexed = &list == &m_sentList;
+
+  if (indexed)
+    {
+      // Skip the sent items before the one containing seq
+      PacketList::iterator found = FindSentItem (seq);
+      if (found != list.end ())
+        {
+          it = found;
+          beginOfCurrentPacket = (*it)->m_startSeq;
+        }
+    }
 
   while (it != list.end ())
     {
@@ -471,7 +510,12 @@ TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listSt
               SplitItems (firstPart, currentItem, seq - beginOfCurrentPacket);
 
               // insert firstPart before currentItem
-              list.insert (it, firstPart);
+              PacketList::iterator firstIt = list.insert (it, firstPart);
+              if (indexed)
+                {
+                  m_sentIndex[firstPart->m_startSeq] = firstIt;
+                  m_sentIndex[currentItem->m_startSeq] = it;
+                }
               if (listEdited)
                 {
                   *listEdited = true;
@@ -517,6 +561,10 @@ TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listSt
                   NS_ASSERT (it != list.begin ());
                   TcpTxItem *previous = *(--it);
 
+                  if (indexed)
+                    {
+                      m_sentIndex.erase (previous->m_startSeq);
+                    }
                   list.erase (it);
 
                   MergeItems (previous, currentItem);
@@ -537,7 +585,12 @@ TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listSt
               SplitItems (firstPart, currentItem, numBytes);
 
               // insert firstPart before currentItem
-              list.insert (it, firstPart);
+              PacketList::iterator firstIt = list.insert (it, firstPart);
+              if (indexed)
+                {
+                  m_sentIndex[firstPart->m_startSeq] = firstIt;
+                  m_sentIndex[currentItem->m_startSeq] = it;
+                }
               if (listEdited)
                 {
                   *listEdited = true;
@@ -566,6 +619,10 @@ TcpTxBuffer::GetPacketFromList (PacketList &list, const SequenceNumber32 &listSt
                                    // in the previous if
 
           MergeItems (currentItem, next);
+          if (indexed)
+            {
+              m_sentIndex.erase (next->m_startSeq);
+            }
           list.erase (it);
 
           delete next;
@@ -651,9 +708,11 @@ bool
 TcpTxBuffer::IsRetransmittedDataAcked (const SequenceNumber32& ack) const
 {
   NS_LOG_FUNCTION (this);
-  for (const auto &it : m_sentList)
+  // Only the item ending right before ack can end at ack
+  PacketList::const_iterator it = FindSentItem (ack - 1);
+  if (it != m_sentList.end ())
      {
-       TcpTxItem *item = it;
+       TcpTxItem *item = *it;
        Ptr<Packet> p = item->m_packet;
        if (item->m_startSeq + p->GetSize () == ack && !item->m_sacked && item->m_retrans)
          {
@@ -708,6 +767,7 @@ TcpTxBuffer::DiscardUpTo (const SequenceNumber32& seq,
 
           RemoveFromCounts (item, pktSize);
 
+          m_sentIndex.erase (item->m_startSeq);
           i = m_sentList.erase (i);
           NS_LOG_INFO ("Removed " << *item << " lost: " << m_lostOut <<
                        " retrans: " << m_retrans << " sacked: " << m_sackedOut <<
@@ -727,7 +787,9 @@ TcpTxBuffer::DiscardUpTo (const SequenceNumber32& seq,
           NS_LOG_INFO (*item);
           // PacketTags are preserved when fragmenting
           item->m_packet = item->m_packet->CreateFragment (offset, pktSize);
+          m_sentIndex.erase (item->m_startSeq);
           item->m_startSeq += offset;
+          m_sentIndex[item->m_startSeq] = i;
           m_size -= offset;
           m_sentSize -= offset;
           m_firstByteSeq += offset;
@@ -800,6 +862,13 @@ TcpTxBuffer::Update (const TcpOptionSack::SackList &list,
           return bytesSacked;
         }
 
+      // The items starting before the block cannot be sacked by it
+      item_it = FindSentItemFrom ((*option_it).first);
+      if (item_it != m_sentList.end ())
+        {
+          beginOfCurrentPacket = (*item_it)->m_startSeq;
+        }
+
       while (item_it != m_sentList.end ())
         {
           uint32_t pktSize = (*item_it)->m_packet->GetSize ();
@@ -938,9 +1007,13 @@ TcpTxBuffer::IsLost (const SequenceNumber32 &seq) const
       return false;
     }
 
-  // In theory, using a map and hints when inserting elements can improve
-  // performance
-  for (it = m_sentList.begin (); it != m_sentList.end (); ++it)
+  // Start from the first item at or after seq
+  it = FindSentItemFrom (seq);
+  if (it != m_sentList.end ())
+    {
+      beginOfCurrentPacket = (*it)->m_startSeq;
+    }
+  for (; it != m_sentList.end (); ++it)
     {
       // Search for the right iterator before calling IsLost()
       if (beginOfCurrentPacket >= seq)
@@ -1248,6 +1321,7 @@ TcpTxBuffer::ResetSentList ()
       m_appList.push_front (item);
       m_sentList.pop_back ();
     }
+  m_sentIndex.clear ();
 
   m_sentSize = 0;
   m_lostOut = 0;
@@ -1264,6 +1338,7 @@ TcpTxBuffer::ResetLastSegmentSent ()
     {
       TcpTxItem *item = m_sentList.back ();
 
+      m_sentIndex.erase (item->m_startSeq);
       m_sentList.pop_back ();
       m_sentSize -= item->m_packet->GetSize ();
       if (item->m_retrans)
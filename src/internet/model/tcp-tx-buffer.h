@@ -22,6 +22,8 @@
 #ifndef TCP_TX_BUFFER_H
 #define TCP_TX_BUFFER_H
 
+#include <map>
+
 #include "ns3/object.h"
 #include "ns3/traced-value.h"
 #include "ns3/sequence-number.h"
@@ -71,7 +73,10 @@ class Packet;
  * class TcpTxItem: instead of storing a list of packets, we store a list of
  * TcpTxItem. Each item has different flags (check the corresponding
  * documentation) and maintaining the scoreboard is a matter of travelling the
- * list and set the SACK flag on the corresponding segment sent.
+ * list and set the SACK flag on the corresponding segment sent. The items
+ * of the SentList are also indexed by their starting sequence number, so
+ * that a SACK block, a retransmission or a loss query starts from the item
+ * it concerns instead of walking the list from SND.UNA.
  *
  * Item properties
  * ---------------
@@ -411,6 +416,21 @@ private:
   friend std::ostream & operator<< (std::ostream & os, TcpTxBuffer const & tcpTxBuf);
 
   typedef std::list<TcpTxItem*> PacketList; //!< container for data stored in the buffer
+  typedef std::map<SequenceNumber32, PacketList::iterator> SentIndex; //!< SentList items by starting sequence
+
+  /**
+   * \brief Find the sent item containing a sequence number
+   * \param seq the sequence number
+   * \return an iterator to the item in the SentList, or the end of the list
+   */
+  PacketList::iterator FindSentItem (const SequenceNumber32 &seq) const;
+
+  /**
+   * \brief Find the first sent item starting at or after a sequence number
+   * \param seq the sequence number
+   * \return an iterator to the item in the SentList, or the end of the list
+   */
+  PacketList::iterator FindSentItemFrom (const SequenceNumber32 &seq) const;
 
   /**
    * \brief Update the lost count
@@ -561,7 +581,7 @@ private:
    */
   TcpTxItem* GetPacketFromList (PacketList &list, const SequenceNumber32 &startingSeq,
                                 uint32_t numBytes, const SequenceNumber32 &requestedSeq,
-                                bool *listEdited = nullptr) const;
+                                bool *listEdited = nullptr);
 
   /**
    * \brief Merge two TcpTxItem
@@ -602,6 +622,7 @@ private:
 
   PacketList m_appList;  //!< Buffer for application data
   PacketList m_sentList; //!< Buffer for sent (but not acked) data
+  SentIndex m_sentIndex; //!< Index of m_sentList by starting sequence
   uint32_t m_maxBuffer;  //!< Max number of data bytes in buffer (SND.WND)
   uint32_t m_size;       //!< Size of all data in this buffer
   uint32_t m_sentSize;   //!< Size of sent (and not discarded) segments
@@ -458,6 +458,32 @@ UdpL4Protocol::Send (Ptr<Packet> packet,
   m_downTarget (packet, saddr, daddr, PROT_NUMBER, route);
 }
 
+void
+UdpL4Protocol::SendBatch (const std::vector<Ptr<Packet> > &packets,
+                          Ipv4Address saddr, Ipv4Address daddr,
+                          uint16_t sport, uint16_t dport, Ptr<Ipv4Route> route)
+{
+  NS_LOG_FUNCTION (this << packets.size () << saddr << daddr << sport << dport << route);
+
+  // the same header is serialized in front of each packet
+  UdpHeader udpHeader;
+  if(Node::ChecksumEnabled ())
+    {
+      udpHeader.EnableChecksums ();
+      udpHeader.InitializeChecksum (saddr,
+                                    daddr,
+                                    PROT_NUMBER);
+    }
+  udpHeader.SetDestinationPort (dport);
+  udpHeader.SetSourcePort (sport);
+
+  for (std::size_t i = 0; i < packets.size (); i++)
+    {
+      packets[i]->AddHeader (udpHeader);
+      m_downTarget (packets[i], saddr, daddr, PROT_NUMBER, route);
+    }
+}
+
 void
 UdpL4Protocol::Send (Ptr<Packet> packet,
                      Ipv6Address saddr, Ipv6Address daddr,
@@ -22,6 +22,7 @@
 #define UDP_L4_PROTOCOL_H
 
 #include <stdint.h>
+#include <vector>
 
 #include "ns3/packet.h"
 #include "ns3/ptr.h"
@@ -201,6 +202,19 @@ public:
   void Send (Ptr<Packet> packet,
              Ipv4Address saddr, Ipv4Address daddr, 
              uint16_t sport, uint16_t dport, Ptr<Ipv4Route> route);
+  /**
+   * \brief Send packets via UDP (IPv4), with the same addresses, ports
+   * and route
+   * \param packets The packets to send
+   * \param saddr The source Ipv4Address
+   * \param daddr The destination Ipv4Address
+   * \param sport The source port number
+   * \param dport The destination port number
+   * \param route The route
+   */
+  void SendBatch (const std::vector<Ptr<Packet> > &packets,
+                  Ipv4Address saddr, Ipv4Address daddr,
+                  uint16_t sport, uint16_t dport, Ptr<Ipv4Route> route);
   /**
    * \brief Send a packet via UDP (IPv6)
    * \param packet The packet to send
@@ -513,62 +513,10 @@ UdpSocketImpl::DoSendTo (Ptr<Packet> p, Ipv4Address dest, uint16_t port, uint8_t
       return -1;
     }
 
-  uint8_t priority = GetPriority ();
-  if (tos)
-    {
-      SocketIpTosTag ipTosTag;
-      ipTosTag.SetTos (tos);
-      // This packet may already have a SocketIpTosTag (see BUG 2440)
-      p->ReplacePacketTag (ipTosTag);
-      priority = IpTos2Priority (tos);
-    }
-
-  if (priority)
-    {
-      SocketPriorityTag priorityTag;
-      priorityTag.SetPriority (priority);
-      p->ReplacePacketTag (priorityTag);
-    }
+  AddIpv4Tags (p, dest, tos);
 
   Ptr<Ipv4> ipv4 = m_node->GetObject<Ipv4> ();
 
-  // Locally override the IP TTL for this socket
-  // We cannot directly modify the TTL at this stage, so we set a Packet tag
-  // The destination can be either multicast, unicast/anycast, or
-  // either all-hosts broadcast or limited (subnet-directed) broadcast.
-  // For the latter two broadcast types, the TTL will later be set to one
-  // irrespective of what is set in these socket options.  So, this tagging
-  // may end up setting the TTL of a limited broadcast packet to be
-  // the same as a unicast, but it will be fixed further down the stack
-  if (m_ipMulticastTtl != 0 && dest.IsMulticast ())
-    {
-      SocketIpTtlTag tag;
-      tag.SetTtl (m_ipMulticastTtl);
-      p->AddPacketTag (tag);
-    }
-  else if (IsManualIpTtl () && GetIpTtl () != 0 && !dest.IsMulticast () && !dest.IsBroadcast ())
-    {
-      SocketIpTtlTag tag;
-      tag.SetTtl (GetIpTtl ());
-      p->AddPacketTag (tag);
-    }
-  {
-    SocketSetDontFragmentTag tag;
-    bool found = p->RemovePacketTag (tag);
-    if (!found)
-      {
-        if (m_mtuDiscover)
-          {
-            tag.Enable ();
-          }
-        else
-          {
-            tag.Disable ();
-          }
-        p->AddPacketTag (tag);
-      }
-  }
-
   // Note that some systems will only send limited broadcast packets
   // out of the "default" interface; here we send it out all interfaces
   if (dest.IsBroadcast ())
@@ -662,6 +610,146 @@ UdpSocketImpl::DoSendTo (Ptr<Packet> p, Ipv4Address dest, uint16_t port, uint8_t
   return 0;
 }
 
+void
+UdpSocketImpl::AddIpv4Tags (Ptr<Packet> p, Ipv4Address dest, uint8_t tos)
+{
+  NS_LOG_FUNCTION (this << p << dest << (uint16_t) tos);
+  uint8_t priority = GetPriority ();
+  if (tos)
+    {
+      SocketIpTosTag ipTosTag;
+      ipTosTag.SetTos (tos);
+      // This packet may already have a SocketIpTosTag (see BUG 2440)
+      p->ReplacePacketTag (ipTosTag);
+      priority = IpTos2Priority (tos);
+    }
+
+  if (priority)
+    {
+      SocketPriorityTag priorityTag;
+      priorityTag.SetPriority (priority);
+      p->ReplacePacketTag (priorityTag);
+    }
+
+  // Locally override the IP TTL for this socket
+  // We cannot directly modify the TTL at this stage, so we set a Packet tag
+  // The destination can be either multicast, unicast/anycast, or
+  // either all-hosts broadcast or limited (subnet-directed) broadcast.
+  // For the latter two broadcast types, the TTL will later be set to one
+  // irrespective of what is set in these socket options.  So, this tagging
+  // may end up setting the TTL of a limited broadcast packet to be
+  // the same as a unicast, but it will be fixed further down the stack
+  if (m_ipMulticastTtl != 0 && dest.IsMulticast ())
+    {
+      SocketIpTtlTag tag;
+      tag.SetTtl (m_ipMulticastTtl);
+      p->AddPacketTag (tag);
+    }
+  else if (IsManualIpTtl () && GetIpTtl () != 0 && !dest.IsMulticast () && !dest.IsBroadcast ())
+    {
+      SocketIpTtlTag tag;
+      tag.SetTtl (GetIpTtl ());
+      p->AddPacketTag (tag);
+    }
+  {
+    SocketSetDontFragmentTag tag;
+    bool found = p->RemovePacketTag (tag);
+    if (!found)
+      {
+        if (m_mtuDiscover)
+          {
+            tag.Enable ();
+          }
+        else
+          {
+            tag.Disable ();
+          }
+        p->AddPacketTag (tag);
+      }
+  }
+}
+
+int
+UdpSocketImpl::DoSendBatchTo (const std::vector<Ptr<Packet> > &packets, Ipv4Address dest, uint16_t port, uint8_t tos)
+{
+  NS_LOG_FUNCTION (this << packets.size () << dest << port << (uint16_t) tos);
+  if (m_endPoint == 0)
+    {
+      if (Bind () == -1)
+        {
+          NS_ASSERT (m_endPoint == 0);
+          return -1;
+        }
+      NS_ASSERT (m_endPoint != 0);
+    }
+  Ptr<Ipv4> ipv4 = m_node->GetObject<Ipv4> ();
+  if (packets.empty () || dest.IsBroadcast ()
+      || m_endPoint->GetLocalAddress () != Ipv4Address::GetAny ()
+      || ipv4->GetRoutingProtocol () == 0)
+    {
+      // no route lookup to share
+      return Socket::SendBatch (packets, 0);
+    }
+  if (m_shutdownSend)
+    {
+      m_errno = ERROR_SHUTDOWN;
+      return -1;
+    }
+
+  // the packets are sent up to the first one that is too large
+  std::vector<Ptr<Packet> > copies;
+  uint32_t bytes = 0;
+  for (std::size_t i = 0; i < packets.size (); i++)
+    {
+      if (packets[i]->GetSize () > GetTxAvailable ())
+        {
+          m_errno = ERROR_MSGSIZE;
+          break;
+        }
+      AddIpv4Tags (packets[i], dest, tos);
+      copies.push_back (packets[i]->Copy ());
+      bytes += packets[i]->GetSize ();
+    }
+  if (copies.empty ())
+    {
+      return -1;
+    }
+
+  // the route of the first packet is used for all of them
+  Ipv4Header header;
+  header.SetDestination (dest);
+  header.SetProtocol (UdpL4Protocol::PROT_NUMBER);
+  Socket::SocketErrno errno_;
+  Ptr<NetDevice> oif = m_boundnetdevice; //specify non-zero if bound to a specific device
+  Ptr<Ipv4Route> route = ipv4->GetRoutingProtocol ()->RouteOutput (copies[0], header, oif, errno_);
+  if (route == 0)
+    {
+      NS_LOG_LOGIC ("No route to destination");
+      NS_LOG_ERROR (errno_);
+      m_errno = errno_;
+      return -1;
+    }
+  if (!m_allowBroadcast)
+    {
+      // Here we try to route subnet-directed broadcasts
+      uint32_t outputIfIndex = ipv4->GetInterfaceForDevice (route->GetOutputDevice ());
+      uint32_t ifNAddr = ipv4->GetNAddresses (outputIfIndex);
+      for (uint32_t addrI = 0; addrI < ifNAddr; ++addrI)
+        {
+          Ipv4InterfaceAddress ifAddr = ipv4->GetAddress (outputIfIndex, addrI);
+          if (dest == ifAddr.GetBroadcast ())
+            {
+              m_errno = ERROR_OPNOTSUPP;
+              return -1;
+            }
+        }
+    }
+
+  m_udp->SendBatch (copies, route->GetSource (), dest, m_endPoint->GetLocalPort (), port, route);
+  NotifyDataSent (bytes);
+  return copies.size ();
+}
+
 int
 UdpSocketImpl::DoSendTo (Ptr<Packet> p, Ipv6Address dest, uint16_t port)
 {
@@ -864,6 +952,46 @@ UdpSocketImpl::RecvFrom (uint32_t maxSize, uint32_t flags,
   return p;
 }
 
+int
+UdpSocketImpl::SendBatch (const std::vector<Ptr<Packet> > &packets, uint32_t flags)
+{
+  NS_LOG_FUNCTION (this << packets.size () << flags);
+
+  if (!m_connected)
+    {
+      m_errno = ERROR_NOTCONN;
+      return -1;
+    }
+  if (Ipv4Address::IsMatchingType (m_defaultAddress))
+    {
+      return DoSendBatchTo (packets, Ipv4Address::ConvertFrom (m_defaultAddress), m_defaultPort, GetIpTos ());
+    }
+  return Socket::SendBatch (packets, flags);
+}
+
+uint32_t
+UdpSocketImpl::RecvBatch (std::vector<Ptr<Packet> > &packets, std::vector<Address> &fromAddresses,
+                          uint32_t maxPackets, uint32_t flags)
+{
+  NS_LOG_FUNCTION (this << maxPackets << flags);
+
+  uint32_t received = 0;
+  while (received < maxPackets && !m_deliveryQueue.empty ())
+    {
+      Ptr<Packet> p = m_deliveryQueue.front ().first;
+      packets.push_back (p);
+      fromAddresses.push_back (m_deliveryQueue.front ().second);
+      m_deliveryQueue.pop ();
+      m_rxAvailable -= p->GetSize ();
+      received++;
+    }
+  if (received == 0)
+    {
+      m_errno = ERROR_AGAIN;
+    }
+  return received;
+}
+
 int
 UdpSocketImpl::GetSockName (Address &address) const
 {
@@ -109,6 +109,10 @@ public:
   virtual Ptr<Packet> Recv (uint32_t maxSize, uint32_t flags);
   virtual Ptr<Packet> RecvFrom (uint32_t maxSize, uint32_t flags,
                                 Address &fromAddress);
+  virtual int SendBatch (const std::vector<Ptr<Packet> > &packets, uint32_t flags);
+  virtual uint32_t RecvBatch (std::vector<Ptr<Packet> > &packets,
+                              std::vector<Address> &fromAddresses,
+                              uint32_t maxPackets, uint32_t flags);
   virtual int GetSockName (Address &address) const; 
   virtual int GetPeerName (Address &address) const;
   virtual int MulticastJoinGroup (uint32_t interfaceIndex, const Address &groupAddress);
@@ -201,6 +205,23 @@ private:
    * \returns 0 on success, -1 on failure
    */
   int DoSendTo (Ptr<Packet> p, Ipv4Address daddr, uint16_t dport, uint8_t tos);
+  /**
+   * \brief Send packets to a specific destination and port (IPv4), with a
+   * single route lookup
+   * \param packets the packets
+   * \param daddr destination address
+   * \param dport destination port
+   * \param tos ToS
+   * \returns the number of packets sent, or -1 if none could be sent
+   */
+  int DoSendBatchTo (const std::vector<Ptr<Packet> > &packets, Ipv4Address daddr, uint16_t dport, uint8_t tos);
+  /**
+   * \brief Add the tags carrying the socket options to a packet (IPv4)
+   * \param p packet
+   * \param daddr destination address
+   * \param tos ToS
+   */
+  void AddIpv4Tags (Ptr<Packet> p, Ipv4Address daddr, uint8_t tos);
   /**
    * \brief Send a packet to a specific destination and port (IPv6)
    * \param p packet
@@ -0,0 +1,245 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/ipv4-end-point-demux.h"
+#include "ns3/ipv4-end-point.h"
+#include "ns3/ipv4-interface.h"
+#include "ns3/ipv4-interface-address.h"
+#include "ns3/ipv6-end-point-demux.h"
+#include "ns3/ipv6-end-point.h"
+#include "ns3/ipv6-interface.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check that the indexed IPv4 endpoint lookups find the most
+ * specific endpoint, and follow the changes of the endpoints.
+ */
+class Ipv4EndPointDemuxTestCase : public TestCase
+{
+public:
+  Ipv4EndPointDemuxTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Look up the endpoint receiving a packet.
+   * \param daddr destination address
+   * \param dport destination port
+   * \param saddr source address
+   * \param sport source port
+   * \returns the endpoint, or 0 if there is none
+   */
+  Ipv4EndPoint *Lookup (Ipv4Address daddr, uint16_t dport, Ipv4Address saddr, uint16_t sport);
+
+  Ipv4EndPointDemux m_demux;           //!< the demux
+  Ptr<Ipv4Interface> m_interface;      //!< the incoming interface
+};
+
+Ipv4EndPointDemuxTestCase::Ipv4EndPointDemuxTestCase ()
+  : TestCase ("Check the indexed IPv4 endpoint lookups")
+{
+}
+
+Ipv4EndPoint *
+Ipv4EndPointDemuxTestCase::Lookup (Ipv4Address daddr, uint16_t dport, Ipv4Address saddr, uint16_t sport)
+{
+  Ipv4EndPointDemux::EndPoints endPoints = m_demux.Lookup (daddr, dport, saddr, sport, m_interface);
+  return endPoints.empty () ? 0 : endPoints.front ();
+}
+
+void
+Ipv4EndPointDemuxTestCase::DoRun (void)
+{
+  Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice> ();
+  Ptr<SimpleNetDevice> otherDevice = CreateObject<SimpleNetDevice> ();
+  m_interface = CreateObject<Ipv4Interface> ();
+  m_interface->SetDevice (device);
+  m_interface->AddAddress (Ipv4InterfaceAddress (Ipv4Address ("10.1.1.1"), Ipv4Mask ("255.255.255.0")));
+
+  Ipv4Address local ("10.1.1.1");
+  Ipv4Address peer ("10.1.1.2");
+  Ipv4Address other ("10.1.1.3");
+
+  Ipv4EndPoint *listener = m_demux.Allocate (0, 80);
+  Ipv4EndPoint *bound = m_demux.Allocate (0, local, 80);
+  Ipv4EndPoint *connection = m_demux.Allocate (0, local, 80, peer, 1000);
+  NS_TEST_ASSERT_MSG_NE (connection, 0, "Connection not allocated");
+  NS_TEST_EXPECT_MSG_EQ (m_demux.Allocate (0, local, 80, peer, 1000), 0, "Duplicated endpoint allocated");
+  NS_TEST_EXPECT_MSG_EQ (m_demux.Allocate (0, 80), 0, "Duplicated listener allocated");
+  NS_TEST_EXPECT_MSG_EQ (m_demux.LookupPortLocal (80), true, "Port not in use");
+  NS_TEST_EXPECT_MSG_EQ (m_demux.LookupLocal (0, Ipv4Address::GetAny (), 80), true, "Listener not found");
+
+  NS_TEST_EXPECT_MSG_EQ (Lookup (local, 80, peer, 1000), connection, "Exact match not preferred");
+  NS_TEST_EXPECT_MSG_EQ (Lookup (local, 81, peer, 1000), 0, "Unexpected match");
+
+  // an endpoint bound to the local address is preferred to the wildcard one
+  NS_TEST_EXPECT_MSG_EQ (Lookup (local, 80, other, 1000), bound, "Local address match not preferred");
+  NS_TEST_EXPECT_MSG_EQ (Lookup (Ipv4Address ("10.1.1.4"), 80, other, 1000), listener, "Wildcard match not found");
+
+  // disabled endpoints are skipped
+  connection->SetRxEnabled (false);
+  NS_TEST_EXPECT_MSG_EQ (Lookup (local, 80, peer, 1000), bound, "Disabled endpoint not skipped");
+  connection->SetRxEnabled (true);
+
+  // endpoints bound to another device are skipped
+  Ipv4EndPoint *otherListener = m_demux.Allocate (otherDevice, 70);
+  NS_TEST_ASSERT_MSG_NE (otherListener, 0, "Bound listener not allocated");
+  otherListener->BindToNetDevice (otherDevice);
+  NS_TEST_EXPECT_MSG_EQ (Lookup (local, 70, peer, 1000), 0, "Endpoint bound to another device not skipped");
+
+  // subnet directed broadcasts
+  Ipv4EndPoint *subnet = m_demux.Allocate (0, Ipv4Address ("10.1.1.0"), 90);
+  NS_TEST_EXPECT_MSG_EQ (Lookup (Ipv4Address ("10.1.1.255"), 90, peer, 1000), subnet, "Subnet match not found");
+  NS_TEST_EXPECT_MSG_EQ (Lookup (Ipv4Address ("10.1.2.255"), 90, peer, 1000), 0, "Unexpected subnet match");
+
+  // the index follows the changes of the endpoints
+  Ipv4EndPoint *client = m_demux.Allocate ();
+  uint16_t port = client->GetLocalPort ();
+  NS_TEST_EXPECT_MSG_EQ (Lookup (local, port, peer, 80), client, "Unconnected endpoint not found");
+  client->SetLocalAddress (local);
+  client->SetPeer (peer, 80);
+  NS_TEST_EXPECT_MSG_EQ (Lookup (local, port, peer, 80), client, "Connected endpoint not found");
+  NS_TEST_EXPECT_MSG_EQ (Lookup (local, port, other, 80), 0, "Connected endpoint matches another peer");
+  NS_TEST_EXPECT_MSG_EQ (m_demux.SimpleLookup (local, port, peer, 80), client, "Simple lookup failed");
+
+  m_demux.DeAllocate (connection);
+  NS_TEST_EXPECT_MSG_EQ (Lookup (local, 80, peer, 1000), bound, "Deallocated endpoint found");
+  m_demux.DeAllocate (bound);
+  m_demux.DeAllocate (listener);
+  NS_TEST_EXPECT_MSG_EQ (Lookup (local, 80, peer, 1000), 0, "Deallocated endpoint found");
+  NS_TEST_EXPECT_MSG_EQ (m_demux.LookupPortLocal (80), false, "Port still in use");
+  NS_TEST_EXPECT_MSG_EQ (m_demux.GetAllEndPoints ().size (), 3, "Wrong number of endpoints");
+  m_interface = 0;
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check that the indexed IPv6 endpoint lookups find the most
+ * specific endpoint, and follow the changes of the endpoints.
+ */
+class Ipv6EndPointDemuxTestCase : public TestCase
+{
+public:
+  Ipv6EndPointDemuxTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Look up the endpoint receiving a packet.
+   * \param daddr destination address
+   * \param dport destination port
+   * \param saddr source address
+   * \param sport source port
+   * \returns the endpoint, or 0 if there is none
+   */
+  Ipv6EndPoint *Lookup (Ipv6Address daddr, uint16_t dport, Ipv6Address saddr, uint16_t sport);
+
+  Ipv6EndPointDemux m_demux;           //!< the demux
+  Ptr<Ipv6Interface> m_interface;      //!< the incoming interface
+};
+
+Ipv6EndPointDemuxTestCase::Ipv6EndPointDemuxTestCase ()
+  : TestCase ("Check the indexed IPv6 endpoint lookups")
+{
+}
+
+Ipv6EndPoint *
+Ipv6EndPointDemuxTestCase::Lookup (Ipv6Address daddr, uint16_t dport, Ipv6Address saddr, uint16_t sport)
+{
+  Ipv6EndPointDemux::EndPoints endPoints = m_demux.Lookup (daddr, dport, saddr, sport, m_interface);
+  return endPoints.empty () ? 0 : endPoints.front ();
+}
+
+void
+Ipv6EndPointDemuxTestCase::DoRun (void)
+{
+  Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice> ();
+  Ptr<SimpleNetDevice> otherDevice = CreateObject<SimpleNetDevice> ();
+  m_interface = CreateObject<Ipv6Interface> ();
+  m_interface->SetDevice (device);
+
+  Ipv6Address local ("2001:db8::1");
+  Ipv6Address peer ("2001:db8::2");
+  Ipv6Address other ("2001:db8::3");
+
+  Ipv6EndPoint *listener = m_demux.Allocate (0, 80);
+  Ipv6EndPoint *bound = m_demux.Allocate (0, local, 80);
+  Ipv6EndPoint *connection = m_demux.Allocate (0, local, 80, peer, 1000);
+  NS_TEST_ASSERT_MSG_NE (connection, 0, "Connection not allocated");
+  NS_TEST_EXPECT_MSG_EQ (m_demux.Allocate (0, local, 80, peer, 1000), 0, "Duplicated endpoint allocated");
+  NS_TEST_EXPECT_MSG_EQ (m_demux.Allocate (0, 80), 0, "Duplicated listener allocated");
+
+  NS_TEST_EXPECT_MSG_EQ (Lookup (local, 80, peer, 1000), connection, "Exact match not preferred");
+  NS_TEST_EXPECT_MSG_EQ (Lookup (local, 80, other, 1000), bound, "Local address match not preferred");
+  NS_TEST_EXPECT_MSG_EQ (Lookup (Ipv6Address ("2001:db8::4"), 80, other, 1000), listener, "Wildcard match not found");
+
+  connection->SetRxEnabled (false);
+  NS_TEST_EXPECT_MSG_EQ (Lookup (local, 80, peer, 1000), bound, "Disabled endpoint not skipped");
+  connection->SetRxEnabled (true);
+
+  Ipv6EndPoint *otherListener = m_demux.Allocate (otherDevice, 70);
+  NS_TEST_ASSERT_MSG_NE (otherListener, 0, "Bound listener not allocated");
+  otherListener->BindToNetDevice (otherDevice);
+  NS_TEST_EXPECT_MSG_EQ (Lookup (local, 70, peer, 1000), 0, "Endpoint bound to another device not skipped");
+
+  // the index follows the changes of the endpoints, including the port
+  Ipv6EndPoint *client = m_demux.Allocate ();
+  client->SetLocalAddress (local);
+  client->SetPeer (peer, 80);
+  client->SetLocalPort (5000);
+  NS_TEST_EXPECT_MSG_EQ (Lookup (local, 5000, peer, 80), client, "Moved endpoint not found");
+  NS_TEST_EXPECT_MSG_EQ (m_demux.LookupPortLocal (5000), true, "Port not in use");
+  NS_TEST_EXPECT_MSG_EQ (m_demux.SimpleLookup (local, 5000, peer, 80), client, "Simple lookup failed");
+
+  m_demux.DeAllocate (connection);
+  m_demux.DeAllocate (bound);
+  NS_TEST_EXPECT_MSG_EQ (Lookup (local, 80, peer, 1000), listener, "Deallocated endpoint found");
+  m_demux.DeAllocate (client);
+  NS_TEST_EXPECT_MSG_EQ (m_demux.LookupPortLocal (5000), false, "Port still in use");
+  NS_TEST_EXPECT_MSG_EQ (m_demux.GetEndPoints ().size (), 2, "Wrong number of endpoints");
+  m_interface = 0;
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief End point demux TestSuite
+ */
+class EndPointDemuxTestSuite : public TestSuite
+{
+public:
+  EndPointDemuxTestSuite ();
+};
+
+EndPointDemuxTestSuite::EndPointDemuxTestSuite ()
+  : TestSuite ("end-point-demux", UNIT)
+{
+  AddTestCase (new Ipv4EndPointDemuxTestCase, TestCase::QUICK);
+  AddTestCase (new Ipv6EndPointDemuxTestCase, TestCase::QUICK);
+}
+
+static EndPointDemuxTestSuite g_endPointDemuxTestSuite; //!< Static variable for test initialization
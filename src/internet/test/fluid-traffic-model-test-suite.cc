@@ -0,0 +1,389 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/node.h"
+#include "ns3/queue.h"
+#include "ns3/net-device-queue-interface.h"
+#include "ns3/udp-socket-factory.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/pointer.h"
+#include "ns3/enum.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-routing-helper.h"
+#include "ns3/ipv4-static-routing.h"
+#include "ns3/fluid-traffic-model.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Base class of the FluidTrafficModel tests, on a line of three
+ * nodes A - B - C, with a 20 Mbps link from A to B and a 10 Mbps link from
+ * B to C.
+ */
+class FluidTrafficModelTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor.
+   * \param name the test case name
+   */
+  FluidTrafficModelTestCase (std::string name);
+
+protected:
+  /**
+   * \brief Create the nodes and the links.
+   */
+  void BuildLine (void);
+
+  /**
+   * \param device a device
+   * \returns the "BackgroundDataRate" of the device
+   */
+  DataRate GetBackgroundRate (Ptr<NetDevice> device);
+
+  Ptr<Node> m_nodes[3];               //!< nodes A, B and C
+  Ptr<SimpleNetDevice> m_abDevice;    //!< the device of A towards B
+  Ptr<SimpleNetDevice> m_bcDevice;    //!< the device of B towards C
+  Ipv4Address m_addressB;             //!< the address of B
+  Ipv4Address m_addressC;             //!< the address of C
+};
+
+FluidTrafficModelTestCase::FluidTrafficModelTestCase (std::string name)
+  : TestCase (name)
+{
+}
+
+void
+FluidTrafficModelTestCase::BuildLine (void)
+{
+  InternetStackHelper internet;
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      m_nodes[i] = CreateObject<Node> ();
+      internet.Install (m_nodes[i]);
+    }
+
+  const char *addresses[4] = {"10.1.1.1", "10.1.1.2", "10.1.2.1", "10.1.2.2"};
+  const char *rates[2] = {"20Mbps", "10Mbps"};
+  Ptr<SimpleNetDevice> devices[4];
+  for (uint32_t l = 0; l < 2; l++)
+    {
+      Ptr<SimpleChannel> channel = CreateObject<SimpleChannel> ();
+      channel->SetAttribute ("Delay", TimeValue (MilliSeconds (1)));
+      for (uint32_t end = 0; end < 2; end++)
+        {
+          uint32_t d = 2 * l + end;
+          Ptr<Node> node = m_nodes[l + end];
+          devices[d] = CreateObject<SimpleNetDevice> ();
+          devices[d]->SetAttribute ("DataRate", DataRateValue (DataRate (rates[l])));
+          devices[d]->SetAddress (Mac48Address::Allocate ());
+          devices[d]->SetChannel (channel);
+          Ptr<NetDeviceQueueInterface> ndqi = CreateObject<NetDeviceQueueInterface> ();
+          ndqi->GetTxQueue (0)->ConnectQueueTraces (devices[d]->GetQueue ());
+          devices[d]->AggregateObject (ndqi);
+          node->AddDevice (devices[d]);
+          Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
+          uint32_t ifIndex = ipv4->AddInterface (devices[d]);
+          ipv4->AddAddress (ifIndex, Ipv4InterfaceAddress (Ipv4Address (addresses[d]), Ipv4Mask ("/24")));
+          ipv4->SetUp (ifIndex);
+        }
+    }
+  m_abDevice = devices[0];
+  m_bcDevice = devices[2];
+  m_addressB = Ipv4Address (addresses[1]);
+  m_addressC = Ipv4Address (addresses[3]);
+
+  Ptr<Ipv4StaticRouting> routing = Ipv4RoutingHelper::GetRouting<Ipv4StaticRouting> (m_nodes[0]->GetObject<Ipv4> ()->GetRoutingProtocol ());
+  routing->SetDefaultRoute (m_addressB, 1);
+}
+
+DataRate
+FluidTrafficModelTestCase::GetBackgroundRate (Ptr<NetDevice> device)
+{
+  DataRateValue rate;
+  device->GetAttribute ("BackgroundDataRate", rate);
+  return rate.Get ();
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check the max-min fair rates of flows A to C, B to C and A to B,
+ * and that they are applied to the devices while the flows are active.
+ */
+class FluidTrafficModelMaxMinTestCase : public FluidTrafficModelTestCase
+{
+public:
+  FluidTrafficModelMaxMinTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Check the rates while the flows are active.
+   */
+  void CheckRates (void);
+
+  Ptr<FluidTrafficModel> m_model; //!< the model
+  uint32_t m_flows[3];            //!< the flows A to C, B to C and A to B
+};
+
+FluidTrafficModelMaxMinTestCase::FluidTrafficModelMaxMinTestCase ()
+  : FluidTrafficModelTestCase ("Max-min fair sharing of the links")
+{
+}
+
+void
+FluidTrafficModelMaxMinTestCase::CheckRates (void)
+{
+  // B to C is the bottleneck of the first two flows, the third one gets
+  // the rest of A to B
+  NS_TEST_EXPECT_MSG_EQ (m_model->GetFlowRate (m_flows[0]), DataRate ("5Mbps"), "Wrong rate of A to C");
+  NS_TEST_EXPECT_MSG_EQ (m_model->GetFlowRate (m_flows[1]), DataRate ("5Mbps"), "Wrong rate of B to C");
+  NS_TEST_EXPECT_MSG_EQ (m_model->GetFlowRate (m_flows[2]), DataRate ("15Mbps"), "Wrong rate of A to B");
+  NS_TEST_EXPECT_MSG_EQ (GetBackgroundRate (m_abDevice), DataRate ("20Mbps"), "Wrong background rate of A to B");
+  NS_TEST_EXPECT_MSG_EQ (GetBackgroundRate (m_bcDevice), DataRate ("10Mbps"), "Wrong background rate of B to C");
+}
+
+void
+FluidTrafficModelMaxMinTestCase::DoRun (void)
+{
+  BuildLine ();
+  m_model = CreateObject<FluidTrafficModel> ();
+  m_model->SetAttribute ("Model", EnumValue (FluidTrafficModel::MAX_MIN));
+  m_flows[0] = m_model->AddFlow (m_nodes[0], m_addressC, Seconds (1), Seconds (3), 0);
+  m_flows[1] = m_model->AddFlow (m_nodes[1], m_addressC, Seconds (1), Seconds (3), 0);
+  m_flows[2] = m_model->AddFlow (m_nodes[0], m_addressB, Seconds (1), Seconds (3), 0);
+
+  Simulator::Schedule (Seconds (2), &FluidTrafficModelMaxMinTestCase::CheckRates, this);
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_model->IsFlowFinished (m_flows[0]), true, "The flow should have stopped");
+  NS_TEST_EXPECT_MSG_EQ_TOL (m_model->GetFlowTotalBytes (m_flows[2]), 15e6 / 8 * 2, 15e6 / 8 * 0.01,
+                             "Wrong number of bytes of A to B");
+  NS_TEST_EXPECT_MSG_EQ (GetBackgroundRate (m_abDevice), DataRate (0), "Background rate not reset");
+  NS_TEST_EXPECT_MSG_EQ (GetBackgroundRate (m_bcDevice), DataRate (0), "Background rate not reset");
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check that a TCP fluid flow from A to C fills the bottleneck and
+ * its buffer, and completes in the time the link takes to carry it.
+ */
+class FluidTrafficModelTcpTestCase : public FluidTrafficModelTestCase
+{
+public:
+  FluidTrafficModelTcpTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Check the bottleneck while the flow is active.
+   */
+  void CheckBottleneck (void);
+
+  /**
+   * \brief Record the completion of a flow.
+   * \param flowId the flow
+   */
+  void FlowCompleted (uint32_t flowId);
+
+  Time m_completion;  //!< the completion time of the flow
+};
+
+FluidTrafficModelTcpTestCase::FluidTrafficModelTcpTestCase ()
+  : FluidTrafficModelTestCase ("TCP fluid flow through a bottleneck")
+{
+}
+
+void
+FluidTrafficModelTcpTestCase::CheckBottleneck (void)
+{
+  PointerValue txQueue;
+  m_bcDevice->GetAttribute ("TxQueue", txQueue);
+  NS_TEST_EXPECT_MSG_GT (txQueue.Get<QueueBase> ()->GetVirtualPackets (), 50,
+                         "The flow should fill the buffer of the bottleneck");
+  NS_TEST_EXPECT_MSG_GT (GetBackgroundRate (m_bcDevice), DataRate ("9Mbps"),
+                         "The flow should use most of the bottleneck");
+  PointerValue abQueue;
+  m_abDevice->GetAttribute ("TxQueue", abQueue);
+  NS_TEST_EXPECT_MSG_EQ (abQueue.Get<QueueBase> ()->GetVirtualPackets (), 0,
+                         "No backlog expected before the bottleneck");
+}
+
+void
+FluidTrafficModelTcpTestCase::FlowCompleted ([[maybe_unused]] uint32_t flowId)
+{
+  m_completion = Simulator::Now ();
+}
+
+void
+FluidTrafficModelTcpTestCase::DoRun (void)
+{
+  BuildLine ();
+  Ptr<FluidTrafficModel> model = CreateObject<FluidTrafficModel> ();
+  model->TraceConnectWithoutContext ("FlowCompleted",
+                                     MakeCallback (&FluidTrafficModelTcpTestCase::FlowCompleted, this));
+  // 10 MB take 8 s at 10 Mbps
+  model->AddFlow (m_nodes[0], m_addressC, Seconds (1), Seconds (0), 10000000);
+
+  Simulator::Schedule (Seconds (5), &FluidTrafficModelTcpTestCase::CheckBottleneck, this);
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_GT_OR_EQ (m_completion, Seconds (9), "The flow completed too early");
+  NS_TEST_EXPECT_MSG_LT (m_completion, Seconds (9.5), "The flow completed too late");
+  PointerValue txQueue;
+  m_bcDevice->GetAttribute ("TxQueue", txQueue);
+  NS_TEST_EXPECT_MSG_EQ (txQueue.Get<QueueBase> ()->GetVirtualPackets (), 0, "Backlog not reset");
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check that the backlog of a TCP fluid flow stops the device queue
+ * of the bottleneck when it fills the queue, and that the device queue is
+ * woken when the backlog drops, so that the packets sent after the flow
+ * go through.
+ */
+class FluidTrafficModelFlowControlTestCase : public FluidTrafficModelTestCase
+{
+public:
+  FluidTrafficModelFlowControlTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Check the state of the device queue of the bottleneck.
+   */
+  void CheckDeviceQueue (void);
+
+  /**
+   * \brief Send a packet from B to C.
+   * \param socket the sending socket
+   */
+  void Send (Ptr<Socket> socket);
+
+  /**
+   * \brief Receive a packet at C.
+   * \param socket the receiving socket
+   */
+  void Receive (Ptr<Socket> socket);
+
+  uint32_t m_stopped;   //!< number of checks finding the device queue stopped
+  uint32_t m_received;  //!< number of packets received at C
+};
+
+FluidTrafficModelFlowControlTestCase::FluidTrafficModelFlowControlTestCase ()
+  : FluidTrafficModelTestCase ("Flow control of a device queue holding a fluid backlog"),
+    m_stopped (0),
+    m_received (0)
+{
+}
+
+void
+FluidTrafficModelFlowControlTestCase::CheckDeviceQueue (void)
+{
+  Ptr<NetDeviceQueue> deviceQueue = m_bcDevice->GetObject<NetDeviceQueueInterface> ()->GetTxQueue (0);
+  bool full = m_bcDevice->GetQueue ()->WouldOverflow (1, m_bcDevice->GetMtu ());
+  NS_TEST_EXPECT_MSG_EQ (deviceQueue->IsStopped (), full,
+                         "The device queue should be stopped if and only if the queue is full");
+  m_stopped += deviceQueue->IsStopped () ? 1 : 0;
+}
+
+void
+FluidTrafficModelFlowControlTestCase::Send (Ptr<Socket> socket)
+{
+  socket->Send (Create<Packet> (500));
+}
+
+void
+FluidTrafficModelFlowControlTestCase::Receive (Ptr<Socket> socket)
+{
+  while (socket->Recv ())
+    {
+      m_received++;
+    }
+}
+
+void
+FluidTrafficModelFlowControlTestCase::DoRun (void)
+{
+  BuildLine ();
+  Ptr<FluidTrafficModel> model = CreateObject<FluidTrafficModel> ();
+  // 10 MB take 8 s at 10 Mbps
+  model->AddFlow (m_nodes[0], m_addressC, Seconds (1), Seconds (0), 10000000);
+  // sample the device queue in the middle of the steps of the model
+  for (Time t = MicroSeconds (2000500); t < Seconds (9); t += MilliSeconds (10))
+    {
+      Simulator::Schedule (t, &FluidTrafficModelFlowControlTestCase::CheckDeviceQueue, this);
+    }
+
+  Ptr<Socket> sink = Socket::CreateSocket (m_nodes[2], UdpSocketFactory::GetTypeId ());
+  sink->Bind (InetSocketAddress (Ipv4Address::GetAny (), 9));
+  sink->SetRecvCallback (MakeCallback (&FluidTrafficModelFlowControlTestCase::Receive, this));
+  Ptr<Socket> source = Socket::CreateSocket (m_nodes[1], UdpSocketFactory::GetTypeId ());
+  source->Connect (InetSocketAddress (m_addressC, 9));
+  for (uint32_t i = 0; i < 10; i++)
+    {
+      Simulator::Schedule (Seconds (11) + MilliSeconds (100 * i), &FluidTrafficModelFlowControlTestCase::Send,
+                           this, source);
+    }
+  Simulator::Stop (Seconds (13));
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_GT (m_stopped, 0, "The backlog should have filled the queue of the bottleneck");
+  NS_TEST_EXPECT_MSG_EQ (m_bcDevice->GetObject<NetDeviceQueueInterface> ()->GetTxQueue (0)->IsStopped (), false,
+                         "The device queue should have been woken");
+  NS_TEST_EXPECT_MSG_EQ (m_received, 10, "The packets sent after the flow should be received");
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief FluidTrafficModel TestSuite
+ */
+class FluidTrafficModelTestSuite : public TestSuite
+{
+public:
+  FluidTrafficModelTestSuite ();
+};
+
+FluidTrafficModelTestSuite::FluidTrafficModelTestSuite ()
+  : TestSuite ("fluid-traffic-model", UNIT)
+{
+  AddTestCase (new FluidTrafficModelMaxMinTestCase (), TestCase::QUICK);
+  AddTestCase (new FluidTrafficModelTcpTestCase (), TestCase::QUICK);
+  AddTestCase (new FluidTrafficModelFlowControlTestCase (), TestCase::QUICK);
+}
+
+static FluidTrafficModelTestSuite g_fluidTrafficModelTestSuite; //!< Static variable for test initialization
@@ -494,6 +494,135 @@ Ipv4DeduplicationTest::CheckDrops (const std::string &name)
       }
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief IPv4 Deduplication table limit test: with MaxDuplicateEntries,
+ * the oldest entries are removed to make room for new ones, and the
+ * expired entries are purged.
+ */
+class Ipv4DeduplicationLimitTest : public TestCase
+{
+public:
+  Ipv4DeduplicationLimitTest ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Receive a multicast packet on the device of the node.
+   * \param identification the IPv4 identification of the packet
+   */
+  void ReceivePacket (uint16_t identification);
+
+  /**
+   * \brief Record the number of duplicate entries.
+   * \param oldValue the previous number of entries
+   * \param newValue the number of entries
+   */
+  void DuplicateEntries (uint32_t oldValue, uint32_t newValue);
+
+  /**
+   * \brief Count the duplicate packets dropped.
+   * \param ipHeader the IP header
+   * \param packet the packet
+   * \param reason the drop reason
+   * \param ipv4 the IPv4 protocol
+   * \param interface the interface
+   */
+  void DropPacket (const Ipv4Header &ipHeader, Ptr<const Packet> packet,
+                   Ipv4L3Protocol::DropReason reason, Ptr<Ipv4> ipv4, uint32_t interface);
+
+  Ptr<Ipv4L3Protocol> m_ipv4;     //!< the IPv4 protocol of the node
+  Ptr<SimpleNetDevice> m_device;  //!< the device of the node
+  uint32_t m_entries;             //!< the number of duplicate entries
+  uint32_t m_maxEntries;          //!< the maximum number of duplicate entries
+  uint32_t m_duplicates;          //!< the number of duplicate packets dropped
+};
+
+Ipv4DeduplicationLimitTest::Ipv4DeduplicationLimitTest ()
+  : TestCase ("IPv4 deduplication table limit"),
+    m_entries (0),
+    m_maxEntries (0),
+    m_duplicates (0)
+{
+}
+
+void
+Ipv4DeduplicationLimitTest::ReceivePacket (uint16_t identification)
+{
+  Ptr<Packet> packet = Create<Packet> (10);
+  Ipv4Header header;
+  header.SetSource (Ipv4Address ("10.0.0.2"));
+  header.SetDestination (Ipv4Address ("239.1.1.1"));
+  header.SetProtocol (17);
+  header.SetIdentification (identification);
+  header.SetPayloadSize (packet->GetSize ());
+  header.SetTtl (64);
+  packet->AddHeader (header);
+  m_ipv4->Receive (m_device, packet, Ipv4L3Protocol::PROT_NUMBER, Mac48Address::Allocate (),
+                   m_device->GetAddress (), NetDevice::PACKET_MULTICAST);
+}
+
+void
+Ipv4DeduplicationLimitTest::DuplicateEntries ([[maybe_unused]] uint32_t oldValue, uint32_t newValue)
+{
+  m_entries = newValue;
+  m_maxEntries = std::max (m_maxEntries, newValue);
+}
+
+void
+Ipv4DeduplicationLimitTest::DropPacket ([[maybe_unused]] const Ipv4Header &ipHeader,
+                                        [[maybe_unused]] Ptr<const Packet> packet,
+                                        Ipv4L3Protocol::DropReason reason,
+                                        [[maybe_unused]] Ptr<Ipv4> ipv4,
+                                        [[maybe_unused]] uint32_t interface)
+{
+  if (reason == Ipv4L3Protocol::DROP_DUPLICATE)
+    {
+      m_duplicates++;
+    }
+}
+
+void
+Ipv4DeduplicationLimitTest::DoRun (void)
+{
+  Ptr<Node> node = CreateObject<Node> ();
+  InternetStackHelper internet;
+  internet.Install (node);
+  m_device = CreateObject<SimpleNetDevice> ();
+  m_device->SetAddress (Mac48Address::Allocate ());
+  m_device->SetChannel (CreateObject<SimpleChannel> ());
+  node->AddDevice (m_device);
+  m_ipv4 = node->GetObject<Ipv4L3Protocol> ();
+  uint32_t ifIndex = m_ipv4->AddInterface (m_device);
+  m_ipv4->AddAddress (ifIndex, Ipv4InterfaceAddress (Ipv4Address ("10.0.0.1"), Ipv4Mask ("/24")));
+  m_ipv4->SetUp (ifIndex);
+
+  m_ipv4->SetAttribute ("EnableDuplicatePacketDetection", BooleanValue (true));
+  m_ipv4->SetAttribute ("DuplicateExpire", TimeValue (Seconds (1)));
+  m_ipv4->SetAttribute ("PurgeExpiredPeriod", TimeValue (Seconds (1)));
+  m_ipv4->SetAttribute ("MaxDuplicateEntries", UintegerValue (2));
+  m_ipv4->TraceConnectWithoutContext ("DuplicateEntries",
+                                      MakeCallback (&Ipv4DeduplicationLimitTest::DuplicateEntries, this));
+  m_ipv4->TraceConnectWithoutContext ("Drop", MakeCallback (&Ipv4DeduplicationLimitTest::DropPacket, this));
+
+  // the first packet is removed from the table by the third one
+  for (uint16_t id = 1; id <= 3; id++)
+    {
+      Simulator::Schedule (MilliSeconds (100 * id), &Ipv4DeduplicationLimitTest::ReceivePacket, this, id);
+    }
+  Simulator::Schedule (MilliSeconds (400), &Ipv4DeduplicationLimitTest::ReceivePacket, this, 3);
+  Simulator::Schedule (MilliSeconds (500), &Ipv4DeduplicationLimitTest::ReceivePacket, this, 1);
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_duplicates, 1, "Only the second copy of the third packet is a duplicate");
+  NS_TEST_EXPECT_MSG_EQ (m_maxEntries, 2, "The table should be limited to 2 entries");
+  NS_TEST_EXPECT_MSG_EQ (m_entries, 0, "The expired entries should be purged");
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -515,6 +644,7 @@ Ipv4DeduplicationTestSuite::Ipv4DeduplicationTestSuite ()
   AddTestCase (new Ipv4DeduplicationTest (false), TestCase::QUICK);
   // degenerate case is enabled RFC but with too short an expiry
   AddTestCase (new Ipv4DeduplicationTest (true, MicroSeconds (50)), TestCase::QUICK);
+  AddTestCase (new Ipv4DeduplicationLimitTest, TestCase::QUICK);
 }
 
 static Ipv4DeduplicationTestSuite g_ipv4DeduplicationTestSuite; //!< Static variable for test initialization
@@ -28,6 +28,7 @@
 #include "ns3/ipv4-raw-socket-factory.h"
 #include "ns3/udp-socket-factory.h"
 #include "ns3/simulator.h"
+#include "ns3/simple-channel.h"
 #include "ns3/simple-net-device.h"
 #include "ns3/simple-net-device-helper.h"
 #include "ns3/socket.h"
@@ -49,6 +50,7 @@
 
 #include <string>
 #include <limits>
+#include <vector>
 #include <netinet/in.h>
 
 using namespace ns3;
@@ -531,6 +533,159 @@ Ipv4FragmentationTest::DoRun (void)
 }
 
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief IPv4 fragment buffer test: with FragmentBufferSize, the oldest
+ * packet being reassembled is dropped when the fragments of another one
+ * exceed the buffer, and the other one is reassembled.
+ */
+class Ipv4FragmentBufferTest : public TestCase
+{
+public:
+  Ipv4FragmentBufferTest ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Receive a fragment on the device of the node.
+   * \param identification the IPv4 identification of the packet
+   * \param offset the offset of the fragment
+   * \param size the size of the fragment
+   * \param last whether it is the last fragment
+   */
+  void ReceiveFragment (uint16_t identification, uint16_t offset, uint32_t size, bool last);
+
+  /**
+   * \brief Record the number of bytes of the fragments held.
+   * \param oldValue the previous number of bytes
+   * \param newValue the number of bytes
+   */
+  void FragmentBytes (uint32_t oldValue, uint32_t newValue);
+
+  /**
+   * \brief Record the dropped packets.
+   * \param ipHeader the IP header
+   * \param packet the packet
+   * \param reason the drop reason
+   * \param ipv4 the IPv4 protocol
+   * \param interface the interface
+   */
+  void DropPacket (const Ipv4Header &ipHeader, Ptr<const Packet> packet,
+                   Ipv4L3Protocol::DropReason reason, Ptr<Ipv4> ipv4, uint32_t interface);
+
+  /**
+   * \brief Record the delivered packets.
+   * \param ipHeader the IP header
+   * \param packet the packet
+   * \param interface the interface
+   */
+  void DeliverPacket (const Ipv4Header &ipHeader, Ptr<const Packet> packet, uint32_t interface);
+
+  Ptr<Ipv4L3Protocol> m_ipv4;     //!< the IPv4 protocol of the node
+  Ptr<SimpleNetDevice> m_device;  //!< the device of the node
+  uint32_t m_bytes;               //!< the number of bytes of fragments held
+  uint32_t m_maxBytes;            //!< the maximum number of bytes of fragments held
+  std::vector<std::pair<uint16_t, Time> > m_dropped;   //!< the identification and time of the dropped packets
+  std::vector<std::pair<uint16_t, uint32_t> > m_delivered; //!< the identification and size of the delivered packets
+};
+
+Ipv4FragmentBufferTest::Ipv4FragmentBufferTest ()
+  : TestCase ("IPv4 fragment buffer limit"),
+    m_bytes (0),
+    m_maxBytes (0)
+{
+}
+
+void
+Ipv4FragmentBufferTest::ReceiveFragment (uint16_t identification, uint16_t offset, uint32_t size, bool last)
+{
+  Ptr<Packet> packet = Create<Packet> (size);
+  Ipv4Header header;
+  header.SetSource (Ipv4Address ("10.0.0.2"));
+  header.SetDestination (Ipv4Address ("10.0.0.1"));
+  header.SetProtocol (253);
+  header.SetIdentification (identification);
+  header.SetFragmentOffset (offset);
+  if (!last)
+    {
+      header.SetMoreFragments ();
+    }
+  header.SetPayloadSize (size);
+  header.SetTtl (64);
+  packet->AddHeader (header);
+  m_ipv4->Receive (m_device, packet, Ipv4L3Protocol::PROT_NUMBER, Mac48Address::Allocate (),
+                   m_device->GetAddress (), NetDevice::PACKET_HOST);
+}
+
+void
+Ipv4FragmentBufferTest::FragmentBytes ([[maybe_unused]] uint32_t oldValue, uint32_t newValue)
+{
+  m_bytes = newValue;
+  m_maxBytes = std::max (m_maxBytes, newValue);
+}
+
+void
+Ipv4FragmentBufferTest::DropPacket (const Ipv4Header &ipHeader,
+                                    [[maybe_unused]] Ptr<const Packet> packet,
+                                    Ipv4L3Protocol::DropReason reason,
+                                    [[maybe_unused]] Ptr<Ipv4> ipv4,
+                                    [[maybe_unused]] uint32_t interface)
+{
+  if (reason == Ipv4L3Protocol::DROP_FRAGMENT_TIMEOUT)
+    {
+      m_dropped.push_back (std::make_pair (ipHeader.GetIdentification (), Simulator::Now ()));
+    }
+}
+
+void
+Ipv4FragmentBufferTest::DeliverPacket (const Ipv4Header &ipHeader, Ptr<const Packet> packet,
+                                       [[maybe_unused]] uint32_t interface)
+{
+  m_delivered.push_back (std::make_pair (ipHeader.GetIdentification (), packet->GetSize ()));
+}
+
+void
+Ipv4FragmentBufferTest::DoRun (void)
+{
+  Ptr<Node> node = CreateObject<Node> ();
+  InternetStackHelper internet;
+  internet.Install (node);
+  m_device = CreateObject<SimpleNetDevice> ();
+  m_device->SetAddress (Mac48Address::Allocate ());
+  m_device->SetChannel (CreateObject<SimpleChannel> ());
+  node->AddDevice (m_device);
+  m_ipv4 = node->GetObject<Ipv4L3Protocol> ();
+  uint32_t ifIndex = m_ipv4->AddInterface (m_device);
+  m_ipv4->AddAddress (ifIndex, Ipv4InterfaceAddress (Ipv4Address ("10.0.0.1"), Ipv4Mask ("/24")));
+  m_ipv4->SetUp (ifIndex);
+
+  m_ipv4->SetAttribute ("FragmentBufferSize", UintegerValue (1500));
+  m_ipv4->TraceConnectWithoutContext ("FragmentBytes",
+                                      MakeCallback (&Ipv4FragmentBufferTest::FragmentBytes, this));
+  m_ipv4->TraceConnectWithoutContext ("Drop", MakeCallback (&Ipv4FragmentBufferTest::DropPacket, this));
+  m_ipv4->TraceConnectWithoutContext ("LocalDeliver", MakeCallback (&Ipv4FragmentBufferTest::DeliverPacket, this));
+
+  // the first fragment of packet 2 overflows the buffer, which drops packet 1
+  Simulator::Schedule (Seconds (1), &Ipv4FragmentBufferTest::ReceiveFragment, this, 1, 0, 1000, false);
+  Simulator::Schedule (Seconds (2), &Ipv4FragmentBufferTest::ReceiveFragment, this, 2, 0, 1000, false);
+  Simulator::Schedule (Seconds (3), &Ipv4FragmentBufferTest::ReceiveFragment, this, 2, 1000, 200, true);
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_dropped.size (), 1, "One packet should be dropped");
+  NS_TEST_EXPECT_MSG_EQ (m_dropped[0].first, 1, "The oldest packet should be dropped");
+  NS_TEST_EXPECT_MSG_EQ (m_dropped[0].second, Seconds (2), "The packet should be dropped when the buffer overflows");
+  NS_TEST_ASSERT_MSG_EQ (m_delivered.size (), 1, "One packet should be reassembled");
+  NS_TEST_EXPECT_MSG_EQ (m_delivered[0].first, 2, "The newest packet should be reassembled");
+  NS_TEST_EXPECT_MSG_EQ (m_delivered[0].second, 1200, "Wrong size of the reassembled packet");
+  NS_TEST_EXPECT_MSG_EQ (m_maxBytes, 2000, "The buffer should hold both fragments before dropping");
+  NS_TEST_EXPECT_MSG_EQ (m_bytes, 0, "The buffer should be empty");
+  Simulator::Destroy ();
+}
+
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -548,6 +703,7 @@ Ipv4FragmentationTestSuite::Ipv4FragmentationTestSuite ()
 {
   AddTestCase (new Ipv4FragmentationTest(false), TestCase::QUICK);
   AddTestCase (new Ipv4FragmentationTest(true), TestCase::QUICK);
+  AddTestCase (new Ipv4FragmentBufferTest, TestCase::QUICK);
 }
 
 static Ipv4FragmentationTestSuite g_ipv4fragmentationTestSuite; //!< Static variable for test initialization
@@ -15,8 +15,10 @@
  */
 
 #include <vector>
+#include <sstream>
 #include "ns3/boolean.h"
 #include "ns3/config.h"
+#include "ns3/global-value.h"
 #include "ns3/inet-socket-address.h"
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-address-helper.h"
@@ -41,6 +43,7 @@
 #include "ns3/ipv4-routing-protocol.h"
 #include "ns3/ipv4-routing-table-entry.h"
 #include "ns3/ipv4-global-routing.h"
+#include "ns3/global-router-interface.h"
 #include "ns3/bridge-helper.h"
 
 using namespace ns3;
@@ -1244,6 +1247,166 @@ Ipv4GlobalRoutingSlash32TestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check that the routes computed on several threads, and the routes
+ * updated after a topology change, are the routes a full computation on a
+ * single thread installs.
+ *
+ * The topology has two separate parts: a ring of routers with chords, a LAN
+ * and a stub router, and a line of routers.  The metrics of the links of
+ * the ring are distinct powers of two, so that there are no equal cost
+ * paths.
+ */
+class Ipv4GlobalRoutingUpdateTestCase : public TestCase
+{
+public:
+  Ipv4GlobalRoutingUpdateTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Connect two nodes with a point-to-point link.
+   * \param a first node
+   * \param b second node
+   * \param address the address helper
+   * \param metric the metric of the link
+   * \returns the interfaces of the link
+   */
+  Ipv4InterfaceContainer Connect (Ptr<Node> a, Ptr<Node> b, Ipv4AddressHelper &address, uint16_t metric);
+
+  /**
+   * \brief Get the global routes of all the nodes.
+   * \returns for each node, the description of its routes
+   */
+  std::vector<std::vector<std::string> > GetRoutes (void);
+
+  NodeContainer m_nodes; //!< Nodes used in the test.
+};
+
+Ipv4GlobalRoutingUpdateTestCase::Ipv4GlobalRoutingUpdateTestCase ()
+  : TestCase ("Global routing parallel and incremental route computation")
+{
+}
+
+Ipv4InterfaceContainer
+Ipv4GlobalRoutingUpdateTestCase::Connect (Ptr<Node> a, Ptr<Node> b, Ipv4AddressHelper &address, uint16_t metric)
+{
+  SimpleNetDeviceHelper simpleHelper;
+  simpleHelper.SetNetDevicePointToPointMode (true);
+  NetDeviceContainer devices = simpleHelper.Install (NodeContainer (a, b), CreateObject<SimpleChannel> ());
+  Ipv4InterfaceContainer interfaces = address.Assign (devices);
+  address.NewNetwork ();
+  for (uint32_t i = 0; i < 2; i++)
+    {
+      interfaces.Get (i).first->SetMetric (interfaces.Get (i).second, metric);
+    }
+  return interfaces;
+}
+
+std::vector<std::vector<std::string> >
+Ipv4GlobalRoutingUpdateTestCase::GetRoutes (void)
+{
+  std::vector<std::vector<std::string> > routes;
+  for (uint32_t i = 0; i < m_nodes.GetN (); i++)
+    {
+      Ptr<Ipv4GlobalRouting> routing = m_nodes.Get (i)->GetObject<GlobalRouter> ()->GetRoutingProtocol ();
+      routes.push_back (std::vector<std::string> ());
+      for (uint32_t j = 0; j < routing->GetNRoutes (); j++)
+        {
+          std::ostringstream oss;
+          oss << *routing->GetRoute (j);
+          routes.back ().push_back (oss.str ());
+        }
+    }
+  return routes;
+}
+
+void
+Ipv4GlobalRoutingUpdateTestCase::DoRun (void)
+{
+  // nodes 0 to 7: ring with chords; 8: stub attached to 0; 9 to 12: line
+  m_nodes.Create (13);
+  InternetStackHelper internet;
+  Ipv4GlobalRoutingHelper ipv4RoutingHelper;
+  internet.SetRoutingHelper (ipv4RoutingHelper);
+  internet.Install (m_nodes);
+
+  Ipv4AddressHelper address;
+  address.SetBase ("10.1.1.0", "255.255.255.252");
+  for (uint32_t i = 0; i < 8; i++)
+    {
+      Connect (m_nodes.Get (i), m_nodes.Get ((i + 1) % 8), address, 1 << i);
+    }
+  Ipv4InterfaceContainer chord = Connect (m_nodes.Get (1), m_nodes.Get (5), address, 1 << 8);
+  Connect (m_nodes.Get (2), m_nodes.Get (6), address, 1 << 9);
+  Connect (m_nodes.Get (0), m_nodes.Get (8), address, 1);
+  for (uint32_t i = 9; i < 12; i++)
+    {
+      Connect (m_nodes.Get (i), m_nodes.Get (i + 1), address, 1);
+    }
+  SimpleNetDeviceHelper lanHelper;
+  NetDeviceContainer lan = lanHelper.Install (NodeContainer (m_nodes.Get (3), m_nodes.Get (4), m_nodes.Get (7)),
+                                              CreateObject<SimpleChannel> ());
+  address.SetBase ("10.2.1.0", "255.255.255.0");
+  Ipv4InterfaceContainer lanInterfaces = address.Assign (lan);
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      lanInterfaces.Get (i).first->SetMetric (lanInterfaces.Get (i).second, 1 << (10 + i));
+    }
+
+  Ipv4GlobalRoutingHelper::PopulateRoutingTables ();
+  std::vector<std::vector<std::string> > serial = GetRoutes ();
+  NS_TEST_ASSERT_MSG_EQ (serial[8].size (), 1, "The stub router must only have a default route");
+
+  GlobalValue::Bind ("GlobalRoutingThreads", UintegerValue (4));
+  Ipv4GlobalRoutingHelper::RecomputeRoutingTables ();
+  std::vector<std::vector<std::string> > parallel = GetRoutes ();
+  for (uint32_t i = 0; i < m_nodes.GetN (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ ((parallel[i] == serial[i]), true, "Wrong routes computed in parallel for node " << i);
+    }
+
+  // Routes added by hand are kept on the nodes that are not updated
+  Ptr<Ipv4GlobalRouting> routing10 = m_nodes.Get (10)->GetObject<GlobalRouter> ()->GetRoutingProtocol ();
+  routing10->AddHostRouteTo (Ipv4Address ("192.168.1.1"), Ipv4Address ("10.1.1.42"), 1);
+  uint32_t nRoutes10 = routing10->GetNRoutes ();
+
+  // Remove the chord between 1 and 5
+  Ptr<Ipv4> ipv4 = chord.Get (0).first;
+  ipv4->SetDown (chord.Get (0).second);
+  Ipv4GlobalRoutingHelper::UpdateRoutingTables ();
+  std::vector<std::vector<std::string> > updated = GetRoutes ();
+  NS_TEST_EXPECT_MSG_EQ (routing10->GetNRoutes (), nRoutes10, "Unaffected node must not be updated");
+  Ipv4GlobalRoutingHelper::RecomputeRoutingTables ();
+  std::vector<std::vector<std::string> > recomputed = GetRoutes ();
+  NS_TEST_EXPECT_MSG_EQ ((recomputed[1] != serial[1]), true, "The topology change must change the routes");
+  for (uint32_t i = 0; i < m_nodes.GetN (); i++)
+    {
+      if (i == 10)
+        {
+          NS_TEST_EXPECT_MSG_EQ (updated[i].size (), recomputed[i].size () + 1, "Wrong routes updated for node " << i);
+          continue;
+        }
+      NS_TEST_EXPECT_MSG_EQ ((updated[i] == recomputed[i]), true, "Wrong routes updated for node " << i);
+    }
+
+  // Restore the chord
+  ipv4->SetUp (chord.Get (0).second);
+  Ipv4GlobalRoutingHelper::UpdateRoutingTables ();
+  updated = GetRoutes ();
+  for (uint32_t i = 0; i < m_nodes.GetN (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ ((updated[i] == serial[i]), true, "Wrong routes restored for node " << i);
+    }
+
+  GlobalValue::Bind ("GlobalRoutingThreads", UintegerValue (1));
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -1267,6 +1430,7 @@ Ipv4GlobalRoutingTestSuite::Ipv4GlobalRoutingTestSuite ()
     AddTestCase (new TwoBridgeTest, TestCase::QUICK);
     AddTestCase (new Ipv4DynamicGlobalRoutingTestCase, TestCase::QUICK);
     AddTestCase (new Ipv4GlobalRoutingSlash32TestCase, TestCase::QUICK);
+    AddTestCase (new Ipv4GlobalRoutingUpdateTestCase, TestCase::QUICK);
   }
 
 static Ipv4GlobalRoutingTestSuite g_globalRoutingTestSuite; //!< Static variable for test initialization
@@ -265,6 +265,77 @@ Ipv4HeaderTest::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief IPv4 Header checksum Test: the checksum updated when the TTL of a
+ * received header changes must be the one computed from scratch.
+ */
+class Ipv4HeaderChecksumTest : public TestCase
+{
+public:
+  Ipv4HeaderChecksumTest ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Serialize a header and deserialize it, with checksums enabled.
+   * \param header the header
+   * \returns the deserialized header
+   */
+  Ipv4Header Receive (const Ipv4Header &header);
+};
+
+Ipv4HeaderChecksumTest::Ipv4HeaderChecksumTest ()
+  : TestCase ("IPv4 Header incremental checksum Test")
+{
+}
+
+Ipv4Header
+Ipv4HeaderChecksumTest::Receive (const Ipv4Header &header)
+{
+  Ptr<Packet> packet = Create<Packet> (10);
+  packet->AddHeader (header);
+  Ipv4Header received;
+  received.EnableChecksum ();
+  packet->RemoveHeader (received);
+  return received;
+}
+
+void
+Ipv4HeaderChecksumTest::DoRun (void)
+{
+  for (uint32_t protocol = 0; protocol < 256; protocol += 17)
+    {
+      Ipv4Header header;
+      header.EnableChecksum ();
+      header.SetSource (Ipv4Address ("10.1.2.3"));
+      header.SetDestination (Ipv4Address ("192.168.254.1"));
+      header.SetProtocol (protocol);
+      header.SetIdentification (protocol * 251);
+      header.SetPayloadSize (10);
+      header.SetTtl (255);
+
+      Ipv4Header received = Receive (header);
+      NS_TEST_ASSERT_MSG_EQ (received.IsChecksumOk (), true, "Bad checksum of the original header");
+      for (uint32_t ttl = 254; ttl > 0; ttl--)
+        {
+          // forward the received header, as Ipv4L3Protocol::IpForward does
+          received.SetTtl (ttl);
+          received = Receive (received);
+          NS_TEST_ASSERT_MSG_EQ (received.IsChecksumOk (), true, "Bad checksum with TTL " << ttl);
+          NS_TEST_ASSERT_MSG_EQ (static_cast<uint32_t> (received.GetTtl ()), ttl, "Bad TTL");
+        }
+
+      // a header changed in other fields gets its checksum computed again
+      received.SetTtl (64);
+      received.SetDestination (Ipv4Address ("10.0.0.1"));
+      NS_TEST_ASSERT_MSG_EQ (Receive (received).IsChecksumOk (), true, "Bad checksum after a change");
+    }
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -277,6 +348,7 @@ public:
   Ipv4HeaderTestSuite () : TestSuite ("ipv4-header", UNIT)
   {
     AddTestCase (new Ipv4HeaderTest, TestCase::QUICK);
+    AddTestCase (new Ipv4HeaderChecksumTest, TestCase::QUICK);
   }
 };
 
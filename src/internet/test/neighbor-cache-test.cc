@@ -0,0 +1,190 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/node-container.h"
+#include "ns3/socket.h"
+#include "ns3/udp-socket-factory.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/inet6-socket-address.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/ipv6-address-helper.h"
+#include "ns3/ipv4-l3-protocol.h"
+#include "ns3/ipv4-interface.h"
+#include "ns3/ipv6-l3-protocol.h"
+#include "ns3/ipv6-interface.h"
+#include "ns3/arp-cache.h"
+#include "ns3/ndisc-cache.h"
+#include "ns3/neighbor-cache-helper.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check that NeighborCacheHelper fills the ARP or NDISC caches of the
+ * interfaces of a channel, so that a packet is sent without address
+ * resolution.
+ */
+class NeighborCacheTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor.
+   * \param shared whether the interfaces share a table
+   * \param ipv6 whether to send the packet over IPv6
+   */
+  NeighborCacheTestCase (bool shared, bool ipv6);
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Receive a packet.
+   * \param socket the receiving socket
+   */
+  void ReceivePacket (Ptr<Socket> socket);
+
+  /**
+   * \brief Send a packet.
+   * \param socket the sending socket
+   * \param to the destination
+   */
+  void SendPacket (Ptr<Socket> socket, Address to);
+
+  bool m_shared;   //!< whether the interfaces share a table
+  bool m_ipv6;     //!< whether to send the packet over IPv6
+  Time m_received; //!< the time the packet was received
+};
+
+NeighborCacheTestCase::NeighborCacheTestCase (bool shared, bool ipv6)
+  : TestCase (std::string (ipv6 ? "IPv6" : "IPv4") + (shared ? " shared table" : " per-interface entries")),
+    m_shared (shared),
+    m_ipv6 (ipv6)
+{
+}
+
+void
+NeighborCacheTestCase::ReceivePacket (Ptr<Socket> socket)
+{
+  while (socket->Recv ())
+    {
+      m_received = Simulator::Now ();
+    }
+}
+
+void
+NeighborCacheTestCase::SendPacket (Ptr<Socket> socket, Address to)
+{
+  socket->SendTo (Create<Packet> (100), 0, to);
+}
+
+void
+NeighborCacheTestCase::DoRun (void)
+{
+  NodeContainer nodes;
+  nodes.Create (3);
+  InternetStackHelper internet;
+  internet.Install (nodes);
+  Ptr<SimpleChannel> channel = CreateObject<SimpleChannel> ();
+  channel->SetAttribute ("Delay", TimeValue (MilliSeconds (1)));
+  SimpleNetDeviceHelper simple;
+  NetDeviceContainer devices = simple.Install (nodes, channel);
+  Ipv4AddressHelper ipv4Addresses ("10.0.0.0", "255.255.255.0");
+  Ipv4InterfaceContainer ipv4Interfaces = ipv4Addresses.Assign (devices);
+  Ipv6AddressHelper ipv6Addresses (Ipv6Address ("2001:db8::"), Ipv6Prefix (64));
+  Ipv6InterfaceContainer ipv6Interfaces = ipv6Addresses.Assign (devices);
+
+  NeighborCacheHelper neighbors;
+  neighbors.SetSharedTable (m_shared);
+  neighbors.PopulateNeighborCache (devices);
+
+  // Every interface knows the addresses of the others
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      Ptr<ArpCache> arp = nodes.Get (i)->GetObject<Ipv4L3Protocol> ()->GetInterface (1)->GetArpCache ();
+      Ptr<NdiscCache> ndisc = nodes.Get (i)->GetObject<Ipv6L3Protocol> ()->GetInterface (1)->GetNdiscCache ();
+      NS_TEST_EXPECT_MSG_EQ ((arp->GetSharedCache () != 0), m_shared, "Unexpected ARP shared cache");
+      NS_TEST_EXPECT_MSG_EQ ((ndisc->GetSharedCache () != 0), m_shared, "Unexpected NDISC shared cache");
+      for (uint32_t j = 0; j < 3; j++)
+        {
+          if (j == i)
+            {
+              continue;
+            }
+          ArpCache::Entry *arpEntry = arp->Lookup (ipv4Interfaces.GetAddress (j));
+          NS_TEST_ASSERT_MSG_NE (arpEntry, 0, "Missing ARP entry");
+          NS_TEST_EXPECT_MSG_EQ (arpEntry->IsPermanent (), true, "ARP entry not permanent");
+          NS_TEST_EXPECT_MSG_EQ (arpEntry->GetMacAddress (), devices.Get (j)->GetAddress (), "Wrong ARP entry");
+          for (uint32_t a = 0; a < 2; a++)
+            {
+              NdiscCache::Entry *ndiscEntry = ndisc->Lookup (ipv6Interfaces.GetAddress (j, a));
+              NS_TEST_ASSERT_MSG_NE (ndiscEntry, 0, "Missing NDISC entry");
+              NS_TEST_EXPECT_MSG_EQ (ndiscEntry->IsPermanent (), true, "NDISC entry not permanent");
+              NS_TEST_EXPECT_MSG_EQ (ndiscEntry->GetMacAddress (), devices.Get (j)->GetAddress (), "Wrong NDISC entry");
+            }
+        }
+    }
+
+  // A packet takes the channel delay only, with no address resolution
+  Ptr<Socket> rxSocket = Socket::CreateSocket (nodes.Get (1), UdpSocketFactory::GetTypeId ());
+  Ptr<Socket> txSocket = Socket::CreateSocket (nodes.Get (0), UdpSocketFactory::GetTypeId ());
+  rxSocket->SetRecvCallback (MakeCallback (&NeighborCacheTestCase::ReceivePacket, this));
+  if (m_ipv6)
+    {
+      rxSocket->Bind (Inet6SocketAddress (Ipv6Address::GetAny (), 1234));
+      Simulator::Schedule (Seconds (3), &NeighborCacheTestCase::SendPacket, this, txSocket,
+                           Inet6SocketAddress (ipv6Interfaces.GetAddress (1, 1), 1234));
+    }
+  else
+    {
+      rxSocket->Bind (InetSocketAddress (Ipv4Address::GetAny (), 1234));
+      Simulator::Schedule (Seconds (3), &NeighborCacheTestCase::SendPacket, this, txSocket,
+                           InetSocketAddress (ipv4Interfaces.GetAddress (1), 1234));
+    }
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_received, Seconds (3) + MilliSeconds (1), "Packet not received after the channel delay");
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief NeighborCacheHelper TestSuite
+ */
+class NeighborCacheTestSuite : public TestSuite
+{
+public:
+  NeighborCacheTestSuite ();
+};
+
+NeighborCacheTestSuite::NeighborCacheTestSuite ()
+  : TestSuite ("neighbor-cache", UNIT)
+{
+  AddTestCase (new NeighborCacheTestCase (true, false), TestCase::QUICK);
+  AddTestCase (new NeighborCacheTestCase (false, false), TestCase::QUICK);
+  AddTestCase (new NeighborCacheTestCase (true, true), TestCase::QUICK);
+  AddTestCase (new NeighborCacheTestCase (false, true), TestCase::QUICK);
+}
+
+static NeighborCacheTestSuite g_neighborCacheTestSuite; //!< Static variable for test initialization
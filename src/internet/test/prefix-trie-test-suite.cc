@@ -0,0 +1,544 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Check the forwarding table indexes of the routing protocols against a
+// linear scan of their route lists.
+
+#include <vector>
+#include <utility>
+
+#include "ns3/test.h"
+#include "ns3/prefix-trie.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-static-routing-helper.h"
+#include "ns3/ipv4-static-routing.h"
+#include "ns3/ipv4-global-routing.h"
+#include "ns3/ipv4-list-routing.h"
+#include "ns3/ipv4-routing-table-entry.h"
+#include "ns3/ipv6-static-routing-helper.h"
+#include "ns3/ipv6-static-routing.h"
+#include "ns3/ipv6-routing-table-entry.h"
+#include "ns3/ipv6.h"
+#include "ns3/ipv6-route.h"
+#include "ns3/ipv4-route.h"
+
+using namespace ns3;
+
+namespace {
+
+/**
+ * \brief Add a node with two simple devices to the IPv4 and IPv6 stacks.
+ * \return the node
+ */
+Ptr<Node>
+CreateRoutingNode (void)
+{
+  Ptr<Node> node = CreateObject<Node> ();
+  InternetStackHelper internet;
+  internet.Install (node);
+  Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
+  Ptr<Ipv6> ipv6 = node->GetObject<Ipv6> ();
+  for (uint32_t i = 1; i <= 2; i++)
+    {
+      Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice> ();
+      device->SetAddress (Mac48Address::Allocate ());
+      node->AddDevice (device);
+      uint32_t ifIndex = ipv4->AddInterface (device);
+      ipv4->AddAddress (ifIndex, Ipv4InterfaceAddress (Ipv4Address (0x0a000001 + (i << 8)), Ipv4Mask ("/24")));
+      ipv4->SetUp (ifIndex);
+      ifIndex = ipv6->AddInterface (device);
+      uint8_t bytes[16] = {0x20, 0x01, 0x0d, 0xb8, 0, static_cast<uint8_t> (i), 0, 0, 0, 0, 0, 0, 0, 0, 0, 1};
+      ipv6->AddAddress (ifIndex, Ipv6InterfaceAddress (Ipv6Address (bytes), Ipv6Prefix (64)));
+      ipv6->SetUp (ifIndex);
+    }
+  return node;
+}
+
+} // unnamed namespace
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check PrefixTrie insertions, removals and matches against a list
+ * of prefixes.
+ */
+class PrefixTrieTestCase : public TestCase
+{
+public:
+  PrefixTrieTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+PrefixTrieTestCase::PrefixTrieTestCase ()
+  : TestCase ("Check PrefixTrie against a list of prefixes")
+{
+}
+
+void
+PrefixTrieTestCase::DoRun (void)
+{
+  typedef std::pair<uint32_t, uint8_t> Prefix;
+  Ptr<UniformRandomVariable> rand = CreateObject<UniformRandomVariable> ();
+  PrefixTrie<4, uint32_t> trie;
+  std::vector<std::pair<Prefix, uint32_t> > list;
+  const uint32_t pool[] = {0x0a000000, 0x0a010000, 0x0a010100, 0xc0a80000, 0x80000000};
+
+  for (uint32_t step = 0; step < 4000; step++)
+    {
+      uint32_t address = pool[rand->GetInteger (0, 4)] | rand->GetInteger (0, 0xffff);
+      uint8_t key[4] = {static_cast<uint8_t> (address >> 24), static_cast<uint8_t> (address >> 16),
+                        static_cast<uint8_t> (address >> 8), static_cast<uint8_t> (address)};
+      if (step < 2000 ? rand->GetValue () < 0.7 : rand->GetValue () < 0.3)
+        {
+          uint8_t length = static_cast<uint8_t> (rand->GetInteger (0, 32));
+          uint32_t network = length == 0 ? 0 : address & (0xffffffff << (32 - length));
+          trie.Insert (key, length, step);
+          list.push_back (std::make_pair (Prefix (network, length), step));
+        }
+      else if (!list.empty ())
+        {
+          uint32_t index = rand->GetInteger (0, list.size () - 1);
+          Prefix p = list[index].first;
+          uint32_t value = list[index].second;
+          uint8_t k[4] = {static_cast<uint8_t> (p.first >> 24), static_cast<uint8_t> (p.first >> 16),
+                          static_cast<uint8_t> (p.first >> 8), static_cast<uint8_t> (p.first)};
+          bool removed = trie.Remove (k, p.second, [value] (uint32_t v) { return v == value; });
+          NS_TEST_ASSERT_MSG_EQ (removed, true, "Value " << value << " not found");
+          list.erase (list.begin () + index);
+        }
+
+      // The matches, from the shortest prefix, each in insertion order
+      std::vector<uint32_t> expected;
+      for (uint8_t length = 0; length <= 32; length++)
+        {
+          uint32_t network = length == 0 ? 0 : address & (0xffffffff << (32 - length));
+          for (std::size_t i = 0; i < list.size (); i++)
+            {
+              if (list[i].first == Prefix (network, length))
+                {
+                  expected.push_back (list[i].second);
+                }
+            }
+        }
+      std::vector<uint32_t> found;
+      uint8_t previous = 0;
+      bool ordered = true;
+      trie.Match (key, [&] (uint8_t length, const std::vector<uint32_t> &values)
+                  {
+                    ordered = ordered && (found.empty () || length > previous);
+                    previous = length;
+                    found.insert (found.end (), values.begin (), values.end ());
+                  });
+      NS_TEST_ASSERT_MSG_EQ (ordered, true, "Prefixes not visited from the shortest");
+      NS_TEST_ASSERT_MSG_EQ (found.size (), expected.size (), "Wrong number of matches at step " << step);
+      for (std::size_t i = 0; i < found.size (); i++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (found[i], expected[i], "Wrong match at step " << step);
+        }
+      NS_TEST_ASSERT_MSG_LT_OR_EQ (trie.GetNNodes (), 2 * list.size () + 1, "Too many nodes");
+    }
+
+  while (!list.empty ())
+    {
+      Prefix p = list.back ().first;
+      uint32_t value = list.back ().second;
+      uint8_t k[4] = {static_cast<uint8_t> (p.first >> 24), static_cast<uint8_t> (p.first >> 16),
+                      static_cast<uint8_t> (p.first >> 8), static_cast<uint8_t> (p.first)};
+      NS_TEST_ASSERT_MSG_NE (trie.Find (k, p.second), 0, "Prefix not found");
+      trie.Remove (k, p.second, [value] (uint32_t v) { return v == value; });
+      list.pop_back ();
+    }
+  NS_TEST_EXPECT_MSG_EQ (trie.GetNNodes (), 1, "Removed prefixes must be pruned");
+
+  uint8_t mask[4] = {0xff, 0xf0, 0xff, 0};
+  uint32_t maskLength = PrefixTrie<4, int>::GetMaskLength (mask);
+  NS_TEST_EXPECT_MSG_EQ (maskLength, 12, "Wrong length of non contiguous mask");
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check the indexed lookups of Ipv4StaticRouting against a scan of
+ * its routes.
+ */
+class Ipv4StaticRoutingFibTestCase : public TestCase
+{
+public:
+  Ipv4StaticRoutingFibTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Look up a destination by scanning the routes.
+   * \param routing the routing protocol
+   * \param dest the destination
+   * \return the index of the selected route, or -1
+   */
+  static int32_t Scan (Ptr<Ipv4StaticRouting> routing, Ipv4Address dest);
+};
+
+Ipv4StaticRoutingFibTestCase::Ipv4StaticRoutingFibTestCase ()
+  : TestCase ("Check the Ipv4StaticRouting forwarding table index")
+{
+}
+
+int32_t
+Ipv4StaticRoutingFibTestCase::Scan (Ptr<Ipv4StaticRouting> routing, Ipv4Address dest)
+{
+  int32_t selected = -1;
+  uint16_t longestMask = 0;
+  uint32_t shortestMetric = 0xffffffff;
+  for (uint32_t i = 0; i < routing->GetNRoutes (); i++)
+    {
+      Ipv4RoutingTableEntry route = routing->GetRoute (i);
+      uint32_t metric = routing->GetMetric (i);
+      uint16_t maskLen = route.GetDestNetworkMask ().GetPrefixLength ();
+      if (!route.GetDestNetworkMask ().IsMatch (dest, route.GetDestNetwork ()) || maskLen < longestMask)
+        {
+          continue;
+        }
+      if (maskLen > longestMask)
+        {
+          shortestMetric = 0xffffffff;
+        }
+      longestMask = maskLen;
+      if (metric > shortestMetric)
+        {
+          continue;
+        }
+      shortestMetric = metric;
+      selected = i;
+      if (maskLen == 32)
+        {
+          break;
+        }
+    }
+  return selected;
+}
+
+void
+Ipv4StaticRoutingFibTestCase::DoRun (void)
+{
+  Ptr<Node> node = CreateRoutingNode ();
+  Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
+  Ipv4StaticRoutingHelper helper;
+  Ptr<Ipv4StaticRouting> routing = helper.GetStaticRouting (ipv4);
+  Ptr<UniformRandomVariable> rand = CreateObject<UniformRandomVariable> ();
+  const uint32_t pool[] = {0x0b000000, 0x0b010000, 0x0b010100, 0x0b010180, 0x0c000000};
+
+  // The gateways identify the routes
+  uint32_t gateway = 0x0a010100;
+  for (uint32_t step = 0; step < 1500; step++)
+    {
+      uint32_t address = pool[rand->GetInteger (0, 4)] | rand->GetInteger (0, 0x1ff);
+      if (step == 1000)
+        {
+          // Drop all the routes through the second interface
+          ipv4->SetDown (2);
+        }
+      if (rand->GetValue () < 0.6)
+        {
+          uint8_t length = static_cast<uint8_t> (rand->GetInteger (0, 32));
+          Ipv4Mask mask = Ipv4Mask (length == 0 ? 0 : 0xffffffff << (32 - length));
+          if (rand->GetValue () < 0.1)
+            {
+              mask = Ipv4Mask (0xffff00ff);
+            }
+          uint32_t interface = step < 1000 ? rand->GetInteger (1, 2) : 1;
+          routing->AddNetworkRouteTo (Ipv4Address (address).CombineMask (mask), mask,
+                                      Ipv4Address (++gateway), interface, rand->GetInteger (0, 2));
+        }
+      else if (routing->GetNRoutes () > 0)
+        {
+          routing->RemoveRoute (rand->GetInteger (0, routing->GetNRoutes () - 1));
+        }
+
+      Ipv4Header header;
+      header.SetDestination (Ipv4Address (address));
+      Socket::SocketErrno err;
+      Ptr<Ipv4Route> route = routing->RouteOutput (Create<Packet> (), header, 0, err);
+      int32_t expected = Scan (routing, Ipv4Address (address));
+      NS_TEST_ASSERT_MSG_EQ ((route != 0), (expected >= 0), "Route presence mismatch at step " << step);
+      if (route != 0)
+        {
+          Ipv4RoutingTableEntry entry = routing->GetRoute (expected);
+          NS_TEST_ASSERT_MSG_EQ (route->GetGateway (), entry.GetGateway (), "Wrong route at step " << step);
+          NS_TEST_ASSERT_MSG_EQ (route->GetOutputDevice (), ipv4->GetNetDevice (entry.GetInterface ()),
+                                 "Wrong device at step " << step);
+        }
+    }
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check the indexed lookups of Ipv4GlobalRouting against a scan of
+ * its host, network and external routes.
+ */
+class Ipv4GlobalRoutingFibTestCase : public TestCase
+{
+public:
+  Ipv4GlobalRoutingFibTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+Ipv4GlobalRoutingFibTestCase::Ipv4GlobalRoutingFibTestCase ()
+  : TestCase ("Check the Ipv4GlobalRouting forwarding table index")
+{
+}
+
+void
+Ipv4GlobalRoutingFibTestCase::DoRun (void)
+{
+  Ptr<Node> node = CreateRoutingNode ();
+  Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
+  Ptr<Ipv4ListRouting> list = DynamicCast<Ipv4ListRouting> (ipv4->GetRoutingProtocol ());
+  Ptr<Ipv4GlobalRouting> routing;
+  for (uint32_t i = 0; i < list->GetNRoutingProtocols (); i++)
+    {
+      int16_t priority;
+      routing = DynamicCast<Ipv4GlobalRouting> (list->GetRoutingProtocol (i, priority));
+      if (routing != 0)
+        {
+          break;
+        }
+    }
+  NS_TEST_ASSERT_MSG_NE (routing, 0, "Missing global routing");
+
+  // The routes of each list, in list order
+  std::vector<Ipv4RoutingTableEntry> routes[3];
+  Ptr<UniformRandomVariable> rand = CreateObject<UniformRandomVariable> ();
+  const uint32_t pool[] = {0x0b000000, 0x0b010000, 0x0b010100, 0x0c000000};
+  uint32_t gateway = 0x0a010100;
+  for (uint32_t step = 0; step < 1500; step++)
+    {
+      uint32_t address = pool[rand->GetInteger (0, 3)] | rand->GetInteger (0, 0x1ff);
+      if (rand->GetValue () < 0.6)
+        {
+          uint32_t type = rand->GetInteger (0, 2);
+          uint8_t length = static_cast<uint8_t> (rand->GetInteger (0, 32));
+          Ipv4Mask mask = Ipv4Mask (length == 0 ? 0 : 0xffffffff << (32 - length));
+          Ipv4Address network = Ipv4Address (address).CombineMask (mask);
+          uint32_t interface = rand->GetInteger (1, 2);
+          if (type == 0)
+            {
+              routing->AddHostRouteTo (Ipv4Address (address), Ipv4Address (++gateway), interface);
+              routes[0].push_back (Ipv4RoutingTableEntry::CreateHostRouteTo (Ipv4Address (address), Ipv4Address (gateway), interface));
+            }
+          else if (type == 1)
+            {
+              routing->AddNetworkRouteTo (network, mask, Ipv4Address (++gateway), interface);
+              routes[1].push_back (Ipv4RoutingTableEntry::CreateNetworkRouteTo (network, mask, Ipv4Address (gateway), interface));
+            }
+          else
+            {
+              routing->AddASExternalRouteTo (network, mask, Ipv4Address (++gateway), interface);
+              routes[2].push_back (Ipv4RoutingTableEntry::CreateNetworkRouteTo (network, mask, Ipv4Address (gateway), interface));
+            }
+        }
+      else if (routing->GetNRoutes () > 0)
+        {
+          uint32_t index = rand->GetInteger (0, routing->GetNRoutes () - 1);
+          routing->RemoveRoute (index);
+          for (uint32_t type = 0; type < 3; type++)
+            {
+              if (index < routes[type].size ())
+                {
+                  routes[type].erase (routes[type].begin () + index);
+                  break;
+                }
+              index -= routes[type].size ();
+            }
+        }
+
+      // The first host route, else the first network route, else the first
+      // external route
+      Ipv4Address dest = Ipv4Address (address);
+      const Ipv4RoutingTableEntry *expected = 0;
+      for (uint32_t type = 0; type < 3 && expected == 0; type++)
+        {
+          for (std::size_t i = 0; i < routes[type].size () && expected == 0; i++)
+            {
+              if (routes[type][i].GetDestNetworkMask ().IsMatch (dest, routes[type][i].GetDestNetwork ()))
+                {
+                  expected = &routes[type][i];
+                }
+            }
+        }
+
+      Ipv4Header header;
+      header.SetDestination (dest);
+      Socket::SocketErrno err;
+      Ptr<Ipv4Route> route = routing->RouteOutput (Create<Packet> (), header, 0, err);
+      NS_TEST_ASSERT_MSG_EQ ((route != 0), (expected != 0), "Route presence mismatch at step " << step);
+      if (route != 0)
+        {
+          NS_TEST_ASSERT_MSG_EQ (route->GetGateway (), expected->GetGateway (), "Wrong route at step " << step);
+        }
+    }
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check the indexed lookups of Ipv6StaticRouting against a scan of
+ * its routes.
+ */
+class Ipv6StaticRoutingFibTestCase : public TestCase
+{
+public:
+  Ipv6StaticRoutingFibTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Look up a destination by scanning the routes.
+   * \param routing the routing protocol
+   * \param dest the destination
+   * \return the index of the selected route, or -1
+   */
+  static int32_t Scan (Ptr<Ipv6StaticRouting> routing, Ipv6Address dest);
+};
+
+Ipv6StaticRoutingFibTestCase::Ipv6StaticRoutingFibTestCase ()
+  : TestCase ("Check the Ipv6StaticRouting forwarding table index")
+{
+}
+
+int32_t
+Ipv6StaticRoutingFibTestCase::Scan (Ptr<Ipv6StaticRouting> routing, Ipv6Address dest)
+{
+  int32_t selected = -1;
+  uint16_t longestMask = 0;
+  uint32_t shortestMetric = 0xffffffff;
+  for (uint32_t i = 0; i < routing->GetNRoutes (); i++)
+    {
+      Ipv6RoutingTableEntry route = routing->GetRoute (i);
+      uint32_t metric = routing->GetMetric (i);
+      uint16_t maskLen = route.GetDestNetworkPrefix ().GetPrefixLength ();
+      if (!route.GetDestNetworkPrefix ().IsMatch (dest, route.GetDestNetwork ()) || maskLen < longestMask)
+        {
+          continue;
+        }
+      if (maskLen > longestMask)
+        {
+          shortestMetric = 0xffffffff;
+        }
+      longestMask = maskLen;
+      if (metric > shortestMetric)
+        {
+          continue;
+        }
+      shortestMetric = metric;
+      selected = i;
+      if (maskLen == 128)
+        {
+          break;
+        }
+    }
+  return selected;
+}
+
+void
+Ipv6StaticRoutingFibTestCase::DoRun (void)
+{
+  Ptr<Node> node = CreateRoutingNode ();
+  Ptr<Ipv6> ipv6 = node->GetObject<Ipv6> ();
+  Ipv6StaticRoutingHelper helper;
+  Ptr<Ipv6StaticRouting> routing = helper.GetStaticRouting (ipv6);
+  Ptr<UniformRandomVariable> rand = CreateObject<UniformRandomVariable> ();
+
+  uint32_t gateway = 0;
+  for (uint32_t step = 0; step < 1500; step++)
+    {
+      uint8_t bytes[16] = {0x20, 0x01, 0x0d, 0xb8, 0, static_cast<uint8_t> (rand->GetInteger (0, 3)), 0, 0,
+                           0, 0, 0, 0, 0, 0, static_cast<uint8_t> (rand->GetInteger (0, 1)),
+                           static_cast<uint8_t> (rand->GetInteger (0, 255))};
+      Ipv6Address address = Ipv6Address (bytes);
+      if (rand->GetValue () < 0.6)
+        {
+          Ipv6Prefix prefix = Ipv6Prefix (static_cast<uint8_t> (rand->GetInteger (0, 128)));
+          if (rand->GetValue () < 0.1)
+            {
+              uint8_t mask[16] = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff};
+              prefix = Ipv6Prefix (mask);
+            }
+          uint8_t gw[16] = {0x20, 0x01, 0x0d, 0xb8, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+                            static_cast<uint8_t> (++gateway >> 16), static_cast<uint8_t> (gateway >> 8),
+                            static_cast<uint8_t> (gateway)};
+          routing->AddNetworkRouteTo (address.CombinePrefix (prefix), prefix, Ipv6Address (gw),
+                                      rand->GetInteger (1, 2), rand->GetInteger (0, 2));
+        }
+      else if (routing->GetNRoutes () > 0)
+        {
+          routing->RemoveRoute (rand->GetInteger (0, routing->GetNRoutes () - 1));
+        }
+
+      Ipv6Header header;
+      header.SetDestination (address);
+      Socket::SocketErrno err;
+      Ptr<Ipv6Route> route = routing->RouteOutput (Create<Packet> (), header, 0, err);
+      int32_t expected = Scan (routing, address);
+      NS_TEST_ASSERT_MSG_EQ ((route != 0), (expected >= 0), "Route presence mismatch at step " << step);
+      if (route != 0)
+        {
+          Ipv6RoutingTableEntry entry = routing->GetRoute (expected);
+          NS_TEST_ASSERT_MSG_EQ (route->GetGateway (), entry.GetGateway (), "Wrong route at step " << step);
+          NS_TEST_ASSERT_MSG_EQ (route->GetOutputDevice (), ipv6->GetNetDevice (entry.GetInterface ()),
+                                 "Wrong device at step " << step);
+        }
+    }
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Forwarding table index TestSuite
+ */
+class PrefixTrieTestSuite : public TestSuite
+{
+public:
+  PrefixTrieTestSuite ();
+};
+
+PrefixTrieTestSuite::PrefixTrieTestSuite ()
+  : TestSuite ("prefix-trie", UNIT)
+{
+  AddTestCase (new PrefixTrieTestCase, TestCase::QUICK);
+  AddTestCase (new Ipv4StaticRoutingFibTestCase, TestCase::QUICK);
+  AddTestCase (new Ipv4GlobalRoutingFibTestCase, TestCase::QUICK);
+  AddTestCase (new Ipv6StaticRoutingFibTestCase, TestCase::QUICK);
+}
+
+static PrefixTrieTestSuite g_prefixTrieTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,555 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/node.h"
+#include "ns3/node-container.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/ipv6-address-helper.h"
+#include "ns3/ipv4-global-routing-helper.h"
+#include "ns3/ipv4-l3-protocol.h"
+#include "ns3/ipv6-l3-protocol.h"
+#include "ns3/ipv4-header.h"
+#include "ns3/tcp-socket-factory.h"
+#include "ns3/tcp-header.h"
+#include "ns3/tcp-socket-base.h"
+#include "ns3/tcp-l4-protocol.h"
+#include "ns3/tcp-linux-reno.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/inet6-socket-address.h"
+#include "ns3/segmentation-offload-tag.h"
+#include "ns3/uinteger.h"
+#include "ns3/boolean.h"
+#include "ns3/global-value.h"
+#include "ns3/string.h"
+#include "ns3/data-rate.h"
+#include "ns3/packet.h"
+#include "ns3/log.h"
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("TcpTsoTestSuite");
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check that a bulk transfer with TCP segmentation offload delivers
+ * the same data in about the same time as without it, with fewer packets.
+ *
+ * The same transfer is run without segmentation offload and with it, over
+ * a rate-limited link: all the data must be received in both cases, the
+ * super-segments must be fewer than the segments, and the transfer time
+ * must stay within a few percent. The congestion control counts the
+ * acknowledged segments rather than the ACKs, so that its window grows
+ * alike when an ACK covers a whole super-segment.
+ */
+class TcpTsoTestCase : public TestCase
+{
+public:
+  /**
+   * \brief Constructor
+   * \param tsoMaxSegments value of the TsoMaxSegments attribute
+   * \param ipv6 whether to run the transfer over IPv6
+   */
+  TcpTsoTestCase (uint16_t tsoMaxSegments, bool ipv6);
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Outcome of a transfer
+   */
+  struct Transfer
+  {
+    uint32_t received {0};   //!< Bytes received
+    uint32_t segments {0};   //!< Data packets sent
+    uint32_t largest {0};    //!< Largest data packet sent
+    Time end;                //!< Duration until the last byte reception
+  };
+
+  /**
+   * \brief Run a transfer
+   * \param tsoMaxSegments value of the TsoMaxSegments attribute
+   * \return the outcome of the transfer
+   */
+  Transfer RunTransfer (uint16_t tsoMaxSegments);
+  /**
+   * \brief Fill the send buffer of the sender
+   * \param socket the sender socket
+   * \param available the space in the send buffer
+   */
+  void Write (Ptr<Socket> socket, uint32_t available);
+  /**
+   * \brief Accept a connection
+   * \param socket the new socket
+   * \param from the peer address
+   */
+  void Accept (Ptr<Socket> socket, const Address &from);
+  /**
+   * \brief Read the received data
+   * \param socket the receiver socket
+   */
+  void Receive (Ptr<Socket> socket);
+  /**
+   * \brief Trace the segments sent
+   * \param p the payload
+   * \param h the TCP header
+   * \param socket the sender socket
+   */
+  void Tx (Ptr<const Packet> p, const TcpHeader &h, Ptr<const TcpSocketBase> socket);
+
+  uint16_t m_tsoMaxSegments;  //!< TsoMaxSegments of the second transfer
+  bool m_ipv6;                //!< Run the transfers over IPv6
+  uint32_t m_toSend;          //!< Bytes left to write
+  Transfer m_current;         //!< Outcome of the current transfer
+
+  static const uint32_t TOTAL_BYTES = 2000000; //!< Bytes of each transfer
+  static const Time START;                     //!< Start time of each transfer
+};
+
+// Leave the time to the IPv6 addresses to complete the duplicate address detection
+const Time TcpTsoTestCase::START = Seconds (2);
+
+TcpTsoTestCase::TcpTsoTestCase (uint16_t tsoMaxSegments, bool ipv6)
+  : TestCase (std::string ("TCP segmentation offload with up to ")
+              + std::to_string (tsoMaxSegments) + " segments over "
+              + (ipv6 ? "IPv6" : "IPv4")),
+    m_tsoMaxSegments (tsoMaxSegments),
+    m_ipv6 (ipv6),
+    m_toSend (0)
+{
+}
+
+void
+TcpTsoTestCase::Write (Ptr<Socket> socket, [[maybe_unused]] uint32_t available)
+{
+  while (m_toSend > 0 && socket->GetTxAvailable () > 0)
+    {
+      uint32_t size = std::min (m_toSend, socket->GetTxAvailable ());
+      int sent = socket->Send (Create<Packet> (size));
+      if (sent <= 0)
+        {
+          return;
+        }
+      m_toSend -= sent;
+    }
+}
+
+void
+TcpTsoTestCase::Accept (Ptr<Socket> socket, [[maybe_unused]] const Address &from)
+{
+  socket->SetRecvCallback (MakeCallback (&TcpTsoTestCase::Receive, this));
+}
+
+void
+TcpTsoTestCase::Receive (Ptr<Socket> socket)
+{
+  Ptr<Packet> p;
+  while ((p = socket->Recv ()) && p->GetSize () > 0)
+    {
+      SegmentationOffloadTag offloadTag;
+      NS_TEST_EXPECT_MSG_EQ (p->PeekPacketTag (offloadTag), false,
+                             "Segmentation offload tag delivered to the application");
+      m_current.received += p->GetSize ();
+      m_current.end = Simulator::Now () - START;
+    }
+}
+
+void
+TcpTsoTestCase::Tx (Ptr<const Packet> p, [[maybe_unused]] const TcpHeader &h,
+                    [[maybe_unused]] Ptr<const TcpSocketBase> socket)
+{
+  if (p->GetSize () > 0)
+    {
+      m_current.segments++;
+      m_current.largest = std::max (m_current.largest, p->GetSize ());
+    }
+}
+
+TcpTsoTestCase::Transfer
+TcpTsoTestCase::RunTransfer (uint16_t tsoMaxSegments)
+{
+  m_current = Transfer ();
+  m_toSend = TOTAL_BYTES;
+
+  NodeContainer nodes;
+  nodes.Create (2);
+  InternetStackHelper internet;
+  internet.Install (nodes);
+  for (uint32_t i = 0; i < nodes.GetN (); i++)
+    {
+      nodes.Get (i)->GetObject<TcpL4Protocol> ()->SetAttribute ("SocketType",
+                                                                 TypeIdValue (TcpLinuxReno::GetTypeId ()));
+    }
+
+  Ptr<SimpleChannel> channel = CreateObject<SimpleChannel> ();
+  channel->SetAttribute ("Delay", TimeValue (MilliSeconds (1)));
+  SimpleNetDeviceHelper simple;
+  simple.SetNetDevicePointToPointMode (true);
+  simple.SetDeviceAttribute ("DataRate", DataRateValue (DataRate ("1Gbps")));
+  simple.SetDeviceAttribute ("SegmentationOffload", BooleanValue (true));
+  simple.SetQueue ("ns3::DropTailQueue", "MaxSize", StringValue ("1000p"));
+  NetDeviceContainer devices = simple.Install (nodes, channel);
+
+  Address serverAddress;
+  Address anyAddress;
+  if (m_ipv6)
+    {
+      Ipv6AddressHelper ipv6;
+      ipv6.SetBase (Ipv6Address ("2001:db8::"), Ipv6Prefix (64));
+      Ipv6InterfaceContainer interfaces = ipv6.Assign (devices);
+      interfaces.SetForwarding (0, false);
+      serverAddress = Inet6SocketAddress (interfaces.GetAddress (1, 1), 5000);
+      anyAddress = Inet6SocketAddress (Ipv6Address::GetAny (), 5000);
+    }
+  else
+    {
+      Ipv4AddressHelper ipv4;
+      ipv4.SetBase ("10.1.1.0", "255.255.255.0");
+      Ipv4InterfaceContainer interfaces = ipv4.Assign (devices);
+      serverAddress = InetSocketAddress (interfaces.GetAddress (1), 5000);
+      anyAddress = InetSocketAddress (Ipv4Address::GetAny (), 5000);
+    }
+
+  Ptr<Socket> server = Socket::CreateSocket (nodes.Get (1), TcpSocketFactory::GetTypeId ());
+  server->SetAttribute ("RcvBufSize", UintegerValue (1 << 20));
+  server->Bind (anyAddress);
+  server->Listen ();
+  server->SetAcceptCallback (MakeNullCallback<bool, Ptr<Socket>, const Address &> (),
+                             MakeCallback (&TcpTsoTestCase::Accept, this));
+
+  Ptr<Socket> source = Socket::CreateSocket (nodes.Get (0), TcpSocketFactory::GetTypeId ());
+  source->SetAttribute ("SegmentSize", UintegerValue (1400));
+  source->SetAttribute ("SndBufSize", UintegerValue (1 << 20));
+  source->SetAttribute ("TsoMaxSegments", UintegerValue (tsoMaxSegments));
+  source->TraceConnectWithoutContext ("Tx", MakeCallback (&TcpTsoTestCase::Tx, this));
+  source->SetSendCallback (MakeCallback (&TcpTsoTestCase::Write, this));
+  if (m_ipv6)
+    {
+      source->Bind6 ();
+    }
+  else
+    {
+      source->Bind ();
+    }
+  Simulator::Schedule (START, &Socket::Connect, source, serverAddress);
+  Simulator::Schedule (START, &TcpTsoTestCase::Write, this, source, 0);
+
+  Simulator::Stop (Seconds (30));
+  Simulator::Run ();
+  Simulator::Destroy ();
+  return m_current;
+}
+
+void
+TcpTsoTestCase::DoRun (void)
+{
+  Transfer plain = RunTransfer (1);
+  Transfer offload = RunTransfer (m_tsoMaxSegments);
+
+  NS_TEST_ASSERT_MSG_EQ (plain.received, TOTAL_BYTES, "Not all the data received without offload");
+  NS_TEST_ASSERT_MSG_EQ (offload.received, TOTAL_BYTES, "Not all the data received with offload");
+  NS_TEST_ASSERT_MSG_EQ (plain.largest, 1400, "Segment larger than the segment size without offload");
+  NS_TEST_ASSERT_MSG_GT (offload.largest, 1400, "No super-segment sent");
+  NS_TEST_ASSERT_MSG_LT_OR_EQ (offload.largest, 1400u * m_tsoMaxSegments, "Super-segment too large");
+  NS_TEST_ASSERT_MSG_LT (offload.segments, plain.segments, "Offload did not reduce the number of packets");
+  NS_TEST_ASSERT_MSG_EQ_TOL (offload.end.GetSeconds (), plain.end.GetSeconds (),
+                             plain.end.GetSeconds () * 0.1,
+                             "Transfer time changed by the segmentation offload");
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Check that super-segments are only sent through the devices
+ * supporting segmentation offload.
+ *
+ * A transfer with segmentation offload is run from A to B through a router
+ * R, over links with an MTU of 1500 bytes. The device of B's link never
+ * supports segmentation offload, the one of A's link supports it or not.
+ * When it does not, A must send single segments; when it does, A sends
+ * super-segments, which R must split into segments that fit in the MTU
+ * rather than fragment. All the data must be received in both cases.
+ */
+class TcpTsoRoutedTestCase : public TestCase
+{
+public:
+  /**
+   * \brief Constructor
+   * \param firstHopOffload whether the devices of A's link support segmentation offload
+   * \param ipv6 whether to run the transfer over IPv6
+   */
+  TcpTsoRoutedTestCase (bool firstHopOffload, bool ipv6);
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Fill the send buffer of the sender
+   * \param socket the sender socket
+   * \param available the space in the send buffer
+   */
+  void Write (Ptr<Socket> socket, uint32_t available);
+  /**
+   * \brief Accept a connection
+   * \param socket the new socket
+   * \param from the peer address
+   */
+  void Accept (Ptr<Socket> socket, const Address &from);
+  /**
+   * \brief Read the received data
+   * \param socket the receiver socket
+   */
+  void Receive (Ptr<Socket> socket);
+  /**
+   * \brief Trace the segments sent by the sender socket
+   * \param p the payload
+   * \param h the TCP header
+   * \param socket the sender socket
+   */
+  void SocketTx (Ptr<const Packet> p, const TcpHeader &h, Ptr<const TcpSocketBase> socket);
+  /**
+   * \brief Trace the IPv4 packets sent by the router
+   * \param p the packet, with its IP header
+   * \param ipv4 the IPv4 protocol of the router
+   * \param interface the output interface
+   */
+  void RouterTx (Ptr<const Packet> p, Ptr<Ipv4> ipv4, uint32_t interface);
+  /**
+   * \brief Trace the IPv6 packets sent by the router
+   * \param p the packet, with its IP header
+   * \param ipv6 the IPv6 protocol of the router
+   * \param interface the output interface
+   */
+  void RouterTx6 (Ptr<const Packet> p, Ptr<Ipv6> ipv6, uint32_t interface);
+
+  bool m_firstHopOffload;    //!< Whether the devices of A's link support segmentation offload
+  bool m_ipv6;               //!< Run the transfer over IPv6
+  uint32_t m_toSend;         //!< Bytes left to write
+  uint32_t m_received;       //!< Bytes received
+  uint32_t m_largestSent;    //!< Largest payload sent by the sender socket
+  uint32_t m_largestRouted;  //!< Largest packet sent by the router
+  uint32_t m_fragments;      //!< IPv4 fragments sent by the router
+
+  static const uint32_t TOTAL_BYTES = 1000000; //!< Bytes of the transfer
+  static const uint16_t MTU = 1500;            //!< MTU of the devices
+};
+
+TcpTsoRoutedTestCase::TcpTsoRoutedTestCase (bool firstHopOffload, bool ipv6)
+  : TestCase (std::string ("TCP segmentation offload through a router, ")
+              + (firstHopOffload ? "with" : "without")
+              + " offload on the first hop, over " + (ipv6 ? "IPv6" : "IPv4")),
+    m_firstHopOffload (firstHopOffload),
+    m_ipv6 (ipv6),
+    m_toSend (0),
+    m_received (0),
+    m_largestSent (0),
+    m_largestRouted (0),
+    m_fragments (0)
+{
+}
+
+void
+TcpTsoRoutedTestCase::Write (Ptr<Socket> socket, [[maybe_unused]] uint32_t available)
+{
+  while (m_toSend > 0 && socket->GetTxAvailable () > 0)
+    {
+      uint32_t size = std::min (m_toSend, socket->GetTxAvailable ());
+      int sent = socket->Send (Create<Packet> (size));
+      if (sent <= 0)
+        {
+          return;
+        }
+      m_toSend -= sent;
+    }
+}
+
+void
+TcpTsoRoutedTestCase::Accept (Ptr<Socket> socket, [[maybe_unused]] const Address &from)
+{
+  socket->SetRecvCallback (MakeCallback (&TcpTsoRoutedTestCase::Receive, this));
+}
+
+void
+TcpTsoRoutedTestCase::Receive (Ptr<Socket> socket)
+{
+  Ptr<Packet> p;
+  while ((p = socket->Recv ()) && p->GetSize () > 0)
+    {
+      m_received += p->GetSize ();
+    }
+}
+
+void
+TcpTsoRoutedTestCase::SocketTx (Ptr<const Packet> p, [[maybe_unused]] const TcpHeader &h,
+                                [[maybe_unused]] Ptr<const TcpSocketBase> socket)
+{
+  m_largestSent = std::max (m_largestSent, p->GetSize ());
+}
+
+void
+TcpTsoRoutedTestCase::RouterTx (Ptr<const Packet> p, [[maybe_unused]] Ptr<Ipv4> ipv4,
+                                [[maybe_unused]] uint32_t interface)
+{
+  m_largestRouted = std::max (m_largestRouted, p->GetSize ());
+  Ipv4Header ipHeader;
+  p->PeekHeader (ipHeader);
+  if (!ipHeader.IsLastFragment () || ipHeader.GetFragmentOffset () != 0)
+    {
+      m_fragments++;
+    }
+}
+
+void
+TcpTsoRoutedTestCase::RouterTx6 (Ptr<const Packet> p, [[maybe_unused]] Ptr<Ipv6> ipv6,
+                                 [[maybe_unused]] uint32_t interface)
+{
+  m_largestRouted = std::max (m_largestRouted, p->GetSize ());
+}
+
+void
+TcpTsoRoutedTestCase::DoRun (void)
+{
+  m_toSend = TOTAL_BYTES;
+  // the receiver drops the segments split by the router with a wrong checksum
+  GlobalValue::Bind ("ChecksumEnabled", BooleanValue (true));
+
+  NodeContainer nodes;
+  nodes.Create (3);
+  InternetStackHelper internet;
+  internet.Install (nodes);
+
+  SimpleNetDeviceHelper simple;
+  simple.SetNetDevicePointToPointMode (true);
+  simple.SetDeviceAttribute ("DataRate", DataRateValue (DataRate ("100Mbps")));
+  simple.SetQueue ("ns3::DropTailQueue", "MaxSize", StringValue ("1000p"));
+  simple.SetDeviceAttribute ("SegmentationOffload", BooleanValue (m_firstHopOffload));
+  NetDeviceContainer devicesAR = simple.Install (NodeContainer (nodes.Get (0), nodes.Get (1)),
+                                                 CreateObject<SimpleChannel> ());
+  simple.SetDeviceAttribute ("SegmentationOffload", BooleanValue (false));
+  NetDeviceContainer devicesRB = simple.Install (NodeContainer (nodes.Get (1), nodes.Get (2)),
+                                                 CreateObject<SimpleChannel> ());
+  for (uint32_t i = 0; i < 2; i++)
+    {
+      devicesAR.Get (i)->SetMtu (MTU);
+      devicesRB.Get (i)->SetMtu (MTU);
+    }
+
+  Address serverAddress;
+  Address anyAddress;
+  if (m_ipv6)
+    {
+      Ipv6AddressHelper ipv6;
+      ipv6.SetBase (Ipv6Address ("2001:1::"), Ipv6Prefix (64));
+      Ipv6InterfaceContainer interfacesAR = ipv6.Assign (devicesAR);
+      interfacesAR.SetForwarding (1, true);
+      interfacesAR.SetDefaultRouteInAllNodes (1);
+      ipv6.SetBase (Ipv6Address ("2001:2::"), Ipv6Prefix (64));
+      Ipv6InterfaceContainer interfacesRB = ipv6.Assign (devicesRB);
+      interfacesRB.SetForwarding (0, true);
+      interfacesRB.SetDefaultRouteInAllNodes (0);
+      serverAddress = Inet6SocketAddress (interfacesRB.GetAddress (1, 1), 5000);
+      anyAddress = Inet6SocketAddress (Ipv6Address::GetAny (), 5000);
+      nodes.Get (1)->GetObject<Ipv6L3Protocol> ()->TraceConnectWithoutContext (
+        "Tx", MakeCallback (&TcpTsoRoutedTestCase::RouterTx6, this));
+    }
+  else
+    {
+      Ipv4AddressHelper ipv4;
+      ipv4.SetBase ("10.1.1.0", "255.255.255.0");
+      ipv4.Assign (devicesAR);
+      ipv4.SetBase ("10.1.2.0", "255.255.255.0");
+      Ipv4InterfaceContainer interfacesRB = ipv4.Assign (devicesRB);
+      Ipv4GlobalRoutingHelper::PopulateRoutingTables ();
+      serverAddress = InetSocketAddress (interfacesRB.GetAddress (1), 5000);
+      anyAddress = InetSocketAddress (Ipv4Address::GetAny (), 5000);
+      nodes.Get (1)->GetObject<Ipv4L3Protocol> ()->TraceConnectWithoutContext (
+        "Tx", MakeCallback (&TcpTsoRoutedTestCase::RouterTx, this));
+    }
+
+  Ptr<Socket> server = Socket::CreateSocket (nodes.Get (2), TcpSocketFactory::GetTypeId ());
+  server->SetAttribute ("RcvBufSize", UintegerValue (1 << 20));
+  server->Bind (anyAddress);
+  server->Listen ();
+  server->SetAcceptCallback (MakeNullCallback<bool, Ptr<Socket>, const Address &> (),
+                             MakeCallback (&TcpTsoRoutedTestCase::Accept, this));
+
+  Ptr<Socket> source = Socket::CreateSocket (nodes.Get (0), TcpSocketFactory::GetTypeId ());
+  source->SetAttribute ("SegmentSize", UintegerValue (1400));
+  source->SetAttribute ("SndBufSize", UintegerValue (1 << 20));
+  source->SetAttribute ("TsoMaxSegments", UintegerValue (16));
+  source->TraceConnectWithoutContext ("Tx", MakeCallback (&TcpTsoRoutedTestCase::SocketTx, this));
+  source->SetSendCallback (MakeCallback (&TcpTsoRoutedTestCase::Write, this));
+  if (m_ipv6)
+    {
+      source->Bind6 ();
+    }
+  else
+    {
+      source->Bind ();
+    }
+  // Leave the time to the IPv6 addresses to complete the duplicate address detection
+  Simulator::Schedule (Seconds (2), &Socket::Connect, source, serverAddress);
+  Simulator::Schedule (Seconds (2), &TcpTsoRoutedTestCase::Write, this, source, 0);
+
+  Simulator::Stop (Seconds (30));
+  Simulator::Run ();
+  Simulator::Destroy ();
+  GlobalValue::Bind ("ChecksumEnabled", BooleanValue (false));
+
+  NS_TEST_ASSERT_MSG_EQ (m_received, TOTAL_BYTES, "Not all the data received");
+  if (m_firstHopOffload)
+    {
+      NS_TEST_ASSERT_MSG_GT (m_largestSent, 1400, "No super-segment sent");
+    }
+  else
+    {
+      NS_TEST_ASSERT_MSG_EQ (m_largestSent, 1400, "Super-segment sent through a device without offload");
+    }
+  NS_TEST_ASSERT_MSG_GT (m_largestRouted, 1400, "No segment forwarded");
+  NS_TEST_ASSERT_MSG_LT_OR_EQ (m_largestRouted, MTU, "Packet larger than the MTU forwarded");
+  NS_TEST_ASSERT_MSG_EQ (m_fragments, 0, "Super-segment fragmented rather than split");
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief TestSuite for the TCP segmentation offload
+ */
+class TcpTsoTestSuite : public TestSuite
+{
+public:
+  TcpTsoTestSuite ()
+    : TestSuite ("tcp-tso", UNIT)
+  {
+    AddTestCase (new TcpTsoTestCase (4, false), TestCase::QUICK);
+    AddTestCase (new TcpTsoTestCase (44, false), TestCase::QUICK);
+    AddTestCase (new TcpTsoTestCase (16, true), TestCase::QUICK);
+    AddTestCase (new TcpTsoRoutedTestCase (false, false), TestCase::QUICK);
+    AddTestCase (new TcpTsoRoutedTestCase (true, false), TestCase::QUICK);
+    AddTestCase (new TcpTsoRoutedTestCase (true, true), TestCase::QUICK);
+  }
+};
+
+static TcpTsoTestSuite g_tcpTsoTestSuite; //!< Static variable for test initialization
@@ -53,6 +53,9 @@ private:
   /** \brief Test the logic of merging items in GetTransmittedSegment()
    * which is triggered by CopyFromSequence()*/
   void TestMergeItemsWhenGetTransmittedSegment ();
+  /** \brief Test the lookups of the sent items by sequence after they
+   * have been split, sacked and partially acknowledged */
+  void TestSentIndex ();
   /**
    * \brief Callback to provide a value of receiver window
    * \returns the receiver window size
@@ -101,6 +104,15 @@ TcpTxBufferTestCase::DoRun ()
   Simulator::Schedule (Seconds (0.0),
                          &TcpTxBufferTestCase::TestMergeItemsWhenGetTransmittedSegment, this);
 
+  /*
+   * Case for the lookups of the sent items:
+   *  -> SACK blocks far from the head are mapped on the right items
+   *  -> items split by a retransmission and by a partial ACK can be found
+   *     again by their new starting sequence
+   */
+  Simulator::Schedule (Seconds (0.0),
+                       &TcpTxBufferTestCase::TestSentIndex, this);
+
   Simulator::Run ();
   Simulator::Destroy ();
 }
@@ -385,6 +397,50 @@ TcpTxBufferTestCase::TestMergeItemsWhenGetTransmittedSegment ()
   txBuf.CopyFromSequence (2000, SequenceNumber32(1));
 }
 
+void
+TcpTxBufferTestCase::TestSentIndex ()
+{
+  TcpTxBuffer txBuf;
+  txBuf.SetHeadSequence (SequenceNumber32 (1));
+  txBuf.SetSegmentSize (1000);
+  txBuf.SetDupAckThresh (3);
+
+  txBuf.Add (Create<Packet> (10000));
+  for (uint32_t i = 0; i < 10; ++i)
+    {
+      txBuf.CopyFromSequence (1000, SequenceNumber32 ((i * 1000) + 1));
+    }
+
+  TcpOptionSack::SackList sackList;
+  sackList.push_back (TcpOptionSack::SackBlock (SequenceNumber32 (3001), SequenceNumber32 (5001)));
+  sackList.push_back (TcpOptionSack::SackBlock (SequenceNumber32 (7001), SequenceNumber32 (8001)));
+  NS_TEST_ASSERT_MSG_EQ (txBuf.Update (sackList), 3000, "Wrong number of sacked bytes");
+  NS_TEST_ASSERT_MSG_EQ (txBuf.GetSacked (), 3000, "Wrong number of sacked bytes");
+
+  // Retransmit the second half of the second segment, splitting its item
+  Ptr<Packet> ret = txBuf.CopyFromSequence (500, SequenceNumber32 (1501))->GetPacketCopy ();
+  NS_TEST_ASSERT_MSG_EQ (ret->GetSize (), 500, "Returned packet has different size than requested");
+
+  sackList.clear ();
+  sackList.push_back (TcpOptionSack::SackBlock (SequenceNumber32 (1501), SequenceNumber32 (2001)));
+  NS_TEST_ASSERT_MSG_EQ (txBuf.Update (sackList), 500, "Split item not found by the SACK block");
+  NS_TEST_ASSERT_MSG_EQ (txBuf.IsLost (SequenceNumber32 (1501)), false, "Sacked item reported as lost");
+
+  // Acknowledge the middle of the first half, moving the start of its item
+  txBuf.DiscardUpTo (SequenceNumber32 (1251));
+  NS_TEST_ASSERT_MSG_EQ (txBuf.GetSacked (), 3500, "Wrong number of sacked bytes");
+  NS_TEST_ASSERT_MSG_EQ (txBuf.Size (), 8750, "Size is different than expected");
+
+  ret = txBuf.CopyFromSequence (250, SequenceNumber32 (1251))->GetPacketCopy ();
+  NS_TEST_ASSERT_MSG_EQ (ret->GetSize (), 250, "Returned packet has different size than requested");
+  ret = txBuf.CopyFromSequence (1000, SequenceNumber32 (5001))->GetPacketCopy ();
+  NS_TEST_ASSERT_MSG_EQ (ret->GetSize (), 1000, "Returned packet has different size than requested");
+
+  txBuf.DiscardUpTo (SequenceNumber32 (10001));
+  NS_TEST_ASSERT_MSG_EQ (txBuf.Size (), 0, "Size is different than expected");
+  NS_TEST_ASSERT_MSG_EQ (txBuf.GetSacked (), 0, "Wrong number of sacked bytes");
+}
+
 void
 TcpTxBufferTestCase::TestTransmittedBlock ()
 {
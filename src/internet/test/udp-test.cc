@@ -55,6 +55,7 @@
 
 #include <string>
 #include <limits>
+#include <vector>
 
 using namespace ns3;
 
@@ -111,6 +112,62 @@ UdpSocketLoopbackTest::DoRun ()
   NS_TEST_EXPECT_MSG_EQ (m_receivedPacket->GetSize (), 246, "first socket should not receive it (it is bound specifically to the second interface's address");
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief UDP Socket batch send and receive over IPv4 Test
+ */
+class UdpSocketBatchTest : public TestCase
+{
+public:
+  UdpSocketBatchTest ();
+  virtual void DoRun (void);
+};
+
+UdpSocketBatchTest::UdpSocketBatchTest ()
+  : TestCase ("UDP batch send and receive test")
+{
+}
+
+void
+UdpSocketBatchTest::DoRun ()
+{
+  Ptr<Node> rxNode = CreateObject<Node> ();
+  InternetStackHelper internet;
+  internet.Install (rxNode);
+
+  Ptr<SocketFactory> rxSocketFactory = rxNode->GetObject<UdpSocketFactory> ();
+  Ptr<Socket> rxSocket = rxSocketFactory->CreateSocket ();
+  rxSocket->Bind (InetSocketAddress (Ipv4Address::GetAny (), 80));
+
+  Ptr<Socket> txSocket = rxSocketFactory->CreateSocket ();
+  std::vector<Ptr<Packet> > packets;
+  for (uint32_t i = 0; i < 5; i++)
+    {
+      packets.push_back (Create<Packet> (100 + i));
+    }
+  NS_TEST_EXPECT_MSG_EQ (txSocket->SendBatch (packets, 0), -1, "an unconnected socket should not send");
+  txSocket->Connect (InetSocketAddress ("127.0.0.1", 80));
+  NS_TEST_EXPECT_MSG_EQ (txSocket->SendBatch (packets, 0), 5, "all the packets should be sent");
+  Simulator::Run ();
+
+  std::vector<Ptr<Packet> > received;
+  std::vector<Address> from;
+  NS_TEST_EXPECT_MSG_EQ (rxSocket->RecvBatch (received, from, 3, 0), 3, "the batch should be limited to 3 packets");
+  NS_TEST_EXPECT_MSG_EQ (rxSocket->RecvBatch (received, from, 3, 0), 2, "the remaining packets should be read");
+  NS_TEST_EXPECT_MSG_EQ (rxSocket->RecvBatch (received, from, 3, 0), 0, "no packet should be left");
+  NS_TEST_EXPECT_MSG_EQ (rxSocket->GetErrno (), Socket::ERROR_AGAIN, "an empty read should set ERROR_AGAIN");
+  NS_TEST_ASSERT_MSG_EQ (received.size (), 5, "wrong number of packets read");
+  NS_TEST_ASSERT_MSG_EQ (from.size (), 5, "wrong number of addresses read");
+  for (uint32_t i = 0; i < 5; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (received[i]->GetSize (), 100 + i, "the packets should be read in order");
+      NS_TEST_EXPECT_MSG_EQ (InetSocketAddress::ConvertFrom (from[i]).GetIpv4 (), Ipv4Address ("127.0.0.1"), "wrong sender address");
+    }
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -721,6 +778,7 @@ public:
   {
     AddTestCase (new UdpSocketImplTest, TestCase::QUICK);
     AddTestCase (new UdpSocketLoopbackTest, TestCase::QUICK);
+    AddTestCase (new UdpSocketBatchTest, TestCase::QUICK);
     AddTestCase (new Udp6SocketImplTest, TestCase::QUICK);
     AddTestCase (new Udp6SocketLoopbackTest, TestCase::QUICK);
   }
@@ -208,6 +208,25 @@ AsciiTraceHelper::CreateFileStream (std::string filename, std::ios::openmode fil
   return StreamWrapper;
 }
 
+Ptr<OutputStreamWrapper>
+AsciiTraceHelper::CreateBinaryFileStream (std::string filename, bool headerDigests,
+                                          uint32_t writeBufferSize, bool asyncFlush)
+{
+  NS_LOG_FUNCTION (filename << headerDigests << writeBufferSize << asyncFlush);
+
+  Ptr<BinaryTraceFile> file = Create<BinaryTraceFile> ();
+  file->SetHeaderDigests (headerDigests);
+  file->SetWriteBuffer (writeBufferSize, asyncFlush);
+  file->Open (filename, std::ios::out);
+  NS_ABORT_MSG_IF (file->Fail (), "AsciiTraceHelper::CreateBinaryFileStream():  Unable to Open " << filename);
+
+  //
+  // Same lifetime rules as for CreateFileStream (): the binary trace file
+  // is closed when the last callback holding the wrapper goes away.
+  //
+  return Create<OutputStreamWrapper> (file);
+}
+
 std::string
 AsciiTraceHelper::GetFilenameFromDevice (std::string prefix, Ptr<NetDevice> device, bool useObjectNames)
 {
@@ -310,6 +329,12 @@ void
 AsciiTraceHelper::DefaultEnqueueSinkWithoutContext (Ptr<OutputStreamWrapper> stream, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (stream << p);
+  Ptr<BinaryTraceFile> binary = stream->GetBinaryTraceFile ();
+  if (binary)
+    {
+      binary->Write (Simulator::Now (), BinaryTraceFile::ENQUEUE, "", p);
+      return;
+    }
   *stream->GetStream () << "+ " << Simulator::Now ().GetSeconds () << " " << *p << std::endl;
 }
 
@@ -317,6 +342,12 @@ void
 AsciiTraceHelper::DefaultEnqueueSinkWithContext (Ptr<OutputStreamWrapper> stream, std::string context, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (stream << p);
+  Ptr<BinaryTraceFile> binary = stream->GetBinaryTraceFile ();
+  if (binary)
+    {
+      binary->Write (Simulator::Now (), BinaryTraceFile::ENQUEUE, context, p);
+      return;
+    }
   *stream->GetStream () << "+ " << Simulator::Now ().GetSeconds () << " " << context << " " << *p << std::endl;
 }
 
@@ -336,6 +367,12 @@ void
 AsciiTraceHelper::DefaultDropSinkWithoutContext (Ptr<OutputStreamWrapper> stream, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (stream << p);
+  Ptr<BinaryTraceFile> binary = stream->GetBinaryTraceFile ();
+  if (binary)
+    {
+      binary->Write (Simulator::Now (), BinaryTraceFile::DROP, "", p);
+      return;
+    }
   *stream->GetStream () << "d " << Simulator::Now ().GetSeconds () << " " << *p << std::endl;
 }
 
@@ -343,6 +380,12 @@ void
 AsciiTraceHelper::DefaultDropSinkWithContext (Ptr<OutputStreamWrapper> stream, std::string context, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (stream << p);
+  Ptr<BinaryTraceFile> binary = stream->GetBinaryTraceFile ();
+  if (binary)
+    {
+      binary->Write (Simulator::Now (), BinaryTraceFile::DROP, context, p);
+      return;
+    }
   *stream->GetStream () << "d " << Simulator::Now ().GetSeconds () << " " << context << " " << *p << std::endl;
 }
 
@@ -363,6 +406,12 @@ void
 AsciiTraceHelper::DefaultDequeueSinkWithoutContext (Ptr<OutputStreamWrapper> stream, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (stream << p);
+  Ptr<BinaryTraceFile> binary = stream->GetBinaryTraceFile ();
+  if (binary)
+    {
+      binary->Write (Simulator::Now (), BinaryTraceFile::DEQUEUE, "", p);
+      return;
+    }
   *stream->GetStream () << "- " << Simulator::Now ().GetSeconds () << " " << *p << std::endl;
 }
 
@@ -370,6 +419,12 @@ void
 AsciiTraceHelper::DefaultDequeueSinkWithContext (Ptr<OutputStreamWrapper> stream, std::string context, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (stream << p);
+  Ptr<BinaryTraceFile> binary = stream->GetBinaryTraceFile ();
+  if (binary)
+    {
+      binary->Write (Simulator::Now (), BinaryTraceFile::DEQUEUE, context, p);
+      return;
+    }
   *stream->GetStream () << "- " << Simulator::Now ().GetSeconds () << " " << context << " " << *p << std::endl;
 }
 
@@ -387,6 +442,12 @@ void
 AsciiTraceHelper::DefaultReceiveSinkWithoutContext (Ptr<OutputStreamWrapper> stream, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (stream << p);
+  Ptr<BinaryTraceFile> binary = stream->GetBinaryTraceFile ();
+  if (binary)
+    {
+      binary->Write (Simulator::Now (), BinaryTraceFile::RECEIVE, "", p);
+      return;
+    }
   *stream->GetStream () << "r " << Simulator::Now ().GetSeconds () << " " << *p << std::endl;
 }
 
@@ -394,6 +455,12 @@ void
 AsciiTraceHelper::DefaultReceiveSinkWithContext (Ptr<OutputStreamWrapper> stream, std::string context, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (stream << p);
+  Ptr<BinaryTraceFile> binary = stream->GetBinaryTraceFile ();
+  if (binary)
+    {
+      binary->Write (Simulator::Now (), BinaryTraceFile::RECEIVE, context, p);
+      return;
+    }
   *stream->GetStream () << "r " << Simulator::Now ().GetSeconds () << " " << context << " " << *p << std::endl;
 }
 
@@ -223,6 +223,34 @@ public:
   Ptr<OutputStreamWrapper> CreateFileStream (std::string filename, 
                                              std::ios::openmode filemode = std::ios::out);
 
+  /**
+   * @brief Create an output stream object that makes the default trace
+   * sinks log their events to a compact binary file.
+   *
+   * Instead of printing each packet through Packet::Print, the default
+   * enqueue, dequeue, drop and receive sinks store one fixed-width record
+   * per event in a BinaryTraceFile.  Since no packet is printed, helpers
+   * given such a stream do not enable packet printing.  The file can be
+   * turned into the classic ascii layout offline with
+   * BinaryTraceFile::ConvertToAscii or the binary-trace-to-ascii utility.
+   *
+   * Pass the returned stream to the EnableAscii methods taking a stream,
+   * e.g. EnableAsciiAll (stream), so that the records carry the node and
+   * device of each event.  Trace sinks other than the default ones that
+   * write text to the stream have their output discarded.
+   *
+   * @param filename file name
+   * @param headerDigests whether to store a digest of the leading packet
+   *        bytes in each record
+   * @param writeBufferSize size of the buffer batching the records, in bytes
+   * @param asyncFlush whether full buffers are written by a background thread
+   * @returns a smart pointer to the output stream
+   */
+  Ptr<OutputStreamWrapper> CreateBinaryFileStream (std::string filename,
+                                                   bool headerDigests = false,
+                                                   uint32_t writeBufferSize = 1 << 20,
+                                                   bool asyncFlush = false);
+
   /**
    * @brief Hook a trace source to the default enqueue operation trace sink that
    * does not accept nor log a trace context.
@@ -359,6 +359,16 @@ public:
    */
   virtual bool SupportsSendFrom (void) const = 0;
 
+  /**
+   * A device supporting segmentation offload transmits a super-segment
+   * (see SegmentationOffloadTag) larger than its MTU as the segments it
+   * stands for. The network layer splits the super-segments it sends
+   * through any other device.
+   *
+   * eturn true if this interface supports segmentation offload, false otherwise.
+   */
+  virtual bool SupportsSegmentationOffload (void) const;
+
 };
 
 } // namespace ns3
@@ -32,6 +32,8 @@
 #include "ns3/global-value.h"
 #include "ns3/boolean.h"
 
+#include <algorithm>
+
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("Node");
@@ -155,6 +157,77 @@ Node::GetNDevices (void) const
   return m_devices.size ();
 }
 
+Ptr<Object>
+Node::GetAggregate (TypeId tid) const
+{
+  NS_LOG_FUNCTION (this << tid);
+  if (m_aggregateIndex.empty ())
+    {
+      // nothing was ever aggregated to this node
+      return GetObject<Object> (tid);
+    }
+  TypeIndex::const_iterator i = std::lower_bound (m_aggregateIndex.begin (), m_aggregateIndex.end (),
+                                                  std::make_pair (tid.GetUid (), (Object *) 0));
+  if (i == m_aggregateIndex.end () || i->first != tid.GetUid ())
+    {
+      return 0;
+    }
+  if (i->second == 0)
+    {
+      // several aggregated objects derive from tid
+      return GetObject<Object> (tid);
+    }
+  return i->second;
+}
+
+void
+Node::AddToTypeIndex (TypeIndex &index, Object *object)
+{
+  NS_LOG_FUNCTION (&index << object);
+  TypeId objectTid = Object::GetTypeId ();
+  TypeId tid = object->GetInstanceTypeId ();
+  while (tid != objectTid)
+    {
+      // keep the entries of a type in insertion order
+      TypeIndex::iterator i = std::upper_bound (index.begin (), index.end (),
+                                                std::make_pair (tid.GetUid (), object),
+                                                [] (const TypeIndex::value_type &a,
+                                                    const TypeIndex::value_type &b)
+                                                { return a.first < b.first; });
+      index.insert (i, std::make_pair (tid.GetUid (), object));
+      if (!tid.HasParent ())
+        {
+          break;
+        }
+      tid = tid.GetParent ();
+    }
+}
+
+void
+Node::NotifyNewAggregate (void)
+{
+  NS_LOG_FUNCTION (this);
+  TypeIndex index;
+  AggregateIterator aggregates = GetAggregateIterator ();
+  while (aggregates.HasNext ())
+    {
+      AddToTypeIndex (index, const_cast<Object *> (PeekPointer (aggregates.Next ())));
+    }
+  m_aggregateIndex.clear ();
+  for (TypeIndex::const_iterator i = index.begin (); i != index.end (); ++i)
+    {
+      if (!m_aggregateIndex.empty () && m_aggregateIndex.back ().first == i->first)
+        {
+          m_aggregateIndex.back ().second = 0;
+        }
+      else
+        {
+          m_aggregateIndex.push_back (*i);
+        }
+    }
+  Object::NotifyNewAggregate ();
+}
+
 uint32_t 
 Node::AddApplication (Ptr<Application> application)
 {
@@ -187,6 +260,7 @@ Node::DoDispose ()
   NS_LOG_FUNCTION (this);
   m_deviceAdditionListeners.clear ();
   m_handlers.clear ();
+  m_aggregateIndex.clear ();
   for (std::vector<Ptr<NetDevice> >::iterator i = m_devices.begin ();
        i != m_devices.end (); i++)
     {
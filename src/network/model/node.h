@@ -114,6 +114,28 @@ public:
    *          to this Node.
    */
   uint32_t GetNDevices (void) const;
+  /**
+   * \brief Get an object aggregated to this node.
+   *
+   * This is equivalent to GetObject (tid), but looks the object up in a
+   * per-node index of the aggregated objects and of their parent types,
+   * which is updated whenever objects are aggregated to the node.  It is
+   * meant for the objects fetched for many nodes at a time, such as the
+   * Ipv4, MobilityModel or TrafficControlLayer of every node, and is used
+   * by Config to resolve paths such as "/NodeList/0/$ns3::Ipv4L3Protocol".
+   *
+   * \param tid the TypeId of the requested object.
+   * \returns the aggregated object, or 0 if there is none.
+   */
+  Ptr<Object> GetAggregate (TypeId tid) const override;
+  /**
+   * \brief Get an object aggregated to this node.
+   *
+   * \tparam T \explicit the type of the requested object.
+   * \returns the aggregated object, or 0 if there is none.
+   */
+  template <typename T>
+  Ptr<T> GetAggregate (void) const;
 
   /**
    * \brief Associate an Application to this Node.
@@ -218,6 +240,11 @@ protected:
    */
   virtual void DoDispose (void);
   virtual void DoInitialize (void);
+  /**
+   * Rebuild the index used by GetAggregate.  Subclasses overriding this
+   * method must chain up to it.
+   */
+  virtual void NotifyNewAggregate (void);
 private:
 
   /**
@@ -282,14 +309,32 @@ private:
   /// Typedef for NetDevice addition listeners container
   typedef std::vector<DeviceAdditionListener> DeviceAdditionListenerList;
 
+  /// Typedef for the type indexes, sorted by TypeId uid
+  typedef std::vector<std::pair<uint16_t, Object *> > TypeIndex;
+
+  /**
+   * \brief Add an object to a type index, under its type and parent types.
+   * \param index the type index
+   * \param object the object
+   */
+  static void AddToTypeIndex (TypeIndex &index, Object *object);
+
   uint32_t    m_id;         //!< Node id for this node
   uint32_t    m_sid;        //!< System id for this node
   std::vector<Ptr<NetDevice> > m_devices; //!< Devices associated to this node
   std::vector<Ptr<Application> > m_applications; //!< Applications associated to this node
   ProtocolHandlerList m_handlers; //!< Protocol handlers in the node
   DeviceAdditionListenerList m_deviceAdditionListeners; //!< Device addition listeners in the node
+  TypeIndex m_aggregateIndex; //!< Aggregated objects by type; null if the type is ambiguous
 };
 
+template <typename T>
+Ptr<T>
+Node::GetAggregate (void) const
+{
+  return DynamicCast<T> (GetAggregate (T::GetTypeId ()));
+}
+
 } // namespace ns3
 
 #endif /* NODE_H */
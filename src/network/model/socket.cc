@@ -198,6 +198,50 @@ Socket::RecvFrom (Address &fromAddress)
   return RecvFrom (std::numeric_limits<uint32_t>::max (), 0, fromAddress);
 }
 
+int
+Socket::SendBatch (const std::vector<Ptr<Packet> > &packets, uint32_t flags)
+{
+  NS_LOG_FUNCTION (this << packets.size () << flags);
+  int sent = 0;
+  for (std::size_t i = 0; i < packets.size (); i++)
+    {
+      int size = packets[i]->GetSize ();
+      if (Send (packets[i], flags) != size)
+        {
+          break;
+        }
+      sent++;
+    }
+  if (sent == 0 && !packets.empty ())
+    {
+      return -1;
+    }
+  return sent;
+}
+
+uint32_t
+Socket::RecvBatch (std::vector<Ptr<Packet> > &packets, std::vector<Address> &fromAddresses,
+                   uint32_t maxPackets, uint32_t flags)
+{
+  NS_LOG_FUNCTION (this << maxPackets << flags);
+  uint32_t received = 0;
+  Ptr<Packet> packet;
+  Address from;
+  while (received < maxPackets
+         && (packet = RecvFrom (std::numeric_limits<uint32_t>::max (), flags, from)))
+    {
+      packets.push_back (packet);
+      fromAddresses.push_back (from);
+      received++;
+      if (packet->GetSize () == 0)
+        {
+          // end of stream
+          break;
+        }
+    }
+  return received;
+}
+
 int
 Socket::RecvFrom (uint8_t* buf, uint32_t size, uint32_t flags,
                   Address &fromAddress)
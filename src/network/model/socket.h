@@ -30,6 +30,7 @@
 #include "ns3/net-device.h"
 #include "address.h"
 #include <stdint.h>
+#include <vector>
 #include "ns3/inet-socket-address.h"
 #include "ns3/inet6-socket-address.h"
 
@@ -476,6 +477,44 @@ public:
   virtual Ptr<Packet> RecvFrom (uint32_t maxSize, uint32_t flags,
                                 Address &fromAddress) = 0;
 
+  /**
+   * \brief Send several packets.
+   *
+   * This function matches in semantics the sendmmsg() function call of
+   * the Linux C library: the packets are sent in order, as by Send (),
+   * and sending stops at the first packet that is not accepted in full.
+   * The default implementation calls Send () for each packet; subclasses
+   * may override it to share the work of a call, such as the route
+   * lookup, among the packets.
+   *
+   * \param packets the packets to send
+   * \param flags Socket control flags
+   * \returns the number of packets accepted for transmission, or -1 if
+   *          the first packet could not be sent.
+   */
+  virtual int SendBatch (const std::vector<Ptr<Packet> > &packets, uint32_t flags);
+
+  /**
+   * \brief Read several packets from the socket and retrieve their sender
+   * addresses.
+   *
+   * This function matches in semantics the recvmmsg() function call of
+   * the Linux C library, except that the receive I/O is asynchronous:
+   * it returns the packets available, up to maxPackets, as by repeated
+   * calls to RecvFrom ().  Reading stops after a packet of size zero,
+   * which marks the end of a stream.
+   *
+   * \param packets vector to which the packets read are appended
+   * \param fromAddresses vector to which the addresses of the senders of
+   *        the packets are appended
+   * \param maxPackets maximum number of packets to read
+   * \param flags Socket control flags
+   * \returns the number of packets read
+   */
+  virtual uint32_t RecvBatch (std::vector<Ptr<Packet> > &packets,
+                              std::vector<Address> &fromAddresses,
+                              uint32_t maxPackets, uint32_t flags);
+
   /////////////////////////////////////////////////////////////////////
   //   The remainder of these public methods are overloaded methods  //
   //   or variants of Send() and Recv(), and they are non-virtual    //
@@ -0,0 +1,144 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <sstream>
+
+#include "ns3/test.h"
+#include "ns3/packet.h"
+#include "ns3/nstime.h"
+#include "ns3/binary-trace-file.h"
+#include "ns3/output-stream-wrapper.h"
+#include "ns3/trace-helper.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Check that events written to a BinaryTraceFile are read back with
+ * their contexts, and converted to the ascii trace layout.
+ */
+class BinaryTraceFileTestCase : public TestCase
+{
+public:
+  BinaryTraceFileTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+BinaryTraceFileTestCase::BinaryTraceFileTestCase ()
+  : TestCase ("Check that BinaryTraceFile records round-trip and convert to ascii")
+{
+}
+
+void
+BinaryTraceFileTestCase::DoRun (void)
+{
+  std::string filename = CreateTempDirFilename ("events.btr");
+  std::string rx = "/NodeList/3/DeviceList/1/$ns3::CsmaNetDevice/MacRx";
+  std::string tx = "/NodeList/12/DeviceList/0/$ns3::CsmaNetDevice/TxQueue/Enqueue";
+  Ptr<Packet> p1 = Create<Packet> (100);
+  Ptr<Packet> p2 = Create<Packet> (1500);
+
+  {
+    Ptr<BinaryTraceFile> file = Create<BinaryTraceFile> ();
+    file->SetHeaderDigests (true);
+    file->SetWriteBuffer (64, true);
+    file->Open (filename, std::ios::out);
+    NS_TEST_ASSERT_MSG_EQ (file->Fail (), false, "Open (" << filename << ") returns error");
+
+    // The default sinks write through the stream wrapper.
+    Ptr<OutputStreamWrapper> stream = Create<OutputStreamWrapper> (file);
+    NS_TEST_ASSERT_MSG_EQ (stream->GetBinaryTraceFile (), file, "Wrapper must hold the binary file");
+
+    file->Write (MilliSeconds (1500), BinaryTraceFile::ENQUEUE, tx, p1);
+    file->Write (MilliSeconds (1501), BinaryTraceFile::RECEIVE, rx, p1);
+    file->Write (Seconds (2), BinaryTraceFile::ENQUEUE, tx, p2);
+    file->Write (Seconds (3), BinaryTraceFile::DROP, "", p2);
+    file->Close ();
+    NS_TEST_EXPECT_MSG_EQ (file->Fail (), false, "Write must not fail");
+  }
+
+  BinaryTraceFile file;
+  file.Open (filename, std::ios::in);
+  NS_TEST_ASSERT_MSG_EQ (file.Fail (), false, "Open (" << filename << ") for reading returns error");
+
+  BinaryTraceFile::Record r;
+  NS_TEST_ASSERT_MSG_EQ (file.Read (r), true, "Missing first record");
+  NS_TEST_EXPECT_MSG_EQ (r.m_type, '+', "Wrong event type");
+  NS_TEST_EXPECT_MSG_EQ (r.m_nodeId, 12, "Wrong node id");
+  NS_TEST_EXPECT_MSG_EQ (r.m_deviceId, 0, "Wrong device id");
+  NS_TEST_EXPECT_MSG_EQ (r.m_uid, p1->GetUid (), "Wrong packet uid");
+  NS_TEST_EXPECT_MSG_EQ (r.m_size, 100, "Wrong packet size");
+  NS_TEST_EXPECT_MSG_EQ (file.GetTime (r), MilliSeconds (1500), "Wrong timestamp");
+  NS_TEST_EXPECT_MSG_EQ (file.GetContext (r.m_context), tx, "Wrong context");
+  NS_TEST_EXPECT_MSG_EQ ((r.m_flags & BinaryTraceFile::DIGEST_VALID), BinaryTraceFile::DIGEST_VALID, "Missing digest");
+  uint32_t digest = r.m_digest;
+
+  NS_TEST_ASSERT_MSG_EQ (file.Read (r), true, "Missing second record");
+  NS_TEST_EXPECT_MSG_EQ (r.m_type, 'r', "Wrong event type");
+  NS_TEST_EXPECT_MSG_EQ (r.m_nodeId, 3, "Wrong node id");
+  NS_TEST_EXPECT_MSG_EQ (r.m_deviceId, 1, "Wrong device id");
+  NS_TEST_EXPECT_MSG_EQ (file.GetContext (r.m_context), rx, "Wrong context");
+  NS_TEST_EXPECT_MSG_EQ (r.m_digest, digest, "Same packet must have the same digest");
+
+  NS_TEST_ASSERT_MSG_EQ (file.Read (r), true, "Missing third record");
+  NS_TEST_EXPECT_MSG_EQ (file.GetContext (r.m_context), tx, "Contexts must be reused");
+  NS_TEST_EXPECT_MSG_EQ (r.m_size, 1500, "Wrong packet size");
+
+  NS_TEST_ASSERT_MSG_EQ (file.Read (r), true, "Missing fourth record");
+  NS_TEST_EXPECT_MSG_EQ (r.m_type, 'd', "Wrong event type");
+  NS_TEST_EXPECT_MSG_EQ (r.m_context, BinaryTraceFile::UNKNOWN, "Event without context");
+  NS_TEST_EXPECT_MSG_EQ (r.m_nodeId, BinaryTraceFile::UNKNOWN, "Event without node");
+  NS_TEST_EXPECT_MSG_EQ (file.Read (r), false, "Unexpected record");
+
+  std::ostringstream ascii;
+  NS_TEST_ASSERT_MSG_EQ (BinaryTraceFile::ConvertToAscii (filename, ascii), true, "Conversion failed");
+  std::istringstream lines (ascii.str ());
+  std::string line;
+  std::getline (lines, line);
+  std::ostringstream expected;
+  expected << "+ 1.5 " << tx << " uid=" << p1->GetUid () << " size=100 digest=0x";
+  NS_TEST_EXPECT_MSG_EQ (line.substr (0, expected.str ().size ()), expected.str (), "Wrong ascii line");
+  std::getline (lines, line);
+  std::getline (lines, line);
+  std::getline (lines, line);
+  expected.str ("");
+  expected << "d 3 uid=" << p2->GetUid () << " size=1500 digest=0x";
+  NS_TEST_EXPECT_MSG_EQ (line.substr (0, expected.str ().size ()), expected.str (), "Wrong ascii line");
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Binary trace file TestSuite
+ */
+class BinaryTraceFileTestSuite : public TestSuite
+{
+public:
+  BinaryTraceFileTestSuite ();
+};
+
+BinaryTraceFileTestSuite::BinaryTraceFileTestSuite ()
+  : TestSuite ("binary-trace-file", UNIT)
+{
+  AddTestCase (new BinaryTraceFileTestCase, TestCase::QUICK);
+}
+
+static BinaryTraceFileTestSuite g_binaryTraceFileTestSuite; //!< Static variable for test initialization
@@ -387,6 +387,87 @@ BufferTest::DoRun (void)
   NS_TEST_ASSERT_MSG_EQ (val1, val2, "Bad ReadNtohU16()");
 }
 
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Buffer checksum test: the checksum of any range of a buffer with a
+ * zero area must be the one computed a byte at a time.
+ */
+class BufferChecksumTest : public TestCase
+{
+public:
+  BufferChecksumTest ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Compute a checksum a byte at a time.
+   * \param i the start of the range
+   * \param size the size of the range
+   * \param initialChecksum the initial value
+   * \returns the checksum
+   */
+  uint16_t SerialChecksum (Buffer::Iterator i, uint16_t size, uint32_t initialChecksum);
+};
+
+BufferChecksumTest::BufferChecksumTest ()
+  : TestCase ("Buffer checksum over a zero area")
+{
+}
+
+uint16_t
+BufferChecksumTest::SerialChecksum (Buffer::Iterator i, uint16_t size, uint32_t initialChecksum)
+{
+  uint32_t sum = initialChecksum;
+  for (uint16_t j = 0; j < size; j++)
+    {
+      uint32_t byte = i.ReadU8 ();
+      sum += (j & 1) ? (byte << 8) : byte;
+    }
+  while (sum >> 16)
+    {
+      sum = (sum & 0xffff) + (sum >> 16);
+    }
+  return ~sum;
+}
+
+void
+BufferChecksumTest::DoRun (void)
+{
+  // 37 bytes, a zero area of 16 bytes, then 29 bytes
+  Buffer buffer (16);
+  buffer.AddAtStart (37);
+  buffer.AddAtEnd (29);
+  Buffer::Iterator i = buffer.Begin ();
+  for (uint32_t j = 0; j < 37; j++)
+    {
+      i.WriteU8 (static_cast<uint8_t> (j * 37 + 11));
+    }
+  i.Next (16);
+  for (uint32_t j = 0; j < 29; j++)
+    {
+      i.WriteU8 (static_cast<uint8_t> (0xff - j * 13));
+    }
+
+  for (uint32_t start = 0; start < buffer.GetSize (); start++)
+    {
+      for (uint32_t size = 0; start + size <= buffer.GetSize (); size++)
+        {
+          Buffer::Iterator expected = buffer.Begin ();
+          expected.Next (start);
+          Buffer::Iterator actual = expected;
+          uint32_t initialChecksum = start * 1021;
+          NS_TEST_ASSERT_MSG_EQ (actual.CalculateIpChecksum (size, initialChecksum),
+                                 SerialChecksum (expected, size, initialChecksum),
+                                 "Bad checksum of " << size << " bytes at " << start);
+          NS_TEST_ASSERT_MSG_EQ (buffer.Begin ().GetDistanceFrom (actual), start + size,
+                                 "Iterator not advanced past the range");
+        }
+    }
+}
+
 /**
  * \ingroup network-test
  * \ingroup tests
@@ -403,6 +484,7 @@ BufferTestSuite::BufferTestSuite ()
   : TestSuite ("buffer", UNIT)
 {
   AddTestCase (new BufferTest, TestCase::QUICK);
+  AddTestCase (new BufferChecksumTest, TestCase::QUICK);
 }
 
 static BufferTestSuite g_bufferTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,171 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/node.h"
+#include "ns3/config.h"
+#include "ns3/simulator.h"
+
+#include <sstream>
+
+using namespace ns3;
+
+namespace {
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Base class of the objects aggregated in NodeIndexTestCase.
+ */
+class NodeIndexTestBase : public Object
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void)
+  {
+    static TypeId tid = TypeId ("ns3::NodeIndexTestBase")
+      .SetParent<Object> ()
+      .SetGroupName ("Network")
+    ;
+    return tid;
+  }
+};
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief First object aggregated in NodeIndexTestCase.
+ */
+class NodeIndexTestA : public NodeIndexTestBase
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void)
+  {
+    static TypeId tid = TypeId ("ns3::NodeIndexTestA")
+      .SetParent<NodeIndexTestBase> ()
+      .SetGroupName ("Network")
+      .AddConstructor<NodeIndexTestA> ()
+    ;
+    return tid;
+  }
+};
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Second object aggregated in NodeIndexTestCase.
+ */
+class NodeIndexTestB : public NodeIndexTestBase
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void)
+  {
+    static TypeId tid = TypeId ("ns3::NodeIndexTestB")
+      .SetParent<NodeIndexTestBase> ()
+      .SetGroupName ("Network")
+      .AddConstructor<NodeIndexTestB> ()
+    ;
+    return tid;
+  }
+};
+
+} // unnamed namespace
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Check the per-node index of the aggregated objects.
+ */
+class NodeIndexTestCase : public TestCase
+{
+public:
+  NodeIndexTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+NodeIndexTestCase::NodeIndexTestCase ()
+  : TestCase ("Check the per-node aggregate index")
+{
+}
+
+void
+NodeIndexTestCase::DoRun (void)
+{
+  Ptr<Node> node = CreateObject<Node> ();
+  NS_TEST_EXPECT_MSG_EQ (node->GetAggregate<Node> (), node, "Node must be found before any aggregation");
+  NS_TEST_EXPECT_MSG_EQ (node->GetAggregate<NodeIndexTestA> (), 0, "Nothing aggregated yet");
+
+  Ptr<NodeIndexTestA> a = CreateObject<NodeIndexTestA> ();
+  node->AggregateObject (a);
+  NS_TEST_EXPECT_MSG_EQ (node->GetAggregate<NodeIndexTestA> (), a, "Aggregated object not indexed");
+  NS_TEST_EXPECT_MSG_EQ (node->GetAggregate<NodeIndexTestBase> (), a, "Parent type not indexed");
+  NS_TEST_EXPECT_MSG_EQ (node->GetAggregate<Node> (), node, "Node not indexed");
+  NS_TEST_EXPECT_MSG_EQ (node->GetAggregate<NodeIndexTestB> (), 0, "Unexpected object");
+
+  // the parent type is now shared by two objects
+  Ptr<NodeIndexTestB> b = CreateObject<NodeIndexTestB> ();
+  a->AggregateObject (b);
+  NS_TEST_EXPECT_MSG_EQ (node->GetAggregate<NodeIndexTestB> (), b, "Aggregated object not indexed");
+  NS_TEST_EXPECT_MSG_EQ (node->GetAggregate<NodeIndexTestA> (), a, "Aggregated object lost");
+  NS_TEST_EXPECT_MSG_EQ (node->GetAggregate<NodeIndexTestBase> (), node->GetObject<NodeIndexTestBase> (),
+                         "Ambiguous type must behave as GetObject");
+
+  // Config resolves the "$" elements of the paths through the index
+  std::ostringstream oss;
+  oss << "/NodeList/" << node->GetId () << "/$ns3::NodeIndexTestB";
+  Config::MatchContainer matches = Config::LookupMatches (oss.str ());
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 1, "Aggregated object not found by Config");
+  NS_TEST_EXPECT_MSG_EQ (matches.Get (0), b, "Wrong object found by Config");
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Node TestSuite
+ */
+class NodeTestSuite : public TestSuite
+{
+public:
+  NodeTestSuite ();
+};
+
+NodeTestSuite::NodeTestSuite ()
+  : TestSuite ("node", UNIT)
+{
+  AddTestCase (new NodeIndexTestCase, TestCase::QUICK);
+}
+
+static NodeTestSuite g_nodeTestSuite; //!< Static variable for test initialization
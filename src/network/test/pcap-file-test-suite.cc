@@ -21,10 +21,14 @@
 #include <cstdlib>
 #include <sstream>
 #include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
 
 #include "ns3/log.h"
 #include "ns3/test.h"
 #include "ns3/pcap-file.h"
+#include "ns3/pcapng-file.h"
 
 using namespace ns3;
 
@@ -1144,6 +1148,175 @@ DiffTestCase::DoRun (void)
   NS_TEST_EXPECT_MSG_EQ (usec, 3696, "Files are different from 2.3696 seconds");
 }
 
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Test case to make sure that buffered and asynchronously flushed
+ * writes produce the same file as unbuffered writes.
+ */
+class BufferedWriteTestCase : public TestCase
+{
+public:
+  BufferedWriteTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Write the known packets to a file.
+   * \param filename The file name.
+   * \param bufferSize The size of the write buffer.
+   * \param async Whether the buffers are flushed by a background thread.
+   */
+  void WriteKnownPackets (std::string const &filename, uint32_t bufferSize, bool async);
+};
+
+BufferedWriteTestCase::BufferedWriteTestCase ()
+  : TestCase ("Check that PcapFile::SetWriteBuffer does not change the file contents")
+{
+}
+
+void
+BufferedWriteTestCase::WriteKnownPackets (std::string const &filename, uint32_t bufferSize, bool async)
+{
+  PcapFile f;
+  f.SetWriteBuffer (bufferSize, async);
+  f.Open (filename, std::ios::out);
+  NS_TEST_ASSERT_MSG_EQ (f.Fail (), false, "Open (" << filename << ", \"std::ios::out\") returns error");
+  f.Init (1, N_PACKET_BYTES);
+  NS_TEST_ASSERT_MSG_EQ (f.Fail (), false, "Init (1, " << N_PACKET_BYTES << ") returns error");
+
+  for (uint32_t i = 0; i < N_KNOWN_PACKETS; ++i)
+    {
+      PacketEntry const & p = knownPackets[i];
+      std::vector<uint8_t> data (p.origLen);
+      for (uint32_t j = 0; j < p.inclLen && j < N_PACKET_BYTES; ++j)
+        {
+          data[j] = p.data[j];
+        }
+      f.Write (p.tsSec, p.tsUsec, data.data (), p.origLen);
+      NS_TEST_EXPECT_MSG_EQ (f.Fail (), false, "Write must not fail");
+    }
+  f.Close ();
+}
+
+void
+BufferedWriteTestCase::DoRun (void)
+{
+  std::string plain = CreateTempDirFilename ("unbuffered.pcap");
+  std::string buffered = CreateTempDirFilename ("buffered.pcap");
+  std::string async = CreateTempDirFilename ("async.pcap");
+
+  // A small buffer, so that records straddle several batches
+  WriteKnownPackets (plain, 0, false);
+  WriteKnownPackets (buffered, 100, false);
+  WriteKnownPackets (async, 100, true);
+
+  uint32_t sec (0), usec (0), packets (0);
+  bool diff = PcapFile::Diff (plain, buffered, sec, usec, packets);
+  NS_TEST_EXPECT_MSG_EQ (diff, false, "Buffered file differs at packet " << packets);
+  NS_TEST_EXPECT_MSG_EQ (packets, N_KNOWN_PACKETS, "Buffered file misses packets");
+
+  packets = 0;
+  diff = PcapFile::Diff (plain, async, sec, usec, packets);
+  NS_TEST_EXPECT_MSG_EQ (diff, false, "Asynchronously flushed file differs at packet " << packets);
+  NS_TEST_EXPECT_MSG_EQ (packets, N_KNOWN_PACKETS, "Asynchronously flushed file misses packets");
+}
+
+/**
+ * \ingroup network-test
+ * \ingroup tests
+ *
+ * \brief Test case to check the block structure of pcapng files.
+ */
+class PcapNgFileTestCase : public TestCase
+{
+public:
+  PcapNgFileTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+PcapNgFileTestCase::PcapNgFileTestCase ()
+  : TestCase ("Check that PcapNgFile writes one interface block per interface and snaplen-truncated packet blocks")
+{
+}
+
+void
+PcapNgFileTestCase::DoRun (void)
+{
+  std::string filename = CreateTempDirFilename ("interfaces.pcapng");
+  {
+    Ptr<PcapNgFile> f = PcapNgFile::GetShared (filename, 64, true);
+    NS_TEST_ASSERT_MSG_EQ (f->Fail (), false, "Open (" << filename << ") returns error");
+    NS_TEST_ASSERT_MSG_EQ (PcapNgFile::GetShared (filename), f, "Shared files must be unique per name");
+
+    uint32_t if0 = f->AddInterface (1, 16, "node-0-dev-0");
+    uint32_t if1 = f->AddInterface (105, 65535, "node-1-dev-0", true);
+    NS_TEST_EXPECT_MSG_EQ (if0, 0, "Unexpected interface identifier");
+    NS_TEST_EXPECT_MSG_EQ (if1, 1, "Unexpected interface identifier");
+
+    uint8_t data[100];
+    std::memset (data, 0xab, sizeof (data));
+    f->Write (if0, 1000, data, 100);
+    f->Write (if1, 2000, data, 37);
+    NS_TEST_EXPECT_MSG_EQ (f->Fail (), false, "Write must not fail");
+  }
+
+  // Walk the blocks of the file, which must be closed by now.
+  std::ifstream in (filename.c_str (), std::ios::binary);
+  std::vector<uint8_t> bytes ((std::istreambuf_iterator<char> (in)), std::istreambuf_iterator<char> ());
+  std::vector<uint32_t> types;
+  std::vector<uint32_t> capLens;
+  std::vector<uint32_t> interfaceOffsets;
+  uint32_t offset = 0;
+  while (offset + 12 <= bytes.size ())
+    {
+      uint32_t type, length, trailer;
+      std::memcpy (&type, &bytes[offset], 4);
+      std::memcpy (&length, &bytes[offset + 4], 4);
+      NS_TEST_ASSERT_MSG_EQ (length % 4, 0, "Block lengths must be 32-bit aligned");
+      NS_TEST_ASSERT_MSG_LT_OR_EQ (offset + length, bytes.size (), "Truncated block");
+      std::memcpy (&trailer, &bytes[offset + length - 4], 4);
+      NS_TEST_EXPECT_MSG_EQ (trailer, length, "Block length fields must match");
+      types.push_back (type);
+      if (type == 1)
+        {
+          interfaceOffsets.push_back (offset);
+        }
+      if (type == 6)
+        {
+          uint32_t capLen;
+          std::memcpy (&capLen, &bytes[offset + 20], 4);
+          capLens.push_back (capLen);
+        }
+      offset += length;
+    }
+  NS_TEST_EXPECT_MSG_EQ (offset, bytes.size (), "Trailing garbage after the last block");
+  NS_TEST_ASSERT_MSG_EQ (types.size (), 5, "Expected SHB, two IDBs and two EPBs");
+  NS_TEST_EXPECT_MSG_EQ (types[0], 0x0A0D0D0A, "First block must be a section header");
+  NS_TEST_EXPECT_MSG_EQ (types[1], 1, "Expected an interface description block");
+  NS_TEST_EXPECT_MSG_EQ (types[2], 1, "Expected an interface description block");
+  NS_TEST_ASSERT_MSG_EQ (capLens.size (), 2, "Expected two enhanced packet blocks");
+  NS_TEST_EXPECT_MSG_EQ (capLens[0], 16, "Packet must be truncated to the snap length");
+  NS_TEST_EXPECT_MSG_EQ (capLens[1], 37, "Packet must not be truncated");
+
+  // The if_tsresol option of the second interface follows its 12-byte name.
+  uint32_t tsresol = interfaceOffsets[1] + 16 + 4 + 12;
+  uint16_t code, length;
+  std::memcpy (&code, &bytes[tsresol], 2);
+  std::memcpy (&length, &bytes[tsresol + 2], 2);
+  NS_TEST_EXPECT_MSG_EQ (code, 9, "Expected an if_tsresol option");
+  NS_TEST_EXPECT_MSG_EQ (length, 1, "The if_tsresol option value is one byte");
+  NS_TEST_EXPECT_MSG_EQ (unsigned (bytes[tsresol + 4]), 9, "Expected a nanosecond resolution");
+  for (uint32_t i = 5; i < 8; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (unsigned (bytes[tsresol + i]), 0, "The if_tsresol option must be zero-padded");
+    }
+}
+
 /**
  * \ingroup network-test
  * \ingroup tests
@@ -1167,6 +1340,8 @@ PcapFileTestSuite::PcapFileTestSuite ()
   AddTestCase (new RecordHeaderTestCase, TestCase::QUICK);
   AddTestCase (new ReadFileTestCase, TestCase::QUICK);
   AddTestCase (new DiffTestCase, TestCase::QUICK);
+  AddTestCase (new BufferedWriteTestCase, TestCase::QUICK);
+  AddTestCase (new PcapNgFileTestCase, TestCase::QUICK);
 }
 
 static PcapFileTestSuite pcapFileTestSuite; //!< Static variable for test initialization
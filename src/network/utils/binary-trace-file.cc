@@ -0,0 +1,360 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cstring>
+#include <cstdlib>
+#include <iomanip>
+#include "ns3/assert.h"
+#include "ns3/log.h"
+#include "ns3/hash.h"
+#include "ns3/packet.h"
+#include "ns3/fatal-impl.h"
+#include "binary-trace-file.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("BinaryTraceFile");
+
+namespace {
+
+const uint32_t MAGIC = 0x43525442;    //!< "BTRC" in little endian byte order
+const uint16_t VERSION = 1;           //!< Version of the file format
+const uint32_t FILE_HEADER_SIZE = 16; //!< Size of the file header
+
+/**
+ * \brief Parse the unsigned integer following a path element of a context.
+ * \param context The trace context, such as "/NodeList/3/DeviceList/1/...".
+ * \param element The path element, such as "/NodeList/".
+ * \returns the integer, or BinaryTraceFile::UNKNOWN
+ */
+uint32_t
+ParseContextIndex (std::string const &context, char const *element)
+{
+  std::string::size_type pos = context.find (element);
+  if (pos == std::string::npos)
+    {
+      return BinaryTraceFile::UNKNOWN;
+    }
+  char const *start = context.c_str () + pos + std::strlen (element);
+  char *end;
+  unsigned long value = std::strtoul (start, &end, 10);
+  if (end == start)
+    {
+      return BinaryTraceFile::UNKNOWN;
+    }
+  return static_cast<uint32_t> (value);
+}
+
+} // unnamed namespace
+
+BinaryTraceFile::BinaryTraceFile ()
+  : m_writeBufferSize (0),
+    m_asyncFlush (false),
+    m_headerDigests (false),
+    m_resolution (Time::GetResolution ())
+{
+  NS_LOG_FUNCTION (this);
+  FatalImpl::RegisterStream (&m_file);
+}
+
+BinaryTraceFile::~BinaryTraceFile ()
+{
+  NS_LOG_FUNCTION (this);
+  FatalImpl::UnregisterStream (&m_file);
+  Close ();
+}
+
+void
+BinaryTraceFile::SetWriteBuffer (uint32_t size, bool asyncFlush)
+{
+  NS_LOG_FUNCTION (this << size << asyncFlush);
+  m_writeBufferSize = size;
+  m_asyncFlush = asyncFlush;
+}
+
+void
+BinaryTraceFile::SetHeaderDigests (bool enable)
+{
+  NS_LOG_FUNCTION (this << enable);
+  m_headerDigests = enable;
+}
+
+void
+BinaryTraceFile::Open (std::string const &filename, std::ios::openmode mode)
+{
+  NS_LOG_FUNCTION (this << filename << mode);
+  NS_ASSERT (!m_file.is_open ());
+  m_contextIndex.clear ();
+  m_contexts.clear ();
+  m_file.open (filename.c_str (), mode | std::ios::binary);
+  if (!m_file.is_open ())
+    {
+      return;
+    }
+
+  uint8_t header[FILE_HEADER_SIZE];
+  if (mode & std::ios::in)
+    {
+      m_file.read (reinterpret_cast<char *> (header), FILE_HEADER_SIZE);
+      uint32_t magic;
+      uint16_t version;
+      uint32_t recordSize;
+      std::memcpy (&magic, header, 4);
+      std::memcpy (&version, header + 4, 2);
+      std::memcpy (&recordSize, header + 8, 4);
+      if (m_file.fail () || magic != MAGIC || version != VERSION
+          || recordSize != RECORD_SIZE || header[6] >= Time::LAST)
+        {
+          m_file.setstate (std::ios::failbit);
+          return;
+        }
+      m_resolution = static_cast<enum Time::Unit> (header[6]);
+      return;
+    }
+
+  m_resolution = Time::GetResolution ();
+  std::memset (header, 0, FILE_HEADER_SIZE);
+  std::memcpy (header, &MAGIC, 4);
+  std::memcpy (header + 4, &VERSION, 2);
+  header[6] = static_cast<uint8_t> (m_resolution);
+  uint32_t recordSize = RECORD_SIZE;
+  std::memcpy (header + 8, &recordSize, 4);
+  m_file.write (reinterpret_cast<char const *> (header), FILE_HEADER_SIZE);
+  m_writeBuffer.Attach (&m_file, m_writeBufferSize, m_asyncFlush);
+}
+
+void
+BinaryTraceFile::Close (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_writeBuffer.Detach ();
+  m_file.close ();
+}
+
+void
+BinaryTraceFile::Flush (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_writeBuffer.IsEnabled ())
+    {
+      m_writeBuffer.Flush ();
+    }
+  else
+    {
+      m_file.flush ();
+    }
+}
+
+bool
+BinaryTraceFile::Fail (void) const
+{
+  NS_LOG_FUNCTION (this);
+  if (m_writeBuffer.IsEnabled ())
+    {
+      return m_writeBuffer.Failed ();
+    }
+  return m_file.fail ();
+}
+
+void
+BinaryTraceFile::SerializeRecord (Record const &record, uint8_t *out)
+{
+  std::memset (out, 0, RECORD_SIZE);
+  out[0] = record.m_type;
+  out[1] = record.m_flags;
+  std::memcpy (out + 4, &record.m_context, 4);
+  std::memcpy (out + 8, &record.m_nodeId, 4);
+  std::memcpy (out + 12, &record.m_deviceId, 4);
+  std::memcpy (out + 16, &record.m_timestamp, 8);
+  std::memcpy (out + 24, &record.m_uid, 8);
+  std::memcpy (out + 32, &record.m_size, 4);
+  std::memcpy (out + 36, &record.m_digest, 4);
+}
+
+void
+BinaryTraceFile::WriteBytes (uint8_t const *data, uint32_t size)
+{
+  if (m_writeBuffer.IsEnabled ())
+    {
+      m_writeBuffer.Append (data, size);
+    }
+  else
+    {
+      m_file.write (reinterpret_cast<char const *> (data), size);
+    }
+}
+
+BinaryTraceFile::ContextInfo const &
+BinaryTraceFile::InternContext (std::string const &context)
+{
+  std::unordered_map<std::string, ContextInfo>::const_iterator it = m_contextIndex.find (context);
+  if (it != m_contextIndex.end ())
+    {
+      return it->second;
+    }
+
+  ContextInfo info;
+  info.m_index = m_contextIndex.size ();
+  info.m_nodeId = ParseContextIndex (context, "/NodeList/");
+  info.m_deviceId = ParseContextIndex (context, "/DeviceList/");
+  NS_LOG_LOGIC ("New context " << info.m_index << ": " << context);
+
+  Record record;
+  std::memset (&record, 0, sizeof (record));
+  record.m_type = CONTEXT;
+  record.m_context = info.m_index;
+  record.m_nodeId = info.m_nodeId;
+  record.m_deviceId = info.m_deviceId;
+  record.m_size = context.size ();
+  uint8_t out[RECORD_SIZE];
+  SerializeRecord (record, out);
+  WriteBytes (out, RECORD_SIZE);
+  std::vector<uint8_t> name ((context.size () + 7) & ~std::size_t (7), 0);
+  std::memcpy (name.data (), context.data (), context.size ());
+  WriteBytes (name.data (), name.size ());
+
+  return m_contextIndex.insert (std::make_pair (context, info)).first->second;
+}
+
+void
+BinaryTraceFile::Write (Time t, EventType type, std::string const &context, Ptr<const Packet> p)
+{
+  NS_LOG_FUNCTION (this << t << static_cast<char> (type) << context << p);
+  Record record;
+  record.m_type = type;
+  record.m_flags = 0;
+  if (context.empty ())
+    {
+      record.m_context = UNKNOWN;
+      record.m_nodeId = UNKNOWN;
+      record.m_deviceId = UNKNOWN;
+    }
+  else
+    {
+      ContextInfo const &info = InternContext (context);
+      record.m_context = info.m_index;
+      record.m_nodeId = info.m_nodeId;
+      record.m_deviceId = info.m_deviceId;
+    }
+  record.m_timestamp = t.GetTimeStep ();
+  record.m_uid = p->GetUid ();
+  record.m_size = p->GetSize ();
+  record.m_digest = 0;
+  if (m_headerDigests)
+    {
+      uint8_t leading[DIGEST_BYTES];
+      uint32_t n = p->CopyData (leading, DIGEST_BYTES);
+      record.m_digest = Hash32 (reinterpret_cast<char const *> (leading), n);
+      record.m_flags |= DIGEST_VALID;
+    }
+
+  if (m_writeBuffer.IsEnabled ())
+    {
+      SerializeRecord (record, m_writeBuffer.Reserve (RECORD_SIZE));
+      return;
+    }
+  uint8_t out[RECORD_SIZE];
+  SerializeRecord (record, out);
+  m_file.write (reinterpret_cast<char const *> (out), RECORD_SIZE);
+}
+
+bool
+BinaryTraceFile::Read (Record &record)
+{
+  NS_LOG_FUNCTION (this);
+  uint8_t in[RECORD_SIZE];
+  while (true)
+    {
+      m_file.read (reinterpret_cast<char *> (in), RECORD_SIZE);
+      if (m_file.gcount () != RECORD_SIZE)
+        {
+          return false;
+        }
+      record.m_type = in[0];
+      record.m_flags = in[1];
+      std::memcpy (&record.m_context, in + 4, 4);
+      std::memcpy (&record.m_nodeId, in + 8, 4);
+      std::memcpy (&record.m_deviceId, in + 12, 4);
+      std::memcpy (&record.m_timestamp, in + 16, 8);
+      std::memcpy (&record.m_uid, in + 24, 8);
+      std::memcpy (&record.m_size, in + 32, 4);
+      std::memcpy (&record.m_digest, in + 36, 4);
+      if (record.m_type != CONTEXT)
+        {
+          return true;
+        }
+
+      std::vector<char> name ((record.m_size + 7) & ~uint32_t (7));
+      m_file.read (name.data (), name.size ());
+      if (m_file.gcount () != static_cast<std::streamsize> (name.size ()))
+        {
+          return false;
+        }
+      if (m_contexts.size () <= record.m_context)
+        {
+          m_contexts.resize (record.m_context + 1);
+        }
+      m_contexts[record.m_context].assign (name.data (), record.m_size);
+    }
+}
+
+std::string
+BinaryTraceFile::GetContext (uint32_t context) const
+{
+  if (context >= m_contexts.size ())
+    {
+      return "";
+    }
+  return m_contexts[context];
+}
+
+Time
+BinaryTraceFile::GetTime (Record const &record) const
+{
+  return Time::FromInteger (record.m_timestamp, m_resolution);
+}
+
+bool
+BinaryTraceFile::ConvertToAscii (std::string const &filename, std::ostream &os)
+{
+  NS_LOG_FUNCTION (filename << &os);
+  BinaryTraceFile file;
+  file.Open (filename, std::ios::in);
+  if (file.Fail ())
+    {
+      return false;
+    }
+
+  Record record;
+  while (file.Read (record))
+    {
+      os << static_cast<char> (record.m_type) << " " << file.GetTime (record).GetSeconds () << " ";
+      if (record.m_context != UNKNOWN)
+        {
+          os << file.GetContext (record.m_context) << " ";
+        }
+      os << "uid=" << record.m_uid << " size=" << record.m_size;
+      if (record.m_flags & DIGEST_VALID)
+        {
+          os << " digest=0x" << std::hex << std::setw (8) << std::setfill ('0')
+             << record.m_digest << std::dec << std::setfill (' ');
+        }
+      os << "\n";
+    }
+  return true;
+}
+
+} // namespace ns3
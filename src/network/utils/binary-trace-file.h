@@ -0,0 +1,250 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef BINARY_TRACE_FILE_H
+#define BINARY_TRACE_FILE_H
+
+#include <string>
+#include <fstream>
+#include <vector>
+#include <unordered_map>
+#include <stdint.h>
+#include "ns3/ptr.h"
+#include "ns3/nstime.h"
+#include "ns3/simple-ref-count.h"
+#include "pcap-write-buffer.h"
+
+namespace ns3 {
+
+class Packet;
+
+/**
+ * \ingroup network
+ *
+ * \brief A compact binary replacement for the ascii device traces.
+ *
+ * The default ascii trace sinks of AsciiTraceHelper print every packet
+ * through Packet::Print, which is slow and produces very large files.  A
+ * BinaryTraceFile instead stores each '+', '-', 'r' and 'd' event as a
+ * fixed-width record holding the event type, the node and device ids,
+ * the timestamp, the packet uid and size and, optionally, a digest of the
+ * leading (header) bytes of the packet.
+ *
+ * Trace contexts such as "/NodeList/3/DeviceList/1/$ns3::CsmaNetDevice/MacRx"
+ * are stored once, in a context record preceding their first event; the
+ * events refer to them by index.
+ *
+ * The file can be converted offline to the classic ascii layout with
+ * ConvertToAscii (), or with the binary-trace-to-ascii utility.  Since the
+ * packet contents are not stored, the packet column of the converted file
+ * shows the packet uid, size and digest instead of the printed headers.
+ *
+ * Record layout (host byte order; readers reject foreign byte order):
+ *
+ * \verbatim
+   offset size  field
+      0     1   type ('+', '-', 'r', 'd'; 'C' for a context record)
+      1     1   flags (bit 0: digest is valid)
+      2     2   reserved
+      4     4   context index
+      8     4   node id
+     12     4   device id
+     16     8   timestamp, in the time resolution stored in the file header
+     24     8   packet uid
+     32     4   packet size (context records: length of the context string)
+     36     4   digest
+   \endverbatim
+ *
+ * A context record is followed by the context string, padded with zeros to
+ * a multiple of 8 bytes.
+ */
+class BinaryTraceFile : public SimpleRefCount<BinaryTraceFile>
+{
+public:
+  /**
+   * \brief Types of the traced events, as they appear in ascii traces.
+   */
+  enum EventType
+  {
+    ENQUEUE = '+',  //!< packet enqueued for transmission
+    DEQUEUE = '-',  //!< packet dequeued for transmission
+    RECEIVE = 'r',  //!< packet received
+    DROP = 'd',     //!< packet dropped
+    CONTEXT = 'C'   //!< definition of a trace context
+  };
+
+  /**
+   * \brief A record read back from the file.
+   */
+  struct Record
+  {
+    uint8_t m_type;       //!< event type, one of EventType
+    uint8_t m_flags;      //!< DIGEST_VALID if m_digest is set
+    uint32_t m_context;   //!< index of the trace context, or UNKNOWN
+    uint32_t m_nodeId;    //!< node id, or UNKNOWN
+    uint32_t m_deviceId;  //!< device index on the node, or UNKNOWN
+    int64_t m_timestamp;  //!< timestamp, in the resolution of the file
+    uint64_t m_uid;       //!< packet uid
+    uint32_t m_size;      //!< packet size
+    uint32_t m_digest;    //!< digest of the leading packet bytes
+  };
+
+  static const uint32_t UNKNOWN = 0xffffffff;  //!< Missing context, node or device
+  static const uint8_t DIGEST_VALID = 0x1;     //!< Record flag: digest is set
+  static const uint32_t RECORD_SIZE = 40;      //!< Size of a record in the file
+  static const uint32_t DIGEST_BYTES = 64;     //!< Number of packet bytes hashed into the digest
+
+  BinaryTraceFile ();
+  ~BinaryTraceFile ();
+
+  /**
+   * \brief Batch the records written to the file in memory.
+   *
+   * Must be called before Open ().  See PcapFile::SetWriteBuffer.
+   *
+   * \param size Size of the buffer in bytes; zero writes every record
+   * straight to the stream.
+   * \param asyncFlush If true, full buffers are written by a background
+   * thread.
+   */
+  void SetWriteBuffer (uint32_t size, bool asyncFlush = false);
+
+  /**
+   * \brief Enable the digest of the leading packet bytes.
+   *
+   * Computing the digest serializes the first DIGEST_BYTES bytes of every
+   * packet, so it is off by default.
+   *
+   * \param enable Whether the digests are computed.
+   */
+  void SetHeaderDigests (bool enable);
+
+  /**
+   * \brief Open a file for writing, writing its header, or for reading,
+   * verifying its header.
+   *
+   * \param filename Name of the file.
+   * \param mode std::ios::out or std::ios::in.
+   */
+  void Open (std::string const &filename, std::ios::openmode mode);
+
+  /**
+   * \brief Write all buffered records and close the file.
+   */
+  void Close (void);
+
+  /**
+   * \brief Write all buffered records to the file.
+   */
+  void Flush (void);
+
+  /**
+   * \return true if the file could not be opened, is invalid, or could not
+   * be written.
+   */
+  bool Fail (void) const;
+
+  /**
+   * \brief Write an event record.
+   *
+   * \param t Time of the event.
+   * \param type Type of the event.
+   * \param context Trace context of the event; empty if unknown.
+   * \param p The packet.
+   */
+  void Write (Time t, EventType type, std::string const &context, Ptr<const Packet> p);
+
+  /**
+   * \brief Read the next event record.
+   *
+   * Context records are consumed transparently; the context strings are
+   * available through GetContext ().
+   *
+   * \param record [out] The record.
+   * \returns false at the end of the file or on error
+   */
+  bool Read (Record &record);
+
+  /**
+   * \param context A context index read from an event record.
+   * \returns the context string, empty if unknown
+   */
+  std::string GetContext (uint32_t context) const;
+
+  /**
+   * \param record An event record read from the file.
+   * \returns the time of the event
+   */
+  Time GetTime (Record const &record) const;
+
+  /**
+   * \brief Convert a binary trace file to the classic ascii trace layout.
+   *
+   * Each event becomes a line "<type> <seconds> [<context> ]<packet>",
+   * where the packet column holds "uid=<uid> size=<size>" and, if
+   * available, "digest=<hex digest>".
+   *
+   * \param filename Name of the binary trace file.
+   * \param os Stream the ascii trace is written to.
+   * \returns false if the file could not be read
+   */
+  static bool ConvertToAscii (std::string const &filename, std::ostream &os);
+
+private:
+  /**
+   * \brief Properties of a trace context written to the file.
+   */
+  struct ContextInfo
+  {
+    uint32_t m_index;     //!< index of the context in the file
+    uint32_t m_nodeId;    //!< node id found in the context
+    uint32_t m_deviceId;  //!< device index found in the context
+  };
+
+  /**
+   * \brief Look up a context, writing its context record if it is new.
+   * \param context The context string.
+   * \returns the properties of the context
+   */
+  ContextInfo const & InternContext (std::string const &context);
+
+  /**
+   * \brief Serialize a record.
+   * \param record The record.
+   * \param out Where to store its RECORD_SIZE bytes.
+   */
+  static void SerializeRecord (Record const &record, uint8_t *out);
+
+  /**
+   * \brief Write bytes to the file, through the write buffer if enabled.
+   * \param data The bytes.
+   * \param size The number of bytes.
+   */
+  void WriteBytes (uint8_t const *data, uint32_t size);
+
+  std::fstream m_file;                      //!< file stream
+  PcapWriteBuffer m_writeBuffer;            //!< batches records on their way to m_file
+  uint32_t m_writeBufferSize;               //!< size of the write buffer, zero if disabled
+  bool m_asyncFlush;                        //!< write buffer uses a flush thread
+  bool m_headerDigests;                     //!< compute digests of the leading packet bytes
+  enum Time::Unit m_resolution;             //!< time resolution of the timestamps
+  std::unordered_map<std::string, ContextInfo> m_contextIndex;  //!< contexts written so far
+  std::vector<std::string> m_contexts;      //!< contexts read so far, by index
+};
+
+} // namespace ns3
+
+#endif /* BINARY_TRACE_FILE_H */
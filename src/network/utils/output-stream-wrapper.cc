@@ -46,6 +46,15 @@ OutputStreamWrapper::OutputStreamWrapper (std::ostream* os)
   NS_ABORT_MSG_UNLESS (m_ostream->good (), "Output stream is not valid for writing.");
 }
 
+OutputStreamWrapper::OutputStreamWrapper (Ptr<BinaryTraceFile> file)
+  : m_ostream (new std::ostream (0)),
+    m_destroyable (true),
+    m_binaryTraceFile (file)
+{
+  NS_LOG_FUNCTION (this << file);
+  NS_ABORT_MSG_IF (file == 0 || file->Fail (), "Binary trace file is not valid for writing.");
+}
+
 OutputStreamWrapper::~OutputStreamWrapper ()
 {
   NS_LOG_FUNCTION (this);
@@ -61,4 +70,10 @@ OutputStreamWrapper::GetStream (void)
   return m_ostream;
 }
 
+Ptr<BinaryTraceFile>
+OutputStreamWrapper::GetBinaryTraceFile (void) const
+{
+  return m_binaryTraceFile;
+}
+
 } // namespace ns3
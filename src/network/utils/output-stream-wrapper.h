@@ -23,6 +23,7 @@
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 #include "ns3/simple-ref-count.h"
+#include "binary-trace-file.h"
 
 namespace ns3 {
 
@@ -81,6 +82,16 @@ public:
    * \param os output stream
    */
   OutputStreamWrapper (std::ostream* os);
+  /**
+   * Constructor
+   *
+   * The default ascii trace sinks of AsciiTraceHelper write their events
+   * to the binary trace file instead of the stream.  The stream returned by
+   * GetStream discards anything written to it.
+   *
+   * \param file binary trace file
+   */
+  OutputStreamWrapper (Ptr<BinaryTraceFile> file);
   ~OutputStreamWrapper ();
 
   /**
@@ -92,9 +103,16 @@ public:
    */
   std::ostream *GetStream (void);
 
+  /**
+   * \returns the binary trace file the default ascii trace sinks write to,
+   * or 0 if they write text to the stream
+   */
+  Ptr<BinaryTraceFile> GetBinaryTraceFile (void) const;
+
 private:
   std::ostream *m_ostream; //!< The output stream
   bool m_destroyable; //!< Can be destroyed
+  Ptr<BinaryTraceFile> m_binaryTraceFile; //!< The binary trace file, if any
 };
 
 } // namespace ns3
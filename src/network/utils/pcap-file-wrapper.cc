@@ -19,6 +19,7 @@
 #include "ns3/log.h"
 #include "ns3/boolean.h"
 #include "ns3/uinteger.h"
+#include "ns3/string.h"
 #include "ns3/buffer.h"
 #include "ns3/header.h"
 #include "pcap-file-wrapper.h"
@@ -46,12 +47,30 @@ PcapFileWrapper::GetTypeId (void)
                    BooleanValue (false),
                    MakeBooleanAccessor (&PcapFileWrapper::m_nanosecMode),
                    MakeBooleanChecker())
+    .AddAttribute ("WriteBufferSize",
+                   "Size in bytes of the buffer batching the records written to the file. "
+                   "Zero writes every record straight to the file.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&PcapFileWrapper::m_writeBufferSize),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("AsyncFlush",
+                   "Whether full write buffers are written to the file by a background thread.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&PcapFileWrapper::m_asyncFlush),
+                   MakeBooleanChecker ())
+    .AddAttribute ("PcapNgFile",
+                   "If not empty, the packets are written as one interface of this shared "
+                   "pcapng file instead of to the file passed to Open.",
+                   StringValue (""),
+                   MakeStringAccessor (&PcapFileWrapper::m_pcapNgFilename),
+                   MakeStringChecker ())
   ;
   return tid;
 }
 
 
 PcapFileWrapper::PcapFileWrapper ()
+  : m_pcapNgInterface (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -66,6 +85,10 @@ bool
 PcapFileWrapper::Fail (void) const
 {
   NS_LOG_FUNCTION (this);
+  if (m_pcapNgFile)
+    {
+      return m_pcapNgFile->Fail ();
+    }
   return m_file.Fail ();
 }
 
@@ -73,6 +96,10 @@ bool
 PcapFileWrapper::Eof (void) const
 {
   NS_LOG_FUNCTION (this);
+  if (m_pcapNgFile)
+    {
+      return false;
+    }
   return m_file.Eof ();
 }
 void 
@@ -86,13 +113,35 @@ void
 PcapFileWrapper::Close (void)
 {
   NS_LOG_FUNCTION (this);
+  m_pcapNgFile = 0;
   m_file.Close ();
 }
 
+void
+PcapFileWrapper::Flush (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_pcapNgFile)
+    {
+      m_pcapNgFile->Flush ();
+    }
+  else
+    {
+      m_file.Flush ();
+    }
+}
+
 void
 PcapFileWrapper::Open (std::string const &filename, std::ios::openmode mode)
 {
   NS_LOG_FUNCTION (this << filename << mode);
+  if (!m_pcapNgFilename.empty () && !(mode & std::ios::in))
+    {
+      m_interfaceName = filename;
+      m_pcapNgFile = PcapNgFile::GetShared (m_pcapNgFilename, m_writeBufferSize, m_asyncFlush);
+      return;
+    }
+  m_file.SetWriteBuffer (m_writeBufferSize, m_asyncFlush);
   m_file.Open (filename, mode);
 }
 
@@ -105,6 +154,13 @@ PcapFileWrapper::Init (uint32_t dataLinkType, uint32_t snapLen, int32_t tzCorrec
   // a snaplen, we use the one provided.
   //
   NS_LOG_FUNCTION (this << dataLinkType << snapLen << tzCorrection);
+  if (m_pcapNgFile)
+    {
+      // pcapng has no time zone field; timestamps are always UTC.
+      uint32_t len = snapLen != std::numeric_limits<uint32_t>::max () ? snapLen : m_snapLen;
+      m_pcapNgInterface = m_pcapNgFile->AddInterface (dataLinkType, len, m_interfaceName, m_nanosecMode);
+      return;
+    }
   if (snapLen != std::numeric_limits<uint32_t>::max ())
     {
       m_file.Init (dataLinkType, snapLen, tzCorrection, false, m_nanosecMode);
@@ -119,6 +175,11 @@ void
 PcapFileWrapper::Write (Time t, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (this << t << p);
+  if (m_pcapNgFile)
+    {
+      m_pcapNgFile->Write (m_pcapNgInterface, GetPcapNgTimestamp (t), p);
+      return;
+    }
   if (m_file.IsNanoSecMode())
     {
       uint64_t current = t.GetNanoSeconds ();
@@ -139,6 +200,11 @@ void
 PcapFileWrapper::Write (Time t, const Header &header, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (this << t << &header << p);
+  if (m_pcapNgFile)
+    {
+      m_pcapNgFile->Write (m_pcapNgInterface, GetPcapNgTimestamp (t), header, p);
+      return;
+    }
   if (m_file.IsNanoSecMode())
     {
       uint64_t current = t.GetNanoSeconds ();
@@ -159,6 +225,11 @@ void
 PcapFileWrapper::Write (Time t, uint8_t const *buffer, uint32_t length)
 {
   NS_LOG_FUNCTION (this << t << &buffer << length);
+  if (m_pcapNgFile)
+    {
+      m_pcapNgFile->Write (m_pcapNgInterface, GetPcapNgTimestamp (t), buffer, length);
+      return;
+    }
   if (m_file.IsNanoSecMode())
     {
       uint64_t current = t.GetNanoSeconds ();
@@ -175,9 +246,20 @@ PcapFileWrapper::Write (Time t, uint8_t const *buffer, uint32_t length)
     }
 }
 
+uint64_t
+PcapFileWrapper::GetPcapNgTimestamp (Time t) const
+{
+  if (m_pcapNgFile->IsNanoSecMode (m_pcapNgInterface))
+    {
+      return t.GetNanoSeconds ();
+    }
+  return t.GetMicroSeconds ();
+}
+
 Ptr<Packet> 
 PcapFileWrapper::Read (Time &t)
 {
+  NS_ASSERT_MSG (m_pcapNgFile == 0, "pcapng files are write-only");
   uint32_t tsSec;
   uint32_t tsUsec;
   uint32_t inclLen;
@@ -245,6 +327,10 @@ uint32_t
 PcapFileWrapper::GetSnapLen (void)
 {
   NS_LOG_FUNCTION (this);
+  if (m_pcapNgFile)
+    {
+      return m_pcapNgFile->GetSnapLen (m_pcapNgInterface);
+    }
   return m_file.GetSnapLen ();
 }
 
@@ -252,6 +338,10 @@ uint32_t
 PcapFileWrapper::GetDataLinkType (void)
 {
   NS_LOG_FUNCTION (this);
+  if (m_pcapNgFile)
+    {
+      return m_pcapNgFile->GetDataLinkType (m_pcapNgInterface);
+    }
   return m_file.GetDataLinkType ();
 }
 
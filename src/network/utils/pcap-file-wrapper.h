@@ -27,6 +27,7 @@
 #include "ns3/object.h"
 #include "ns3/nstime.h"
 #include "pcap-file.h"
+#include "pcapng-file.h"
 
 namespace ns3 {
 
@@ -35,6 +36,15 @@ namespace ns3 {
  * ns-3 interface to the low-level public methods of PcapFile.  Users are
  * encouraged to use this object instead of class ns3::PcapFile in ns-3
  * public APIs.
+ *
+ * Tracing many devices to pcap files costs a stream write per record field
+ * on the simulation thread.  The "WriteBufferSize" and "AsyncFlush"
+ * attributes batch the records in memory and optionally hand the batches to
+ * a background thread.  The "PcapNgFile" attribute redirects the wrappers
+ * opened for writing into a single shared pcapng file, where each wrapper
+ * becomes one interface named after the file name it was opened with.
+ * Since PcapHelper creates its wrappers through the attribute system, all of
+ * these can be enabled for the device helpers with Config::SetDefault.
  */
 class PcapFileWrapper : public Object
 {
@@ -220,10 +230,28 @@ public:
    */ 
   uint32_t GetDataLinkType (void);
 
+  /**
+   * \brief Write all buffered records to the file.
+   */
+  void Flush (void);
+
 private:
+  /**
+   * \brief Convert a timestamp to the resolution of the pcapng interface.
+   * \param t The timestamp.
+   * \returns the timestamp in micro- or nanoseconds
+   */
+  uint64_t GetPcapNgTimestamp (Time t) const;
+
   PcapFile m_file; //!< Pcap file
   uint32_t m_snapLen; //!< max length of saved packets
   bool     m_nanosecMode; //!< Timestamps in nanosecond mode
+  uint32_t m_writeBufferSize; //!< Size of the record write buffer
+  bool     m_asyncFlush; //!< Write buffers are flushed by a background thread
+  std::string m_pcapNgFilename; //!< Shared pcapng file to write to, if not empty
+  std::string m_interfaceName; //!< Name of the pcapng interface of this wrapper
+  Ptr<PcapNgFile> m_pcapNgFile; //!< Shared pcapng file, if written to
+  uint32_t m_pcapNgInterface; //!< Interface of this wrapper in the pcapng file
 };
 
 } // namespace ns3
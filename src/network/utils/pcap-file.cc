@@ -50,7 +50,9 @@ const uint16_t VERSION_MINOR = 4;             /**< Minor version of supported pc
 PcapFile::PcapFile ()
   : m_file (),
     m_swapMode (false),
-    m_nanosecMode (false)
+    m_nanosecMode (false),
+    m_writeBufferSize (0),
+    m_asyncFlush (false)
 {
   NS_LOG_FUNCTION (this);
   FatalImpl::RegisterStream (&m_file);
@@ -68,7 +70,12 @@ bool
 PcapFile::Fail (void) const
 {
   NS_LOG_FUNCTION (this);
-  return m_file.fail ();
+  if (m_asyncFlush && m_writeBuffer.IsEnabled ())
+    {
+      // The stream state belongs to the flush thread.
+      return m_writeBuffer.Failed ();
+    }
+  return m_file.fail () || m_writeBuffer.Failed ();
 }
 bool
 PcapFile::Eof (void) const
@@ -88,9 +95,32 @@ void
 PcapFile::Close (void)
 {
   NS_LOG_FUNCTION (this);
+  m_writeBuffer.Detach ();
   m_file.close ();
 }
 
+void
+PcapFile::SetWriteBuffer (uint32_t size, bool asyncFlush)
+{
+  NS_LOG_FUNCTION (this << size << asyncFlush);
+  m_writeBufferSize = size;
+  m_asyncFlush = asyncFlush;
+}
+
+void
+PcapFile::Flush (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_writeBuffer.IsEnabled ())
+    {
+      m_writeBuffer.Flush ();
+    }
+  else
+    {
+      m_file.flush ();
+    }
+}
+
 uint32_t
 PcapFile::GetMagic (void)
 {
@@ -204,8 +234,10 @@ PcapFile::WriteFileHeader (void)
   NS_LOG_FUNCTION (this);
   //
   // If we're initializing the file, we need to write the pcap file header
-  // at the start of the file.
+  // at the start of the file.  Anything still sitting in the write buffer
+  // has to reach the file first.
   //
+  m_writeBuffer.Flush ();
   m_file.seekp (0, std::ios::beg);
 
   //
@@ -339,6 +371,10 @@ PcapFile::Open (std::string const &filename, std::ios::openmode mode)
       // will set the fail bit if file header is invalid.
       ReadAndVerifyFileHeader ();
     }
+  else if (m_file.is_open ())
+    {
+      m_writeBuffer.Attach (&m_file, m_writeBufferSize, m_asyncFlush);
+    }
 }
 
 void
@@ -430,10 +466,47 @@ PcapFile::WritePacketHeader (uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen)
   return inclLen;
 }
 
+uint8_t *
+PcapFile::ReserveRecord (uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen, uint32_t &inclLen)
+{
+  NS_LOG_FUNCTION (this << tsSec << tsUsec << totalLen);
+  inclLen = totalLen > m_fileHeader.m_snapLen ? m_fileHeader.m_snapLen : totalLen;
+
+  PcapRecordHeader header;
+  header.m_tsSec = tsSec;
+  header.m_tsUsec = tsUsec;
+  header.m_inclLen = inclLen;
+  header.m_origLen = totalLen;
+
+  if (m_swapMode)
+    {
+      Swap (&header, &header);
+    }
+
+  //
+  // The record header and the packet data go to the buffer in one piece;
+  // the fields are copied individually to stay independent of the struct
+  // layout.
+  //
+  uint8_t *out = m_writeBuffer.Reserve (4 * sizeof (uint32_t) + inclLen);
+  std::memcpy (out, &header.m_tsSec, sizeof (header.m_tsSec));
+  std::memcpy (out + 4, &header.m_tsUsec, sizeof (header.m_tsUsec));
+  std::memcpy (out + 8, &header.m_inclLen, sizeof (header.m_inclLen));
+  std::memcpy (out + 12, &header.m_origLen, sizeof (header.m_origLen));
+  return out + 16;
+}
+
 void
 PcapFile::Write (uint32_t tsSec, uint32_t tsUsec, uint8_t const * const data, uint32_t totalLen)
 {
   NS_LOG_FUNCTION (this << tsSec << tsUsec << &data << totalLen);
+  if (m_writeBuffer.IsEnabled ())
+    {
+      uint32_t inclLen;
+      uint8_t *out = ReserveRecord (tsSec, tsUsec, totalLen, inclLen);
+      std::memcpy (out, data, inclLen);
+      return;
+    }
   uint32_t inclLen = WritePacketHeader (tsSec, tsUsec, totalLen);
   m_file.write ((const char *)data, inclLen);
   NS_BUILD_DEBUG(m_file.flush());
@@ -443,6 +516,14 @@ void
 PcapFile::Write (uint32_t tsSec, uint32_t tsUsec, Ptr<const Packet> p)
 {
   NS_LOG_FUNCTION (this << tsSec << tsUsec << p);
+  if (m_writeBuffer.IsEnabled ())
+    {
+      // Only the bytes below the snap length are serialized.
+      uint32_t inclLen;
+      uint8_t *out = ReserveRecord (tsSec, tsUsec, p->GetSize (), inclLen);
+      p->CopyData (out, inclLen);
+      return;
+    }
   uint32_t inclLen = WritePacketHeader (tsSec, tsUsec, p->GetSize ());
   p->CopyData (&m_file, inclLen);
   NS_BUILD_DEBUG(m_file.flush());
@@ -454,11 +535,22 @@ PcapFile::Write (uint32_t tsSec, uint32_t tsUsec, const Header &header, Ptr<cons
   NS_LOG_FUNCTION (this << tsSec << tsUsec << &header << p);
   uint32_t headerSize = header.GetSerializedSize ();
   uint32_t totalSize = headerSize + p->GetSize ();
-  uint32_t inclLen = WritePacketHeader (tsSec, tsUsec, totalSize);
 
   Buffer headerBuffer;
   headerBuffer.AddAtStart (headerSize);
   header.Serialize (headerBuffer.Begin ());
+
+  if (m_writeBuffer.IsEnabled ())
+    {
+      uint32_t inclLen;
+      uint8_t *out = ReserveRecord (tsSec, tsUsec, totalSize, inclLen);
+      uint32_t toCopy = std::min (headerSize, inclLen);
+      headerBuffer.CopyData (out, toCopy);
+      p->CopyData (out + toCopy, inclLen - toCopy);
+      return;
+    }
+
+  uint32_t inclLen = WritePacketHeader (tsSec, tsUsec, totalSize);
   uint32_t toCopy = std::min (headerSize, inclLen);
   headerBuffer.CopyData (&m_file, toCopy);
   inclLen -= toCopy;
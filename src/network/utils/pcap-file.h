@@ -25,6 +25,7 @@
 #include <fstream>
 #include <stdint.h>
 #include "ns3/ptr.h"
+#include "pcap-write-buffer.h"
 
 namespace ns3 {
 
@@ -85,6 +86,29 @@ public:
    */
   void Close (void);
 
+  /**
+   * \brief Batch the records written to the file in memory.
+   *
+   * Instead of issuing one stream write per record field, records are
+   * serialized into a buffer of the given size, which is written to the
+   * file when it is full, on Flush () and on Close ().  Packet bytes beyond
+   * the snap length are never serialized.  Reading is not affected.
+   *
+   * The setting applies to the files subsequently opened for writing
+   * with Open ().
+   *
+   * \param size Size of the buffer in bytes; zero (the default) writes
+   * every record straight to the stream.
+   * \param asyncFlush If true, full buffers are written to the file by a
+   * background thread while the caller keeps on filling a second buffer.
+   */
+  void SetWriteBuffer (uint32_t size, bool asyncFlush = false);
+
+  /**
+   * \brief Write all buffered records to the file.
+   */
+  void Flush (void);
+
   /**
    * Initialize the pcap file associated with this object.  This file must have
    * been previously opened with write permissions.
@@ -359,6 +383,18 @@ private:
    */
   uint32_t WritePacketHeader (uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen);
 
+  /**
+   * \brief Reserve room for a whole record in the write buffer and fill
+   * in its record header
+   *
+   * \param tsSec Time stamp (seconds part)
+   * \param tsUsec Time stamp (microseconds part)
+   * \param totalLen total packet length
+   * \param inclLen [out] the length of the packet to write in the Pcap file
+   * \returns a pointer to the inclLen bytes of packet data to fill in
+   */
+  uint8_t * ReserveRecord (uint32_t tsSec, uint32_t tsUsec, uint32_t totalLen, uint32_t &inclLen);
+
   /**
    * \brief Read and verify a Pcap file header
    */
@@ -369,6 +405,9 @@ private:
   PcapFileHeader m_fileHeader;  //!< file header
   bool m_swapMode;              //!< swap mode
   bool m_nanosecMode;           //!< nanosecond timestamp mode
+  PcapWriteBuffer m_writeBuffer; //!< batches records on their way to m_file
+  uint32_t m_writeBufferSize;   //!< size of the write buffer, zero if disabled
+  bool m_asyncFlush;            //!< write buffer uses a flush thread
 };
 
 } // namespace ns3
@@ -0,0 +1,201 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cstring>
+#include "ns3/assert.h"
+#include "ns3/log.h"
+#include "pcap-write-buffer.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("PcapWriteBuffer");
+
+PcapWriteBuffer::PcapWriteBuffer ()
+  : m_os (0),
+    m_capacity (0),
+    m_async (false),
+    m_stop (false),
+    m_failed (false)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+PcapWriteBuffer::~PcapWriteBuffer ()
+{
+  NS_LOG_FUNCTION (this);
+  Detach ();
+}
+
+void
+PcapWriteBuffer::Attach (std::ostream *os, uint32_t capacity, bool async)
+{
+  NS_LOG_FUNCTION (this << os << capacity << async);
+  Detach ();
+  if (capacity == 0)
+    {
+      return;
+    }
+  m_os = os;
+  m_capacity = capacity;
+  m_async = async;
+  m_failed = false;
+  m_active.reserve (capacity);
+  if (m_async)
+    {
+      m_pending.reserve (capacity);
+      m_stop = false;
+      m_thread = std::thread (&PcapWriteBuffer::FlushThread, this);
+    }
+}
+
+void
+PcapWriteBuffer::Detach (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_os == 0)
+    {
+      return;
+    }
+  Flush ();
+  if (m_async)
+    {
+      {
+        std::unique_lock<std::mutex> lock (m_mutex);
+        m_stop = true;
+      }
+      m_cv.notify_all ();
+      m_thread.join ();
+    }
+  m_os = 0;
+  m_capacity = 0;
+  m_async = false;
+  std::vector<uint8_t> ().swap (m_active);
+  std::vector<uint8_t> ().swap (m_pending);
+}
+
+bool
+PcapWriteBuffer::IsEnabled (void) const
+{
+  return m_os != 0;
+}
+
+uint8_t *
+PcapWriteBuffer::Reserve (uint32_t size)
+{
+  NS_ASSERT (m_os != 0);
+  if (!m_active.empty () && m_active.size () + size > m_capacity)
+    {
+      Submit ();
+    }
+  std::size_t offset = m_active.size ();
+  m_active.resize (offset + size);
+  return m_active.data () + offset;
+}
+
+void
+PcapWriteBuffer::Append (void const *data, uint32_t size)
+{
+  std::memcpy (Reserve (size), data, size);
+}
+
+void
+PcapWriteBuffer::Flush (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_os == 0)
+    {
+      return;
+    }
+  if (!m_active.empty ())
+    {
+      Submit ();
+    }
+  if (m_async)
+    {
+      std::unique_lock<std::mutex> lock (m_mutex);
+      WaitIdle (lock);
+    }
+  m_os->flush ();
+  if (m_os->fail ())
+    {
+      m_failed = true;
+    }
+}
+
+bool
+PcapWriteBuffer::Failed (void) const
+{
+  return m_failed;
+}
+
+void
+PcapWriteBuffer::Submit (void)
+{
+  NS_LOG_FUNCTION (this << m_active.size ());
+  if (!m_async)
+    {
+      m_os->write (reinterpret_cast<const char *> (m_active.data ()), m_active.size ());
+      if (m_os->fail ())
+        {
+          m_failed = true;
+        }
+      m_active.clear ();
+      return;
+    }
+
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+    WaitIdle (lock);
+    m_active.swap (m_pending);
+  }
+  m_cv.notify_all ();
+  // m_active now holds the storage of the batch written last time around.
+  m_active.clear ();
+}
+
+void
+PcapWriteBuffer::WaitIdle (std::unique_lock<std::mutex> &lock)
+{
+  m_cv.wait (lock, [this] { return m_pending.empty (); });
+}
+
+void
+PcapWriteBuffer::FlushThread (void)
+{
+  std::unique_lock<std::mutex> lock (m_mutex);
+  while (true)
+    {
+      m_cv.wait (lock, [this] { return m_stop || !m_pending.empty (); });
+      if (m_pending.empty ())
+        {
+          // m_stop is set and there is nothing left to write.
+          return;
+        }
+      // The simulation thread does not touch m_pending while it is not
+      // empty, so the batch can be written without holding the lock.
+      lock.unlock ();
+      m_os->write (reinterpret_cast<const char *> (m_pending.data ()), m_pending.size ());
+      if (m_os->fail ())
+        {
+          m_failed = true;
+        }
+      lock.lock ();
+      m_pending.clear ();
+      m_cv.notify_all ();
+    }
+}
+
+} // namespace ns3
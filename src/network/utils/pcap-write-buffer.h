@@ -0,0 +1,141 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef PCAP_WRITE_BUFFER_H
+#define PCAP_WRITE_BUFFER_H
+
+#include <ostream>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <stdint.h>
+
+namespace ns3 {
+
+/**
+ * \ingroup network
+ *
+ * \brief A batching write buffer for the trace file writers.
+ *
+ * Records are serialized into a large in-memory buffer which is handed to
+ * the underlying stream only once it fills up, replacing one stream write
+ * per record field with one large write per batch.  Optionally the batches
+ * are written out by a background thread, so that the simulation thread
+ * only pays for the serialization into memory.
+ *
+ * In asynchronous mode two buffers are used: while the flush thread writes
+ * one of them out, the simulation thread fills the other one.  The
+ * simulation thread blocks only if it fills its buffer before the flush
+ * thread is done with the previous one.
+ *
+ * Data still held in the buffers when the simulation aborts through
+ * NS_FATAL_ERROR is lost; call Flush () at the points where the file
+ * content must be complete.
+ */
+class PcapWriteBuffer
+{
+public:
+  PcapWriteBuffer ();
+  ~PcapWriteBuffer ();
+
+  /**
+   * \brief Start buffering writes to a stream.
+   *
+   * \param os The stream the batches are written to.  It must outlive the
+   *        buffer or a subsequent call to Detach ().
+   * \param capacity Size of the buffer in bytes.  Zero disables buffering.
+   * \param async Whether the batches are written by a background thread.
+   */
+  void Attach (std::ostream *os, uint32_t capacity, bool async);
+
+  /**
+   * \brief Write out all buffered data and stop the flush thread, if any.
+   */
+  void Detach (void);
+
+  /**
+   * \return true if the buffer is attached to a stream.
+   */
+  bool IsEnabled (void) const;
+
+  /**
+   * \brief Reserve room at the end of the buffer.
+   *
+   * The returned memory must be filled by the caller before any other
+   * method of this object is invoked.  Records larger than the capacity
+   * temporarily grow the buffer.
+   *
+   * \param size Number of bytes to reserve.
+   * \returns a pointer to the reserved bytes.
+   */
+  uint8_t * Reserve (uint32_t size);
+
+  /**
+   * \brief Append data to the end of the buffer.
+   *
+   * \param data The data to append.
+   * \param size Number of bytes to append.
+   */
+  void Append (void const *data, uint32_t size);
+
+  /**
+   * \brief Write out all buffered data and flush the underlying stream.
+   *
+   * Blocks until the flush thread, if any, has written everything.
+   */
+  void Flush (void);
+
+  /**
+   * \return true if writing a batch to the underlying stream failed.
+   */
+  bool Failed (void) const;
+
+private:
+  /**
+   * \brief Hand the buffer filled by the simulation thread over to the
+   * writer: either write it out directly, or pass it to the flush thread.
+   */
+  void Submit (void);
+
+  /**
+   * \brief Wait until the flush thread has no batch in progress.
+   *
+   * \param lock The held lock on m_mutex.
+   */
+  void WaitIdle (std::unique_lock<std::mutex> &lock);
+
+  /**
+   * \brief Main loop of the flush thread.
+   */
+  void FlushThread (void);
+
+  std::ostream *m_os;              //!< stream the batches are written to
+  uint32_t m_capacity;             //!< buffer size that triggers a batch write
+  bool m_async;                    //!< whether a flush thread is used
+  std::vector<uint8_t> m_active;   //!< buffer filled by the simulation thread
+  std::vector<uint8_t> m_pending;  //!< batch being written by the flush thread
+  std::thread m_thread;            //!< the flush thread
+  std::mutex m_mutex;              //!< protects m_pending and m_stop
+  std::condition_variable m_cv;    //!< signals batch hand-over and completion
+  bool m_stop;                     //!< asks the flush thread to terminate
+  std::atomic<bool> m_failed;      //!< a batch write failed
+};
+
+} // namespace ns3
+
+#endif /* PCAP_WRITE_BUFFER_H */
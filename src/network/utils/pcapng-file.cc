@@ -0,0 +1,325 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cstring>
+#include <map>
+#include "ns3/assert.h"
+#include "ns3/log.h"
+#include "ns3/packet.h"
+#include "ns3/header.h"
+#include "ns3/buffer.h"
+#include "ns3/fatal-impl.h"
+#include "pcapng-file.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("PcapNgFile");
+
+namespace {
+
+const uint32_t SECTION_HEADER_BLOCK = 0x0A0D0D0A;     //!< Section Header Block type
+const uint32_t INTERFACE_DESCRIPTION_BLOCK = 0x1;     //!< Interface Description Block type
+const uint32_t ENHANCED_PACKET_BLOCK = 0x6;           //!< Enhanced Packet Block type
+const uint32_t BYTE_ORDER_MAGIC = 0x1A2B3C4D;         //!< Section Header Block byte-order magic
+const uint16_t VERSION_MAJOR = 1;                     //!< Major version of the pcapng format
+const uint16_t VERSION_MINOR = 0;                     //!< Minor version of the pcapng format
+const uint16_t OPT_ENDOFOPT = 0;                      //!< End of options option code
+const uint16_t IF_NAME = 2;                           //!< if_name option code
+const uint16_t IF_TSRESOL = 9;                        //!< if_tsresol option code
+const uint32_t EPB_FIXED_SIZE = 32;                   //!< Enhanced Packet Block size without data
+
+/**
+ * \param len A length in bytes.
+ * \returns the length rounded up to the 32-bit boundary pcapng blocks and
+ * options are aligned on
+ */
+uint32_t
+Pad4 (uint32_t len)
+{
+  return (len + 3) & ~3U;
+}
+
+/**
+ * \brief Store a value in host byte order.
+ * \param out Where to store the value.
+ * \param val The value.
+ * \returns a pointer past the stored value
+ */
+template <typename T>
+uint8_t *
+Put (uint8_t *out, T val)
+{
+  std::memcpy (out, &val, sizeof (val));
+  return out + sizeof (val);
+}
+
+/**
+ * \returns the pcapng files currently shared through PcapNgFile::GetShared,
+ * by file name
+ */
+std::map<std::string, PcapNgFile *> &
+SharedFiles (void)
+{
+  static std::map<std::string, PcapNgFile *> files;
+  return files;
+}
+
+} // unnamed namespace
+
+PcapNgFile::PcapNgFile ()
+{
+  NS_LOG_FUNCTION (this);
+  FatalImpl::RegisterStream (&m_file);
+}
+
+PcapNgFile::~PcapNgFile ()
+{
+  NS_LOG_FUNCTION (this);
+  std::map<std::string, PcapNgFile *>::iterator it = SharedFiles ().find (m_filename);
+  if (it != SharedFiles ().end () && it->second == this)
+    {
+      SharedFiles ().erase (it);
+    }
+  FatalImpl::UnregisterStream (&m_file);
+  Close ();
+}
+
+Ptr<PcapNgFile>
+PcapNgFile::GetShared (std::string const &filename, uint32_t bufferSize, bool asyncFlush)
+{
+  NS_LOG_FUNCTION (filename << bufferSize << asyncFlush);
+  std::map<std::string, PcapNgFile *>::iterator it = SharedFiles ().find (filename);
+  if (it != SharedFiles ().end ())
+    {
+      return Ptr<PcapNgFile> (it->second);
+    }
+  Ptr<PcapNgFile> file = Create<PcapNgFile> ();
+  file->Open (filename, bufferSize, asyncFlush);
+  SharedFiles ()[filename] = PeekPointer (file);
+  return file;
+}
+
+bool
+PcapNgFile::Fail (void) const
+{
+  NS_LOG_FUNCTION (this);
+  if (m_writeBuffer.IsEnabled ())
+    {
+      return m_writeBuffer.Failed ();
+    }
+  return m_file.fail ();
+}
+
+void
+PcapNgFile::Open (std::string const &filename, uint32_t bufferSize, bool asyncFlush)
+{
+  NS_LOG_FUNCTION (this << filename << bufferSize << asyncFlush);
+  NS_ASSERT (!m_file.is_open ());
+  m_filename = filename;
+  m_interfaces.clear ();
+  m_file.open (filename.c_str (), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!m_file.is_open ())
+    {
+      return;
+    }
+  m_writeBuffer.Attach (&m_file, bufferSize, asyncFlush);
+
+  uint8_t *out = BeginBlock (28);
+  out = Put (out, SECTION_HEADER_BLOCK);
+  out = Put (out, uint32_t (28));
+  out = Put (out, BYTE_ORDER_MAGIC);
+  out = Put (out, VERSION_MAJOR);
+  out = Put (out, VERSION_MINOR);
+  out = Put (out, int64_t (-1));  // section length not specified
+  Put (out, uint32_t (28));
+  EndBlock ();
+}
+
+void
+PcapNgFile::Close (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_writeBuffer.Detach ();
+  m_file.close ();
+}
+
+void
+PcapNgFile::Flush (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_writeBuffer.IsEnabled ())
+    {
+      m_writeBuffer.Flush ();
+    }
+  else
+    {
+      m_file.flush ();
+    }
+}
+
+uint32_t
+PcapNgFile::AddInterface (uint32_t dataLinkType, uint32_t snapLen,
+                          std::string const &name, bool nanosecMode)
+{
+  NS_LOG_FUNCTION (this << dataLinkType << snapLen << name << nanosecMode);
+  NS_ASSERT_MSG (dataLinkType <= 0xffff, "pcapng link types are 16 bits wide");
+
+  Interface iface;
+  iface.m_dataLinkType = dataLinkType;
+  iface.m_snapLen = snapLen;
+  iface.m_nanosecMode = nanosecMode;
+  m_interfaces.push_back (iface);
+
+  uint16_t nameLen = static_cast<uint16_t> (std::min<std::size_t> (name.size (), 0xffff));
+  uint32_t size = 16                         // block header and fixed fields
+    + (nameLen ? 4 + Pad4 (nameLen) : 0)     // if_name
+    + (nanosecMode ? 8 : 0)                  // if_tsresol
+    + 4                                      // opt_endofopt
+    + 4;                                     // trailing block length
+
+  uint8_t *out = BeginBlock (size);
+  out = Put (out, INTERFACE_DESCRIPTION_BLOCK);
+  out = Put (out, size);
+  out = Put (out, static_cast<uint16_t> (dataLinkType));
+  out = Put (out, uint16_t (0));
+  out = Put (out, snapLen);
+  if (nameLen)
+    {
+      out = Put (out, IF_NAME);
+      out = Put (out, nameLen);
+      std::memcpy (out, name.data (), nameLen);
+      std::memset (out + nameLen, 0, Pad4 (nameLen) - nameLen);
+      out += Pad4 (nameLen);
+    }
+  if (nanosecMode)
+    {
+      out = Put (out, IF_TSRESOL);
+      out = Put (out, uint16_t (1));
+      out = Put (out, uint8_t (9));   // 10^-9
+      std::memset (out, 0, 3);        // padding to the 32-bit boundary
+      out += 3;
+    }
+  out = Put (out, OPT_ENDOFOPT);
+  out = Put (out, uint16_t (0));
+  Put (out, size);
+  EndBlock ();
+
+  return m_interfaces.size () - 1;
+}
+
+bool
+PcapNgFile::IsNanoSecMode (uint32_t interfaceId) const
+{
+  NS_ASSERT (interfaceId < m_interfaces.size ());
+  return m_interfaces[interfaceId].m_nanosecMode;
+}
+
+uint32_t
+PcapNgFile::GetSnapLen (uint32_t interfaceId) const
+{
+  NS_ASSERT (interfaceId < m_interfaces.size ());
+  return m_interfaces[interfaceId].m_snapLen;
+}
+
+uint32_t
+PcapNgFile::GetDataLinkType (uint32_t interfaceId) const
+{
+  NS_ASSERT (interfaceId < m_interfaces.size ());
+  return m_interfaces[interfaceId].m_dataLinkType;
+}
+
+uint8_t *
+PcapNgFile::BeginBlock (uint32_t size)
+{
+  NS_ASSERT (size % 4 == 0);
+  if (m_writeBuffer.IsEnabled ())
+    {
+      return m_writeBuffer.Reserve (size);
+    }
+  m_scratch.resize (size);
+  return m_scratch.data ();
+}
+
+void
+PcapNgFile::EndBlock (void)
+{
+  if (!m_writeBuffer.IsEnabled ())
+    {
+      m_file.write (reinterpret_cast<const char *> (m_scratch.data ()), m_scratch.size ());
+    }
+}
+
+uint8_t *
+PcapNgFile::BeginPacketBlock (uint32_t interfaceId, uint64_t timestamp,
+                              uint32_t totalLen, uint32_t &inclLen)
+{
+  NS_LOG_FUNCTION (this << interfaceId << timestamp << totalLen);
+  NS_ASSERT_MSG (interfaceId < m_interfaces.size (), "Unknown pcapng interface " << interfaceId);
+  uint32_t snapLen = m_interfaces[interfaceId].m_snapLen;
+  inclLen = totalLen > snapLen ? snapLen : totalLen;
+  uint32_t size = EPB_FIXED_SIZE + Pad4 (inclLen);
+
+  uint8_t *out = BeginBlock (size);
+  out = Put (out, ENHANCED_PACKET_BLOCK);
+  out = Put (out, size);
+  out = Put (out, interfaceId);
+  out = Put (out, static_cast<uint32_t> (timestamp >> 32));
+  out = Put (out, static_cast<uint32_t> (timestamp));
+  out = Put (out, inclLen);
+  out = Put (out, totalLen);
+  std::memset (out + inclLen, 0, Pad4 (inclLen) - inclLen);
+  Put (out + Pad4 (inclLen), size);
+  return out;
+}
+
+void
+PcapNgFile::Write (uint32_t interfaceId, uint64_t timestamp, uint8_t const *data, uint32_t totalLen)
+{
+  NS_LOG_FUNCTION (this << interfaceId << timestamp << &data << totalLen);
+  uint32_t inclLen;
+  uint8_t *out = BeginPacketBlock (interfaceId, timestamp, totalLen, inclLen);
+  std::memcpy (out, data, inclLen);
+  EndBlock ();
+}
+
+void
+PcapNgFile::Write (uint32_t interfaceId, uint64_t timestamp, Ptr<const Packet> p)
+{
+  NS_LOG_FUNCTION (this << interfaceId << timestamp << p);
+  uint32_t inclLen;
+  uint8_t *out = BeginPacketBlock (interfaceId, timestamp, p->GetSize (), inclLen);
+  p->CopyData (out, inclLen);
+  EndBlock ();
+}
+
+void
+PcapNgFile::Write (uint32_t interfaceId, uint64_t timestamp, const Header &header, Ptr<const Packet> p)
+{
+  NS_LOG_FUNCTION (this << interfaceId << timestamp << &header << p);
+  uint32_t headerSize = header.GetSerializedSize ();
+  Buffer headerBuffer;
+  headerBuffer.AddAtStart (headerSize);
+  header.Serialize (headerBuffer.Begin ());
+
+  uint32_t inclLen;
+  uint8_t *out = BeginPacketBlock (interfaceId, timestamp, headerSize + p->GetSize (), inclLen);
+  uint32_t toCopy = std::min (headerSize, inclLen);
+  headerBuffer.CopyData (out, toCopy);
+  p->CopyData (out + toCopy, inclLen - toCopy);
+  EndBlock ();
+}
+
+} // namespace ns3
@@ -0,0 +1,211 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef PCAPNG_FILE_H
+#define PCAPNG_FILE_H
+
+#include <string>
+#include <fstream>
+#include <vector>
+#include <stdint.h>
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include "pcap-write-buffer.h"
+
+namespace ns3 {
+
+class Packet;
+class Header;
+
+/**
+ * \ingroup network
+ *
+ * \brief A write-only pcapng file holding the traces of many interfaces.
+ *
+ * Where PcapFile stores the packets of a single link type in a classic
+ * pcap file, a PcapNgFile stores one Interface Description Block per
+ * traced device and tags every Enhanced Packet Block with the interface
+ * it was captured on.  Tracing all devices of a simulation into a single
+ * pcapng file avoids holding one open stream per device.
+ *
+ * The file is a single section, written in host byte order, which the
+ * pcapng readers (e.g. wireshark, tshark) detect from the byte-order magic.
+ *
+ * See https://www.ietf.org/archive/id/draft-tuexen-opsawg-pcapng-05.html
+ */
+class PcapNgFile : public SimpleRefCount<PcapNgFile>
+{
+public:
+  PcapNgFile ();
+  ~PcapNgFile ();
+
+  /**
+   * \brief Get the pcapng file shared under the given name.
+   *
+   * The first call for a file name creates and opens the file; subsequent
+   * calls return the same object for as long as somebody holds a reference
+   * to it.  The file is closed when the last reference is released.
+   *
+   * \param filename Name of the file.
+   * \param bufferSize Size of the write buffer, see PcapFile::SetWriteBuffer.
+   * Only used when the file is created.
+   * \param asyncFlush Whether a flush thread is used, see
+   * PcapFile::SetWriteBuffer.  Only used when the file is created.
+   * \returns the shared file
+   */
+  static Ptr<PcapNgFile> GetShared (std::string const &filename,
+                                    uint32_t bufferSize = 0,
+                                    bool asyncFlush = false);
+
+  /**
+   * \return true if the file could not be opened or written.
+   */
+  bool Fail (void) const;
+
+  /**
+   * \brief Create the file and write the Section Header Block.
+   *
+   * \param filename Name of the file.
+   * \param bufferSize Size of the write buffer in bytes; zero writes every
+   * block straight to the stream.
+   * \param asyncFlush If true, full buffers are written by a background
+   * thread.
+   */
+  void Open (std::string const &filename, uint32_t bufferSize = 0, bool asyncFlush = false);
+
+  /**
+   * \brief Write all buffered blocks and close the file.
+   */
+  void Close (void);
+
+  /**
+   * \brief Write all buffered blocks to the file.
+   */
+  void Flush (void);
+
+  /**
+   * \brief Describe a new capture interface.
+   *
+   * \param dataLinkType A data link type as defined in the pcap library;
+   * pcapng restricts it to 16 bits.
+   * \param snapLen Maximum number of bytes stored per packet.
+   * \param name Name of the interface, stored in the if_name option.
+   * \param nanosecMode Whether the interface timestamps are in nanoseconds
+   * rather than microseconds.
+   * \returns the identifier of the interface to pass to Write ()
+   */
+  uint32_t AddInterface (uint32_t dataLinkType, uint32_t snapLen,
+                         std::string const &name, bool nanosecMode = false);
+
+  /**
+   * \param interfaceId An interface identifier returned by AddInterface ().
+   * \returns whether the timestamps of the interface are in nanoseconds
+   */
+  bool IsNanoSecMode (uint32_t interfaceId) const;
+
+  /**
+   * \param interfaceId An interface identifier returned by AddInterface ().
+   * \returns the snap length of the interface
+   */
+  uint32_t GetSnapLen (uint32_t interfaceId) const;
+
+  /**
+   * \param interfaceId An interface identifier returned by AddInterface ().
+   * \returns the data link type of the interface
+   */
+  uint32_t GetDataLinkType (uint32_t interfaceId) const;
+
+  /**
+   * \brief Write the next packet of an interface.
+   *
+   * \param interfaceId Interface the packet was captured on.
+   * \param timestamp Packet timestamp, in micro- or nanoseconds depending
+   * on the resolution of the interface.
+   * \param data Data buffer.
+   * \param totalLen Total packet length.
+   */
+  void Write (uint32_t interfaceId, uint64_t timestamp, uint8_t const *data, uint32_t totalLen);
+
+  /**
+   * \brief Write the next packet of an interface.
+   *
+   * \param interfaceId Interface the packet was captured on.
+   * \param timestamp Packet timestamp, in micro- or nanoseconds depending
+   * on the resolution of the interface.
+   * \param p Packet to write.
+   */
+  void Write (uint32_t interfaceId, uint64_t timestamp, Ptr<const Packet> p);
+
+  /**
+   * \brief Write the next packet of an interface.
+   *
+   * \param interfaceId Interface the packet was captured on.
+   * \param timestamp Packet timestamp, in micro- or nanoseconds depending
+   * on the resolution of the interface.
+   * \param header Header to write, in front of packet.
+   * \param p Packet to write.
+   */
+  void Write (uint32_t interfaceId, uint64_t timestamp, const Header &header, Ptr<const Packet> p);
+
+private:
+  /**
+   * \brief Properties of an interface described in the file.
+   */
+  struct Interface
+  {
+    uint32_t m_dataLinkType; //!< data link type
+    uint32_t m_snapLen;      //!< maximum length of saved packets
+    bool m_nanosecMode;      //!< timestamps in nanoseconds
+  };
+
+  /**
+   * \brief Write a whole block.
+   *
+   * When buffering is disabled, the block is assembled in a scratch buffer
+   * first, so that there is a single stream write per block.
+   *
+   * \param size The total length of the block, a multiple of four.
+   * \returns a pointer to the block bytes to fill in
+   */
+  uint8_t * BeginBlock (uint32_t size);
+
+  /**
+   * \brief Terminate the block started by BeginBlock ().
+   */
+  void EndBlock (void);
+
+  /**
+   * \brief Start an Enhanced Packet Block and fill in all but its data.
+   *
+   * \param interfaceId Interface the packet was captured on.
+   * \param timestamp Packet timestamp.
+   * \param totalLen Total packet length.
+   * \param inclLen [out] Number of packet bytes to fill in.
+   * \returns a pointer to the packet data of the block
+   */
+  uint8_t * BeginPacketBlock (uint32_t interfaceId, uint64_t timestamp,
+                              uint32_t totalLen, uint32_t &inclLen);
+
+  std::string m_filename;               //!< file name
+  std::ofstream m_file;                 //!< file stream
+  PcapWriteBuffer m_writeBuffer;        //!< batches blocks on their way to m_file
+  std::vector<uint8_t> m_scratch;       //!< block assembly area when not buffering
+  std::vector<Interface> m_interfaces;  //!< interfaces described so far
+};
+
+} // namespace ns3
+
+#endif /* PCAPNG_FILE_H */
@@ -58,7 +58,9 @@ QueueBase::QueueBase () :
   m_nTotalDroppedBytesAfterDequeue (0),
   m_nTotalDroppedPackets (0),
   m_nTotalDroppedPacketsBeforeEnqueue (0),
-  m_nTotalDroppedPacketsAfterDequeue (0)
+  m_nTotalDroppedPacketsAfterDequeue (0),
+  m_nVirtualPackets (0),
+  m_nVirtualBytes (0)
 {
   NS_LOG_FUNCTION (this);
   m_maxSize = QueueSize (QueueSizeUnit::PACKETS, std::numeric_limits<uint32_t>::max ());
@@ -109,15 +111,37 @@ QueueBase::GetCurrentSize (void) const
 
   if (m_maxSize.GetUnit () == QueueSizeUnit::PACKETS)
     {
-      return QueueSize (QueueSizeUnit::PACKETS, m_nPackets);
+      return QueueSize (QueueSizeUnit::PACKETS, m_nPackets + m_nVirtualPackets);
     }
   if (m_maxSize.GetUnit () == QueueSizeUnit::BYTES)
     {
-      return QueueSize (QueueSizeUnit::BYTES, m_nBytes);
+      return QueueSize (QueueSizeUnit::BYTES, m_nBytes + m_nVirtualBytes);
     }
   NS_ABORT_MSG ("Unknown queue size unit");
 }
 
+void
+QueueBase::SetVirtualBacklog (uint32_t nPackets, uint32_t nBytes)
+{
+  NS_LOG_FUNCTION (this << nPackets << nBytes);
+  m_nVirtualPackets = nPackets;
+  m_nVirtualBytes = nBytes;
+}
+
+uint32_t
+QueueBase::GetVirtualPackets (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_nVirtualPackets;
+}
+
+uint32_t
+QueueBase::GetVirtualBytes (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_nVirtualBytes;
+}
+
 uint32_t
 QueueBase::GetTotalReceivedBytes (void) const
 {
@@ -225,11 +249,11 @@ QueueBase::WouldOverflow (uint32_t nPackets, uint32_t nBytes) const
 {
   if (m_maxSize.GetUnit () == QueueSizeUnit::PACKETS)
     {
-      return (m_nPackets + nPackets > m_maxSize.GetValue ());
+      return (m_nPackets + m_nVirtualPackets + nPackets > m_maxSize.GetValue ());
     }
   else
     {
-      return (m_nBytes + nBytes > m_maxSize.GetValue ());
+      return (m_nBytes + m_nVirtualBytes + nBytes > m_maxSize.GetValue ());
     }
 }
 
@@ -98,10 +98,38 @@ public:
 
   /**
    * \return The current size of the Queue in terms of packets, if the maximum
-   *         size is specified in packets, or bytes, otherwise
+   *         size is specified in packets, or bytes, otherwise, including the
+   *         virtual backlog
    */
   QueueSize GetCurrentSize (void) const;
 
+  /**
+   * \brief Set the virtual backlog of the queue
+   *
+   * The virtual backlog stands for packets of traffic modeled at the flow
+   * level (e.g., by FluidTrafficModel) that would be waiting in this queue.
+   * It is not stored, but it takes room in the queue: it is counted by
+   * GetCurrentSize () and WouldOverflow (), hence by the enqueue checks and
+   * by the flow control of the NetDeviceQueue connected to this queue. As
+   * setting the backlog neither enqueues nor dequeues a packet, the caller
+   * must stop or wake that NetDeviceQueue when the queue becomes full or
+   * has room again.
+   *
+   * \param nPackets number of packets of the virtual backlog
+   * \param nBytes number of bytes of the virtual backlog
+   */
+  void SetVirtualBacklog (uint32_t nPackets, uint32_t nBytes);
+
+  /**
+   * \return The number of packets of the virtual backlog
+   */
+  uint32_t GetVirtualPackets (void) const;
+
+  /**
+   * \return The number of bytes of the virtual backlog
+   */
+  uint32_t GetVirtualBytes (void) const;
+
   /**
    * \return The total number of bytes received by this Queue since the
    * simulation began, or since ResetStatistics was called, according to
@@ -224,6 +252,8 @@ private:
   uint32_t m_nTotalDroppedPacketsAfterDequeue;  //!< Total dropped packets after dequeue
 
   QueueSize m_maxSize;                //!< max queue size
+  uint32_t m_nVirtualPackets;         //!< Number of packets of the virtual backlog
+  uint32_t m_nVirtualBytes;           //!< Number of bytes of the virtual backlog
 
   /// Friend class
   template <typename Item>
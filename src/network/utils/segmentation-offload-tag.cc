@@ -0,0 +1,147 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "segmentation-offload-tag.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("SegmentationOffloadTag");
+
+NS_OBJECT_ENSURE_REGISTERED (SegmentationOffloadTag);
+
+TypeId
+SegmentationOffloadTag::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SegmentationOffloadTag")
+    .SetParent<Tag> ()
+    .SetGroupName ("Network")
+    .AddConstructor<SegmentationOffloadTag> ()
+  ;
+  return tid;
+}
+
+TypeId
+SegmentationOffloadTag::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+uint32_t
+SegmentationOffloadTag::GetSerializedSize (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return 6;
+}
+
+void
+SegmentationOffloadTag::Serialize (TagBuffer buf) const
+{
+  NS_LOG_FUNCTION (this << &buf);
+  buf.WriteU16 (m_segments);
+  buf.WriteU16 (m_segmentSize);
+  buf.WriteU16 (m_headerSize);
+}
+
+void
+SegmentationOffloadTag::Deserialize (TagBuffer buf)
+{
+  NS_LOG_FUNCTION (this << &buf);
+  m_segments = buf.ReadU16 ();
+  m_segmentSize = buf.ReadU16 ();
+  m_headerSize = buf.ReadU16 ();
+}
+
+void
+SegmentationOffloadTag::Print (std::ostream &os) const
+{
+  NS_LOG_FUNCTION (this << &os);
+  os << "Segments=" << m_segments << " SegmentSize=" << m_segmentSize << " HeaderSize=" << m_headerSize;
+}
+
+SegmentationOffloadTag::SegmentationOffloadTag ()
+  : Tag (),
+    m_segments (1),
+    m_segmentSize (0),
+    m_headerSize (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+SegmentationOffloadTag::SegmentationOffloadTag (uint16_t segments, uint16_t segmentSize, uint16_t headerSize)
+  : Tag (),
+    m_segments (segments),
+    m_segmentSize (segmentSize),
+    m_headerSize (headerSize)
+{
+  NS_LOG_FUNCTION (this << segments << segmentSize << headerSize);
+}
+
+void
+SegmentationOffloadTag::SetSegments (uint16_t segments)
+{
+  NS_LOG_FUNCTION (this << segments);
+  m_segments = segments;
+}
+
+uint16_t
+SegmentationOffloadTag::GetSegments (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_segments;
+}
+
+void
+SegmentationOffloadTag::SetSegmentSize (uint16_t segmentSize)
+{
+  NS_LOG_FUNCTION (this << segmentSize);
+  m_segmentSize = segmentSize;
+}
+
+uint16_t
+SegmentationOffloadTag::GetSegmentSize (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_segmentSize;
+}
+
+void
+SegmentationOffloadTag::SetHeaderSize (uint16_t headerSize)
+{
+  NS_LOG_FUNCTION (this << headerSize);
+  m_headerSize = headerSize;
+}
+
+uint16_t
+SegmentationOffloadTag::GetHeaderSize (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_headerSize;
+}
+
+uint32_t
+SegmentationOffloadTag::GetWireSize (uint32_t packetSize, uint32_t framingSize) const
+{
+  NS_LOG_FUNCTION (this << packetSize << framingSize);
+  if (m_segments <= 1)
+    {
+      return packetSize;
+    }
+  // every segment but the first one repeats the headers and the framing
+  return packetSize + (m_segments - 1u) * (m_headerSize + framingSize);
+}
+
+} // namespace ns3
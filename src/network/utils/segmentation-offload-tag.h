@@ -0,0 +1,111 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SEGMENTATION_OFFLOAD_TAG_H
+#define SEGMENTATION_OFFLOAD_TAG_H
+
+#include "ns3/tag.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup network
+ *
+ * \brief Packet tag marking a super-segment, i.e., a packet standing for
+ * several back-to-back segments of a transport protocol (segmentation
+ * offload).
+ *
+ * The transport protocol sends the payload of several segments in a
+ * single packet, carrying a single copy of the headers, and records in
+ * this tag the number of segments, their payload size and the size of the
+ * headers (transport and network) that every segment would carry on the
+ * wire.
+ *
+ * Such packets are not fragmented by the network layer when they are sent
+ * through a device supporting segmentation offload (see
+ * NetDevice::SupportsSegmentationOffload), and are not split by that
+ * device: they are transmitted as a single frame whose duration is the one
+ * of the segments sent back-to-back, as returned by GetWireSize (). The
+ * receiver gets the whole super-segment at once, as a receive offload would
+ * have coalesced the segments. The network layer splits the super-segments
+ * it sends through any other device into the segments they stand for.
+ */
+class SegmentationOffloadTag : public Tag
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  virtual TypeId GetInstanceTypeId (void) const;
+  virtual uint32_t GetSerializedSize (void) const;
+  virtual void Serialize (TagBuffer buf) const;
+  virtual void Deserialize (TagBuffer buf);
+  virtual void Print (std::ostream &os) const;
+  SegmentationOffloadTag ();
+
+  /**
+   * Constructs a SegmentationOffloadTag
+   *
+   * \param segments number of segments of the super-segment
+   * \param segmentSize payload size of every segment but the last one
+   * \param headerSize size of the headers repeated in every segment
+   */
+  SegmentationOffloadTag (uint16_t segments, uint16_t segmentSize, uint16_t headerSize);
+  /**
+   * \param segments number of segments of the super-segment
+   */
+  void SetSegments (uint16_t segments);
+  /**
+   * \returns the number of segments of the super-segment
+   */
+  uint16_t GetSegments (void) const;
+  /**
+   * \param segmentSize payload size of every segment but the last one
+   */
+  void SetSegmentSize (uint16_t segmentSize);
+  /**
+   * \returns the payload size of every segment but the last one
+   */
+  uint16_t GetSegmentSize (void) const;
+  /**
+   * \param headerSize size of the headers repeated in every segment
+   */
+  void SetHeaderSize (uint16_t headerSize);
+  /**
+   * \returns the size of the headers repeated in every segment
+   */
+  uint16_t GetHeaderSize (void) const;
+  /**
+   * \brief Compute the number of bytes the segments take on the wire.
+   *
+   * \param packetSize size of the super-segment, including its single copy
+   * of the headers and of the framing
+   * \param framingSize size of the framing added by the device to every
+   * segment
+   * \returns the size of the segments sent back-to-back
+   */
+  uint32_t GetWireSize (uint32_t packetSize, uint32_t framingSize) const;
+private:
+  uint16_t m_segments;    //!< Number of segments
+  uint16_t m_segmentSize; //!< Payload size of the segments
+  uint16_t m_headerSize;  //!< Size of the headers of each segment
+};
+
+} // namespace ns3
+
+#endif /* SEGMENTATION_OFFLOAD_TAG_H */
@@ -19,6 +19,7 @@
  */
 #include "simple-net-device.h"
 #include "simple-channel.h"
+#include "segmentation-offload-tag.h"
 #include "ns3/node.h"
 #include "ns3/packet.h"
 #include "ns3/log.h"
@@ -210,6 +211,19 @@ SimpleNetDevice::GetTypeId (void)
                    DataRateValue (DataRate ("0b/s")),
                    MakeDataRateAccessor (&SimpleNetDevice::m_bps),
                    MakeDataRateChecker ())
+    .AddAttribute ("BackgroundDataRate",
+                   "The part of the data rate used by background traffic modeled "
+                   "at the flow level (see FluidTrafficModel). Packets are sent at "
+                   "the remaining rate, at least 1% of the data rate.",
+                   DataRateValue (DataRate ("0b/s")),
+                   MakeDataRateAccessor (&SimpleNetDevice::m_backgroundBps),
+                   MakeDataRateChecker ())
+    .AddAttribute ("SegmentationOffload",
+                   "Whether the device transmits super-segments larger than its "
+                   "MTU (see SegmentationOffloadTag)",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SimpleNetDevice::m_segmentationOffload),
+                   MakeBooleanChecker ())
     .AddTraceSource ("PhyRxDrop",
                      "Trace source indicating a packet has been dropped "
                      "by the device during reception",
@@ -428,7 +442,8 @@ bool
 SimpleNetDevice::SendFrom (Ptr<Packet> p, const Address& source, const Address& dest, uint16_t protocolNumber)
 {
   NS_LOG_FUNCTION (this << p << source << dest << protocolNumber);
-  if (p->GetSize () > GetMtu ())
+  SegmentationOffloadTag offloadTag;
+  if (p->GetSize () > GetMtu () && !(m_segmentationOffload && p->PeekPacketTag (offloadTag)))
     {
       return false;
     }
@@ -479,7 +494,21 @@ SimpleNetDevice::StartTransmission ()
   Time txTime = Time (0);
   if (m_bps > DataRate (0))
     {
-      txTime = m_bps.CalculateBytesTxTime (packet->GetSize ());
+      // A super-segment takes the time of its segments sent back-to-back
+      SegmentationOffloadTag offloadTag;
+      uint32_t size = packet->GetSize ();
+      if (packet->PeekPacketTag (offloadTag))
+        {
+          size = offloadTag.GetWireSize (size, 0);
+        }
+      // Packets share the link with the background traffic
+      DataRate rate = m_bps;
+      if (m_backgroundBps > DataRate (0))
+        {
+          DataRate floor = DataRate (std::max<uint64_t> (m_bps.GetBitRate () / 100, 1));
+          rate = m_backgroundBps < m_bps - floor ? m_bps - m_backgroundBps : floor;
+        }
+      txTime = rate.CalculateBytesTxTime (size);
     }
   FinishTransmissionEvent = Simulator::Schedule (txTime, &SimpleNetDevice::FinishTransmission, this, packet);
 }
@@ -562,4 +591,11 @@ SimpleNetDevice::SupportsSendFrom (void) const
   return true;
 }
 
+bool
+SimpleNetDevice::SupportsSegmentationOffload (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_segmentationOffload;
+}
+
 } // namespace ns3
@@ -134,6 +134,7 @@ public:
 
   virtual void SetPromiscReceiveCallback (PromiscReceiveCallback cb);
   virtual bool SupportsSendFrom (void) const;
+  virtual bool SupportsSegmentationOffload (void) const;
 
 protected:
   virtual void DoDispose (void);
@@ -180,9 +181,11 @@ private:
    * Enabling this will disable Broadcast and Arp.
    */
   bool m_pointToPointMode;
+  bool m_segmentationOffload; //!< Whether super-segments larger than the MTU are transmitted
 
   Ptr<Queue<Packet> > m_queue; //!< The Queue for outgoing packets.
   DataRate m_bps; //!< The device nominal Data rate. Zero means infinite
+  DataRate m_backgroundBps; //!< The data rate used by flow-level background traffic
   EventId FinishTransmissionEvent; //!< the Tx Complete event
 
   /**
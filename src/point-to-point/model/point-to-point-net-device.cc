@@ -25,6 +25,7 @@
 #include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
 #include "ns3/pointer.h"
+#include "ns3/segmentation-offload-tag.h"
 #include "point-to-point-net-device.h"
 #include "point-to-point-channel.h"
 #include "ppp-header.h"
@@ -57,6 +58,13 @@ PointToPointNetDevice::GetTypeId (void)
                    DataRateValue (DataRate ("32768b/s")),
                    MakeDataRateAccessor (&PointToPointNetDevice::m_bps),
                    MakeDataRateChecker ())
+    .AddAttribute ("BackgroundDataRate",
+                   "The part of the data rate used by background traffic modeled "
+                   "at the flow level (see FluidTrafficModel). Packets are sent at "
+                   "the remaining rate, at least 1% of the data rate.",
+                   DataRateValue (DataRate ("0b/s")),
+                   MakeDataRateAccessor (&PointToPointNetDevice::m_backgroundBps),
+                   MakeDataRateChecker ())
     .AddAttribute ("ReceiveErrorModel", 
                    "The receiver error model used to simulate packet loss",
                    PointerValue (),
@@ -248,7 +256,22 @@ PointToPointNetDevice::TransmitStart (Ptr<Packet> p)
   m_currentPkt = p;
   m_phyTxBeginTrace (m_currentPkt);
 
-  Time txTime = m_bps.CalculateBytesTxTime (p->GetSize ());
+  // A super-segment takes the time of its segments sent back-to-back,
+  // each with its own PPP header
+  uint32_t size = p->GetSize ();
+  SegmentationOffloadTag offloadTag;
+  if (p->PeekPacketTag (offloadTag))
+    {
+      size = offloadTag.GetWireSize (size, PppHeader ().GetSerializedSize ());
+    }
+  // Packets share the link with the background traffic
+  DataRate rate = m_bps;
+  if (m_backgroundBps > DataRate (0))
+    {
+      DataRate floor = DataRate (std::max<uint64_t> (m_bps.GetBitRate () / 100, 1));
+      rate = m_backgroundBps < m_bps - floor ? m_bps - m_backgroundBps : floor;
+    }
+  Time txTime = rate.CalculateBytesTxTime (size);
   Time txCompleteTime = txTime + m_tInterframeGap;
 
   NS_LOG_LOGIC ("Schedule TransmitCompleteEvent in " << txCompleteTime.As (Time::S));
@@ -605,6 +628,13 @@ PointToPointNetDevice::SupportsSendFrom (void) const
   return false;
 }
 
+bool
+PointToPointNetDevice::SupportsSegmentationOffload (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return true;
+}
+
 void
 PointToPointNetDevice::DoMpiReceive (Ptr<Packet> p)
 {
@@ -189,6 +189,7 @@ public:
 
   virtual void SetPromiscReceiveCallback (PromiscReceiveCallback cb);
   virtual bool SupportsSendFrom (void) const;
+  virtual bool SupportsSegmentationOffload (void) const;
 
 protected:
   /**
@@ -301,6 +302,12 @@ private:
    */
   DataRate       m_bps;
 
+  /**
+   * The part of the data rate used by background traffic modeled at the
+   * flow level
+   */
+  DataRate       m_backgroundBps;
+
   /**
    * The interframe gap that the Net Device uses to throttle packet
    * transmission
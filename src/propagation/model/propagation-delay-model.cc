@@ -41,6 +41,18 @@ PropagationDelayModel::~PropagationDelayModel ()
 {
 }
 
+bool
+PropagationDelayModel::IsThreadSafe (void) const
+{
+  return DoIsThreadSafe ();
+}
+
+bool
+PropagationDelayModel::DoIsThreadSafe (void) const
+{
+  return false;
+}
+
 int64_t
 PropagationDelayModel::AssignStreams (int64_t stream)
 {
@@ -113,6 +125,11 @@ ConstantSpeedPropagationDelayModel::GetDelay (Ptr<MobilityModel> a, Ptr<Mobility
   double seconds = distance / m_speed;
   return Seconds (seconds);
 }
+bool
+ConstantSpeedPropagationDelayModel::DoIsThreadSafe (void) const
+{
+  return true;
+}
 void
 ConstantSpeedPropagationDelayModel::SetSpeed (double speed)
 {
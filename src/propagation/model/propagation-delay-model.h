@@ -52,6 +52,14 @@ public:
    * source and destination.
    */
   virtual Time GetDelay (Ptr<MobilityModel> a, Ptr<MobilityModel> b) const = 0;
+  /**
+   * Returns whether GetDelay can be called concurrently from several threads,
+   * provided that each thread passes its own mobility models, e.g., by a
+   * channel that computes the delay to several receivers in parallel.
+   *
+   * \returns true if this model is thread safe
+   */
+  bool IsThreadSafe (void) const;
   /**
    * If this delay model uses objects of type RandomVariableStream,
    * set the stream numbers to the integers starting with the offset
@@ -73,6 +81,16 @@ protected:
    * \return the number of stream indices assigned by this model
    */
   virtual int64_t DoAssignStreams (int64_t stream) = 0;
+
+private:
+  /**
+   * Subclasses whose delay only depends on their attributes and on the
+   * positions of the mobility models can override this to return true; the
+   * default is false.
+   *
+   * \returns whether this model is thread safe
+   */
+  virtual bool DoIsThreadSafe (void) const;
 };
 
 /**
@@ -129,6 +147,7 @@ public:
   double GetSpeed (void) const;
 private:
   int64_t DoAssignStreams (int64_t stream) override;
+  bool DoIsThreadSafe (void) const override;
   double m_speed; //!< speed
 };
 
@@ -29,6 +29,8 @@
 #include "ns3/string.h"
 #include "ns3/pointer.h"
 #include <cmath>
+#include <limits>
+#include <algorithm>
 
 namespace ns3 {
 
@@ -82,6 +84,43 @@ PropagationLossModel::CalcRxPower (double txPowerDbm,
   return self;
 }
 
+double
+PropagationLossModel::GetMaxRange (double txPowerDbm, double rxPowerDbm) const
+{
+  // the models of the chain never increase the power, so each of them
+  // bounds the range of the chain on its own
+  double range = DoGetMaxRange (txPowerDbm, rxPowerDbm);
+  if (m_next != 0)
+    {
+      double next = m_next->GetMaxRange (txPowerDbm, rxPowerDbm);
+      if (std::isinf (range) || std::isinf (next))
+        {
+          return std::numeric_limits<double>::infinity ();
+        }
+      range = std::min (range, next);
+    }
+  return range;
+}
+
+double
+PropagationLossModel::DoGetMaxRange ([[maybe_unused]] double txPowerDbm,
+                                     [[maybe_unused]] double rxPowerDbm) const
+{
+  return std::numeric_limits<double>::infinity ();
+}
+
+bool
+PropagationLossModel::IsThreadSafe (void) const
+{
+  return DoIsThreadSafe () && (m_next == 0 || m_next->IsThreadSafe ());
+}
+
+bool
+PropagationLossModel::DoIsThreadSafe (void) const
+{
+  return false;
+}
+
 int64_t
 PropagationLossModel::AssignStreams (int64_t stream)
 {
@@ -271,6 +310,29 @@ FriisPropagationLossModel::DoCalcRxPower (double txPowerDbm,
   return txPowerDbm - std::max (lossDb, m_minLoss);
 }
 
+double
+FriisPropagationLossModel::DoGetMaxRange (double txPowerDbm, double rxPowerDbm) const
+{
+  if (m_minLoss < 0 || m_systemLoss < 1)
+    {
+      // the model may increase the power
+      return std::numeric_limits<double>::infinity ();
+    }
+  double lossDb = txPowerDbm - rxPowerDbm;
+  if (lossDb < m_minLoss)
+    {
+      return 0;
+    }
+  // distance at which the Friis loss is lossDb
+  return m_lambda / (4 * M_PI) * std::sqrt (std::pow (10.0, lossDb / 10) / m_systemLoss);
+}
+
+bool
+FriisPropagationLossModel::DoIsThreadSafe (void) const
+{
+  return true;
+}
+
 int64_t
 FriisPropagationLossModel::DoAssignStreams (int64_t stream)
 {
@@ -445,6 +507,12 @@ TwoRayGroundPropagationLossModel::DoCalcRxPower (double txPowerDbm,
     }
 }
 
+bool
+TwoRayGroundPropagationLossModel::DoIsThreadSafe (void) const
+{
+  return true;
+}
+
 int64_t
 TwoRayGroundPropagationLossModel::DoAssignStreams (int64_t stream)
 {
@@ -534,6 +602,27 @@ LogDistancePropagationLossModel::DoCalcRxPower (double txPowerDbm,
   return txPowerDbm + rxc;
 }
 
+double
+LogDistancePropagationLossModel::DoGetMaxRange (double txPowerDbm, double rxPowerDbm) const
+{
+  if (m_referenceLoss < 0 || m_exponent <= 0)
+    {
+      return std::numeric_limits<double>::infinity ();
+    }
+  double lossDb = txPowerDbm - rxPowerDbm;
+  if (lossDb < m_referenceLoss)
+    {
+      return 0;
+    }
+  return m_referenceDistance * std::pow (10.0, (lossDb - m_referenceLoss) / (10 * m_exponent));
+}
+
+bool
+LogDistancePropagationLossModel::DoIsThreadSafe (void) const
+{
+  return true;
+}
+
 int64_t
 LogDistancePropagationLossModel::DoAssignStreams (int64_t stream)
 {
@@ -636,6 +725,12 @@ ThreeLogDistancePropagationLossModel::DoCalcRxPower (double txPowerDbm,
   return txPowerDbm - pathLossDb;
 }
 
+bool
+ThreeLogDistancePropagationLossModel::DoIsThreadSafe (void) const
+{
+  return true;
+}
+
 int64_t
 ThreeLogDistancePropagationLossModel::DoAssignStreams (int64_t stream)
 {
@@ -798,6 +893,12 @@ FixedRssLossModel::DoCalcRxPower (double txPowerDbm,
   return m_rss;
 }
 
+bool
+FixedRssLossModel::DoIsThreadSafe (void) const
+{
+  return true;
+}
+
 int64_t
 FixedRssLossModel::DoAssignStreams (int64_t stream)
 {
@@ -924,6 +1025,26 @@ RangePropagationLossModel::DoCalcRxPower (double txPowerDbm,
     }
 }
 
+double
+RangePropagationLossModel::DoGetMaxRange (double txPowerDbm, double rxPowerDbm) const
+{
+  if (rxPowerDbm <= -1000)
+    {
+      return std::numeric_limits<double>::infinity ();
+    }
+  if (txPowerDbm < rxPowerDbm)
+    {
+      return 0;
+    }
+  return m_range;
+}
+
+bool
+RangePropagationLossModel::DoIsThreadSafe (void) const
+{
+  return true;
+}
+
 int64_t
 RangePropagationLossModel::DoAssignStreams (int64_t stream)
 {
@@ -102,6 +102,33 @@ public:
                       Ptr<MobilityModel> a,
                       Ptr<MobilityModel> b) const;
 
+  /**
+   * Returns a distance beyond which the Rx power computed by the chain of
+   * PropagationLossModel(s) is always below a threshold, which a channel
+   * can use to skip the receivers that are out of range.
+   *
+   * The range is only bounded if every model of the chain bounds its own
+   * range and never increases the power, e.g., a chain of deterministic
+   * path loss models; otherwise it is infinite.
+   *
+   * \param txPowerDbm the transmission power (in dBm)
+   * \param rxPowerDbm the reception power threshold (in dBm)
+   * \returns the distance (m), possibly infinite
+   */
+  double GetMaxRange (double txPowerDbm, double rxPowerDbm) const;
+
+  /**
+   * Returns whether CalcRxPower can be called concurrently from several
+   * threads, provided that each thread passes its own mobility models,
+   * e.g., by a channel that computes the Rx power of several receivers in
+   * parallel. This is the case if no model of the chain modifies its state,
+   * draws random variables or uses anything else than the positions of the
+   * mobility models to compute the Rx power.
+   *
+   * \returns true if every model of the chain is thread safe
+   */
+  bool IsThreadSafe (void) const;
+
   /**
    * If this loss model uses objects of type RandomVariableStream,
    * set the stream numbers to the integers starting with the offset
@@ -140,6 +167,27 @@ private:
                                 Ptr<MobilityModel> a,
                                 Ptr<MobilityModel> b) const = 0;
 
+  /**
+   * Subclasses that never increase the power and whose Rx power decreases
+   * with the distance can override this to bound their range; the default
+   * is an infinite range.
+   *
+   * \param txPowerDbm the transmission power (in dBm)
+   * \param rxPowerDbm the reception power threshold (in dBm)
+   * \returns a distance (m) beyond which the Rx power of this model is
+   *          below rxPowerDbm, or infinity
+   */
+  virtual double DoGetMaxRange (double txPowerDbm, double rxPowerDbm) const;
+
+  /**
+   * Subclasses whose Rx power only depends on their attributes and on the
+   * positions of the mobility models can override this to return true; the
+   * default is false.
+   *
+   * \returns whether this model is thread safe
+   */
+  virtual bool DoIsThreadSafe (void) const;
+
   Ptr<PropagationLossModel> m_next; //!< Next propagation loss model in the list
 };
 
@@ -304,6 +352,8 @@ private:
   double DoCalcRxPower (double txPowerDbm,
                         Ptr<MobilityModel> a,
                         Ptr<MobilityModel> b) const override;
+  bool DoIsThreadSafe (void) const override;
+  double DoGetMaxRange (double txPowerDbm, double rxPowerDbm) const override;
   int64_t DoAssignStreams (int64_t stream) override;
 
   /**
@@ -414,6 +464,7 @@ private:
   double DoCalcRxPower (double txPowerDbm,
                         Ptr<MobilityModel> a,
                         Ptr<MobilityModel> b) const override;
+  bool DoIsThreadSafe (void) const override;
   int64_t DoAssignStreams (int64_t stream) override;
 
   /**
@@ -492,6 +543,8 @@ private:
   double DoCalcRxPower (double txPowerDbm,
                         Ptr<MobilityModel> a,
                         Ptr<MobilityModel> b) const override;
+  bool DoIsThreadSafe (void) const override;
+  double DoGetMaxRange (double txPowerDbm, double rxPowerDbm) const override;
 
   int64_t DoAssignStreams (int64_t stream) override;
 
@@ -566,6 +619,7 @@ private:
   double DoCalcRxPower (double txPowerDbm,
                         Ptr<MobilityModel> a,
                         Ptr<MobilityModel> b) const override;
+  bool DoIsThreadSafe (void) const override;
 
   int64_t DoAssignStreams (int64_t stream) override;
 
@@ -682,6 +736,7 @@ private:
   double DoCalcRxPower (double txPowerDbm,
                         Ptr<MobilityModel> a,
                         Ptr<MobilityModel> b) const override;
+  bool DoIsThreadSafe (void) const override;
 
   int64_t DoAssignStreams (int64_t stream) override;
 
@@ -771,6 +826,8 @@ private:
   double DoCalcRxPower (double txPowerDbm,
                         Ptr<MobilityModel> a,
                         Ptr<MobilityModel> b) const override;
+  bool DoIsThreadSafe (void) const override;
+  double DoGetMaxRange (double txPowerDbm, double rxPowerDbm) const override;
 
   int64_t DoAssignStreams (int64_t stream) override;
 
@@ -0,0 +1,416 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef SPATIAL_INDEX_H
+#define SPATIAL_INDEX_H
+
+#include "ns3/mobility-model.h"
+#include "ns3/simulator.h"
+#include "ns3/nstime.h"
+#include "ns3/callback.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup propagation
+ * \brief A uniform grid of the positions of the receivers of a channel,
+ * to find the receivers near a transmitter without visiting the others.
+ *
+ * The receivers are binned in square cells of the XY plane by the position
+ * of their mobility model. The grid is updated lazily, at the next lookup:
+ * a receiver is binned again after a CourseChange notification of its
+ * mobility model and, if it moves, once it may have drifted by half a cell
+ * from the position it was binned at. The velocity is assumed to only
+ * change with a CourseChange notification, as the mobility models of ns-3
+ * do. Lookups are widened by half a cell to cover the drift, so they return
+ * all the receivers within range, and possibly some more. A receiver without
+ * a mobility model has no position and is returned by every lookup.
+ *
+ * \tparam T the type of the receivers
+ */
+template <typename T>
+class SpatialIndex
+{
+public:
+  SpatialIndex ();
+  ~SpatialIndex ();
+
+  // Delete copy constructor and assignment operator to avoid misuse
+  SpatialIndex (const SpatialIndex &) = delete;
+  SpatialIndex & operator = (const SpatialIndex &) = delete;
+
+  /**
+   * Set the size of the cells, which must be done before adding receivers.
+   * A size close to the range of the lookups visits the fewest cells.
+   *
+   * \param cellSize the side of the cells (m)
+   */
+  void SetCellSize (double cellSize);
+  /**
+   * \returns the side of the cells (m), or zero if not set
+   */
+  double GetCellSize (void) const;
+
+  /**
+   * Add a receiver to the grid.
+   *
+   * \param receiver the receiver
+   * \param mobility the mobility model of the receiver, or null
+   */
+  void Add (T receiver, Ptr<MobilityModel> mobility);
+  /**
+   * Remove a receiver from the grid, if present.
+   *
+   * \param receiver the receiver
+   */
+  void Remove (T receiver);
+  /**
+   * Remove all the receivers and disconnect from their mobility models.
+   */
+  void Clear (void);
+  /**
+   * \returns the number of receivers in the grid
+   */
+  std::size_t GetN (void) const;
+
+  /**
+   * Get the receivers that may be within range of a position, in the order
+   * they were added.
+   *
+   * \param position the position
+   * \param range the range (m)
+   * \param receivers vector to which the receivers are appended
+   */
+  void GetReceivers (const Vector &position, double range, std::vector<T> &receivers);
+
+private:
+  /// Deadlines to bin moving receivers again, and their receivers
+  typedef std::multimap<Time, uint32_t> Deadlines;
+
+  /// A receiver of the grid
+  struct Entry
+  {
+    T receiver;                     //!< the receiver
+    Ptr<MobilityModel> mobility;    //!< its mobility model
+    bool valid;                     //!< false once removed
+    bool binned;                    //!< whether it is in a cell
+    int64_t cell;                   //!< its cell, if binned
+    bool moving;                    //!< whether it has a deadline
+    typename Deadlines::iterator deadline; //!< its deadline, if moving
+  };
+
+  /**
+   * \param x the X coordinate
+   * \param y the Y coordinate
+   * \returns the key of the cell
+   */
+  static int64_t GetCellKey (int64_t x, int64_t y);
+  /**
+   * \param coordinate a coordinate (m)
+   * \returns the index of the cell along the axis
+   */
+  int64_t GetCellIndex (double coordinate) const;
+  /**
+   * Bin a receiver at its current position.
+   * \param id the receiver
+   */
+  void Bin (uint32_t id);
+  /**
+   * Remove a receiver from its cell and from the deadlines.
+   * \param id the receiver
+   */
+  void Unbin (uint32_t id);
+  /**
+   * Bin again the receivers that changed course or may have drifted.
+   */
+  void Update (void);
+  /**
+   * Mark the receivers of a mobility model to be binned again.
+   * \param mobility the mobility model
+   */
+  void CourseChanged (Ptr<const MobilityModel> mobility);
+
+  double m_cellSize;                 //!< side of the cells (m)
+  std::vector<Entry> m_entries;      //!< the receivers, in the order they were added
+  std::size_t m_nValid;              //!< number of receivers not removed
+  std::unordered_map<int64_t, std::vector<uint32_t> > m_cells; //!< the receivers of each cell
+  std::unordered_map<const MobilityModel *, std::vector<uint32_t> > m_byMobility; //!< the receivers of each mobility model
+  std::vector<uint32_t> m_unplaced;  //!< receivers without mobility model
+  std::vector<uint32_t> m_changed;   //!< receivers to bin again
+  Deadlines m_deadlines;             //!< deadlines of the moving receivers
+};
+
+/*************************************************
+ *  Implementation of the templates declared above.
+ *************************************************/
+
+template <typename T>
+SpatialIndex<T>::SpatialIndex ()
+  : m_cellSize (0),
+    m_nValid (0)
+{
+}
+
+template <typename T>
+SpatialIndex<T>::~SpatialIndex ()
+{
+  Clear ();
+}
+
+template <typename T>
+void
+SpatialIndex<T>::SetCellSize (double cellSize)
+{
+  NS_ASSERT_MSG (cellSize > 0, "The cells must have a positive size");
+  NS_ASSERT_MSG (m_nValid == 0, "The cell size must be set before adding receivers");
+  m_cellSize = cellSize;
+}
+
+template <typename T>
+double
+SpatialIndex<T>::GetCellSize (void) const
+{
+  return m_cellSize;
+}
+
+template <typename T>
+void
+SpatialIndex<T>::Add (T receiver, Ptr<MobilityModel> mobility)
+{
+  NS_ASSERT_MSG (m_cellSize > 0, "The cell size must be set before adding receivers");
+  uint32_t id = m_entries.size ();
+  Entry entry;
+  entry.receiver = receiver;
+  entry.mobility = mobility;
+  entry.valid = true;
+  entry.binned = false;
+  entry.cell = 0;
+  entry.moving = false;
+  entry.deadline = m_deadlines.end ();
+  m_entries.push_back (entry);
+  m_nValid++;
+  if (mobility == 0)
+    {
+      m_unplaced.push_back (id);
+      return;
+    }
+  std::vector<uint32_t> &ids = m_byMobility[PeekPointer (mobility)];
+  if (ids.empty ())
+    {
+      mobility->TraceConnectWithoutContext ("CourseChange",
+                                            MakeCallback (&SpatialIndex<T>::CourseChanged, this));
+    }
+  ids.push_back (id);
+  Bin (id);
+}
+
+template <typename T>
+void
+SpatialIndex<T>::Remove (T receiver)
+{
+  for (uint32_t id = 0; id < m_entries.size (); id++)
+    {
+      Entry &entry = m_entries[id];
+      if (!entry.valid || !(entry.receiver == receiver))
+        {
+          continue;
+        }
+      if (entry.mobility == 0)
+        {
+          m_unplaced.erase (std::find (m_unplaced.begin (), m_unplaced.end (), id));
+        }
+      else
+        {
+          Unbin (id);
+          std::vector<uint32_t> &ids = m_byMobility[PeekPointer (entry.mobility)];
+          ids.erase (std::find (ids.begin (), ids.end (), id));
+          if (ids.empty ())
+            {
+              entry.mobility->TraceDisconnectWithoutContext ("CourseChange",
+                                                             MakeCallback (&SpatialIndex<T>::CourseChanged, this));
+              m_byMobility.erase (PeekPointer (entry.mobility));
+            }
+        }
+      entry.valid = false;
+      entry.receiver = T ();
+      entry.mobility = 0;
+      m_nValid--;
+    }
+}
+
+template <typename T>
+void
+SpatialIndex<T>::Clear (void)
+{
+  for (auto it = m_entries.begin (); it != m_entries.end (); it++)
+    {
+      if (it->valid && it->mobility != 0 && m_byMobility.erase (PeekPointer (it->mobility)) > 0)
+        {
+          it->mobility->TraceDisconnectWithoutContext ("CourseChange",
+                                                       MakeCallback (&SpatialIndex<T>::CourseChanged, this));
+        }
+    }
+  m_entries.clear ();
+  m_nValid = 0;
+  m_cells.clear ();
+  m_byMobility.clear ();
+  m_unplaced.clear ();
+  m_changed.clear ();
+  m_deadlines.clear ();
+}
+
+template <typename T>
+std::size_t
+SpatialIndex<T>::GetN (void) const
+{
+  return m_nValid;
+}
+
+template <typename T>
+void
+SpatialIndex<T>::GetReceivers (const Vector &position, double range, std::vector<T> &receivers)
+{
+  Update ();
+  double radius = range + m_cellSize / 2;
+  int64_t minX = GetCellIndex (position.x - radius);
+  int64_t maxX = GetCellIndex (position.x + radius);
+  int64_t minY = GetCellIndex (position.y - radius);
+  int64_t maxY = GetCellIndex (position.y + radius);
+  std::vector<uint32_t> ids = m_unplaced;
+  if (std::isinf (radius)
+      || static_cast<double> (maxX - minX + 1) * (maxY - minY + 1) > m_nValid)
+    {
+      // visiting the cells would take longer than visiting all the receivers
+      for (uint32_t id = 0; id < m_entries.size (); id++)
+        {
+          if (m_entries[id].valid)
+            {
+              receivers.push_back (m_entries[id].receiver);
+            }
+        }
+      return;
+    }
+  for (int64_t x = minX; x <= maxX; x++)
+    {
+      for (int64_t y = minY; y <= maxY; y++)
+        {
+          auto cell = m_cells.find (GetCellKey (x, y));
+          if (cell != m_cells.end ())
+            {
+              ids.insert (ids.end (), cell->second.begin (), cell->second.end ());
+            }
+        }
+    }
+  std::sort (ids.begin (), ids.end ());
+  for (auto it = ids.begin (); it != ids.end (); it++)
+    {
+      receivers.push_back (m_entries[*it].receiver);
+    }
+}
+
+template <typename T>
+int64_t
+SpatialIndex<T>::GetCellKey (int64_t x, int64_t y)
+{
+  // shift the unsigned value, shifting a negative one is undefined
+  return static_cast<int64_t> ((static_cast<uint64_t> (x) << 32) ^ (static_cast<uint64_t> (y) & 0xffffffff));
+}
+
+template <typename T>
+int64_t
+SpatialIndex<T>::GetCellIndex (double coordinate) const
+{
+  return static_cast<int64_t> (std::floor (coordinate / m_cellSize));
+}
+
+template <typename T>
+void
+SpatialIndex<T>::Bin (uint32_t id)
+{
+  Unbin (id);
+  Entry &entry = m_entries[id];
+  Vector position = entry.mobility->GetPosition ();
+  entry.cell = GetCellKey (GetCellIndex (position.x), GetCellIndex (position.y));
+  entry.binned = true;
+  m_cells[entry.cell].push_back (id);
+  double speed = entry.mobility->GetVelocity ().GetLength ();
+  if (speed > 0)
+    {
+      Time drift = std::max (Seconds (m_cellSize / 2 / speed), TimeStep (1));
+      entry.deadline = m_deadlines.insert (std::make_pair (Simulator::Now () + drift, id));
+      entry.moving = true;
+    }
+}
+
+template <typename T>
+void
+SpatialIndex<T>::Unbin (uint32_t id)
+{
+  Entry &entry = m_entries[id];
+  if (entry.binned)
+    {
+      std::vector<uint32_t> &ids = m_cells[entry.cell];
+      ids.erase (std::find (ids.begin (), ids.end (), id));
+      if (ids.empty ())
+        {
+          m_cells.erase (entry.cell);
+        }
+      entry.binned = false;
+    }
+  if (entry.moving)
+    {
+      m_deadlines.erase (entry.deadline);
+      entry.moving = false;
+    }
+}
+
+template <typename T>
+void
+SpatialIndex<T>::Update (void)
+{
+  for (auto it = m_changed.begin (); it != m_changed.end (); it++)
+    {
+      if (m_entries[*it].valid)
+        {
+          Bin (*it);
+        }
+    }
+  m_changed.clear ();
+  Time now = Simulator::Now ();
+  while (!m_deadlines.empty () && m_deadlines.begin ()->first <= now)
+    {
+      Bin (m_deadlines.begin ()->second);
+    }
+}
+
+template <typename T>
+void
+SpatialIndex<T>::CourseChanged (Ptr<const MobilityModel> mobility)
+{
+  auto it = m_byMobility.find (PeekPointer (mobility));
+  if (it != m_byMobility.end ())
+    {
+      m_changed.insert (m_changed.end (), it->second.begin (), it->second.end ());
+    }
+}
+
+} // namespace ns3
+
+#endif /* SPATIAL_INDEX_H */
@@ -25,6 +25,8 @@
 #include "ns3/constant-position-mobility-model.h"
 #include "ns3/simulator.h"
 
+#include <cmath>
+
 using namespace ns3;
 
 NS_LOG_COMPONENT_DEFINE ("PropagationLossModelsTest");
@@ -473,6 +475,74 @@ RangePropagationLossModelTestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \ingroup propagation-tests
+ *
+ * \brief PropagationLossModel::GetMaxRange Test
+ */
+class MaxRangePropagationLossModelTestCase : public TestCase
+{
+public:
+  MaxRangePropagationLossModelTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Check that the Rx power is above the threshold just within the range,
+   * and below it just beyond.
+   * \param model the loss model
+   * \param txPowerDbm the transmission power (dBm)
+   * \param rxPowerDbm the reception power threshold (dBm)
+   */
+  void CheckRange (Ptr<PropagationLossModel> model, double txPowerDbm, double rxPowerDbm);
+};
+
+MaxRangePropagationLossModelTestCase::MaxRangePropagationLossModelTestCase ()
+  : TestCase ("Test PropagationLossModel::GetMaxRange")
+{
+}
+
+void
+MaxRangePropagationLossModelTestCase::CheckRange (Ptr<PropagationLossModel> model, double txPowerDbm, double rxPowerDbm)
+{
+  double range = model->GetMaxRange (txPowerDbm, rxPowerDbm);
+  NS_TEST_ASSERT_MSG_GT (range, 0, "Expected a positive range");
+  Ptr<MobilityModel> a = CreateObject<ConstantPositionMobilityModel> ();
+  a->SetPosition (Vector (0, 0, 0));
+  Ptr<MobilityModel> b = CreateObject<ConstantPositionMobilityModel> ();
+  b->SetPosition (Vector (range * 0.99, 0, 0));
+  NS_TEST_EXPECT_MSG_GT_OR_EQ (model->CalcRxPower (txPowerDbm, a, b), rxPowerDbm, "Rx power too low within the range");
+  b->SetPosition (Vector (range * 1.01, 0, 0));
+  NS_TEST_EXPECT_MSG_LT (model->CalcRxPower (txPowerDbm, a, b), rxPowerDbm, "Rx power too high beyond the range");
+}
+
+void
+MaxRangePropagationLossModelTestCase::DoRun (void)
+{
+  Ptr<FriisPropagationLossModel> friis = CreateObject<FriisPropagationLossModel> ();
+  CheckRange (friis, 16.0206, -101);
+  Ptr<LogDistancePropagationLossModel> logDistance = CreateObject<LogDistancePropagationLossModel> ();
+  CheckRange (logDistance, 16.0206, -82);
+
+  Ptr<RangePropagationLossModel> range = CreateObject<RangePropagationLossModel> ();
+  range->SetAttribute ("MaxRange", DoubleValue (127.2));
+  NS_TEST_EXPECT_MSG_EQ_TOL (range->GetMaxRange (0, -100), 127.2, 1e-9, "Unexpected range");
+  NS_TEST_EXPECT_MSG_EQ (range->GetMaxRange (-110, -100), 0, "Unexpected range");
+
+  // a chain is bounded by its shortest range
+  logDistance->SetNext (range);
+  NS_TEST_EXPECT_MSG_EQ_TOL (logDistance->GetMaxRange (16.0206, -100), 127.2, 1e-9, "Unexpected range of the chain");
+  CheckRange (logDistance, 16.0206, -82);
+
+  // a random loss is not bounded
+  Ptr<RandomPropagationLossModel> random = CreateObject<RandomPropagationLossModel> ();
+  NS_TEST_EXPECT_MSG_EQ (std::isinf (random->GetMaxRange (16.0206, -82)), true, "Expected an infinite range");
+  range->SetNext (random);
+  NS_TEST_EXPECT_MSG_EQ (std::isinf (logDistance->GetMaxRange (16.0206, -82)), true, "Expected an infinite range of the chain");
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup propagation-tests
  *
@@ -484,6 +554,7 @@ RangePropagationLossModelTestCase::DoRun (void)
  *   - LogDistancePropagationLossModel
  *   - MatrixPropagationLossModel
  *   - RangePropagationLossModel
+ *   - PropagationLossModel::GetMaxRange
  */
 class PropagationLossModelsTestSuite : public TestSuite
 {
@@ -499,6 +570,7 @@ PropagationLossModelsTestSuite::PropagationLossModelsTestSuite ()
   AddTestCase (new LogDistancePropagationLossModelTestCase, TestCase::QUICK);
   AddTestCase (new MatrixPropagationLossModelTestCase, TestCase::QUICK);
   AddTestCase (new RangePropagationLossModelTestCase, TestCase::QUICK);
+  AddTestCase (new MaxRangePropagationLossModelTestCase, TestCase::QUICK);
 }
 
 /// Static variable for test initialization
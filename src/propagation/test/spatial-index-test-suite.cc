@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/spatial-index.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup propagation-tests
+ *
+ * \brief Check that SpatialIndex returns, in order, at least the receivers
+ * within range of a position, as they move, change course and are removed,
+ * and always the receivers without mobility model.
+ */
+class SpatialIndexTestCase : public TestCase
+{
+public:
+  SpatialIndexTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Check the receivers within range of the origin.
+   * \param expected the receivers within range
+   */
+  void CheckReceivers (std::vector<uint32_t> expected);
+
+  SpatialIndex<uint32_t> m_index;               //!< the index
+  std::vector<Ptr<MobilityModel> > m_mobility;  //!< the mobility models of the receivers
+};
+
+SpatialIndexTestCase::SpatialIndexTestCase ()
+  : TestCase ("Check the receivers found by SpatialIndex")
+{
+}
+
+void
+SpatialIndexTestCase::CheckReceivers (std::vector<uint32_t> expected)
+{
+  double range = 200;
+  std::vector<uint32_t> receivers;
+  m_index.GetReceivers (Vector (0, 0, 0), range, receivers);
+  NS_TEST_EXPECT_MSG_EQ (std::is_sorted (receivers.begin (), receivers.end ()), true,
+                         "The receivers should be in the order they were added");
+  for (auto it = expected.begin (); it != expected.end (); it++)
+    {
+      NS_TEST_EXPECT_MSG_EQ ((std::find (receivers.begin (), receivers.end (), *it) != receivers.end ()), true,
+                             "Missing receiver " << *it << " at " << Simulator::Now ().As (Time::S));
+    }
+  // the index returns the receivers of the nearby cells only
+  for (auto it = receivers.begin (); it != receivers.end (); it++)
+    {
+      if (m_mobility[*it] == 0)
+        {
+          continue;
+        }
+      NS_TEST_EXPECT_MSG_LT (m_mobility[*it]->GetPosition ().GetLength (), range + 3 * m_index.GetCellSize (),
+                             "Receiver " << *it << " is too far");
+    }
+}
+
+void
+SpatialIndexTestCase::DoRun (void)
+{
+  m_index.SetCellSize (100);
+  double positions[4] = {0, 150, 1000, 2000};
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      Ptr<MobilityModel> mobility;
+      if (i == 3)
+        {
+          Ptr<ConstantVelocityMobilityModel> moving = CreateObject<ConstantVelocityMobilityModel> ();
+          moving->SetPosition (Vector (positions[i], 0, 0));
+          moving->SetVelocity (Vector (-100, 0, 0));
+          mobility = moving;
+        }
+      else
+        {
+          mobility = CreateObject<ConstantPositionMobilityModel> ();
+          mobility->SetPosition (Vector (positions[i], 0, 0));
+        }
+      m_mobility.push_back (mobility);
+      m_index.Add (i, mobility);
+    }
+  // far receivers, so that the index visits the nearby cells only
+  for (uint32_t i = 4; i < 100; i++)
+    {
+      Ptr<MobilityModel> mobility = CreateObject<ConstantPositionMobilityModel> ();
+      mobility->SetPosition (Vector (0, 5000 + 10 * i, 0));
+      m_mobility.push_back (mobility);
+      m_index.Add (i, mobility);
+    }
+  // a receiver without position
+  m_mobility.push_back (0);
+  m_index.Add (100, 0);
+  NS_TEST_EXPECT_MSG_EQ (m_index.GetN (), 101, "Wrong number of receivers");
+
+  CheckReceivers ({0, 1, 100});
+  // the moving receiver comes within range without changing course
+  Simulator::Schedule (Seconds (18.5), &SpatialIndexTestCase::CheckReceivers, this,
+                       std::vector<uint32_t> {0, 1, 3, 100});
+  // a receiver jumps within range
+  Simulator::Schedule (Seconds (19), &MobilityModel::SetPosition, m_mobility[2], Vector (50, 50, 0));
+  Simulator::Schedule (Seconds (19), &SpatialIndexTestCase::CheckReceivers, this,
+                       std::vector<uint32_t> {0, 1, 2, 3, 100});
+  Simulator::Schedule (Seconds (19.5), &SpatialIndex<uint32_t>::Remove, &m_index, 1);
+  Simulator::Schedule (Seconds (20), &SpatialIndexTestCase::CheckReceivers, this,
+                       std::vector<uint32_t> {0, 2, 3, 100});
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (m_index.GetN (), 100, "Wrong number of receivers");
+  m_index.Clear ();
+  NS_TEST_EXPECT_MSG_EQ (m_index.GetN (), 0, "Wrong number of receivers");
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup propagation-tests
+ *
+ * \brief SpatialIndex TestSuite
+ */
+class SpatialIndexTestSuite : public TestSuite
+{
+public:
+  SpatialIndexTestSuite ();
+};
+
+SpatialIndexTestSuite::SpatialIndexTestSuite ()
+  : TestSuite ("spatial-index", UNIT)
+{
+  AddTestCase (new SpatialIndexTestCase, TestCase::QUICK);
+}
+
+static SpatialIndexTestSuite g_spatialIndexTestSuite; //!< Static variable for test initialization
@@ -19,7 +19,9 @@
  */
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <utility>
 #include <ns3/object.h>
 #include <ns3/simulator.h>
@@ -79,7 +81,8 @@ RxSpectrumModelInfo::RxSpectrumModelInfo (Ptr<const SpectrumModel> rxSpectrumMod
 }
 
 MultiModelSpectrumChannel::MultiModelSpectrumChannel ()
-  : m_numDevices {0}
+  : m_numDevices {0},
+    m_receiversChanged (true)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -90,6 +93,7 @@ MultiModelSpectrumChannel::DoDispose ()
   NS_LOG_FUNCTION (this);
   m_txSpectrumModelInfoMap.clear ();
   m_rxSpectrumModelInfoMap.clear ();
+  m_receivers.Clear ();
   SpectrumChannel::DoDispose ();
 }
 
@@ -123,6 +127,7 @@ MultiModelSpectrumChannel::RemoveRx (Ptr<SpectrumPhy> phy)
         {
           rxInfoIterator->second.m_rxPhys.erase (phyIt);
           --m_numDevices;
+          m_receiversChanged = true;
           break; // there should be at most one entry
         }
     }
@@ -142,6 +147,7 @@ MultiModelSpectrumChannel::AddRx (Ptr<SpectrumPhy> phy)
   RemoveRx (phy);
 
   ++m_numDevices;
+  m_receiversChanged = true;
 
   RxSpectrumModelInfoMap_t::iterator rxInfoIterator = m_rxSpectrumModelInfoMap.find (rxSpectrumModelUid);
 
@@ -221,6 +227,33 @@ MultiModelSpectrumChannel::FindAndEventuallyAddTxSpectrumModel (Ptr<const Spectr
   return txInfoIterator;
 }
 
+void
+MultiModelSpectrumChannel::IndexReceivers (double range)
+{
+  NS_LOG_FUNCTION (this << range);
+  if (m_receivers.GetCellSize () == 0)
+    {
+      m_receivers.SetCellSize (GetCullingCellSize (range));
+    }
+  if (m_receiversChanged)
+    {
+      m_receivers.Clear ();
+      for (RxSpectrumModelInfoMap_t::const_iterator rxInfoIterator = m_rxSpectrumModelInfoMap.begin ();
+           rxInfoIterator != m_rxSpectrumModelInfoMap.end ();
+           ++rxInfoIterator)
+        {
+          for (auto rxPhyIterator = rxInfoIterator->second.m_rxPhys.begin ();
+               rxPhyIterator != rxInfoIterator->second.m_rxPhys.end ();
+               ++rxPhyIterator)
+            {
+              m_receivers.Add (std::make_pair (rxInfoIterator->first, *rxPhyIterator),
+                               (*rxPhyIterator)->GetMobility ());
+            }
+        }
+      m_receiversChanged = false;
+    }
+}
+
 void
 MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
 {
@@ -243,6 +276,16 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
   NS_LOG_LOGIC ("converter map size: " << txInfoIteratorerator->second.m_spectrumConverterMap.size ());
   NS_LOG_LOGIC ("converter map first element: " << txInfoIteratorerator->second.m_spectrumConverterMap.begin ()->first);
 
+  std::vector<Receiver> receivers;
+  double range = txMobility ? GetCullingRange () : std::numeric_limits<double>::infinity ();
+  if (!std::isinf (range))
+    {
+      IndexReceivers (range);
+      m_receivers.GetReceivers (txMobility->GetPosition (), range, receivers);
+      NS_LOG_DEBUG ("range=" << range << "m, " << receivers.size () << " candidate receivers out of " << m_numDevices);
+    }
+  std::vector<Receiver>::const_iterator receiver = receivers.begin ();
+
   for (RxSpectrumModelInfoMap_t::const_iterator rxInfoIterator = m_rxSpectrumModelInfoMap.begin ();
        rxInfoIterator != m_rxSpectrumModelInfoMap.end ();
        ++rxInfoIterator)
@@ -250,6 +293,22 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
       SpectrumModelUid_t rxSpectrumModelUid = rxInfoIterator->second.m_rxSpectrumModel->GetUid ();
       NS_LOG_LOGIC ("rxSpectrumModelUids " << rxSpectrumModelUid);
 
+      const std::vector<Ptr<SpectrumPhy> > *rxPhys = &rxInfoIterator->second.m_rxPhys;
+      std::vector<Ptr<SpectrumPhy> > culledRxPhys;
+      if (!std::isinf (range))
+        {
+          // the receivers are indexed in the order of the RX spectrum models
+          for (; receiver != receivers.end () && receiver->first == rxSpectrumModelUid; ++receiver)
+            {
+              culledRxPhys.push_back (receiver->second);
+            }
+          if (culledRxPhys.empty ())
+            {
+              continue;
+            }
+          rxPhys = &culledRxPhys;
+        }
+
       Ptr <SpectrumValue> convertedTxPowerSpectrum;
       if (txSpectrumModelUid == rxSpectrumModelUid)
         {
@@ -268,8 +327,8 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
           convertedTxPowerSpectrum = rxConverterIterator->second.Convert (txParams->psd);
         }
 
-      for (auto rxPhyIterator = rxInfoIterator->second.m_rxPhys.begin ();
-           rxPhyIterator != rxInfoIterator->second.m_rxPhys.end ();
+      for (auto rxPhyIterator = rxPhys->begin ();
+           rxPhyIterator != rxPhys->end ();
            ++rxPhyIterator)
         {
           NS_ASSERT_MSG ((*rxPhyIterator)->GetRxSpectrumModel ()->GetUid () == rxSpectrumModelUid,
@@ -290,23 +349,26 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
                     }
                 }
 
-              NS_LOG_LOGIC ("copying signal parameters " << txParams);
-              Ptr<SpectrumSignalParameters> rxParams = txParams->Copy ();
-              rxParams->psd = Copy<SpectrumValue> (convertedTxPowerSpectrum);
+              Ptr<SpectrumSignalParameters> rxParams;
               Time delay = MicroSeconds (0);
 
               Ptr<MobilityModel> receiverMobility = (*rxPhyIterator)->GetMobility ();
 
               if (txMobility && receiverMobility)
                 {
+                  if (!std::isinf (range) && txMobility->GetDistanceFrom (receiverMobility) > range)
+                    {
+                      // culled, as the receivers not returned by the index
+                      continue;
+                    }
                   double txAntennaGain = 0;
                   double rxAntennaGain = 0;
                   double propagationGainDb = 0;
                   double pathLossDb = 0;
-                  if (rxParams->txAntenna != 0)
+                  if (txParams->txAntenna != 0)
                     {
                       Angles txAngles (receiverMobility->GetPosition (), txMobility->GetPosition ());
-                      txAntennaGain = rxParams->txAntenna->GetGainDb (txAngles);
+                      txAntennaGain = txParams->txAntenna->GetGainDb (txAngles);
                       NS_LOG_LOGIC ("txAntennaGain = " << txAntennaGain << " dB");
                       pathLossDb -= txAntennaGain;
                     }
@@ -334,8 +396,12 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
                       // beyond range
                       continue;
                     }
+                  // the copy shares the PSD, which is scaled when first accessed
+                  NS_LOG_LOGIC ("copying signal parameters " << txParams);
+                  rxParams = txParams->Copy ();
+                  rxParams->psd = convertedTxPowerSpectrum->Copy ();
                   double pathGainLinear = std::pow (10.0, (-pathLossDb) / 10.0);
-                  *(rxParams->psd) *= pathGainLinear;              
+                  *(rxParams->psd) *= pathGainLinear;
 
                   if (m_spectrumPropagationLoss)
                     {
@@ -356,6 +422,12 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
                       delay = m_propagationDelay->GetDelay (txMobility, receiverMobility);
                     }
                 }
+              else
+                {
+                  NS_LOG_LOGIC ("copying signal parameters " << txParams);
+                  rxParams = txParams->Copy ();
+                  rxParams->psd = convertedTxPowerSpectrum->Copy ();
+                }
 
               if (rxNetDevice)
                 {
@@ -27,8 +27,11 @@
 #include <ns3/spectrum-channel.h>
 #include <ns3/spectrum-propagation-loss-model.h>
 #include <ns3/propagation-delay-model.h>
+#include <ns3/spatial-index.h>
 #include <map>
 #include <set>
+#include <utility>
+#include <vector>
 
 namespace ns3 {
 
@@ -150,6 +153,16 @@ private:
    */
   virtual void StartRx (Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver);
 
+  /// A receiver and the Uid of the RX SpectrumModel it was added with
+  typedef std::pair<SpectrumModelUid_t, Ptr<SpectrumPhy> > Receiver;
+
+  /**
+   * Index the receivers again if they changed since the last transmission.
+   *
+   * \param range the culling range (m)
+   */
+  void IndexReceivers (double range);
+
   /**
    * Data structure holding, for each TX SpectrumModel,  all the
    * converters to any RX SpectrumModel, and all the corresponding
@@ -170,6 +183,10 @@ private:
    */
   std::size_t m_numDevices;
 
+  /// The receivers, in the order of m_rxSpectrumModelInfoMap, when culling them
+  SpatialIndex<Receiver> m_receivers;
+  bool m_receiversChanged; //!< whether m_receivers misses changes of the receivers
+
 };
 
 
@@ -35,6 +35,8 @@
 #include <ns3/angles.h>
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 #include "single-model-spectrum-channel.h"
 
@@ -46,6 +48,7 @@ NS_LOG_COMPONENT_DEFINE ("SingleModelSpectrumChannel");
 NS_OBJECT_ENSURE_REGISTERED (SingleModelSpectrumChannel);
 
 SingleModelSpectrumChannel::SingleModelSpectrumChannel ()
+  : m_receiversChanged (true)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -55,6 +58,7 @@ SingleModelSpectrumChannel::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
   m_phyList.clear ();
+  m_receivers.Clear ();
   m_spectrumModel = 0;
   SpectrumChannel::DoDispose ();
 }
@@ -80,6 +84,7 @@ SingleModelSpectrumChannel::RemoveRx (Ptr<SpectrumPhy> phy)
   if (it != std::end (m_phyList))
     {
       m_phyList.erase (it);
+      m_receiversChanged = true;
     }
 }
 
@@ -88,6 +93,26 @@ SingleModelSpectrumChannel::AddRx (Ptr<SpectrumPhy> phy)
 {
   NS_LOG_FUNCTION (this << phy);
   m_phyList.push_back (phy);
+  m_receiversChanged = true;
+}
+
+void
+SingleModelSpectrumChannel::IndexReceivers (double range)
+{
+  NS_LOG_FUNCTION (this << range);
+  if (m_receivers.GetCellSize () == 0)
+    {
+      m_receivers.SetCellSize (GetCullingCellSize (range));
+    }
+  if (m_receiversChanged)
+    {
+      m_receivers.Clear ();
+      for (PhyList::const_iterator it = m_phyList.begin (); it != m_phyList.end (); ++it)
+        {
+          m_receivers.Add (*it, (*it)->GetMobility ());
+        }
+      m_receiversChanged = false;
+    }
 }
 
 
@@ -118,8 +143,19 @@ SingleModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
 
   Ptr<MobilityModel> senderMobility = txParams->txPhy->GetMobility ();
 
-  for (PhyList::const_iterator rxPhyIterator = m_phyList.begin ();
-       rxPhyIterator != m_phyList.end ();
+  const PhyList *rxPhys = &m_phyList;
+  PhyList receivers;
+  double range = senderMobility ? GetCullingRange () : std::numeric_limits<double>::infinity ();
+  if (!std::isinf (range))
+    {
+      IndexReceivers (range);
+      m_receivers.GetReceivers (senderMobility->GetPosition (), range, receivers);
+      NS_LOG_DEBUG ("range=" << range << "m, " << receivers.size () << " candidate receivers out of " << m_phyList.size ());
+      rxPhys = &receivers;
+    }
+
+  for (PhyList::const_iterator rxPhyIterator = rxPhys->begin ();
+       rxPhyIterator != rxPhys->end ();
        ++rxPhyIterator)
     {
       Ptr<NetDevice> rxNetDevice = (*rxPhyIterator)->GetDevice ();
@@ -140,19 +176,23 @@ SingleModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
           Time delay  = MicroSeconds (0);
 
           Ptr<MobilityModel> receiverMobility = (*rxPhyIterator)->GetMobility ();
-          NS_LOG_LOGIC ("copying signal parameters " << txParams);
-          Ptr<SpectrumSignalParameters> rxParams = txParams->Copy ();
+          Ptr<SpectrumSignalParameters> rxParams;
 
           if (senderMobility && receiverMobility)
             {
+              if (!std::isinf (range) && senderMobility->GetDistanceFrom (receiverMobility) > range)
+                {
+                  // culled, as the receivers not returned by the index
+                  continue;
+                }
               double txAntennaGain = 0;
               double rxAntennaGain = 0;
               double propagationGainDb = 0;
               double pathLossDb = 0;
-              if (rxParams->txAntenna != 0)
+              if (txParams->txAntenna != 0)
                 {
                   Angles txAngles (receiverMobility->GetPosition (), senderMobility->GetPosition ());
-                  txAntennaGain = rxParams->txAntenna->GetGainDb (txAngles);
+                  txAntennaGain = txParams->txAntenna->GetGainDb (txAngles);
                   NS_LOG_LOGIC ("txAntennaGain = " << txAntennaGain << " dB");
                   pathLossDb -= txAntennaGain;
                 }
@@ -180,8 +220,11 @@ SingleModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
                   // beyond range
                   continue;
                 }
+              // the copy shares the PSD, which is scaled when first accessed
+              NS_LOG_LOGIC ("copying signal parameters " << txParams);
+              rxParams = txParams->Copy ();
               double pathGainLinear = std::pow (10.0, (-pathLossDb) / 10.0);
-              *(rxParams->psd) *= pathGainLinear;              
+              *(rxParams->psd) *= pathGainLinear;
 
               if (m_spectrumPropagationLoss)
                 {
@@ -193,6 +236,11 @@ SingleModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
                   delay = m_propagationDelay->GetDelay (senderMobility, receiverMobility);
                 }
             }
+          else
+            {
+              NS_LOG_LOGIC ("copying signal parameters " << txParams);
+              rxParams = txParams->Copy ();
+            }
 
 
           if (rxNetDevice)
@@ -24,6 +24,7 @@
 
 #include <ns3/spectrum-channel.h>
 #include <ns3/spectrum-model.h>
+#include <ns3/spatial-index.h>
 #include <ns3/traced-callback.h>
 
 namespace ns3 {
@@ -73,11 +74,21 @@ private:
    */
   void StartRx (Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver);
 
+  /**
+   * Index the receivers again if they changed since the last transmission.
+   *
+   * \param range the culling range (m)
+   */
+  void IndexReceivers (double range);
+
   /**
    * List of SpectrumPhy instances attached to the channel.
    */
   PhyList m_phyList;
 
+  SpatialIndex<Ptr<SpectrumPhy> > m_receivers; //!< the receivers, when culling them
+  bool m_receiversChanged; //!< whether m_receivers misses changes of m_phyList
+
   /**
    * SpectrumModel that this channel instance is supporting.
    */
@@ -19,8 +19,11 @@
  */
 
 #include <ns3/log.h>
+#include <ns3/boolean.h>
 #include <ns3/double.h>
 #include <ns3/pointer.h>
+#include <algorithm>
+#include <limits>
 
 #include "spectrum-channel.h"
 
@@ -70,6 +73,33 @@ SpectrumChannel::GetTypeId (void)
                    MakeDoubleAccessor (&SpectrumChannel::m_maxLossDb),
                    MakeDoubleChecker<double> ())
 
+    .AddAttribute ("ReceiverCulling",
+                   "If true, a transmission only visits the receivers within its range, "
+                   "looked up in a grid of their positions, instead of computing the loss "
+                   "towards every receiver. The Gain and PathLoss traces are not fired for "
+                   "the receivers out of range.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SpectrumChannel::m_culling),
+                   MakeBooleanChecker ())
+    .AddAttribute ("MaxRange",
+                   "The range of the transmissions (m) when ReceiverCulling is enabled. If zero, "
+                   "it is derived from the PropagationLossModel, MaxLossDb and CullingAntennaGain.",
+                   DoubleValue (0),
+                   MakeDoubleAccessor (&SpectrumChannel::m_maxRange),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("CullingAntennaGain",
+                   "An upper bound (dB) of the sum of the TX and RX antenna gains, used "
+                   "to derive the range of the transmissions from MaxLossDb.",
+                   DoubleValue (0),
+                   MakeDoubleAccessor (&SpectrumChannel::m_cullingAntennaGainDb),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("CullingCellSize",
+                   "The side (m) of the cells of the grid of receivers. If zero, it is "
+                   "the range of the first transmission.",
+                   DoubleValue (0),
+                   MakeDoubleAccessor (&SpectrumChannel::m_cullingCellSize),
+                   MakeDoubleChecker<double> (0))
+
     .AddAttribute ("PropagationLossModel",
                    "A pointer to the propagation loss model attached to this channel.",
                    PointerValue (0),
@@ -174,5 +204,31 @@ SpectrumChannel::GetPropagationLossModel ()
   return m_propagationLoss;
 }
 
+double
+SpectrumChannel::GetCullingRange (void) const
+{
+  NS_LOG_FUNCTION (this);
+  if (!m_culling)
+    {
+      return std::numeric_limits<double>::infinity ();
+    }
+  if (m_maxRange > 0)
+    {
+      return m_maxRange;
+    }
+  if (!m_propagationLoss)
+    {
+      // without loss, every receiver is within range
+      return std::numeric_limits<double>::infinity ();
+    }
+  return m_propagationLoss->GetMaxRange (0, -(m_maxLossDb + m_cullingAntennaGainDb));
+}
+
+double
+SpectrumChannel::GetCullingCellSize (double range) const
+{
+  return m_cullingCellSize > 0 ? m_cullingCellSize : std::max (range, 1.0);
+}
+
 
 } // namespace
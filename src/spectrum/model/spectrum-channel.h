@@ -188,6 +188,24 @@ public:
 
 protected:
 
+  /**
+   * Get the range beyond which the receivers of a transmission are culled,
+   * i.e., not visited at all. The range is the MaxRange attribute or, if
+   * zero, the distance at which the PropagationLossModel exceeds MaxLossDb
+   * minus CullingAntennaGain.
+   *
+   * \returns the range (m), infinite if ReceiverCulling is disabled or if the
+   * range is unbounded
+   */
+  double GetCullingRange (void) const;
+
+  /**
+   * \returns the side (m) of the cells of the grid of receivers, given the
+   * range of the transmissions
+   * \param range the culling range (m)
+   */
+  double GetCullingCellSize (double range) const;
+
   /**
    * The `PathLoss` trace source. Exporting the pointers to the Tx and Rx
    * SpectrumPhy and a pathloss value, in dB.
@@ -233,6 +251,10 @@ protected:
    */
   Ptr<PhasedArraySpectrumPropagationLossModel> m_phasedArraySpectrumPropagationLoss;
 
+  bool m_culling;                //!< whether to cull the receivers out of range
+  double m_maxRange;             //!< the culling range (m), if positive
+  double m_cullingAntennaGainDb; //!< upper bound of the sum of the TX and RX antenna gains (dB)
+  double m_cullingCellSize;      //!< the side (m) of the cells of the grid of receivers, if positive
 
 };
 
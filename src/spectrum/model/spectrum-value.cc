@@ -22,32 +22,120 @@
 #include <ns3/spectrum-value.h>
 #include <ns3/math.h>
 #include <ns3/log.h>
+#include <algorithm>
 
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("SpectrumValue");
 
 SpectrumValue::SpectrumValue ()
+  : m_values (std::make_shared<Values> ()),
+    m_scale (1),
+    m_exposed (false)
 {
 }
 
 SpectrumValue::SpectrumValue (Ptr<const SpectrumModel> sof)
   : m_spectrumModel (sof),
-    m_values (sof->GetNumBands ())
+    m_values (std::make_shared<Values> (sof->GetNumBands ())),
+    m_scale (1),
+    m_exposed (false)
 {
 
 }
 
+SpectrumValue::SpectrumValue (const SpectrumValue &o)
+  : SimpleRefCount<SpectrumValue> (o),
+    m_spectrumModel (o.m_spectrumModel),
+    m_scale (1),
+    m_exposed (false)
+{
+  if (o.m_exposed)
+    {
+      // the values of o may be modified through references at any time
+      m_values = std::make_shared<Values> (o.GetValues ());
+    }
+  else
+    {
+      m_values = o.m_values;
+      m_scale = o.m_scale;
+    }
+}
+
+SpectrumValue&
+SpectrumValue::operator= (const SpectrumValue &o)
+{
+  if (this == &o)
+    {
+      return *this;
+    }
+  m_spectrumModel = o.m_spectrumModel;
+  if (m_exposed)
+    {
+      // keep the references to the values of this instance valid
+      *m_values = o.GetValues ();
+      m_scale = 1;
+    }
+  else if (o.m_exposed)
+    {
+      m_values = std::make_shared<Values> (o.GetValues ());
+      m_scale = 1;
+    }
+  else
+    {
+      m_values = o.m_values;
+      m_scale = o.m_scale;
+    }
+  return *this;
+}
+
+const Values&
+SpectrumValue::GetValues () const
+{
+  if (m_scale != 1)
+    {
+      if (m_values.use_count () > 1)
+        {
+          // the other instances keep the unscaled values
+          std::shared_ptr<Values> values = std::make_shared<Values> (m_values->size ());
+          std::transform (m_values->begin (), m_values->end (), values->begin (),
+                          [this] (double v) { return v * m_scale; });
+          m_values = values;
+        }
+      else
+        {
+          for (Values::iterator it = m_values->begin (); it != m_values->end (); ++it)
+            {
+              *it *= m_scale;
+            }
+        }
+      m_scale = 1;
+    }
+  return *m_values;
+}
+
+Values&
+SpectrumValue::GetMutableValues ()
+{
+  GetValues ();
+  if (m_values.use_count () > 1)
+    {
+      m_values = std::make_shared<Values> (*m_values);
+    }
+  return *m_values;
+}
+
 double&
 SpectrumValue::operator[] (size_t index)
 {
-  return m_values.at (index);
+  m_exposed = true;
+  return GetMutableValues ().at (index);
 }
 
 const double&
 SpectrumValue::operator[] (size_t index) const
 {
-  return m_values.at (index);
+  return GetValues ().at (index);
 }
 
 
@@ -68,26 +156,28 @@ SpectrumValue::GetSpectrumModel () const
 Values::const_iterator
 SpectrumValue::ConstValuesBegin () const
 {
-  return m_values.begin ();
+  return GetValues ().begin ();
 }
 
 Values::const_iterator
 SpectrumValue::ConstValuesEnd () const
 {
-  return m_values.end ();
+  return GetValues ().end ();
 }
 
 
 Values::iterator
 SpectrumValue::ValuesBegin ()
 {
-  return m_values.begin ();
+  m_exposed = true;
+  return GetMutableValues ().begin ();
 }
 
 Values::iterator
 SpectrumValue::ValuesEnd ()
 {
-  return m_values.end ();
+  m_exposed = true;
+  return GetMutableValues ().end ();
 }
 
 Bands::const_iterator
@@ -106,13 +196,15 @@ SpectrumValue::ConstBandsEnd () const
 void
 SpectrumValue::Add (const SpectrumValue& x)
 {
-  Values::iterator it1 = m_values.begin ();
-  Values::const_iterator it2 = x.m_values.begin ();
+  Values &values = GetMutableValues ();
+  const Values &xValues = x.GetValues ();
+  Values::iterator it1 = values.begin ();
+  Values::const_iterator it2 = xValues.begin ();
 
   NS_ASSERT (m_spectrumModel == x.m_spectrumModel);
-  NS_ASSERT (m_values.size () == x.m_values.size ());
+  NS_ASSERT (values.size () == xValues.size ());
 
-  while (it1 != m_values.end ())
+  while (it1 != values.end ())
     {
       *it1 += *it2;
       ++it1;
@@ -124,9 +216,10 @@ SpectrumValue::Add (const SpectrumValue& x)
 void
 SpectrumValue::Add (double s)
 {
-  Values::iterator it1 = m_values.begin ();
+  Values &values = GetMutableValues ();
+  Values::iterator it1 = values.begin ();
 
-  while (it1 != m_values.end ())
+  while (it1 != values.end ())
     {
       *it1 += s;
       ++it1;
@@ -138,13 +231,15 @@ SpectrumValue::Add (double s)
 void
 SpectrumValue::Subtract (const SpectrumValue& x)
 {
-  Values::iterator it1 = m_values.begin ();
-  Values::const_iterator it2 = x.m_values.begin ();
+  Values &values = GetMutableValues ();
+  const Values &xValues = x.GetValues ();
+  Values::iterator it1 = values.begin ();
+  Values::const_iterator it2 = xValues.begin ();
 
   NS_ASSERT (m_spectrumModel == x.m_spectrumModel);
-  NS_ASSERT (m_values.size () == x.m_values.size ());
+  NS_ASSERT (values.size () == xValues.size ());
 
-  while (it1 != m_values.end ())
+  while (it1 != values.end ())
     {
       *it1 -= *it2;
       ++it1;
@@ -164,13 +259,15 @@ SpectrumValue::Subtract (double s)
 void
 SpectrumValue::Multiply (const SpectrumValue& x)
 {
-  Values::iterator it1 = m_values.begin ();
-  Values::const_iterator it2 = x.m_values.begin ();
+  Values &values = GetMutableValues ();
+  const Values &xValues = x.GetValues ();
+  Values::iterator it1 = values.begin ();
+  Values::const_iterator it2 = xValues.begin ();
 
   NS_ASSERT (m_spectrumModel == x.m_spectrumModel);
-  NS_ASSERT (m_values.size () == x.m_values.size ());
+  NS_ASSERT (values.size () == xValues.size ());
 
-  while (it1 != m_values.end ())
+  while (it1 != values.end ())
     {
       *it1 *= *it2;
       ++it1;
@@ -182,9 +279,17 @@ SpectrumValue::Multiply (const SpectrumValue& x)
 void
 SpectrumValue::Multiply (double s)
 {
-  Values::iterator it1 = m_values.begin ();
+  if (m_scale == 1 && m_values.use_count () > 1)
+    {
+      // defer the product until the values are accessed, so that they are
+      // copied and scaled in a single pass, if ever
+      m_scale = s;
+      return;
+    }
+  Values &values = GetMutableValues ();
+  Values::iterator it1 = values.begin ();
 
-  while (it1 != m_values.end ())
+  while (it1 != values.end ())
     {
       *it1 *= s;
       ++it1;
@@ -197,13 +302,15 @@ SpectrumValue::Multiply (double s)
 void
 SpectrumValue::Divide (const SpectrumValue& x)
 {
-  Values::iterator it1 = m_values.begin ();
-  Values::const_iterator it2 = x.m_values.begin ();
+  Values &values = GetMutableValues ();
+  const Values &xValues = x.GetValues ();
+  Values::iterator it1 = values.begin ();
+  Values::const_iterator it2 = xValues.begin ();
 
   NS_ASSERT (m_spectrumModel == x.m_spectrumModel);
-  NS_ASSERT (m_values.size () == x.m_values.size ());
+  NS_ASSERT (values.size () == xValues.size ());
 
-  while (it1 != m_values.end ())
+  while (it1 != values.end ())
     {
       *it1 /= *it2;
       ++it1;
@@ -216,9 +323,10 @@ void
 SpectrumValue::Divide (double s)
 {
   NS_LOG_FUNCTION (this << s);
-  Values::iterator it1 = m_values.begin ();
+  Values &values = GetMutableValues ();
+  Values::iterator it1 = values.begin ();
 
-  while (it1 != m_values.end ())
+  while (it1 != values.end ())
     {
       *it1 /= s;
       ++it1;
@@ -231,9 +339,10 @@ SpectrumValue::Divide (double s)
 void
 SpectrumValue::ChangeSign ()
 {
-  Values::iterator it1 = m_values.begin ();
+  Values &values = GetMutableValues ();
+  Values::iterator it1 = values.begin ();
 
-  while (it1 != m_values.end ())
+  while (it1 != values.end ())
     {
       *it1 = -(*it1);
       ++it1;
@@ -244,15 +353,16 @@ SpectrumValue::ChangeSign ()
 void
 SpectrumValue::ShiftLeft (int n)
 {
+  Values &values = GetMutableValues ();
   int i = 0;
-  while (i < (int) m_values.size () - n)
+  while (i < (int) values.size () - n)
     {
-      m_values.at (i) = m_values.at (i + n);
+      values.at (i) = values.at (i + n);
       i++;
     }
-  while (i < (int)m_values.size ())
+  while (i < (int)values.size ())
     {
-      m_values.at (i) = 0;
+      values.at (i) = 0;
       i++;
     }
 }
@@ -261,15 +371,16 @@ SpectrumValue::ShiftLeft (int n)
 void
 SpectrumValue::ShiftRight (int n)
 {
-  int i = m_values.size () - 1;
+  Values &values = GetMutableValues ();
+  int i = values.size () - 1;
   while (i - n >= 0)
     {
-      m_values.at (i) = m_values.at (i - n);
+      values.at (i) = values.at (i - n);
       i = i - 1;
     }
   while (i >= 0)
     {
-      m_values.at (i) = 0;
+      values.at (i) = 0;
       --i;
     }
 }
@@ -280,9 +391,10 @@ void
 SpectrumValue::Pow (double exp)
 {
   NS_LOG_FUNCTION (this << exp);
-  Values::iterator it1 = m_values.begin ();
+  Values &values = GetMutableValues ();
+  Values::iterator it1 = values.begin ();
 
-  while (it1 != m_values.end ())
+  while (it1 != values.end ())
     {
       *it1 = std::pow (*it1, exp);
       ++it1;
@@ -294,9 +406,10 @@ void
 SpectrumValue::Exp (double base)
 {
   NS_LOG_FUNCTION (this << base);
-  Values::iterator it1 = m_values.begin ();
+  Values &values = GetMutableValues ();
+  Values::iterator it1 = values.begin ();
 
-  while (it1 != m_values.end ())
+  while (it1 != values.end ())
     {
       *it1 = std::pow (base, *it1);
       ++it1;
@@ -308,9 +421,10 @@ void
 SpectrumValue::Log10 ()
 {
   NS_LOG_FUNCTION (this);
-  Values::iterator it1 = m_values.begin ();
+  Values &values = GetMutableValues ();
+  Values::iterator it1 = values.begin ();
 
-  while (it1 != m_values.end ())
+  while (it1 != values.end ())
     {
       *it1 = std::log10 (*it1);
       ++it1;
@@ -321,9 +435,10 @@ void
 SpectrumValue::Log2 ()
 {
   NS_LOG_FUNCTION (this);
-  Values::iterator it1 = m_values.begin ();
+  Values &values = GetMutableValues ();
+  Values::iterator it1 = values.begin ();
 
-  while (it1 != m_values.end ())
+  while (it1 != values.end ())
     {
       *it1 = log2 (*it1);
       ++it1;
@@ -335,9 +450,10 @@ void
 SpectrumValue::Log ()
 {
   NS_LOG_FUNCTION (this);
-  Values::iterator it1 = m_values.begin ();
+  Values &values = GetMutableValues ();
+  Values::iterator it1 = values.begin ();
 
-  while (it1 != m_values.end ())
+  while (it1 != values.end ())
     {
       *it1 = std::log (*it1);
       ++it1;
@@ -408,11 +524,8 @@ Integral (const SpectrumValue& arg)
 Ptr<SpectrumValue>
 SpectrumValue::Copy () const
 {
-  Ptr<SpectrumValue> p = Create<SpectrumValue> (m_spectrumModel);
-  *p = *this;
-  return p;
-
-  //  return Copy<SpectrumValue> (*this)
+  // the copy shares the values until either instance is modified
+  return Create<SpectrumValue> (*this);
 }
 
 
@@ -664,9 +777,17 @@ SpectrumValue::operator/= (double rhs)
 SpectrumValue&
 SpectrumValue::operator= (double rhs)
 {
-  Values::iterator it1 = m_values.begin ();
+  if (m_values.use_count () > 1)
+    {
+      // no need to copy the values that are overwritten
+      m_values = std::make_shared<Values> (m_values->size (), rhs);
+      m_scale = 1;
+      return *this;
+    }
+  Values &values = GetMutableValues ();
+  Values::iterator it1 = values.begin ();
 
-  while (it1 != m_values.end ())
+  while (it1 != values.end ())
     {
       *it1 = rhs;
       ++it1;
@@ -695,13 +816,13 @@ SpectrumValue::operator>> (int n) const
 uint32_t
 SpectrumValue::GetValuesN () const
 {
-  return m_values.size ();
+  return m_values->size ();
 }
 
 const double &
 SpectrumValue::ValuesAt (uint32_t pos) const
 {
-  return m_values.at (pos);
+  return GetValues ().at (pos);
 }
 
 } // namespace ns3
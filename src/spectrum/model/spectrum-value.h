@@ -24,6 +24,7 @@
 #include <ns3/ptr.h>
 #include <ns3/simple-ref-count.h>
 #include <ns3/spectrum-model.h>
+#include <memory>
 #include <ostream>
 #include <vector>
 
@@ -54,6 +55,19 @@ typedef std::vector<double> Values;
  * The intended use of this class is to represent frequency-dependent
  * things, such as power spectral densities, frequency-dependent
  * propagation losses, spectral masks, etc.
+ *
+ * Copies of a SpectrumValue share its values until either of them is
+ * modified (copy-on-write), and multiplying a shared SpectrumValue by a
+ * scalar is deferred until its values are accessed. This way, a channel
+ * can hand the same transmitted power spectral density, scaled by a
+ * different path gain, to many receivers without copying it for each of
+ * them.
+ *
+ * The non-const operator[], ValuesBegin () and ValuesEnd () detach the
+ * values of the instance, which then never shares them again: it is
+ * copied eagerly, and assigning to it overwrites its values in place.
+ * Hence, the references and iterators they return stay valid, and writes
+ * through them modify this instance only, as with a std::vector.
  */
 class SpectrumValue : public SimpleRefCount<SpectrumValue>
 {
@@ -80,6 +94,22 @@ public:
 
   SpectrumValue ();
 
+  /**
+   * Copy constructor. The copy shares the values of \p o, unless \p o
+   * handed out references to them.
+   *
+   * @param o the SpectrumValue to copy
+   */
+  SpectrumValue (const SpectrumValue &o);
+
+  /**
+   * Assignment operator. This instance shares the values of \p o, unless
+   * either of them handed out references to its values.
+   *
+   * @param o the SpectrumValue to copy
+   * @return a reference to this instance
+   */
+  SpectrumValue& operator= (const SpectrumValue &o);
 
   /**
    * Access value at given frequency index
@@ -510,7 +540,8 @@ public:
 
   /**
    *
-   * @return a Ptr to a copy of this instance
+   * @return a Ptr to a copy of this instance, which shares the values of
+   * this instance until either of them is modified
    */
   Ptr<SpectrumValue> Copy () const;
 
@@ -609,14 +640,34 @@ private:
   Ptr<const SpectrumModel> m_spectrumModel; //!< The spectrum model
 
 
+  /**
+   * Apply the pending scale factor, if any, to the values.
+   *
+   * @return the values, for reading
+   */
+  const Values& GetValues () const;
+
+  /**
+   * Apply the pending scale factor, if any, and copy the values if they
+   * are shared with other instances.
+   *
+   * @return the values, for modifying
+   */
+  Values& GetMutableValues ();
+
   /**
    * Set of values which implement the codomain of the functions in
    * the Function Space defined by SpectrumValue. There is no restriction
    * on what these values represent (a transmission power density, a
-   * propagation loss, etc.).
+   * propagation loss, etc.). They are shared by the copies of this
+   * instance and scaled by m_scale.
    *
    */
-  Values m_values;
+  mutable std::shared_ptr<Values> m_values;
+
+  mutable double m_scale; //!< scale factor not yet applied to m_values
+
+  bool m_exposed; //!< whether references to m_values were handed out, so that they are not shared
 
 
 };
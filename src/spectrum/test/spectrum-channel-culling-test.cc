@@ -0,0 +1,265 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <ns3/test.h>
+#include <ns3/simulator.h>
+#include <ns3/boolean.h>
+#include <ns3/double.h>
+#include <ns3/net-device.h>
+#include <ns3/spectrum-phy.h>
+#include <ns3/spectrum-value.h>
+#include <ns3/spectrum-signal-parameters.h>
+#include <ns3/single-model-spectrum-channel.h>
+#include <ns3/multi-model-spectrum-channel.h>
+#include <ns3/propagation-loss-model.h>
+#include <ns3/constant-position-mobility-model.h>
+
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief A SpectrumPhy that records the power it receives.
+ */
+class CullingTestSpectrumPhy : public SpectrumPhy
+{
+public:
+  /**
+   * Constructor
+   * \param model the RX spectrum model
+   */
+  CullingTestSpectrumPhy (Ptr<const SpectrumModel> model);
+
+  // inherited from SpectrumPhy
+  void SetDevice (Ptr<NetDevice> d);
+  Ptr<NetDevice> GetDevice () const;
+  void SetMobility (Ptr<MobilityModel> m);
+  Ptr<MobilityModel> GetMobility () const;
+  void SetChannel (Ptr<SpectrumChannel> c);
+  Ptr<const SpectrumModel> GetRxSpectrumModel () const;
+  Ptr<Object> GetAntenna () const;
+  void StartRx (Ptr<SpectrumSignalParameters> params);
+
+  std::vector<double> m_rxPowerW; //!< the power of the received signals (W)
+
+private:
+  Ptr<const SpectrumModel> m_model; //!< the RX spectrum model
+  Ptr<MobilityModel> m_mobility;    //!< the mobility model
+};
+
+CullingTestSpectrumPhy::CullingTestSpectrumPhy (Ptr<const SpectrumModel> model)
+  : m_model (model)
+{
+}
+
+void
+CullingTestSpectrumPhy::SetDevice (Ptr<NetDevice> d)
+{
+}
+
+Ptr<NetDevice>
+CullingTestSpectrumPhy::GetDevice () const
+{
+  return 0;
+}
+
+void
+CullingTestSpectrumPhy::SetMobility (Ptr<MobilityModel> m)
+{
+  m_mobility = m;
+}
+
+Ptr<MobilityModel>
+CullingTestSpectrumPhy::GetMobility () const
+{
+  return m_mobility;
+}
+
+void
+CullingTestSpectrumPhy::SetChannel (Ptr<SpectrumChannel> c)
+{
+}
+
+Ptr<const SpectrumModel>
+CullingTestSpectrumPhy::GetRxSpectrumModel () const
+{
+  return m_model;
+}
+
+Ptr<Object>
+CullingTestSpectrumPhy::GetAntenna () const
+{
+  return 0;
+}
+
+void
+CullingTestSpectrumPhy::StartRx (Ptr<SpectrumSignalParameters> params)
+{
+  m_rxPowerW.push_back (Integral (*params->psd));
+}
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief Check that the receivers culled by a SpectrumChannel are those
+ * beyond MaxLossDb, and that the others receive the same signals, scaled
+ * copies of a shared PSD, as without culling.
+ */
+class SpectrumChannelCullingTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   * \param multiModel whether to test MultiModelSpectrumChannel
+   */
+  SpectrumChannelCullingTestCase (bool multiModel);
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Transmit from the first PHY.
+   * \param culling whether to cull the receivers
+   * \param rxPowerW the power received by each PHY (W)
+   * \param nGains the number of times the Gain trace was fired
+   */
+  void Run (bool culling, std::vector<std::vector<double> > &rxPowerW, uint32_t &nGains);
+
+  /// Count the Gain trace
+  void Gain (Ptr<const MobilityModel>, Ptr<const MobilityModel>, double, double, double, double);
+
+  bool m_multiModel; //!< whether to test MultiModelSpectrumChannel
+  uint32_t m_nGains; //!< number of times the Gain trace was fired
+};
+
+SpectrumChannelCullingTestCase::SpectrumChannelCullingTestCase (bool multiModel)
+  : TestCase (std::string ("Receiver culling of ") + (multiModel ? "MultiModelSpectrumChannel" : "SingleModelSpectrumChannel")),
+    m_multiModel (multiModel),
+    m_nGains (0)
+{
+}
+
+void
+SpectrumChannelCullingTestCase::Gain (Ptr<const MobilityModel>, Ptr<const MobilityModel>, double, double, double, double)
+{
+  m_nGains++;
+}
+
+void
+SpectrumChannelCullingTestCase::Run (bool culling, std::vector<std::vector<double> > &rxPowerW, uint32_t &nGains)
+{
+  std::vector<double> freqs {2.400e9, 2.401e9, 2.402e9, 2.403e9};
+  Ptr<SpectrumModel> txModel = Create<SpectrumModel> (freqs);
+  // same bands, but a different model, which needs a conversion
+  Ptr<SpectrumModel> otherModel = Create<SpectrumModel> (freqs);
+
+  Ptr<SpectrumChannel> channel;
+  if (m_multiModel)
+    {
+      channel = CreateObject<MultiModelSpectrumChannel> ();
+    }
+  else
+    {
+      channel = CreateObject<SingleModelSpectrumChannel> ();
+    }
+  channel->SetAttribute ("ReceiverCulling", BooleanValue (culling));
+  // about 277 m with the default LogDistancePropagationLossModel
+  channel->SetAttribute ("MaxLossDb", DoubleValue (120));
+  channel->AddPropagationLossModel (CreateObject<LogDistancePropagationLossModel> ());
+  m_nGains = 0;
+  channel->TraceConnectWithoutContext ("Gain", MakeCallback (&SpectrumChannelCullingTestCase::Gain, this));
+
+  // the last PHY has no position, so it is never culled
+  double positions[] = {0, 10, 250, 50, 1000, 5000, 20, -1};
+  std::vector<Ptr<CullingTestSpectrumPhy> > phys;
+  for (uint32_t i = 0; i < 8; i++)
+    {
+      Ptr<CullingTestSpectrumPhy> phy = CreateObject<CullingTestSpectrumPhy> (m_multiModel && i % 2 ? otherModel : txModel);
+      if (positions[i] >= 0)
+        {
+          Ptr<MobilityModel> mobility = CreateObject<ConstantPositionMobilityModel> ();
+          mobility->SetPosition (Vector (positions[i], 0, 0));
+          phy->SetMobility (mobility);
+        }
+      channel->AddRx (phy);
+      phys.push_back (phy);
+    }
+
+  Ptr<SpectrumValue> psd = Create<SpectrumValue> (txModel);
+  (*psd) = 1e-9;
+  Ptr<SpectrumSignalParameters> params = Create<SpectrumSignalParameters> ();
+  params->psd = psd;
+  params->duration = MilliSeconds (1);
+  params->txPhy = phys[0];
+  Simulator::Schedule (Seconds (1), &SpectrumChannel::StartTx, channel, params);
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (psd->ValuesAt (0), 1e-9, "The transmitted PSD changed");
+  for (auto it = phys.begin (); it != phys.end (); it++)
+    {
+      rxPowerW.push_back ((*it)->m_rxPowerW);
+    }
+  nGains = m_nGains;
+  Simulator::Destroy ();
+}
+
+void
+SpectrumChannelCullingTestCase::DoRun (void)
+{
+  std::vector<std::vector<double> > all;
+  std::vector<std::vector<double> > culled;
+  uint32_t allGains;
+  uint32_t culledGains;
+  Run (false, all, allGains);
+  Run (true, culled, culledGains);
+
+  uint32_t expected[] = {0, 1, 1, 1, 0, 0, 1, 1};
+  for (uint32_t i = 0; i < 8; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (all[i].size (), expected[i], "Wrong number of receptions of PHY " << i);
+      NS_TEST_EXPECT_MSG_EQ (culled[i].size (), expected[i], "Wrong number of receptions of PHY " << i << " with culling");
+      for (uint32_t j = 0; j < std::min (all[i].size (), culled[i].size ()); j++)
+        {
+          NS_TEST_EXPECT_MSG_EQ (culled[i][j], all[i][j], "Different power received by PHY " << i);
+        }
+    }
+  // the receivers beyond range are not traced
+  NS_TEST_EXPECT_MSG_EQ (allGains, 6, "Wrong number of Gain traces");
+  NS_TEST_EXPECT_MSG_EQ (culledGains, 4, "Wrong number of Gain traces with culling");
+}
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief SpectrumChannel receiver culling TestSuite
+ */
+class SpectrumChannelCullingTestSuite : public TestSuite
+{
+public:
+  SpectrumChannelCullingTestSuite ();
+};
+
+SpectrumChannelCullingTestSuite::SpectrumChannelCullingTestSuite ()
+  : TestSuite ("spectrum-channel-culling", UNIT)
+{
+  AddTestCase (new SpectrumChannelCullingTestCase (false), TestCase::QUICK);
+  AddTestCase (new SpectrumChannelCullingTestCase (true), TestCase::QUICK);
+}
+
+/// Static variable for test initialization
+static SpectrumChannelCullingTestSuite g_spectrumChannelCullingTestSuite;
@@ -94,6 +94,124 @@ SpectrumValueTestCase::DoRun (void)
 }
 
 
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief Check that copies of a SpectrumValue share its values until either
+ * is modified, and that the deferred product by a scalar gives the same
+ * values as the product of a copy.
+ */
+class SpectrumValueCopyOnWriteTestCase : public TestCase
+{
+public:
+  SpectrumValueCopyOnWriteTestCase ();
+  virtual void DoRun (void);
+};
+
+SpectrumValueCopyOnWriteTestCase::SpectrumValueCopyOnWriteTestCase ()
+  : TestCase ("Copy-on-write and deferred scaling of SpectrumValue")
+{
+}
+
+void
+SpectrumValueCopyOnWriteTestCase::DoRun (void)
+{
+  std::vector<double> freqs {1, 2, 3, 4};
+  Ptr<SpectrumModel> model = Create<SpectrumModel> (freqs);
+  Ptr<SpectrumValue> filled = Create<SpectrumValue> (model);
+  for (uint32_t i = 0; i < filled->GetValuesN (); i++)
+    {
+      (*filled)[i] = 0.1 * (i + 1);
+    }
+  // the values written through references are not shared, those of a copy are
+  Ptr<SpectrumValue> psd = filled->Copy ();
+  const SpectrumValue &original = *psd;
+
+  // a scaled copy leaves the original unchanged
+  Ptr<SpectrumValue> scaled = psd->Copy ();
+  *scaled *= 0.3;
+  Ptr<SpectrumValue> copy = psd->Copy ();
+  (*copy)[0] = 7;
+  for (uint32_t i = 0; i < psd->GetValuesN (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (original[i], 0.1 * (i + 1), "The original changed");
+      NS_TEST_EXPECT_MSG_EQ (scaled->ValuesAt (i), 0.1 * (i + 1) * 0.3, "Wrong scaled value");
+      NS_TEST_EXPECT_MSG_EQ ((*copy)[i], (i == 0 ? 7 : 0.1 * (i + 1)), "Wrong copied value");
+    }
+
+  // scaling twice applies both factors in turn
+  Ptr<SpectrumValue> twice = psd->Copy ();
+  *twice *= 0.3;
+  *twice *= 0.7;
+  NS_TEST_EXPECT_MSG_EQ (Sum (*twice), ((0.1 * 0.3) * 0.7) + ((0.2 * 0.3) * 0.7) + ((0.1 * 3 * 0.3) * 0.7) + ((0.1 * 4 * 0.3) * 0.7),
+                         "Wrong value scaled twice");
+
+  // modifying the original leaves its copies unchanged
+  *psd += 1;
+  NS_TEST_EXPECT_MSG_EQ (scaled->ValuesAt (1), 0.2 * 0.3, "A copy changed with the original");
+  NS_TEST_EXPECT_MSG_EQ (original[1], 0.2 + 1, "Wrong modified value");
+}
+
+
+/**
+ * \ingroup spectrum-tests
+ *
+ * \brief Check that the references and iterators returned by the non-const
+ * accessors of a SpectrumValue stay valid, and modify that instance only,
+ * after it is copied or assigned.
+ */
+class SpectrumValueReferenceTestCase : public TestCase
+{
+public:
+  SpectrumValueReferenceTestCase ();
+  virtual void DoRun (void);
+};
+
+SpectrumValueReferenceTestCase::SpectrumValueReferenceTestCase ()
+  : TestCase ("References to the values of a copied SpectrumValue")
+{
+}
+
+void
+SpectrumValueReferenceTestCase::DoRun (void)
+{
+  std::vector<double> freqs {1, 2, 3, 4};
+  Ptr<SpectrumModel> model = Create<SpectrumModel> (freqs);
+  SpectrumValue value (model);
+  double &first = value[0];
+  Values::iterator second = value.ValuesBegin () + 1;
+
+  // writing through the references leaves the copies unchanged
+  SpectrumValue copy = value;
+  Ptr<SpectrumValue> copyPtr = value.Copy ();
+  first = 5;
+  *second = 6;
+  NS_TEST_EXPECT_MSG_EQ (value.ValuesAt (0), 5, "Write through operator[] lost");
+  NS_TEST_EXPECT_MSG_EQ (value.ValuesAt (1), 6, "Write through ValuesBegin () lost");
+  NS_TEST_EXPECT_MSG_EQ (Sum (copy), 0, "A copy changed through a reference");
+  NS_TEST_EXPECT_MSG_EQ (Sum (*copyPtr), 0, "A copy changed through a reference");
+
+  // assigning a shared, scaled value keeps the references valid
+  SpectrumValue other (model);
+  other = 1;
+  SpectrumValue shared = other;
+  shared *= 2;
+  value = shared;
+  NS_TEST_EXPECT_MSG_EQ (first, 2, "Wrong assigned value");
+  first = 7;
+  *second = 8;
+  NS_TEST_EXPECT_MSG_EQ (value.ValuesAt (0), 7, "Write through operator[] lost after an assignment");
+  NS_TEST_EXPECT_MSG_EQ (value.ValuesAt (1), 8, "Write through ValuesBegin () lost after an assignment");
+  NS_TEST_EXPECT_MSG_EQ (Sum (shared), 8, "The assigned value changed through a reference");
+  NS_TEST_EXPECT_MSG_EQ (Sum (other), 4, "The assigned value changed through a reference");
+
+  // an instance assigned from value does not share its values either
+  other = value;
+  first = 9;
+  NS_TEST_EXPECT_MSG_EQ (other.ValuesAt (0), 7, "An assigned instance changed through a reference");
+}
+
+
 
 
 /**
@@ -260,6 +378,9 @@ SpectrumValueTestSuite::SpectrumValueTestSuite ()
   tv1rs3 = v1 >> 3;
   AddTestCase (new SpectrumValueTestCase (tv1rs3, v1rs3, "tv1rs3 = v1 >> 3"), TestCase::QUICK);
 
+  AddTestCase (new SpectrumValueCopyOnWriteTestCase, TestCase::QUICK);
+  AddTestCase (new SpectrumValueReferenceTestCase, TestCase::QUICK);
+
 
 }
 
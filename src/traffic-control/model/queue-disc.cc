@@ -322,6 +322,8 @@ QueueDisc::QueueDisc (QueueDiscSizePolicy policy)
   :  m_nPackets (0),
      m_nBytes (0),
      m_maxSize (QueueSize ("1p")),         // to avoid that setting the mode at construction time is ignored
+     m_nVirtualPackets (0),
+     m_nVirtualBytes (0),
      m_running (false),
      m_peeked (false),
      m_sizePolicy (policy),
@@ -476,6 +478,13 @@ QueueDisc::GetMaxSize (void) const
     }
 }
 
+QueueDiscSizePolicy
+QueueDisc::GetSizePolicy (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_sizePolicy;
+}
+
 bool
 QueueDisc::SetMaxSize (QueueSize size)
 {
@@ -524,15 +533,30 @@ QueueDisc::GetCurrentSize (void)
 
   if (GetMaxSize ().GetUnit () == QueueSizeUnit::PACKETS)
     {
-      return QueueSize (QueueSizeUnit::PACKETS, m_nPackets);
+      return QueueSize (QueueSizeUnit::PACKETS, m_nPackets + m_nVirtualPackets);
     }
   if (GetMaxSize ().GetUnit () == QueueSizeUnit::BYTES)
     {
-      return QueueSize (QueueSizeUnit::BYTES, m_nBytes);
+      return QueueSize (QueueSizeUnit::BYTES, m_nBytes + m_nVirtualBytes);
     }
   NS_ABORT_MSG ("Unknown queue size unit");
 }
 
+void
+QueueDisc::SetVirtualBacklog (uint32_t nPackets, uint32_t nBytes)
+{
+  NS_LOG_FUNCTION (this << nPackets << nBytes);
+  m_nVirtualPackets = nPackets;
+  m_nVirtualBytes = nBytes;
+}
+
+uint32_t
+QueueDisc::GetVirtualBytes (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_nVirtualBytes;
+}
+
 void
 QueueDisc::SetNetDeviceQueueInterface (Ptr<NetDeviceQueueInterface> ndqi)
 {
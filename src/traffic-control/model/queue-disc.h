@@ -315,6 +315,13 @@ public:
    */
   QueueSize GetMaxSize (void) const;
 
+  /**
+   * \brief Get the size policy of the queue disc.
+   *
+   * \returns the size policy of the queue disc.
+   */
+  QueueDiscSizePolicy GetSizePolicy (void) const;
+
   /**
    * \brief Set the maximum size of the queue disc.
    *
@@ -330,11 +337,32 @@ public:
    *        operating in bytes mode, or packets, otherwise.
    *
    * Do not call this method if the queue disc size is not limited.
+   * The virtual backlog is included.
    *
    * \returns The queue disc size in bytes or packets.
    */
   QueueSize GetCurrentSize (void);
 
+  /**
+   * \brief Set the virtual backlog of the queue disc.
+   *
+   * The virtual backlog stands for packets of traffic modeled at the flow
+   * level (e.g., by FluidTrafficModel) that would be waiting in this queue
+   * disc. It is not stored, but it is counted by GetCurrentSize (), so that
+   * the queue discs checking their size before enqueuing a packet drop the
+   * packets that would not fit.
+   *
+   * \param nPackets number of packets of the virtual backlog
+   * \param nBytes number of bytes of the virtual backlog
+   */
+  void SetVirtualBacklog (uint32_t nPackets, uint32_t nBytes);
+
+  /**
+   * \brief Get the number of bytes of the virtual backlog.
+   * \return the number of bytes of the virtual backlog.
+   */
+  uint32_t GetVirtualBytes (void) const;
+
   /**
    * \brief Retrieve all the collected statistics.
    * \return the collected statistics.
@@ -688,6 +716,8 @@ private:
   TracedValue<uint32_t> m_nBytes;   //!< Number of bytes in the queue
   TracedCallback<Time> m_sojourn;   //!< Sojourn time of the latest dequeued packet
   QueueSize m_maxSize;              //!< max queue size
+  uint32_t m_nVirtualPackets;       //!< Number of packets of the virtual backlog
+  uint32_t m_nVirtualBytes;         //!< Number of bytes of the virtual backlog
 
   Stats m_stats;                    //!< The collected statistics
   uint32_t m_quota;                 //!< Maximum number of packets dequeued in a qdisc run
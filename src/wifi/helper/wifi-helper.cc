@@ -22,9 +22,11 @@
 
 #include "ns3/wifi-net-device.h"
 #include "ns3/ap-wifi-mac.h"
+#include "ns3/sta-wifi-mac.h"
 #include "ns3/ampdu-subframe-header.h"
 #include "ns3/mobility-model.h"
 #include "ns3/log.h"
+#include "ns3/abort.h"
 #include "ns3/pointer.h"
 #include "ns3/radiotap-header.h"
 #include "ns3/config.h"
@@ -658,7 +660,8 @@ WifiHelper::~WifiHelper ()
 WifiHelper::WifiHelper ()
   : m_standard (WIFI_STANDARD_80211ax),
     m_selectQueueCallback (&SelectQueueByDSField),
-    m_enableFlowControl (true)
+    m_enableFlowControl (true),
+    m_enablePhyAbstraction (false)
 {
   SetRemoteStationManager ("ns3::IdealWifiManager");
 }
@@ -675,6 +678,12 @@ WifiHelper::DisableFlowControl (void)
   m_enableFlowControl = false;
 }
 
+void
+WifiHelper::EnablePhyAbstraction (void)
+{
+  m_enablePhyAbstraction = true;
+}
+
 void
 WifiHelper::SetSelectQueueCallback (SelectQueueCallback f)
 {
@@ -721,6 +730,10 @@ WifiHelper::Install (const WifiPhyHelper &phyHelper,
       Ptr<WifiRemoteStationManager> manager = m_stationManager.Create<WifiRemoteStationManager> ();
       Ptr<WifiPhy> phy = phyHelper.Create (node, device);
       phy->ConfigureStandard (m_standard);
+      if (m_enablePhyAbstraction)
+        {
+          phy->SetAbstraction (true);
+        }
       device->SetPhy (phy);
       Ptr<WifiMac> mac = macHelper.Create (device, m_standard);
       device->SetMac (mac);
@@ -941,4 +954,21 @@ WifiHelper::AssignStreams (NetDeviceContainer c, int64_t stream)
   return (currentStream - stream);
 }
 
+void
+WifiHelper::PreAssociate (NetDeviceContainer staDevices, Ptr<NetDevice> apDevice)
+{
+  Ptr<WifiNetDevice> apWifi = DynamicCast<WifiNetDevice> (apDevice);
+  NS_ABORT_MSG_IF (apWifi == 0, "Not a WifiNetDevice");
+  Ptr<ApWifiMac> apMac = DynamicCast<ApWifiMac> (apWifi->GetMac ());
+  NS_ABORT_MSG_IF (apMac == 0, "Not an AP device");
+  for (NetDeviceContainer::Iterator i = staDevices.Begin (); i != staDevices.End (); ++i)
+    {
+      Ptr<WifiNetDevice> wifi = DynamicCast<WifiNetDevice> (*i);
+      NS_ABORT_MSG_IF (wifi == 0, "Not a WifiNetDevice");
+      Ptr<StaWifiMac> staMac = DynamicCast<StaWifiMac> (wifi->GetMac ());
+      NS_ABORT_MSG_IF (staMac == 0, "Not a non-AP STA device");
+      staMac->PreAssociate (apMac);
+    }
+}
+
 } //namespace ns3
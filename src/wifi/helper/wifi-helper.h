@@ -326,6 +326,15 @@ public:
    */
   void DisableFlowControl (void);
 
+  /**
+   * Receive the PPDUs at an abstraction level on the PHYs of the devices
+   * created by this helper (\see WifiPhy::SetAbstraction). This saves
+   * most of the events and computations of the receptions of the PHY
+   * headers and payloads, while notifying the MAC at the same times,
+   * at the expense of the accuracy of the reception failures.
+   */
+  void EnablePhyAbstraction (void);
+
   /**
    * \param phy the PHY helper to create PHY objects
    * \param mac the MAC helper to create MAC objects
@@ -409,6 +418,16 @@ public:
   */
   int64_t AssignStreams (NetDeviceContainer c, int64_t stream);
 
+  /**
+   * Associate the given stations with the given AP without any probe or
+   * association exchange (see StaWifiMac::PreAssociate). This must be called
+   * after the devices have been installed and before the simulation starts.
+   *
+   * \param staDevices the devices of the non-AP stations
+   * \param apDevice the device of the AP
+   */
+  static void PreAssociate (NetDeviceContainer staDevices, Ptr<NetDevice> apDevice);
+
 
 protected:
   ObjectFactory m_stationManager;            ///< station manager
@@ -417,6 +436,7 @@ protected:
   SelectQueueCallback m_selectQueueCallback; ///< select queue callback
   ObjectFactory m_obssPdAlgorithm;           ///< OBSS_PD algorithm
   bool m_enableFlowControl;                  //!< whether to enable flow control
+  bool m_enablePhyAbstraction;               //!< whether to receive the PPDUs at an abstraction level
 };
 
 } //namespace ns3
@@ -805,6 +805,33 @@ ApWifiMac::SendAssocResp (Mac48Address to, bool success, bool isReassoc)
   hdr.SetDsNotFrom ();
   hdr.SetDsNotTo ();
   Ptr<Packet> packet = Create<Packet> ();
+  packet->AddHeader (GetAssocResp (to, success, isReassoc));
+
+  if (!GetQosSupported ())
+    {
+      GetTxop ()->Queue (packet, hdr);
+    }
+  // "A QoS STA that transmits a Management frame determines access category used
+  // for medium access in transmission of the Management frame as follows
+  // (If dot11QMFActivated is false or not present)
+  // — If the Management frame is individually addressed to a non-QoS STA, category
+  //   AC_BE should be selected.
+  // — If category AC_BE was not selected by the previous step, category AC_VO
+  //   shall be selected." (Sec. 10.2.3.2 of 802.11-2020)
+  else if (!GetWifiRemoteStationManager ()->GetQosSupported (to))
+    {
+      GetBEQueue ()->Queue (packet, hdr);
+    }
+  else
+    {
+      GetVOQueue ()->Queue (packet, hdr);
+    }
+}
+
+MgtAssocResponseHeader
+ApWifiMac::GetAssocResp (Mac48Address to, bool success, bool isReassoc)
+{
+  NS_LOG_FUNCTION (this << to << success << isReassoc);
   MgtAssocResponseHeader assoc;
   StatusCode code;
   if (success)
@@ -875,48 +902,18 @@ ApWifiMac::SendAssocResp (Mac48Address to, bool success, bool isReassoc)
       assoc.SetHeOperation (GetHeOperation ());
       assoc.SetMuEdcaParameterSet (GetMuEdcaParameterSet ());
     }
-  packet->AddHeader (assoc);
-
-  if (!GetQosSupported ())
-    {
-      GetTxop ()->Queue (packet, hdr);
-    }
-  // "A QoS STA that transmits a Management frame determines access category used
-  // for medium access in transmission of the Management frame as follows
-  // (If dot11QMFActivated is false or not present)
-  // — If the Management frame is individually addressed to a non-QoS STA, category
-  //   AC_BE should be selected.
-  // — If category AC_BE was not selected by the previous step, category AC_VO
-  //   shall be selected." (Sec. 10.2.3.2 of 802.11-2020)
-  else if (!GetWifiRemoteStationManager ()->GetQosSupported (to))
-    {
-      GetBEQueue ()->Queue (packet, hdr);
-    }
-  else
-    {
-      GetVOQueue ()->Queue (packet, hdr);
-    }
+  return assoc;
 }
 
-void
-ApWifiMac::SendOneBeacon (void)
+MgtBeaconHeader
+ApWifiMac::GetBeaconHeader (void) const
 {
   NS_LOG_FUNCTION (this);
-  WifiMacHeader hdr;
-  hdr.SetType (WIFI_MAC_MGT_BEACON);
-  hdr.SetAddr1 (Mac48Address::GetBroadcast ());
-  hdr.SetAddr2 (GetAddress ());
-  hdr.SetAddr3 (GetAddress ());
-  hdr.SetDsNotFrom ();
-  hdr.SetDsNotTo ();
-  Ptr<Packet> packet = Create<Packet> ();
   MgtBeaconHeader beacon;
   beacon.SetSsid (GetSsid ());
   beacon.SetSupportedRates (GetSupportedRates ());
   beacon.SetBeaconIntervalUs (GetBeaconInterval ().GetMicroSeconds ());
   beacon.SetCapabilities (GetCapabilities ());
-  GetWifiRemoteStationManager ()->SetShortPreambleEnabled (m_shortPreambleEnabled);
-  GetWifiRemoteStationManager ()->SetShortSlotTimeEnabled (m_shortSlotTimeEnabled);
   if (GetDsssSupported ())
     {
       beacon.SetDsssParameterSet (GetDsssParameterSet ());
@@ -946,7 +943,24 @@ ApWifiMac::SendOneBeacon (void)
       beacon.SetHeOperation (GetHeOperation ());
       beacon.SetMuEdcaParameterSet (GetMuEdcaParameterSet ());
     }
-  packet->AddHeader (beacon);
+  return beacon;
+}
+
+void
+ApWifiMac::SendOneBeacon (void)
+{
+  NS_LOG_FUNCTION (this);
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_MGT_BEACON);
+  hdr.SetAddr1 (Mac48Address::GetBroadcast ());
+  hdr.SetAddr2 (GetAddress ());
+  hdr.SetAddr3 (GetAddress ());
+  hdr.SetDsNotFrom ();
+  hdr.SetDsNotTo ();
+  Ptr<Packet> packet = Create<Packet> ();
+  GetWifiRemoteStationManager ()->SetShortPreambleEnabled (m_shortPreambleEnabled);
+  GetWifiRemoteStationManager ()->SetShortSlotTimeEnabled (m_shortSlotTimeEnabled);
+  packet->AddHeader (GetBeaconHeader ());
 
   //The beacon has it's own special queue, so we load it in there
   m_beaconTxop->Queue (packet, hdr);
@@ -1103,139 +1117,11 @@ ApWifiMac::Receive (Ptr<WifiMacQueueItem> mpdu)
           if (hdr->IsAssocReq ())
             {
               NS_LOG_DEBUG ("Association request received from " << from);
-              //first, verify that the the station's supported
-              //rate set is compatible with our Basic Rate set
               MgtAssocRequestHeader assocReq;
               packet->PeekHeader (assocReq);
-              CapabilityInformation capabilities = assocReq.GetCapabilities ();
-              GetWifiRemoteStationManager ()->AddSupportedPhyPreamble (from, capabilities.IsShortPreamble ());
-              SupportedRates rates = assocReq.GetSupportedRates ();
-              bool problem = false;
-              if (rates.GetNRates () == 0)
-                {
-                  problem = true;
-                }
-              if (GetHtSupported ())
-                {
-                  //check whether the HT STA supports all MCSs in Basic MCS Set
-                  HtCapabilities htcapabilities = assocReq.GetHtCapabilities ();
-                  if (htcapabilities.IsSupportedMcs (0))
-                    {
-                      for (uint8_t i = 0; i < GetWifiRemoteStationManager ()->GetNBasicMcs (); i++)
-                        {
-                          WifiMode mcs = GetWifiRemoteStationManager ()->GetBasicMcs (i);
-                          if (!htcapabilities.IsSupportedMcs (mcs.GetMcsValue ()))
-                            {
-                              problem = true;
-                              break;
-                            }
-                        }
-                    }
-                }
-              if (GetVhtSupported ())
-                {
-                  //check whether the VHT STA supports all MCSs in Basic MCS Set
-                  VhtCapabilities vhtcapabilities = assocReq.GetVhtCapabilities ();
-                  if (vhtcapabilities.GetVhtCapabilitiesInfo () != 0)
-                    {
-                      for (uint8_t i = 0; i < GetWifiRemoteStationManager ()->GetNBasicMcs (); i++)
-                        {
-                          WifiMode mcs = GetWifiRemoteStationManager ()->GetBasicMcs (i);
-                          if (!vhtcapabilities.IsSupportedTxMcs (mcs.GetMcsValue ()))
-                            {
-                              problem = true;
-                              break;
-                            }
-                        }
-                    }
-                }
-              if (GetHeSupported ())
-                {
-                  //check whether the HE STA supports all MCSs in Basic MCS Set
-                  HeCapabilities hecapabilities = assocReq.GetHeCapabilities ();
-                  if (hecapabilities.GetSupportedMcsAndNss () != 0)
-                    {
-                      for (uint8_t i = 0; i < GetWifiRemoteStationManager ()->GetNBasicMcs (); i++)
-                        {
-                          WifiMode mcs = GetWifiRemoteStationManager ()->GetBasicMcs (i);
-                          if (!hecapabilities.IsSupportedTxMcs (mcs.GetMcsValue ()))
-                            {
-                              problem = true;
-                              break;
-                            }
-                        }
-                    }
-                }
-              if (problem)
-                {
-                  NS_LOG_DEBUG ("One of the Basic Rate set mode is not supported by the station: send association response with an error status");
-                  SendAssocResp (hdr->GetAddr2 (), false, false);
-                }
-              else
-                {
-                  NS_LOG_DEBUG ("The Basic Rate set modes are supported by the station");
-                  //record all its supported modes in its associated WifiRemoteStation
-                  for (const auto & mode : GetWifiPhy ()->GetModeList ())
-                    {
-                      if (rates.IsSupportedRate (mode.GetDataRate (GetWifiPhy ()->GetChannelWidth ())))
-                        {
-                          GetWifiRemoteStationManager ()->AddSupportedMode (from, mode);
-                        }
-                    }
-                  if (GetErpSupported () && GetWifiRemoteStationManager ()->GetErpOfdmSupported (from) && capabilities.IsShortSlotTime ())
-                    {
-                      GetWifiRemoteStationManager ()->AddSupportedErpSlotTime (from, true);
-                    }
-                  if (GetHtSupported ())
-                    {
-                      HtCapabilities htCapabilities = assocReq.GetHtCapabilities ();
-                      if (htCapabilities.IsSupportedMcs (0))
-                        {
-                          GetWifiRemoteStationManager ()->AddStationHtCapabilities (from, htCapabilities);
-                        }
-                    }
-                  if (GetVhtSupported ())
-                    {
-                      VhtCapabilities vhtCapabilities = assocReq.GetVhtCapabilities ();
-                      //we will always fill in RxHighestSupportedLgiDataRate field at TX, so this can be used to check whether it supports VHT
-                      if (vhtCapabilities.GetRxHighestSupportedLgiDataRate () > 0)
-                        {
-                          GetWifiRemoteStationManager ()->AddStationVhtCapabilities (from, vhtCapabilities);
-                          for (const auto & mcs : GetWifiPhy ()->GetMcsList (WIFI_MOD_CLASS_VHT))
-                            {
-                              if (vhtCapabilities.IsSupportedTxMcs (mcs.GetMcsValue ()))
-                                {
-                                  GetWifiRemoteStationManager ()->AddSupportedMcs (hdr->GetAddr2 (), mcs);
-                                  //here should add a control to add basic MCS when it is implemented
-                                }
-                            }
-                        }
-                    }
-                  if (GetHtSupported ())
-                    {
-                      ExtendedCapabilities extendedCapabilities = assocReq.GetExtendedCapabilities ();
-                      //TODO: to be completed
-                    }
-                  if (GetHeSupported ())
-                    {
-                      HeCapabilities heCapabilities = assocReq.GetHeCapabilities ();
-                      if (heCapabilities.GetSupportedMcsAndNss () != 0)
-                        {
-                          GetWifiRemoteStationManager ()->AddStationHeCapabilities (from, heCapabilities);
-                          for (const auto & mcs : GetWifiPhy ()->GetMcsList (WIFI_MOD_CLASS_HE))
-                            {
-                              if (heCapabilities.IsSupportedTxMcs (mcs.GetMcsValue ()))
-                                {
-                                  GetWifiRemoteStationManager ()->AddSupportedMcs (hdr->GetAddr2 (), mcs);
-                                  //here should add a control to add basic MCS when it is implemented
-                                }
-                            }
-                        }
-                    }
-                  GetWifiRemoteStationManager ()->RecordWaitAssocTxOk (from);
-                  NS_LOG_DEBUG ("Send association response with success status");
-                  SendAssocResp (hdr->GetAddr2 (), true, false);
-                }
+              bool success = ReceiveAssocRequest (assocReq, from);
+              NS_LOG_DEBUG ("Send association response with " << (success ? "success" : "error") << " status");
+              SendAssocResp (from, success, false);
               return;
             }
           else if (hdr->IsReassocReq ())
@@ -1410,6 +1296,156 @@ ApWifiMac::Receive (Ptr<WifiMacQueueItem> mpdu)
   WifiMac::Receive (Create<WifiMacQueueItem> (packet, *hdr));
 }
 
+bool
+ApWifiMac::ReceiveAssocRequest (const MgtAssocRequestHeader& assocReq, const Mac48Address& from)
+{
+  NS_LOG_FUNCTION (this << assocReq << from);
+  //first, verify that the the station's supported
+  //rate set is compatible with our Basic Rate set
+  CapabilityInformation capabilities = assocReq.GetCapabilities ();
+  GetWifiRemoteStationManager ()->AddSupportedPhyPreamble (from, capabilities.IsShortPreamble ());
+  SupportedRates rates = assocReq.GetSupportedRates ();
+  bool problem = false;
+  if (rates.GetNRates () == 0)
+    {
+      problem = true;
+    }
+  if (GetHtSupported ())
+    {
+      //check whether the HT STA supports all MCSs in Basic MCS Set
+      HtCapabilities htcapabilities = assocReq.GetHtCapabilities ();
+      if (htcapabilities.IsSupportedMcs (0))
+        {
+          for (uint8_t i = 0; i < GetWifiRemoteStationManager ()->GetNBasicMcs (); i++)
+            {
+              WifiMode mcs = GetWifiRemoteStationManager ()->GetBasicMcs (i);
+              if (!htcapabilities.IsSupportedMcs (mcs.GetMcsValue ()))
+                {
+                  problem = true;
+                  break;
+                }
+            }
+        }
+    }
+  if (GetVhtSupported ())
+    {
+      //check whether the VHT STA supports all MCSs in Basic MCS Set
+      VhtCapabilities vhtcapabilities = assocReq.GetVhtCapabilities ();
+      if (vhtcapabilities.GetVhtCapabilitiesInfo () != 0)
+        {
+          for (uint8_t i = 0; i < GetWifiRemoteStationManager ()->GetNBasicMcs (); i++)
+            {
+              WifiMode mcs = GetWifiRemoteStationManager ()->GetBasicMcs (i);
+              if (!vhtcapabilities.IsSupportedTxMcs (mcs.GetMcsValue ()))
+                {
+                  problem = true;
+                  break;
+                }
+            }
+        }
+    }
+  if (GetHeSupported ())
+    {
+      //check whether the HE STA supports all MCSs in Basic MCS Set
+      HeCapabilities hecapabilities = assocReq.GetHeCapabilities ();
+      if (hecapabilities.GetSupportedMcsAndNss () != 0)
+        {
+          for (uint8_t i = 0; i < GetWifiRemoteStationManager ()->GetNBasicMcs (); i++)
+            {
+              WifiMode mcs = GetWifiRemoteStationManager ()->GetBasicMcs (i);
+              if (!hecapabilities.IsSupportedTxMcs (mcs.GetMcsValue ()))
+                {
+                  problem = true;
+                  break;
+                }
+            }
+        }
+    }
+  if (problem)
+    {
+      NS_LOG_DEBUG ("One of the Basic Rate set mode is not supported by the station");
+      return false;
+    }
+  else
+    {
+      NS_LOG_DEBUG ("The Basic Rate set modes are supported by the station");
+      //record all its supported modes in its associated WifiRemoteStation
+      for (const auto & mode : GetWifiPhy ()->GetModeList ())
+        {
+          if (rates.IsSupportedRate (mode.GetDataRate (GetWifiPhy ()->GetChannelWidth ())))
+            {
+              GetWifiRemoteStationManager ()->AddSupportedMode (from, mode);
+            }
+        }
+      if (GetErpSupported () && GetWifiRemoteStationManager ()->GetErpOfdmSupported (from) && capabilities.IsShortSlotTime ())
+        {
+          GetWifiRemoteStationManager ()->AddSupportedErpSlotTime (from, true);
+        }
+      if (GetHtSupported ())
+        {
+          HtCapabilities htCapabilities = assocReq.GetHtCapabilities ();
+          if (htCapabilities.IsSupportedMcs (0))
+            {
+              GetWifiRemoteStationManager ()->AddStationHtCapabilities (from, htCapabilities);
+            }
+        }
+      if (GetVhtSupported ())
+        {
+          VhtCapabilities vhtCapabilities = assocReq.GetVhtCapabilities ();
+          //we will always fill in RxHighestSupportedLgiDataRate field at TX, so this can be used to check whether it supports VHT
+          if (vhtCapabilities.GetRxHighestSupportedLgiDataRate () > 0)
+            {
+              GetWifiRemoteStationManager ()->AddStationVhtCapabilities (from, vhtCapabilities);
+              for (const auto & mcs : GetWifiPhy ()->GetMcsList (WIFI_MOD_CLASS_VHT))
+                {
+                  if (vhtCapabilities.IsSupportedTxMcs (mcs.GetMcsValue ()))
+                    {
+                      GetWifiRemoteStationManager ()->AddSupportedMcs (from, mcs);
+                      //here should add a control to add basic MCS when it is implemented
+                    }
+                }
+            }
+        }
+      if (GetHtSupported ())
+        {
+          ExtendedCapabilities extendedCapabilities = assocReq.GetExtendedCapabilities ();
+          //TODO: to be completed
+        }
+      if (GetHeSupported ())
+        {
+          HeCapabilities heCapabilities = assocReq.GetHeCapabilities ();
+          if (heCapabilities.GetSupportedMcsAndNss () != 0)
+            {
+              GetWifiRemoteStationManager ()->AddStationHeCapabilities (from, heCapabilities);
+              for (const auto & mcs : GetWifiPhy ()->GetMcsList (WIFI_MOD_CLASS_HE))
+                {
+                  if (heCapabilities.IsSupportedTxMcs (mcs.GetMcsValue ()))
+                    {
+                      GetWifiRemoteStationManager ()->AddSupportedMcs (from, mcs);
+                      //here should add a control to add basic MCS when it is implemented
+                    }
+                }
+            }
+        }
+      GetWifiRemoteStationManager ()->RecordWaitAssocTxOk (from);
+    }
+  return !problem;
+}
+
+MgtAssocResponseHeader
+ApWifiMac::PreAssociate (const MgtAssocRequestHeader& assocReq, Mac48Address from)
+{
+  NS_LOG_FUNCTION (this << assocReq << from);
+  bool success = ReceiveAssocRequest (assocReq, from);
+  MgtAssocResponseHeader assocResp = GetAssocResp (from, success, false);
+  if (success)
+    {
+      // the association response is assumed to be acknowledged
+      GetWifiRemoteStationManager ()->RecordGotAssocTxOk (from);
+    }
+  return assocResp;
+}
+
 void
 ApWifiMac::DeaggregateAmsduAndForward (Ptr<WifiMacQueueItem> mpdu)
 {
@@ -39,6 +39,9 @@ class VhtOperation;
 class HeOperation;
 class CfParameterSet;
 class UniformRandomVariable;
+class MgtBeaconHeader;
+class MgtAssocRequestHeader;
+class MgtAssocResponseHeader;
 
 /**
  * \brief Wi-Fi AP state machine
@@ -138,6 +141,24 @@ public:
    */
   uint8_t GetMaxBufferStatus (Mac48Address address) const;
 
+  /**
+   * Return the Beacon frame body that this AP would transmit now.
+   *
+   * \return the Beacon frame body
+   */
+  MgtBeaconHeader GetBeaconHeader (void) const;
+  /**
+   * Process the given association request of the station with the given
+   * address as if it had been received and the association response had been
+   * acknowledged, without exchanging any frame. This is used to install
+   * stations that are already associated when the simulation starts.
+   *
+   * \param assocReq the association request of the station
+   * \param from the address of the station
+   * \return the association response of this AP
+   */
+  MgtAssocResponseHeader PreAssociate (const MgtAssocRequestHeader& assocReq, Mac48Address from);
+
 private:
   void Receive (Ptr<WifiMacQueueItem> mpdu)  override;
   /**
@@ -204,6 +225,27 @@ private:
    * \param isReassoc indicates whether it is a reassociation response
    */
   void SendAssocResp (Mac48Address to, bool success, bool isReassoc);
+  /**
+   * Build an association or a reassociation response. If the association
+   * is successful and the station is not associated yet, an association ID
+   * is allocated to the station.
+   *
+   * \param to the address of the STA we are sending an association response to
+   * \param success indicates whether the association was successful or not
+   * \param isReassoc indicates whether it is a reassociation response
+   * \return the association response
+   */
+  MgtAssocResponseHeader GetAssocResp (Mac48Address to, bool success, bool isReassoc);
+  /**
+   * Check that the supported rates and capabilities of the station that sent
+   * the given association request are compatible with our Basic Rate set and,
+   * if so, record them in the remote station manager.
+   *
+   * \param assocReq the association request
+   * \param from the address of the station
+   * \return true if the association can be accepted
+   */
+  bool ReceiveAssocRequest (const MgtAssocRequestHeader& assocReq, const Mac48Address& from);
   /**
    * Forward a beacon packet to the beacon special DCF.
    */
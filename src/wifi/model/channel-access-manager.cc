@@ -20,6 +20,7 @@
 
 #include "ns3/log.h"
 #include "ns3/simulator.h"
+#include "ns3/boolean.h"
 #include "channel-access-manager.h"
 #include "txop.h"
 #include "wifi-phy-listener.h"
@@ -98,6 +99,26 @@ private:
  *      Implement the channel access manager of all Txop holders
  ****************************************************************/
 
+NS_OBJECT_ENSURE_REGISTERED (ChannelAccessManager);
+
+TypeId
+ChannelAccessManager::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::ChannelAccessManager")
+    .SetParent<Object> ()
+    .SetGroupName ("Wifi")
+    .AddConstructor<ChannelAccessManager> ()
+    .AddAttribute ("AnalyticBackoff",
+                   "If true, the access timeout is moved to the expected end of the backoff "
+                   "procedures whenever the state of the medium changes, instead of expiring "
+                   "while the medium is busy and being rescheduled.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&ChannelAccessManager::m_analyticBackoff),
+                   MakeBooleanChecker ())
+  ;
+  return tid;
+}
+
 ChannelAccessManager::ChannelAccessManager ()
   : m_lastAckTimeoutEnd (MicroSeconds (0)),
     m_lastCtsTimeoutEnd (MicroSeconds (0)),
@@ -114,6 +135,7 @@ ChannelAccessManager::ChannelAccessManager ()
     m_lastSwitchingDuration (MicroSeconds (0)),
     m_sleeping (false),
     m_off (false),
+    m_analyticBackoff (false),
     m_phyListener (0)
 {
   NS_LOG_FUNCTION (this);
@@ -503,15 +525,14 @@ ChannelAccessManager::UpdateBackoff (void)
     }
 }
 
-void
-ChannelAccessManager::DoRestartAccessTimeoutIfNeeded (void)
+Time
+ChannelAccessManager::GetExpectedBackoffEnd (void)
 {
   NS_LOG_FUNCTION (this);
   /**
    * Is there a Txop which needs to access the medium, and,
    * if there is one, how many slots for AIFS+backoff does it require ?
    */
-  bool accessTimeoutNeeded = false;
   Time expectedBackoffEnd = Simulator::GetMaximumSimulationTime ();
   for (auto txop : m_txops)
     {
@@ -520,11 +541,19 @@ ChannelAccessManager::DoRestartAccessTimeoutIfNeeded (void)
           Time tmp = GetBackoffEndFor (txop);
           if (tmp > Simulator::Now ())
             {
-              accessTimeoutNeeded = true;
               expectedBackoffEnd = std::min (expectedBackoffEnd, tmp);
             }
         }
     }
+  return expectedBackoffEnd;
+}
+
+void
+ChannelAccessManager::DoRestartAccessTimeoutIfNeeded (void)
+{
+  NS_LOG_FUNCTION (this);
+  Time expectedBackoffEnd = GetExpectedBackoffEnd ();
+  bool accessTimeoutNeeded = (expectedBackoffEnd < Simulator::GetMaximumSimulationTime ());
   NS_LOG_DEBUG ("Access timeout needed: " << accessTimeoutNeeded);
   if (accessTimeoutNeeded)
     {
@@ -543,6 +572,34 @@ ChannelAccessManager::DoRestartAccessTimeoutIfNeeded (void)
     }
 }
 
+void
+ChannelAccessManager::DoMoveAccessTimeoutIfNeeded (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (!m_analyticBackoff || !m_accessTimeout.IsRunning ())
+    {
+      return;
+    }
+  /*
+   * The backoff end of a Txop only depends on the times the medium was last
+   * busy, which are all known by now. Rather than letting the access timeout
+   * expire at a time at which no access can be granted, move it to the
+   * expected backoff end.
+   */
+  Time expectedBackoffEnd = GetExpectedBackoffEnd ();
+  Time expectedBackoffDelay = expectedBackoffEnd - Simulator::Now ();
+  if (Simulator::GetDelayLeft (m_accessTimeout) != expectedBackoffDelay)
+    {
+      NS_LOG_DEBUG ("move access timeout to " << expectedBackoffEnd);
+      m_accessTimeout.Cancel ();
+      if (expectedBackoffEnd < Simulator::GetMaximumSimulationTime ())
+        {
+          m_accessTimeout = Simulator::Schedule (expectedBackoffDelay,
+                                                 &ChannelAccessManager::AccessTimeout, this);
+        }
+    }
+}
+
 void
 ChannelAccessManager::DisableEdcaFor (Ptr<Txop> qosTxop, Time duration)
 {
@@ -565,6 +622,7 @@ ChannelAccessManager::NotifyRxStartNow (Time duration)
   m_lastRxStart = Simulator::Now ();
   m_lastRxDuration = duration;
   m_lastRxReceivedOk = true;
+  DoMoveAccessTimeoutIfNeeded ();
 }
 
 void
@@ -574,6 +632,7 @@ ChannelAccessManager::NotifyRxEndOkNow (void)
   NS_LOG_DEBUG ("rx end ok");
   m_lastRxDuration = Simulator::Now () - m_lastRxStart;
   m_lastRxReceivedOk = true;
+  DoMoveAccessTimeoutIfNeeded ();
 }
 
 void
@@ -590,6 +649,7 @@ ChannelAccessManager::NotifyRxEndErrorNow (void)
     }
   m_lastRxDuration = now - m_lastRxStart;
   m_lastRxReceivedOk = false;
+  DoMoveAccessTimeoutIfNeeded ();
 }
 
 void
@@ -610,6 +670,7 @@ ChannelAccessManager::NotifyTxStartNow (Time duration)
   UpdateBackoff ();
   m_lastTxStart = now;
   m_lastTxDuration = duration;
+  DoMoveAccessTimeoutIfNeeded ();
 }
 
 void
@@ -620,6 +681,7 @@ ChannelAccessManager::NotifyMaybeCcaBusyStartNow (Time duration)
   UpdateBackoff ();
   m_lastBusyStart = Simulator::Now ();
   m_lastBusyDuration = duration;
+  DoMoveAccessTimeoutIfNeeded ();
 }
 
 void
@@ -786,6 +848,7 @@ ChannelAccessManager::NotifyNavStartNow (Time duration)
       m_lastNavStart = Simulator::Now ();
       m_lastNavDuration = duration;
     }
+  DoMoveAccessTimeoutIfNeeded ();
 }
 
 void
@@ -794,6 +857,7 @@ ChannelAccessManager::NotifyAckTimeoutStartNow (Time duration)
   NS_LOG_FUNCTION (this << duration);
   NS_ASSERT (m_lastAckTimeoutEnd < Simulator::Now ());
   m_lastAckTimeoutEnd = Simulator::Now () + duration;
+  DoMoveAccessTimeoutIfNeeded ();
 }
 
 void
@@ -809,6 +873,7 @@ ChannelAccessManager::NotifyCtsTimeoutStartNow (Time duration)
 {
   NS_LOG_FUNCTION (this << duration);
   m_lastCtsTimeoutEnd = Simulator::Now () + duration;
+  DoMoveAccessTimeoutIfNeeded ();
 }
 
 void
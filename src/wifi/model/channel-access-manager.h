@@ -51,6 +51,12 @@ class FrameExchangeManager;
 class ChannelAccessManager : public Object
 {
 public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
   ChannelAccessManager ();
   virtual ~ChannelAccessManager ();
 
@@ -259,7 +265,22 @@ private:
    */
   Time GetBackoffEndFor (Ptr<Txop> txop);
 
+  /**
+   * Return the earliest time at which the backoff procedure of a Txop
+   * requesting access ends, if later than now.
+   *
+   * \return the expected backoff end, or the maximum simulation time if
+   *         no Txop is waiting for the end of its backoff procedure
+   */
+  Time GetExpectedBackoffEnd (void);
+
   void DoRestartAccessTimeoutIfNeeded (void);
+  /**
+   * In analytic backoff mode, move the pending access timeout to the expected
+   * backoff end if the state of the medium changed it, so that the access
+   * timeout does not expire while no access can be granted.
+   */
+  void DoMoveAccessTimeoutIfNeeded (void);
 
   /**
    * Called when access timeout should occur
@@ -313,6 +334,7 @@ private:
   bool m_off;                            //!< flag whether it is in off state
   Time m_eifsNoDifs;                     //!< EIFS no DIFS time
   EventId m_accessTimeout;               //!< the access timeout ID
+  bool m_analyticBackoff;                //!< whether to move the access timeout rather than letting it expire in vain
   Time m_slot;                           //!< the slot time
   Time m_sifs;                           //!< the SIFS time
   PhyListener* m_phyListener;            //!< the PHY listener
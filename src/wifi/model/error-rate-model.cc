@@ -18,12 +18,19 @@
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
 
+#include <cmath>
+#include <limits>
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
 #include "error-rate-model.h"
 #include "ns3/dsss-error-rate-model.h"
 #include "wifi-tx-vector.h"
 
 namespace ns3 {
 
+NS_LOG_COMPONENT_DEFINE ("ErrorRateModel");
+
 NS_OBJECT_ENSURE_REGISTERED (ErrorRateModel);
 
 TypeId ErrorRateModel::GetTypeId (void)
@@ -31,10 +38,44 @@ TypeId ErrorRateModel::GetTypeId (void)
   static TypeId tid = TypeId ("ns3::ErrorRateModel")
     .SetParent<Object> ()
     .SetGroupName ("Wifi")
+    .AddAttribute ("LookupTable",
+                   "If true, interpolate the success rates from tables of the success rate of "
+                   "one bit, sampled on a grid of SNR values, instead of evaluating the model, "
+                   "for the DSSS modes and the models that support it. Outside the grid, "
+                   "the model is evaluated.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&ErrorRateModel::m_lookupTable),
+                   MakeBooleanChecker ())
+    .AddAttribute ("LookupTableResolution",
+                   "The step of the SNR grid of the lookup tables (dB).",
+                   TypeId::ATTR_GET | TypeId::ATTR_CONSTRUCT,
+                   DoubleValue (0.05),
+                   MakeDoubleAccessor (&ErrorRateModel::m_lookupTableStep),
+                   MakeDoubleChecker<double> (0.001))
+    .AddAttribute ("LookupTableMinSnr",
+                   "The lowest SNR of the grid of the lookup tables (dB).",
+                   TypeId::ATTR_GET | TypeId::ATTR_CONSTRUCT,
+                   DoubleValue (-10),
+                   MakeDoubleAccessor (&ErrorRateModel::m_lookupTableMinSnr),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("LookupTableMaxSnr",
+                   "The highest SNR of the grid of the lookup tables (dB).",
+                   TypeId::ATTR_GET | TypeId::ATTR_CONSTRUCT,
+                   DoubleValue (50),
+                   MakeDoubleAccessor (&ErrorRateModel::m_lookupTableMaxSnr),
+                   MakeDoubleChecker<double> ())
   ;
   return tid;
 }
 
+ErrorRateModel::ErrorRateModel ()
+  : m_lookupTable (false),
+    m_lookupTableStep (0.05),
+    m_lookupTableMinSnr (-10),
+    m_lookupTableMaxSnr (50)
+{
+}
+
 double
 ErrorRateModel::CalculateSnr (const WifiTxVector& txVector, double ber) const
 {
@@ -61,6 +102,56 @@ ErrorRateModel::CalculateSnr (const WifiTxVector& txVector, double ber) const
 
 double
 ErrorRateModel::GetChunkSuccessRate (WifiMode mode, const WifiTxVector& txVector, double snr, uint64_t nbits, uint8_t numRxAntennas, WifiPpduField field, uint16_t staId) const
+{
+  if (!m_lookupTable)
+    {
+      return CalculateChunkSuccessRate (mode, txVector, snr, nbits, numRxAntennas, field, staId);
+    }
+  double snrDb = 10 * std::log10 (snr);
+  // the negated condition also holds for a NaN
+  if (!(snrDb >= m_lookupTableMinSnr && snrDb < m_lookupTableMaxSnr))
+    {
+      return CalculateChunkSuccessRate (mode, txVector, snr, nbits, numRxAntennas, field, staId);
+    }
+  std::optional<uint64_t> key;
+  if (mode.GetModulationClass () == WIFI_MOD_CLASS_DSSS || mode.GetModulationClass () == WIFI_MOD_CLASS_HR_DSSS)
+    {
+      key = 0;
+    }
+  else
+    {
+      key = GetLookupTableKey (mode, txVector, field, staId);
+    }
+  if (!key.has_value ())
+    {
+      return CalculateChunkSuccessRate (mode, txVector, snr, nbits, numRxAntennas, field, staId);
+    }
+
+  std::vector<double> &table = m_lookupTables[std::make_pair (mode.GetUid (), key.value ())];
+  if (table.empty ())
+    {
+      NS_LOG_DEBUG ("Fill the lookup table of " << mode << " with key " << key.value ());
+      uint32_t size = static_cast<uint32_t> ((m_lookupTableMaxSnr - m_lookupTableMinSnr) / m_lookupTableStep) + 2;
+      table.reserve (size);
+      for (uint32_t i = 0; i < size; i++)
+        {
+          double gridSnr = std::pow (10.0, (m_lookupTableMinSnr + i * m_lookupTableStep) / 10.0);
+          double psr = CalculateChunkSuccessRate (mode, txVector, gridSnr, 1, numRxAntennas, field, staId);
+          // keep the logarithms finite where the success rate rounds to 0 or 1
+          double errorExponent = std::min (std::max (-std::log (psr), std::numeric_limits<double>::min ()),
+                                           std::numeric_limits<double>::max ());
+          table.push_back (std::log (errorExponent));
+        }
+    }
+  double position = (snrDb - m_lookupTableMinSnr) / m_lookupTableStep;
+  uint32_t index = static_cast<uint32_t> (position);
+  double fraction = position - index;
+  double logErrorExponent = table[index] + fraction * (table[index + 1] - table[index]);
+  return std::exp (-static_cast<double> (nbits) * std::exp (logErrorExponent));
+}
+
+double
+ErrorRateModel::CalculateChunkSuccessRate (WifiMode mode, const WifiTxVector& txVector, double snr, uint64_t nbits, uint8_t numRxAntennas, WifiPpduField field, uint16_t staId) const
 {
   if (mode.GetModulationClass () == WIFI_MOD_CLASS_DSSS || mode.GetModulationClass () == WIFI_MOD_CLASS_HR_DSSS)
     {
@@ -91,6 +182,12 @@ ErrorRateModel::IsAwgn (void) const
   return true;
 }
 
+std::optional<uint64_t>
+ErrorRateModel::GetLookupTableKey (WifiMode mode, const WifiTxVector& txVector, WifiPpduField field, uint16_t staId) const
+{
+  return std::nullopt;
+}
+
 int64_t
 ErrorRateModel::AssignStreams (int64_t stream)
 {
@@ -23,6 +23,9 @@
 
 #include "ns3/object.h"
 #include "wifi-mode.h"
+#include <map>
+#include <optional>
+#include <vector>
 
 namespace ns3 {
 
@@ -30,6 +33,15 @@ namespace ns3 {
  * \ingroup wifi
  * \brief the interface for Wifi's error models
  *
+ * With the LookupTable attribute, the success rate of a chunk is
+ * interpolated from a table of the success rate of one bit, sampled on a
+ * grid of SNR values in dB, instead of being evaluated by the model. The
+ * table of a mode is filled at its first lookup. This applies to the DSSS
+ * modes and to the models whose success rate of a chunk of nbits bits is
+ * the nbits-th power of the success rate of one bit, which return a key
+ * from GetLookupTableKey. With the default resolution, the interpolated
+ * success rates of chunks of 32 bytes or more are within 5e-4 of those of
+ * the model.
  */
 class ErrorRateModel : public Object
 {
@@ -40,6 +52,8 @@ public:
    */
   static TypeId GetTypeId (void);
 
+  ErrorRateModel ();
+
   /**
    * \param txVector a specific transmission vector including WifiMode
    * \param ber a target BER
@@ -97,7 +111,43 @@ public:
   virtual int64_t AssignStreams (int64_t stream);
 
 
+protected:
+  /**
+   * Return the key of the lookup table to use for the given chunk
+   * parameters, if the success rate of a chunk of nbits bits is the
+   * nbits-th power of the success rate of one bit. The success rate
+   * of one bit must depend on the mode, the TXVECTOR, the PPDU field
+   * and the station ID only through the mode and the returned key.
+   * By default, no lookup table is used.
+   *
+   * \param mode the Wi-Fi mode applicable to the chunk
+   * \param txVector TXVECTOR of the overall transmission
+   * \param field the PPDU field to which the chunk belongs to
+   * \param staId the station ID for MU
+   *
+   * \return the key of the lookup table, if any
+   */
+  virtual std::optional<uint64_t> GetLookupTableKey (WifiMode mode, const WifiTxVector& txVector,
+                                                     WifiPpduField field, uint16_t staId) const;
+
+
 private:
+  /**
+   * Evaluate the success rate of a chunk with the model.
+   *
+   * \param mode the Wi-Fi mode applicable to this chunk
+   * \param txVector TXVECTOR of the overall transmission
+   * \param snr the SNR of the chunk
+   * \param nbits the number of bits in this chunk
+   * \param numRxAntennas the number of active RX antennas
+   * \param field the PPDU field to which the chunk belongs to
+   * \param staId the station ID for MU
+   *
+   * \return probability of successfully receiving the chunk
+   */
+  double CalculateChunkSuccessRate (WifiMode mode, const WifiTxVector& txVector, double snr, uint64_t nbits,
+                                    uint8_t numRxAntennas, WifiPpduField field, uint16_t staId) const;
+
   /**
    * A pure virtual method that must be implemented in the subclass.
    *
@@ -113,6 +163,23 @@ private:
    */
   virtual double DoGetChunkSuccessRate (WifiMode mode, const WifiTxVector& txVector, double snr, uint64_t nbits,
                                         uint8_t numRxAntennas, WifiPpduField field, uint16_t staId) const = 0;
+
+  /**
+   * The key of a lookup table: the UID of the mode and the key returned
+   * by GetLookupTableKey.
+   */
+  typedef std::pair<uint32_t, uint64_t> LookupTableKey;
+
+  bool m_lookupTable;              //!< whether to interpolate the success rates from lookup tables
+  double m_lookupTableStep;        //!< the step of the SNR grid (dB)
+  double m_lookupTableMinSnr;      //!< the lowest SNR of the grid (dB)
+  double m_lookupTableMaxSnr;      //!< the highest SNR of the grid (dB)
+  /**
+   * The lookup tables. At each point of the SNR grid, a table holds
+   * log (-log (psr)), where psr is the success rate of one bit, since
+   * this varies smoothly with the SNR in dB.
+   */
+  mutable std::map<LookupTableKey, std::vector<double> > m_lookupTables;
 };
 
 } //namespace ns3
@@ -611,6 +611,13 @@ HePhy::NotifyEndOfHeSigA (HeSigAParameters params)
     }
 }
 
+bool
+HePhy::IsFieldEndNotified (WifiPpduField field, const WifiTxVector& /* txVector */) const
+{
+  //the end of HE-SIG-A is notified to the MAC (e.g. for OBSS_PD spatial reuse)
+  return field == WIFI_PPDU_FIELD_SIG_A;
+}
+
 PhyEntity::PhyFieldRxStatus
 HePhy::ProcessSigB (Ptr<Event> event, PhyFieldRxStatus status)
 {
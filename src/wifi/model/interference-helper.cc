@@ -674,4 +674,11 @@ InterferenceHelper::NotifyRxEnd (Time endTime)
     }
 }
 
+struct PhyEntity::SnrPer
+InterferenceHelper::CalculatePayloadEffectiveSnrPer (Ptr<Event> event, uint16_t channelWidth, WifiSpectrumBand band,
+                                                     uint16_t staId, std::pair<Time, Time> relativeMpduStartStop) const
+{
+  return CalculatePayloadSnrPer (event, channelWidth, band, staId, relativeMpduStartStop);
+}
+
 } //namespace ns3
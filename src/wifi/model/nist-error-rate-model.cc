@@ -238,4 +238,15 @@ NistErrorRateModel::DoGetChunkSuccessRate (WifiMode mode, const WifiTxVector& tx
   return 0;
 }
 
+std::optional<uint64_t>
+NistErrorRateModel::GetLookupTableKey (WifiMode mode, const WifiTxVector& txVector, WifiPpduField field, uint16_t staId) const
+{
+  if (mode.GetModulationClass () >= WIFI_MOD_CLASS_ERP_OFDM)
+    {
+      // the success rate of a bit only depends on the mode
+      return 0;
+    }
+  return std::nullopt;
+}
+
 } //namespace ns3
@@ -49,6 +49,8 @@ public:
 private:
   double DoGetChunkSuccessRate (WifiMode mode, const WifiTxVector& txVector, double snr, uint64_t nbits,
                                 uint8_t numRxAntennas, WifiPpduField field, uint16_t staId) const override;
+  std::optional<uint64_t> GetLookupTableKey (WifiMode mode, const WifiTxVector& txVector,
+                                             WifiPpduField field, uint16_t staId) const override;
   /**
    * Return the bValue such that coding rate = bValue / (bValue + 1).
    *
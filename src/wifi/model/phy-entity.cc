@@ -273,24 +273,65 @@ PhyEntity::StartReceiveField (WifiPpduField field, Ptr<Event> event)
   bool supported = DoStartReceiveField (field, event);
   NS_ABORT_MSG_IF (!supported, "Unknown field " << field << " for this PHY entity"); //TODO see what to do if not supported
   Time duration = GetDuration (field, event->GetTxVector ());
-  m_wifiPhy->m_endPhyRxEvent = Simulator::Schedule (duration, &PhyEntity::EndReceiveField, this, field, event);
+  WifiPpduField lastField = GetLastFieldReceivedAtOnce (field, event, duration);
+  m_wifiPhy->m_endPhyRxEvent = Simulator::Schedule (duration, &PhyEntity::EndReceiveFields, this, field, lastField, event);
   m_state->SwitchMaybeToCcaBusy (duration); //keep in CCA busy state up to reception of Data (will then switch to RX)
 }
 
+WifiPpduField
+PhyEntity::GetLastFieldReceivedAtOnce (WifiPpduField field, Ptr<Event> event, Time &duration)
+{
+  NS_LOG_FUNCTION (this << field << *event << duration);
+  if (!m_wifiPhy->m_abstraction)
+    {
+      return field;
+    }
+  const WifiTxVector& txVector = event->GetTxVector ();
+  WifiPpduField nextField = GetNextField (field, txVector.GetPreambleType ());
+  while (!IsFieldEndNotified (field, txVector) && nextField != WIFI_PPDU_FIELD_DATA)
+    {
+      bool supported = DoStartReceiveField (nextField, event);
+      NS_ABORT_MSG_IF (!supported, "Unknown field " << nextField << " for this PHY entity");
+      duration += GetDuration (nextField, txVector);
+      field = nextField;
+      nextField = GetNextField (field, txVector.GetPreambleType ());
+    }
+  return field;
+}
+
+bool
+PhyEntity::IsFieldEndNotified (WifiPpduField /* field */, const WifiTxVector& /* txVector */) const
+{
+  return false;
+}
+
 void
 PhyEntity::EndReceiveField (WifiPpduField field, Ptr<Event> event)
 {
-  NS_LOG_FUNCTION (this << field << *event);
+  EndReceiveFields (field, field, event);
+}
+
+void
+PhyEntity::EndReceiveFields (WifiPpduField firstField, WifiPpduField lastField, Ptr<Event> event)
+{
+  NS_LOG_FUNCTION (this << firstField << lastField << *event);
   NS_ASSERT (m_wifiPhy); //no sense if no owner WifiPhy instance
   NS_ASSERT (m_wifiPhy->m_endPhyRxEvent.IsExpired ());
-  PhyFieldRxStatus status = DoEndReceiveField (field, event);
   WifiTxVector txVector = event->GetTxVector ();
+  WifiPpduField field = firstField;
+  PhyFieldRxStatus status = DoEndReceiveField (field, event);
+  while (status.isSuccess && field != lastField)
+    {
+      field = GetNextField (field, txVector.GetPreambleType ());
+      status = DoEndReceiveField (field, event);
+    }
   if (status.isSuccess) //move to next field if reception succeeded
     {
-      StartReceiveField (GetNextField (field, txVector.GetPreambleType ()), event);
+      StartReceiveField (GetNextField (lastField, txVector.GetPreambleType ()), event);
     }
   else
     {
+      //the remaining duration of the PPDU is counted from the end of the last field
       Ptr<const WifiPpdu> ppdu = event->GetPpdu ();
       switch (status.actionIfFailure)
         {
@@ -310,11 +351,11 @@ PhyEntity::EndReceiveField (WifiPpduField field, Ptr<Event> event)
                 m_wifiPhy->m_phyRxPayloadBeginTrace (txVector, NanoSeconds (0)); //this callback (equivalent to PHY-RXSTART primitive) is also triggered for filtered PPDUs
               }
             m_wifiPhy->NotifyRxDrop (GetAddressedPsduInPpdu (ppdu), status.reason);
-            m_state->SwitchMaybeToCcaBusy (GetRemainingDurationAfterField (ppdu, field)); //keep in CCA busy state till the end
+            m_state->SwitchMaybeToCcaBusy (GetRemainingDurationAfterField (ppdu, lastField)); //keep in CCA busy state till the end
           //no break
           case IGNORE:
             //Keep in Rx state and reset at end
-            m_endRxPayloadEvents.push_back (Simulator::Schedule (GetRemainingDurationAfterField (ppdu, field),
+            m_endRxPayloadEvents.push_back (Simulator::Schedule (GetRemainingDurationAfterField (ppdu, lastField),
                                                                  &PhyEntity::ResetReceive, this, event));
             break;
           default:
@@ -687,8 +728,17 @@ PhyEntity::GetReceptionStatus (Ptr<const WifiPsdu> psdu, Ptr<Event> event, uint1
 {
   NS_LOG_FUNCTION (this << *psdu << *event << staId << relativeMpduStart << mpduDuration);
   const auto & channelWidthAndBand = GetChannelWidthAndBand (event->GetTxVector (), staId);
-  SnrPer snrPer = m_wifiPhy->m_interference->CalculatePayloadSnrPer (event, channelWidthAndBand.first, channelWidthAndBand.second, staId,
-                                                                    std::make_pair (relativeMpduStart, relativeMpduStart + mpduDuration));
+  SnrPer snrPer;
+  if (m_wifiPhy->m_abstraction)
+    {
+      snrPer = m_wifiPhy->m_interference->CalculatePayloadEffectiveSnrPer (event, channelWidthAndBand.first, channelWidthAndBand.second, staId,
+                                                                         std::make_pair (relativeMpduStart, relativeMpduStart + mpduDuration));
+    }
+  else
+    {
+      snrPer = m_wifiPhy->m_interference->CalculatePayloadSnrPer (event, channelWidthAndBand.first, channelWidthAndBand.second, staId,
+                                                                 std::make_pair (relativeMpduStart, relativeMpduStart + mpduDuration));
+    }
 
   WifiMode mode = event->GetTxVector ().GetMode (staId);
   NS_LOG_DEBUG ("rate=" << (mode.GetDataRate (event->GetTxVector (), staId)) <<
@@ -878,8 +928,9 @@ PhyEntity::EndPreambleDetectionPeriod (Ptr<Event> event)
 
       //Continue receiving preamble
       Time durationTillEnd = GetDuration (WIFI_PPDU_FIELD_PREAMBLE, event->GetTxVector ()) - m_wifiPhy->GetPreambleDetectionDuration ();
+      WifiPpduField lastField = GetLastFieldReceivedAtOnce (WIFI_PPDU_FIELD_PREAMBLE, event, durationTillEnd);
       m_state->SwitchMaybeToCcaBusy (durationTillEnd); //will be prolonged by next field
-      m_wifiPhy->m_endPhyRxEvent = Simulator::Schedule (durationTillEnd, &PhyEntity::EndReceiveField, this, WIFI_PPDU_FIELD_PREAMBLE, event);
+      m_wifiPhy->m_endPhyRxEvent = Simulator::Schedule (durationTillEnd, &PhyEntity::EndReceiveFields, this, WIFI_PPDU_FIELD_PREAMBLE, lastField, event);
     }
   else
     {
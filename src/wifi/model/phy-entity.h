@@ -364,8 +364,10 @@ public:
    * Start receiving a given field.
    *
    * This method will call the DoStartReceiveField.
-   * EndReceiveField is also scheduled after the duration of the field
-   * (except for the special case of preambles \see DoStartReceivePreamble).
+   * EndReceiveFields is also scheduled after the duration of the field
+   * (except for the special case of preambles \see DoStartReceivePreamble),
+   * or, at the abstraction level (\see WifiPhy::SetAbstraction), after
+   * the duration of the fields received at once with it.
    * The PHY is kept in CCA busy during the reception of the field (except for
    * data field which should be in RX).
    *
@@ -385,6 +387,20 @@ public:
    * \param event the event holding incoming PPDU's information
    */
   void EndReceiveField (WifiPpduField field, Ptr<Event> event);
+  /**
+   * End receiving consecutive fields received at once.
+   *
+   * This method will call the DoEndReceiveField of each field in turn to
+   * obtain the outcome of their reception, and stops at the first failure.
+   * In case of success of all the fields, reception of the next field is triggered.
+   * In case of failure, the indications in the returned \see PhyFieldRxStatus
+   * are performed.
+   *
+   * \param firstField the first PPDU field received at once
+   * \param lastField the last (ending) PPDU field received at once
+   * \param event the event holding incoming PPDU's information
+   */
+  void EndReceiveFields (WifiPpduField firstField, WifiPpduField lastField, Ptr<Event> event);
 
   /**
    * The last symbol of the PPDU has arrived.
@@ -511,6 +527,31 @@ protected:
    * \return status of the reception of the PPDU field
    */
   virtual PhyFieldRxStatus DoEndReceiveField (WifiPpduField field, Ptr<Event> event);
+  /**
+   * Return whether the end of the reception of the given field is notified
+   * out of the PHY, e.g. to the MAC, in which case the field is the last of
+   * those received at once at the abstraction level.
+   *
+   * \param field the PPDU field
+   * \param txVector the TXVECTOR of the incoming PPDU
+   * \return \c true if the end of the reception of the field is notified, \c false otherwise
+   */
+  virtual bool IsFieldEndNotified (WifiPpduField field, const WifiTxVector& txVector) const;
+  /**
+   * Get the last of the fields received at once, starting with the given
+   * field, and add the duration of the fields that follow it to the given
+   * duration. Without abstraction (\see WifiPhy::SetAbstraction), the given
+   * field is received alone. Otherwise, the fields are received at once up
+   * to the end of the PHY header or to a field whose end is notified
+   * (\see IsFieldEndNotified), and DoStartReceiveField is called for each
+   * of the fields that follow the given field.
+   *
+   * \param field the first PPDU field received at once
+   * \param event the event holding incoming PPDU's information
+   * \param duration the duration of the reception, to which the duration of the following fields is added
+   * \return the last PPDU field received at once
+   */
+  WifiPpduField GetLastFieldReceivedAtOnce (WifiPpduField field, Ptr<Event> event, Time &duration);
 
   /**
    * Get the event corresponding to the incoming PPDU.
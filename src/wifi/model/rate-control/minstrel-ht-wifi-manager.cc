@@ -35,6 +35,7 @@
  */
 
 #include <iomanip>
+#include <algorithm>
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 #include "ns3/log.h"
@@ -65,6 +66,10 @@ struct MinstrelHtWifiRemoteStation : MinstrelWifiRemoteStation
   uint32_t m_ampduPacketCount; //!< Number of A-MPDUs transmitted.
 
   McsGroupData m_groupsTable;  //!< Table of groups with stats.
+  uint32_t m_numStatsUpdates;  //!< Number of times the statistics were updated.
+  std::vector<uint16_t> m_attemptedRates;     //!< Indexes of the rates attempted since the last statistics update.
+  std::vector<uint16_t> m_prevAttemptedRates; //!< Indexes of the rates attempted before the last statistics update.
+  std::vector<uint16_t> m_nonZeroThRates;     //!< Sorted indexes of the rates whose throughput is not zero.
   bool m_isHt;                 //!< If the station is HT capable.
 
   std::ofstream m_statsFile;   //!< File where statistics table is written.
@@ -439,6 +444,7 @@ MinstrelHtWifiManager::DoCreateStation (void) const
   station->m_avgAmpduLen = 1;
   station->m_ampduLen = 0;
   station->m_ampduPacketCount = 0;
+  station->m_numStatsUpdates = 0;
 
   // If the device supports HT
   if (GetHtSupported ())
@@ -561,9 +567,7 @@ MinstrelHtWifiManager::DoReportDataFailed (WifiRemoteStation *st)
     }
   else if (station->m_longRetry < CountRetries (station))
     {
-      uint8_t rateId = GetRateId (station->m_txrate);
-      uint8_t groupId = GetGroupId (station->m_txrate);
-      station->m_groupsTable[groupId].m_ratesTable[rateId].numRateAttempt++; // Increment the attempts counter for the rate used.
+      AddRateAttempts (station, 0, 1); // Increment the attempts counter for the rate used.
       UpdateRate (station);
     }
 }
@@ -602,10 +606,7 @@ MinstrelHtWifiManager::DoReportDataOk (WifiRemoteStation *st, double ackSnr, Wif
     }
   else
     {
-      uint8_t rateId = GetRateId (station->m_txrate);
-      uint8_t groupId = GetGroupId (station->m_txrate);
-      station->m_groupsTable[groupId].m_ratesTable[rateId].numRateSuccess++;
-      station->m_groupsTable[groupId].m_ratesTable[rateId].numRateAttempt++;
+      AddRateAttempts (station, 1, 1);
 
       UpdatePacketCounters (station, 1, 0);
 
@@ -699,10 +700,7 @@ MinstrelHtWifiManager::DoReportAmpduTxStatus (WifiRemoteStation *st, uint16_t nS
 
   UpdatePacketCounters (station, nSuccessfulMpdus, nFailedMpdus);
 
-  uint8_t rateId = GetRateId (station->m_txrate);
-  uint8_t groupId = GetGroupId (station->m_txrate);
-  station->m_groupsTable[groupId].m_ratesTable[rateId].numRateSuccess += nSuccessfulMpdus;
-  station->m_groupsTable[groupId].m_ratesTable[rateId].numRateAttempt += nSuccessfulMpdus + nFailedMpdus;
+  AddRateAttempts (station, nSuccessfulMpdus, nSuccessfulMpdus + nFailedMpdus);
 
   if (nSuccessfulMpdus == 0 && station->m_longRetry < CountRetries (station))
     {
@@ -1177,7 +1175,7 @@ MinstrelHtWifiManager::FindRate (MinstrelHtWifiRemoteStation *station)
               else
                 {
                   station->m_numSamplesSlow++;
-                  if (sampleRateInfo.numSamplesSkipped >= 20 && station->m_numSamplesSlow <= 2)
+                  if (station->m_numStatsUpdates - sampleRateInfo.lastAttemptedUpdate >= 20 && station->m_numSamplesSlow <= 2)
                     {
                       /// Set flag that we are currently sampling.
                       station->m_isSampling = true;
@@ -1203,12 +1201,26 @@ MinstrelHtWifiManager::FindRate (MinstrelHtWifiRemoteStation *station)
   NS_LOG_DEBUG ("FindRate " << "maxTpRrate=" << station->m_maxTpRate);
   return station->m_maxTpRate;
 }
+void
+MinstrelHtWifiManager::AddRateAttempts (MinstrelHtWifiRemoteStation *station, uint16_t nSuccess, uint16_t nAttempts)
+{
+  NS_LOG_FUNCTION (this << station << nSuccess << nAttempts);
+  MinstrelHtRateInfo &rate = station->m_groupsTable[GetGroupId (station->m_txrate)].m_ratesTable[GetRateId (station->m_txrate)];
+  if (rate.numRateAttempt == 0 && nAttempts > 0)
+    {
+      station->m_attemptedRates.push_back (station->m_txrate);
+    }
+  rate.numRateSuccess += nSuccess;
+  rate.numRateAttempt += nAttempts;
+}
+
 void
 MinstrelHtWifiManager::UpdateStats (MinstrelHtWifiRemoteStation *station)
 {
   NS_LOG_FUNCTION (this << station);
 
   station->m_nextStatsUpdate = Simulator::Now () + m_updateStats;
+  station->m_numStatsUpdates++;
 
   station->m_numSamplesSlow = 0;
   station->m_sampleCount = 0;
@@ -1223,12 +1235,30 @@ MinstrelHtWifiManager::UpdateStats (MinstrelHtWifiRemoteStation *station)
       station->m_ampduPacketCount = 0;
     }
 
+  /**
+   * Only the retries of the rates selected at the last update were updated,
+   * and only the rates attempted since then have counters to reset.
+   */
+  for (uint16_t index : {station->m_maxTpRate, station->m_maxTpRate2, station->m_maxProbRate})
+    {
+      GroupInfo &group = station->m_groupsTable[GetGroupId (index)];
+      if (group.m_supported && group.m_ratesTable[GetRateId (index)].supported)
+        {
+          group.m_ratesTable[GetRateId (index)].retryUpdated = false;
+        }
+    }
+  for (uint16_t index : station->m_prevAttemptedRates)
+    {
+      MinstrelHtRateInfo &rate = station->m_groupsTable[GetGroupId (index)].m_ratesTable[GetRateId (index)];
+      rate.prevNumRateSuccess = 0;
+      rate.prevNumRateAttempt = 0;
+    }
+
   /* Initialize global rate indexes */
   station->m_maxTpRate = GetLowestIndex (station);
   station->m_maxTpRate2 = GetLowestIndex (station);
   station->m_maxProbRate = GetLowestIndex (station);
 
-  /// Update throughput and EWMA for each rate inside each group.
   for (uint8_t j = 0; j < m_numGroups; j++)
     {
       if (station->m_groupsTable[j].m_supported)
@@ -1239,70 +1269,76 @@ MinstrelHtWifiManager::UpdateStats (MinstrelHtWifiRemoteStation *station)
           station->m_groupsTable[j].m_maxTpRate = GetLowestIndex (station, j);
           station->m_groupsTable[j].m_maxTpRate2 = GetLowestIndex (station, j);
           station->m_groupsTable[j].m_maxProbRate = GetLowestIndex (station, j);
+        }
+    }
 
-          for (uint8_t i = 0; i < m_numRates; i++)
-            {
-              if (station->m_groupsTable[j].m_ratesTable[i].supported)
-                {
-                  station->m_groupsTable[j].m_ratesTable[i].retryUpdated = false;
-
-                  NS_LOG_DEBUG (+i << " " << GetMcsSupported (station, station->m_groupsTable[j].m_ratesTable[i].mcsIndex) <<
-                                "\t attempt=" << station->m_groupsTable[j].m_ratesTable[i].numRateAttempt <<
-                                "\t success=" << station->m_groupsTable[j].m_ratesTable[i].numRateSuccess);
+  /**
+   * Update throughput and EWMA for each rate attempted since the last update.
+   * The statistics of the other rates do not change.
+   */
+  for (uint16_t index : station->m_attemptedRates)
+    {
+      uint8_t j = GetGroupId (index);
+      uint8_t i = GetRateId (index);
+      MinstrelHtRateInfo &rate = station->m_groupsTable[j].m_ratesTable[i];
 
-                  /// If we've attempted something.
-                  if (station->m_groupsTable[j].m_ratesTable[i].numRateAttempt > 0)
-                    {
-                      station->m_groupsTable[j].m_ratesTable[i].numSamplesSkipped = 0;
-                      /**
-                       * Calculate the probability of success.
-                       * Assume probability scales from 0 to 100.
-                       */
-                      tempProb = (100 * station->m_groupsTable[j].m_ratesTable[i].numRateSuccess) / station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
+      NS_LOG_DEBUG (+i << " " << GetMcsSupported (station, rate.mcsIndex) <<
+                    "\t attempt=" << rate.numRateAttempt <<
+                    "\t success=" << rate.numRateSuccess);
 
-                      /// Bookkeeping.
-                      station->m_groupsTable[j].m_ratesTable[i].prob = tempProb;
+      rate.lastAttemptedUpdate = station->m_numStatsUpdates;
+      /**
+       * Calculate the probability of success.
+       * Assume probability scales from 0 to 100.
+       */
+      tempProb = (100 * rate.numRateSuccess) / rate.numRateAttempt;
 
-                      if (station->m_groupsTable[j].m_ratesTable[i].successHist == 0)
-                        {
-                          station->m_groupsTable[j].m_ratesTable[i].ewmaProb = tempProb;
-                        }
-                      else
-                        {
-                          station->m_groupsTable[j].m_ratesTable[i].ewmsdProb = CalculateEwmsd (station->m_groupsTable[j].m_ratesTable[i].ewmsdProb,
-                                                                                                tempProb, station->m_groupsTable[j].m_ratesTable[i].ewmaProb,
-                                                                                                m_ewmaLevel);
-                          /// EWMA probability
-                          tempProb = (tempProb * (100 - m_ewmaLevel) + station->m_groupsTable[j].m_ratesTable[i].ewmaProb * m_ewmaLevel)  / 100;
-                          station->m_groupsTable[j].m_ratesTable[i].ewmaProb = tempProb;
-                        }
+      /// Bookkeeping.
+      rate.prob = tempProb;
 
-                      station->m_groupsTable[j].m_ratesTable[i].throughput = CalculateThroughput (station, j, i, tempProb);
+      if (rate.successHist == 0)
+        {
+          rate.ewmaProb = tempProb;
+        }
+      else
+        {
+          rate.ewmsdProb = CalculateEwmsd (rate.ewmsdProb, tempProb, rate.ewmaProb, m_ewmaLevel);
+          /// EWMA probability
+          tempProb = (tempProb * (100 - m_ewmaLevel) + rate.ewmaProb * m_ewmaLevel)  / 100;
+          rate.ewmaProb = tempProb;
+        }
 
-                      station->m_groupsTable[j].m_ratesTable[i].successHist += station->m_groupsTable[j].m_ratesTable[i].numRateSuccess;
-                      station->m_groupsTable[j].m_ratesTable[i].attemptHist += station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
-                    }
-                  else
-                    {
-                      station->m_groupsTable[j].m_ratesTable[i].numSamplesSkipped++;
-                    }
+      rate.throughput = CalculateThroughput (station, j, i, tempProb);
 
-                  /// Bookkeeping.
-                  station->m_groupsTable[j].m_ratesTable[i].prevNumRateSuccess = station->m_groupsTable[j].m_ratesTable[i].numRateSuccess;
-                  station->m_groupsTable[j].m_ratesTable[i].prevNumRateAttempt = station->m_groupsTable[j].m_ratesTable[i].numRateAttempt;
-                  station->m_groupsTable[j].m_ratesTable[i].numRateSuccess = 0;
-                  station->m_groupsTable[j].m_ratesTable[i].numRateAttempt = 0;
+      rate.successHist += rate.numRateSuccess;
+      rate.attemptHist += rate.numRateAttempt;
 
-                  if (station->m_groupsTable[j].m_ratesTable[i].throughput != 0)
-                    {
-                      SetBestStationThRates (station, GetIndex (j, i));
-                      SetBestProbabilityRate (station, GetIndex (j, i));
-                    }
+      /// Bookkeeping.
+      rate.prevNumRateSuccess = rate.numRateSuccess;
+      rate.prevNumRateAttempt = rate.numRateAttempt;
+      rate.numRateSuccess = 0;
+      rate.numRateAttempt = 0;
 
-                }
-            }
+      auto it = std::lower_bound (station->m_nonZeroThRates.begin (), station->m_nonZeroThRates.end (), index);
+      bool found = (it != station->m_nonZeroThRates.end () && *it == index);
+      if (rate.throughput != 0 && !found)
+        {
+          station->m_nonZeroThRates.insert (it, index);
+        }
+      else if (rate.throughput == 0 && found)
+        {
+          station->m_nonZeroThRates.erase (it);
         }
     }
+  station->m_prevAttemptedRates.swap (station->m_attemptedRates);
+  station->m_attemptedRates.clear ();
+
+  /// Find the best rates, in increasing order of index.
+  for (uint16_t index : station->m_nonZeroThRates)
+    {
+      SetBestStationThRates (station, index);
+      SetBestProbabilityRate (station, index);
+    }
 
   //Try to sample all available rates during each interval.
   station->m_sampleCount *= 8;
@@ -1580,7 +1616,7 @@ MinstrelHtWifiManager::RateInit (MinstrelHtWifiRemoteStation *station)
                   station->m_groupsTable[groupId].m_ratesTable[rateId].ewmaProb = 0;
                   station->m_groupsTable[groupId].m_ratesTable[rateId].prevNumRateAttempt = 0;
                   station->m_groupsTable[groupId].m_ratesTable[rateId].prevNumRateSuccess = 0;
-                  station->m_groupsTable[groupId].m_ratesTable[rateId].numSamplesSkipped = 0;
+                  station->m_groupsTable[groupId].m_ratesTable[rateId].lastAttemptedUpdate = station->m_numStatsUpdates;
                   station->m_groupsTable[groupId].m_ratesTable[rateId].successHist = 0;
                   station->m_groupsTable[groupId].m_ratesTable[rateId].attemptHist = 0;
                   station->m_groupsTable[groupId].m_ratesTable[rateId].throughput = 0;
@@ -123,7 +123,7 @@ struct MinstrelHtRateInfo
   double ewmsdProb;             //!< Exponential weighted moving standard deviation of probability.
   uint32_t prevNumRateAttempt;  //!< Number of transmission attempts with previous rate.
   uint32_t prevNumRateSuccess;  //!< Number of successful frames transmitted with previous rate.
-  uint32_t numSamplesSkipped;   //!< Number of times this rate statistics were not updated because no attempts have been made.
+  uint32_t lastAttemptedUpdate; //!< Number of the statistics update at which attempts had been made with this rate.
   uint64_t successHist;         //!< Aggregate of all transmission successes.
   uint64_t attemptHist;         //!< Aggregate of all transmission attempts.
   double throughput;            //!< Throughput of this rate (in packets per second).
@@ -361,6 +361,15 @@ private:
    */
   uint16_t FindRate (MinstrelHtWifiRemoteStation *station);
 
+  /**
+   * Add transmission attempts with the current rate of the station.
+   *
+   * \param station the station
+   * \param nSuccess the number of successful attempts
+   * \param nAttempts the number of attempts
+   */
+  void AddRateAttempts (MinstrelHtWifiRemoteStation *station, uint16_t nSuccess, uint16_t nAttempts);
+
   /**
    * Update the Minstrel Table.
    *
@@ -21,10 +21,12 @@
  */
 
 #include "ns3/log.h"
+#include "ns3/abort.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
 #include "qos-txop.h"
 #include "sta-wifi-mac.h"
+#include "ap-wifi-mac.h"
 #include "wifi-phy.h"
 #include "mgt-headers.h"
 #include "snr-tag.h"
@@ -72,6 +74,14 @@ StaWifiMac::GetTypeId (void)
                    BooleanValue (false),
                    MakeBooleanAccessor (&StaWifiMac::SetActiveProbing, &StaWifiMac::GetActiveProbing),
                    MakeBooleanChecker ())
+    .AddAttribute ("SkipUnchangedBeacons",
+                   "If true, the beacons received from the associated AP whose content, "
+                   "except the timestamp, is identical to the last processed beacon only "
+                   "restart the beacon watchdog and are not parsed. Beacons are still "
+                   "transmitted, hence the airtime, NAV and CCA are not affected.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&StaWifiMac::m_skipUnchangedBeacons),
+                   MakeBooleanChecker ())
     .AddTraceSource ("Assoc", "Associated with an access point.",
                      MakeTraceSourceAccessor (&StaWifiMac::m_assocLogger),
                      "ns3::Mac48Address::TracedCallback")
@@ -105,6 +115,16 @@ void
 StaWifiMac::DoInitialize (void)
 {
   NS_LOG_FUNCTION (this);
+  if (IsAssociated ())
+    {
+      // the STA has been pre-associated, hence it does not need to scan
+      RestartBeaconWatchdog (m_beaconInterval * m_maxMissedBeacons);
+      if (!m_linkUp.IsNull ())
+        {
+          m_linkUp ();
+        }
+      return;
+    }
   StartScanning ();
 }
 
@@ -138,6 +158,25 @@ StaWifiMac::GetActiveProbing (void) const
   return m_activeProbing;
 }
 
+void
+StaWifiMac::PreAssociate (Ptr<ApWifiMac> ap)
+{
+  NS_LOG_FUNCTION (this << ap);
+  NS_ABORT_MSG_IF (IsInitialized (), "STA " << GetAddress () << " can only be pre-associated before it is initialized");
+  MgtBeaconHeader beacon = ap->GetBeaconHeader ();
+  NS_ABORT_MSG_IF (!GetSsid ().IsBroadcast () && !beacon.GetSsid ().IsEqual (GetSsid ()),
+                   "AP " << ap->GetAddress () << " does not belong to the SSID of STA " << GetAddress ());
+  UpdateApInfoFromBeacon (beacon, ap->GetAddress (), ap->GetAddress ());
+  m_beaconInterval = MicroSeconds (beacon.GetBeaconIntervalUs ());
+  MgtAssocResponseHeader assocResp = ap->PreAssociate (GetAssociationRequest (), GetAddress ());
+  NS_ABORT_MSG_IF (!assocResp.GetStatusCode ().IsSuccess (),
+                   "AP " << ap->GetAddress () << " refused the association of STA " << GetAddress ());
+  SetState (ASSOCIATED);
+  m_aid = assocResp.GetAssociationId ();
+  NS_LOG_DEBUG ("pre-associated with AP " << ap->GetAddress () << ", AID " << m_aid);
+  UpdateApInfoFromAssocResp (assocResp, ap->GetAddress ());
+}
+
 void
 StaWifiMac::SetWifiPhy (const Ptr<WifiPhy> phy)
 {
@@ -207,25 +246,7 @@ StaWifiMac::SendAssociationRequest (bool isReassoc)
   Ptr<Packet> packet = Create<Packet> ();
   if (!isReassoc)
     {
-      MgtAssocRequestHeader assoc;
-      assoc.SetSsid (GetSsid ());
-      assoc.SetSupportedRates (GetSupportedRates ());
-      assoc.SetCapabilities (GetCapabilities ());
-      assoc.SetListenInterval (0);
-      if (GetHtSupported ())
-        {
-          assoc.SetExtendedCapabilities (GetExtendedCapabilities ());
-          assoc.SetHtCapabilities (GetHtCapabilities ());
-        }
-      if (GetVhtSupported ())
-        {
-          assoc.SetVhtCapabilities (GetVhtCapabilities ());
-        }
-      if (GetHeSupported ())
-        {
-          assoc.SetHeCapabilities (GetHeCapabilities ());
-        }
-      packet->AddHeader (assoc);
+      packet->AddHeader (GetAssociationRequest ());
     }
   else
     {
@@ -279,6 +300,30 @@ StaWifiMac::SendAssociationRequest (bool isReassoc)
                                              &StaWifiMac::AssocRequestTimeout, this);
 }
 
+MgtAssocRequestHeader
+StaWifiMac::GetAssociationRequest (void) const
+{
+  MgtAssocRequestHeader assoc;
+  assoc.SetSsid (GetSsid ());
+  assoc.SetSupportedRates (GetSupportedRates ());
+  assoc.SetCapabilities (GetCapabilities ());
+  assoc.SetListenInterval (0);
+  if (GetHtSupported ())
+    {
+      assoc.SetExtendedCapabilities (GetExtendedCapabilities ());
+      assoc.SetHtCapabilities (GetHtCapabilities ());
+    }
+  if (GetVhtSupported ())
+    {
+      assoc.SetVhtCapabilities (GetVhtCapabilities ());
+    }
+  if (GetHeSupported ())
+    {
+      assoc.SetHeCapabilities (GetHeCapabilities ());
+    }
+  return assoc;
+}
+
 void
 StaWifiMac::TryToEnsureAssociated (void)
 {
@@ -600,6 +645,19 @@ StaWifiMac::Receive (Ptr<WifiMacQueueItem> mpdu)
   else if (hdr->IsBeacon ())
     {
       NS_LOG_DEBUG ("Beacon received");
+      if ((IsWaitAssocResp () || IsAssociated ()) && hdr->GetAddr3 () != GetBssid ())
+        {
+          // the beacons of other BSSs cannot change our state, no need to parse them
+          NS_LOG_LOGIC ("Beacon is not for us");
+          return;
+        }
+      if (m_skipUnchangedBeacons && IsAssociated () && IsUnchangedBeacon (packet))
+        {
+          NS_LOG_LOGIC ("Beacon is unchanged, skip its processing");
+          m_beaconArrival (Simulator::Now ());
+          RestartBeaconWatchdog (m_beaconInterval * m_maxMissedBeacons);
+          return;
+        }
       MgtBeaconHeader beacon;
       Ptr<Packet> copy = packet->Copy ();
       copy->RemoveHeader (beacon);
@@ -628,17 +686,17 @@ StaWifiMac::Receive (Ptr<WifiMacQueueItem> mpdu)
           NS_LOG_LOGIC ("No match for BSS membership selector");
           goodBeacon = false;
         }
-      if ((IsWaitAssocResp () || IsAssociated ()) && hdr->GetAddr3 () != GetBssid ())
-        {
-          NS_LOG_LOGIC ("Beacon is not for us");
-          goodBeacon = false;
-        }
       if (goodBeacon && m_state == ASSOCIATED)
         {
           m_beaconArrival (Simulator::Now ());
-          Time delay = MicroSeconds (beacon.GetBeaconIntervalUs () * m_maxMissedBeacons);
-          RestartBeaconWatchdog (delay);
+          m_beaconInterval = MicroSeconds (beacon.GetBeaconIntervalUs ());
+          RestartBeaconWatchdog (m_beaconInterval * m_maxMissedBeacons);
           UpdateApInfoFromBeacon (beacon, hdr->GetAddr2 (), hdr->GetAddr3 ());
+          if (m_skipUnchangedBeacons)
+            {
+              m_lastBeacon.resize (packet->GetSize ());
+              packet->CopyData (m_lastBeacon.data (), m_lastBeacon.size ());
+            }
         }
       if (goodBeacon && m_state == WAIT_BEACON)
         {
@@ -732,6 +790,22 @@ StaWifiMac::Receive (Ptr<WifiMacQueueItem> mpdu)
   WifiMac::Receive (Create<WifiMacQueueItem> (packet, *hdr));
 }
 
+bool
+StaWifiMac::IsUnchangedBeacon (Ptr<const Packet> packet) const
+{
+  // the Timestamp field, which changes at every beacon, is the first field
+  // of the Beacon frame body
+  const uint32_t timestampSize = 8;
+  uint32_t size = packet->GetSize ();
+  if (m_lastBeacon.size () != size || size < timestampSize)
+    {
+      return false;
+    }
+  std::vector<uint8_t> buffer (size);
+  packet->CopyData (buffer.data (), size);
+  return std::equal (buffer.begin () + timestampSize, buffer.end (), m_lastBeacon.begin () + timestampSize);
+}
+
 void
 StaWifiMac::UpdateCandidateApList (ApInfo newApInfo)
 {
@@ -1143,6 +1217,11 @@ StaWifiMac::SetState (MacState value)
     {
       m_deAssocLogger (GetBssid ());
     }
+  if (value != m_state)
+    {
+      // beacons must be fully processed again in the new state
+      m_lastBeacon.clear ();
+    }
   m_state = value;
 }
 
@@ -34,6 +34,7 @@ namespace ns3  {
 
 class SupportedRates;
 class CapabilityInformation;
+class ApWifiMac;
 
 /**
  * \ingroup wifi
@@ -151,6 +152,18 @@ public:
    */
   uint16_t GetAssociationId (void) const;
 
+  /**
+   * Associate this STA with the given AP without exchanging any frame, as
+   * if the STA had received a beacon from the AP and completed the
+   * association procedure. This must be called before the STA is
+   * initialized (i.e., before the simulation starts), in which case the
+   * STA does not scan and the link is up from the beginning of the
+   * simulation.
+   *
+   * \param ap the MAC of the AP to associate with
+   */
+  void PreAssociate (Ptr<ApWifiMac> ap);
+
   void NotifyChannelSwitching (void) override;
 
 private:
@@ -313,6 +326,21 @@ private:
    * \return the Capability information that we support
    */
   CapabilityInformation GetCapabilities (void) const;
+  /**
+   * Return the body of the association request sent by this STA.
+   *
+   * \return the association request
+   */
+  MgtAssocRequestHeader GetAssociationRequest (void) const;
+  /**
+   * Check whether the body of the given Beacon frame, except for the Timestamp
+   * field, is identical to that of the last Beacon frame processed while
+   * associated.
+   *
+   * \param packet the body of the Beacon frame
+   * \return true if the beacon is unchanged
+   */
+  bool IsUnchangedBeacon (Ptr<const Packet> packet) const;
 
   /**
    * Indicate that PHY capabilities have changed.
@@ -333,6 +361,9 @@ private:
   Time m_beaconWatchdogEnd;    ///< beacon watchdog end
   uint32_t m_maxMissedBeacons; ///< maximum missed beacons
   bool m_activeProbing;        ///< active probing
+  bool m_skipUnchangedBeacons; ///< whether to skip the processing of unchanged beacons
+  Time m_beaconInterval;       ///< beacon interval of the associated AP
+  std::vector<uint8_t> m_lastBeacon; ///< body of the last beacon processed while associated
   std::vector<ApInfo> m_candidateAps; ///< list of candidate APs to associate to
   // Note: std::multiset<ApInfo> might be a candidate container to implement
   // this sorted list, but we are using a std::vector because we want to sort
@@ -42,6 +42,7 @@ WifiMacQueueItem::WifiMacQueueItem (Ptr<const Packet> p, const WifiMacHeader & h
   : m_packet (p),
     m_header (header),
     m_tstamp (tstamp),
+    m_queueOrder (0),
     m_queueAc (AC_UNDEF)
 {
   if (header.IsQosData () && header.IsQosAmsdu ())
@@ -30,6 +30,7 @@
 #include "amsdu-subframe-header.h"
 #include "qos-utils.h"
 #include <list>
+#include <map>
 
 namespace ns3 {
 
@@ -211,6 +212,8 @@ private:
   Time m_tstamp;                                //!< timestamp when the packet arrived at the queue
   DeaggregatedMsdus m_msduList;                 //!< The list of aggregated MSDUs included in this MPDU
   ConstIterator m_queueIt;                      //!< Queue iterator pointing to this MPDU, if queued
+  int64_t m_queueOrder;                         //!< Order of this MPDU in the queue, increasing from the head, if queued
+  std::multimap<Time, ConstIterator>::const_iterator m_expiryIt; //!< Position of this MPDU in the expiry index of the queue, if queued
   AcIndex m_queueAc;                            //!< AC associated with the queue this MPDU is stored into
   bool m_inFlight;                              //!< whether the MPDU is in flight
 };
@@ -25,6 +25,7 @@
 #include "wifi-mac-queue.h"
 #include "qos-blocked-destinations.h"
 #include <functional>
+#include <limits>
 
 namespace ns3 {
 
@@ -75,6 +76,16 @@ WifiMacQueue::~WifiMacQueue ()
   m_nQueuedBytes.clear ();
 }
 
+void
+WifiMacQueue::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_flows.clear ();
+  m_otherMpdus.clear ();
+  m_expiry.clear ();
+  Queue<WifiMacQueueItem>::DoDispose ();
+}
+
 bool
 WifiMacQueue::TtlExceeded (ConstIterator &it, const Time& now)
 {
@@ -89,6 +100,16 @@ WifiMacQueue::TtlExceeded (ConstIterator &it, const Time& now)
   return false;
 }
 
+void
+WifiMacQueue::RemoveExpired (const Time& now)
+{
+  while (!m_expiry.empty () && now > m_expiry.begin ()->first + m_maxDelay)
+    {
+      ConstIterator it = m_expiry.begin ()->second;
+      TtlExceeded (it, now);
+    }
+}
+
 bool
 WifiMacQueue::TtlExceeded (Ptr<const WifiMacQueueItem> item, const Time& now)
 {
@@ -139,20 +160,16 @@ WifiMacQueue::Insert (ConstIterator pos, Ptr<WifiMacQueueItem> item)
       return DoEnqueue (pos, item);
     }
 
-  // the queue is full; scan the list in the attempt to remove stale packets
-  ConstIterator it = begin ();
+  // the queue is full; attempt to remove the oldest packet, if stale
   const Time now = Simulator::Now ();
-  while (it != end ())
+  if (!m_expiry.empty ())
     {
-      if (it == pos && TtlExceeded (it, now))
-        {
-          return DoEnqueue (it, item);
-        }
+      ConstIterator it = m_expiry.begin ()->second;
+      bool isPos = (it == pos);
       if (TtlExceeded (it, now))
         {
-          return DoEnqueue (pos, item);
+          return DoEnqueue (isPos ? it : pos, item);
         }
-      it++;
     }
 
   // the queue is still full, remove the oldest item if the policy is drop oldest
@@ -279,23 +296,33 @@ WifiMacQueue::PeekByTidAndAddress (uint8_t tid, Mac48Address dest, Ptr<const Wif
   NS_LOG_FUNCTION (this << +tid << dest << item);
   NS_ASSERT (item == nullptr || item->IsQueued ());
 
-  ConstIterator it = (item != nullptr ? std::next (item->m_queueIt) : begin ());
-  const Time now = Simulator::Now ();
-  while (it != end ())
+  auto flowIt = m_flows.find (WifiAddressTidPair (dest, tid));
+  if (flowIt != m_flows.end ())
+    {
+      Ptr<const WifiMacQueueItem> mpdu = PeekInFlow (flowIt->second,
+                                                     (item != nullptr ? item->m_queueOrder : std::numeric_limits<int64_t>::min ()),
+                                                     Simulator::Now ());
+      if (mpdu != nullptr)
+        {
+          return mpdu;
+        }
+    }
+  NS_LOG_DEBUG ("The queue is empty");
+  return nullptr;
+}
+
+Ptr<const WifiMacQueueItem>
+WifiMacQueue::PeekInFlow (const OrderedMpdus &mpdus, int64_t after, const Time& now) const
+{
+  for (auto it = mpdus.upper_bound (after); it != mpdus.end (); it++)
     {
       // skip packets that stayed in the queue for too long. They will be
       // actually removed from the queue by the next call to a non-const method
-      if (now <= (*it)->GetTimeStamp () + m_maxDelay)
+      if (now <= (*it->second)->GetTimeStamp () + m_maxDelay)
         {
-          if ((*it)->GetHeader ().IsQosData () && (*it)->GetDestinationAddress () == dest
-              && (*it)->GetHeader ().GetQosTid () == tid)
-            {
-              return *it;
-            }
+          return *it->second;
         }
-      it++;
     }
-  NS_LOG_DEBUG ("The queue is empty");
   return nullptr;
 }
 
@@ -308,7 +335,9 @@ WifiMacQueue::PeekFirstAvailable (const Ptr<QosBlockedDestinations> blockedPacke
 
   ConstIterator it = (item != nullptr ? std::next (item->m_queueIt) : begin ());
   const Time now = Simulator::Now ();
-  while (it != end ())
+  // The first packets are usually available. Check up to as many packets as
+  // there are flows before looking for the first packet of each flow.
+  for (std::size_t n = 0; it != end () && n <= m_flows.size (); it++, n++)
     {
       // skip packets that stayed in the queue for too long. They will be
       // actually removed from the queue by the next call to a non-const method
@@ -320,10 +349,32 @@ WifiMacQueue::PeekFirstAvailable (const Ptr<QosBlockedDestinations> blockedPacke
               return *it;
             }
         }
-      it++;
     }
-  NS_LOG_DEBUG ("The queue is empty");
-  return nullptr;
+  if (it == end ())
+    {
+      NS_LOG_DEBUG ("The queue is empty");
+      return nullptr;
+    }
+
+  int64_t after = (*std::prev (it))->m_queueOrder;
+  Ptr<const WifiMacQueueItem> first = PeekInFlow (m_otherMpdus, after, now);
+  for (const auto& flow : m_flows)
+    {
+      if (blockedPackets && blockedPackets->IsBlocked (flow.first.first, flow.first.second))
+        {
+          continue;
+        }
+      Ptr<const WifiMacQueueItem> mpdu = PeekInFlow (flow.second, after, now);
+      if (mpdu != nullptr && (first == nullptr || mpdu->m_queueOrder < first->m_queueOrder))
+        {
+          first = mpdu;
+        }
+    }
+  if (first == nullptr)
+    {
+      NS_LOG_DEBUG ("The queue is empty");
+    }
+  return first;
 }
 
 Ptr<WifiMacQueueItem>
@@ -422,22 +473,9 @@ uint32_t
 WifiMacQueue::GetNPacketsByTidAndAddress (uint8_t tid, Mac48Address dest)
 {
   NS_LOG_FUNCTION (this << dest);
-  uint32_t nPackets = 0;
-  const Time now = Simulator::Now ();
-
-  for (ConstIterator it = begin (); it != end (); )
-    {
-      if (!TtlExceeded (it, now))
-        {
-          if ((*it)->GetHeader ().IsQosData () && (*it)->GetDestinationAddress () == dest
-              && (*it)->GetHeader ().GetQosTid () == tid)
-            {
-              nPackets++;
-            }
 
-          it++;
-        }
-    }
+  RemoveExpired (Simulator::Now ());
+  uint32_t nPackets = GetNPackets (tid, dest);
   NS_LOG_DEBUG ("returns " << nPackets);
   return nPackets;
 }
@@ -464,16 +502,9 @@ uint32_t
 WifiMacQueue::GetNPackets (void)
 {
   NS_LOG_FUNCTION (this);
-  const Time now = Simulator::Now ();
 
   // remove packets that stayed in the queue for too long
-  for (ConstIterator it = begin (); it != end (); )
-    {
-      if (!TtlExceeded (it, now))
-        {
-          it++;
-        }
-    }
+  RemoveExpired (Simulator::Now ());
   return QueueBase::GetNPackets ();
 }
 
@@ -481,16 +512,9 @@ uint32_t
 WifiMacQueue::GetNBytes (void)
 {
   NS_LOG_FUNCTION (this);
-  const Time now = Simulator::Now ();
 
   // remove packets that stayed in the queue for too long
-  for (ConstIterator it = begin (); it != end (); )
-    {
-      if (!TtlExceeded (it, now))
-        {
-          it++;
-        }
-    }
+  RemoveExpired (Simulator::Now ());
   return QueueBase::GetNBytes ();
 }
 
@@ -540,6 +564,7 @@ WifiMacQueue::DoEnqueue (ConstIterator pos, Ptr<WifiMacQueueItem> item)
       // set item's information about its position in the queue
       item->m_queueAc = m_ac;
       item->m_queueIt = ret;
+      AddToIndex (ret);
       return true;
     }
   return false;
@@ -567,6 +592,7 @@ WifiMacQueue::DoDequeue (ConstIterator pos)
     {
       NS_ASSERT (item->IsQueued ());
       item->m_queueAc = AC_UNDEF;
+      RemoveFromIndex (item);
     }
 
   return item;
@@ -592,9 +618,79 @@ WifiMacQueue::DoRemove (ConstIterator pos)
     {
       NS_ASSERT (item->IsQueued ());
       item->m_queueAc = AC_UNDEF;
+      RemoveFromIndex (item);
     }
 
   return item;
 }
 
+WifiMacQueue::OrderedMpdus&
+WifiMacQueue::GetFlow (Ptr<const WifiMacQueueItem> item)
+{
+  if (item->GetHeader ().IsQosData ())
+    {
+      return m_flows[WifiAddressTidPair (item->GetHeader ().GetAddr1 (), item->GetHeader ().GetQosTid ())];
+    }
+  return m_otherMpdus;
+}
+
+void
+WifiMacQueue::AddToIndex (ConstIterator it)
+{
+  Ptr<WifiMacQueueItem> item = *it;
+  // the order of an item lies between those of the items around it
+  if (std::next (it) == end ())
+    {
+      item->m_queueOrder = (it == begin () ? 0 : (*std::prev (it))->m_queueOrder + 1);
+    }
+  else if (it == begin ())
+    {
+      item->m_queueOrder = (*std::next (it))->m_queueOrder - 1;
+    }
+  else if ((*std::next (it))->m_queueOrder - (*std::prev (it))->m_queueOrder > 1)
+    {
+      item->m_queueOrder = (*std::next (it))->m_queueOrder - 1;
+    }
+  else
+    {
+      // no room between the items around it: spread the orders of all the
+      // items. An item replacing another one takes its place, hence this
+      // is unusual
+      NS_LOG_DEBUG ("Renumber the items in the queue");
+      m_flows.clear ();
+      m_otherMpdus.clear ();
+      int64_t order = 0;
+      for (ConstIterator i = begin (); i != end (); i++, order += 2)
+        {
+          (*i)->m_queueOrder = order;
+          if (i != it)
+            {
+              GetFlow (*i).emplace (order, i);
+            }
+        }
+    }
+  GetFlow (item).emplace (item->m_queueOrder, it);
+  item->m_expiryIt = m_expiry.emplace (item->GetTimeStamp (), it);
+}
+
+void
+WifiMacQueue::RemoveFromIndex (Ptr<const WifiMacQueueItem> item)
+{
+  m_expiry.erase (item->m_expiryIt);
+  if (item->GetHeader ().IsQosData ())
+    {
+      auto flowIt = m_flows.find (WifiAddressTidPair (item->GetHeader ().GetAddr1 (), item->GetHeader ().GetQosTid ()));
+      NS_ASSERT (flowIt != m_flows.end ());
+      flowIt->second.erase (item->m_queueOrder);
+      if (flowIt->second.empty ())
+        {
+          m_flows.erase (flowIt);
+        }
+    }
+  else
+    {
+      m_otherMpdus.erase (item->m_queueOrder);
+    }
+}
+
 } //namespace ns3
@@ -27,6 +27,7 @@
 #include "wifi-mac-queue-item.h"
 #include "ns3/queue.h"
 #include <unordered_map>
+#include <map>
 #include "qos-utils.h"
 #include <functional>
 
@@ -56,6 +57,11 @@ extern template class Queue<WifiMacQueueItem>;
  * to verify whether or not it should be dropped. If
  * dot11EDCATableMSDULifetime has elapsed, it is dropped.
  * Otherwise, it is returned to the caller.
+ *
+ * Besides the list of all the MPDUs, the queue indexes the QoS data frames
+ * of each (receiver address, TID) pair in queue order, and all the MPDUs
+ * by timestamp, so that the MPDUs of a pair are found and the expired MPDUs
+ * are removed without traversing the whole queue.
  */
 class WifiMacQueue : public Queue<WifiMacQueueItem>
 {
@@ -256,8 +262,9 @@ public:
   uint32_t GetNPacketsByAddress (Mac48Address dest);
   /**
    * Return the number of QoS packets having TID equal to <i>tid</i> and
-   * destination address equal to <i>dest</i>.  The complexity is linear in
-   * the size of the queue.
+   * destination address equal to <i>dest</i>, after removing the packets
+   * whose lifetime expired. The complexity in the average case is
+   * logarithmic in the size of the queue for each expired packet.
    *
    * \param tid the given TID
    * \param dest the given destination
@@ -322,7 +329,13 @@ public:
    */
   bool TtlExceeded (Ptr<const WifiMacQueueItem> item, const Time& now);
 
+protected:
+  void DoDispose (void) override;
+
 private:
+  /// The queued MPDUs of a flow, indexed by their order in the queue
+  typedef std::map<int64_t, ConstIterator> OrderedMpdus;
+
   /**
    * Remove the item pointed to by the iterator <i>it</i> if it has been in the
    * queue for too long. If the item is removed, the iterator is updated to
@@ -333,6 +346,22 @@ private:
    * \return true if the item is removed, false otherwise
    */
   inline bool TtlExceeded (ConstIterator &it, const Time& now);
+  /**
+   * Remove all the items that have been in the queue for too long.
+   *
+   * \param now a copy of Simulator::Now()
+   */
+  void RemoveExpired (const Time& now);
+  /**
+   * Return the first item of the given flow that follows the item with the
+   * given order in the queue and whose lifetime has not expired, if any.
+   *
+   * \param mpdus the queued MPDUs of the flow
+   * \param after the order of the item after which the search starts from
+   * \param now a copy of Simulator::Now()
+   * \return the item or a null pointer
+   */
+  Ptr<const WifiMacQueueItem> PeekInFlow (const OrderedMpdus &mpdus, int64_t after, const Time& now) const;
 
   /**
    * Enqueue the given Wifi MAC queue item before the given position.
@@ -370,6 +399,27 @@ private:
    * \return the item.
    */
   Ptr<WifiMacQueueItem> DoRemove (ConstIterator pos);
+  /**
+   * Set the order of the item pointed to by the given iterator, which was
+   * just inserted in the queue, and add the item to the indexes.
+   *
+   * \param it an iterator pointing to the item
+   */
+  void AddToIndex (ConstIterator it);
+  /**
+   * Remove the given item, which was just removed from the queue, from
+   * the indexes.
+   *
+   * \param item the item
+   */
+  void RemoveFromIndex (Ptr<const WifiMacQueueItem> item);
+  /**
+   * Return the queued MPDUs of the flow of the given item.
+   *
+   * \param item the item
+   * \return the queued MPDUs of the flow of the item
+   */
+  OrderedMpdus& GetFlow (Ptr<const WifiMacQueueItem> item);
 
   Time m_maxDelay;                          //!< Time to live for packets in the queue
   DropPolicy m_dropPolicy;                  //!< Drop behavior of queue
@@ -379,6 +429,10 @@ private:
   std::unordered_map<WifiAddressTidPair, uint32_t, WifiAddressTidHash> m_nQueuedPackets;
   /// Per (MAC address, TID) pair queued bytes
   std::unordered_map<WifiAddressTidPair, uint32_t, WifiAddressTidHash> m_nQueuedBytes;
+  /// Per (MAC address, TID) pair queued QoS data frames, in queue order
+  std::unordered_map<WifiAddressTidPair, OrderedMpdus, WifiAddressTidHash> m_flows;
+  OrderedMpdus m_otherMpdus;                //!< the queued MPDUs that are not QoS data frames, in queue order
+  std::multimap<Time, ConstIterator> m_expiry;  //!< the queued MPDUs, by timestamp
 
   /// Traced callback: fired when a packet is dropped due to lifetime expiration
   TracedCallback<Ptr<const WifiMacQueueItem> > m_traceExpired;
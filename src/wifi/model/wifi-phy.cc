@@ -200,6 +200,16 @@ WifiPhy::GetTypeId (void)
                    MakeBooleanAccessor (&WifiPhy::GetShortPhyPreambleSupported,
                                         &WifiPhy::SetShortPhyPreambleSupported),
                    MakeBooleanChecker ())
+    .AddAttribute ("Abstraction",
+                   "If true, receive the PPDUs at an abstraction level: the fields of the "
+                   "PHY header are received at once, up to the end of the header or of "
+                   "a field whose end is notified to the MAC, and the error rate of an MPDU "
+                   "is obtained from its effective SNR (EESM) in the lookup tables of the "
+                   "error rate model (whose LookupTable attribute is set).",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&WifiPhy::GetAbstraction,
+                                        &WifiPhy::SetAbstraction),
+                   MakeBooleanChecker ())
     .AddAttribute ("FrameCaptureModel",
                    "Ptr to an object that implements the frame capture model",
                    PointerValue (),
@@ -320,6 +330,7 @@ WifiPhy::WifiPhy ()
     m_blockAckTxTime (Seconds (0)),
     m_powerRestricted (false),
     m_channelAccessRequested (false),
+    m_abstraction (false),
     m_txSpatialStreams (0),
     m_rxSpatialStreams (0),
     m_wifiRadioEnergyModel (0),
@@ -531,6 +542,23 @@ WifiPhy::GetShortPhyPreambleSupported (void) const
   return m_shortPreamble;
 }
 
+void
+WifiPhy::SetAbstraction (bool enable)
+{
+  NS_LOG_FUNCTION (this << enable);
+  m_abstraction = enable;
+  if (enable && m_interference != nullptr && m_interference->GetErrorRateModel () != nullptr)
+    {
+      m_interference->GetErrorRateModel ()->SetAttribute ("LookupTable", BooleanValue (true));
+    }
+}
+
+bool
+WifiPhy::GetAbstraction (void) const
+{
+  return m_abstraction;
+}
+
 void
 WifiPhy::SetDevice (const Ptr<WifiNetDevice> device)
 {
@@ -575,6 +603,10 @@ WifiPhy::SetErrorRateModel (const Ptr<ErrorRateModel> model)
 {
   NS_ASSERT (m_interference != nullptr);
   m_interference->SetErrorRateModel (model);
+  if (m_abstraction)
+    {
+      model->SetAttribute ("LookupTable", BooleanValue (true));
+    }
 }
 
 void
@@ -886,6 +886,23 @@ public:
    * \returns if short PHY preamble is supported or not
    */
   bool GetShortPhyPreambleSupported (void) const;
+  /**
+   * Enable or disable the reception of the PPDUs at an abstraction level.
+   * The fields of the PHY header are then received at once, up to the end
+   * of the header or of a field whose end is notified to the MAC, and the
+   * error rate of an MPDU is obtained from its effective SNR, rather than
+   * from the SNRs of its chunks. The MAC is notified of the start and the
+   * end of the receptions and of the MPDUs of the A-MPDUs at the same times
+   * as without abstraction. This also enables the lookup tables of the
+   * error rate model.
+   *
+   * \param enable whether to receive the PPDUs at an abstraction level
+   */
+  void SetAbstraction (bool enable);
+  /**
+   * \return whether the PPDUs are received at an abstraction level
+   */
+  bool GetAbstraction (void) const;
 
   /**
    * Sets the interference helper.
@@ -1375,6 +1392,8 @@ private:
   double m_txPowerMaxMimo;       //!< MIMO maximum transmit power due to OBSS PD SR power restriction (dBm)
   bool m_channelAccessRequested; //!< Flag if channels access has been requested (used for OBSS_PD SR)
 
+  bool m_abstraction;          //!< Flag if the PPDUs are received at an abstraction level
+
   bool m_shortPreamble;        //!< Flag if short PHY preamble is supported
   uint8_t m_numberOfAntennas;  //!< Number of transmitters
   uint8_t m_txSpatialStreams;  //!< Number of supported TX spatial streams
@@ -179,21 +179,23 @@ YansErrorRateModel::GetFecQamBer (double snr, uint64_t nbits,
   return pms;
 }
 
+uint64_t
+YansErrorRateModel::GetPhyRate (WifiMode mode, const WifiTxVector& txVector, uint16_t staId) const
+{
+  if ((txVector.IsMu () && (staId == SU_STA_ID)) || (mode != txVector.GetMode ()))
+    {
+      return mode.GetPhyRate (txVector.GetChannelWidth () >= 40 ? 20 : txVector.GetChannelWidth ()); //This is the PHY header
+    }
+  return mode.GetPhyRate (txVector, staId);
+}
+
 double
 YansErrorRateModel::DoGetChunkSuccessRate (WifiMode mode, const WifiTxVector& txVector, double snr, uint64_t nbits, uint8_t numRxAntennas, WifiPpduField field, uint16_t staId) const
 {
   NS_LOG_FUNCTION (this << mode << txVector << snr << nbits << +numRxAntennas << field << staId);
   if (mode.GetModulationClass () >= WIFI_MOD_CLASS_ERP_OFDM)
     {
-      uint64_t phyRate;
-      if ((txVector.IsMu () && (staId == SU_STA_ID)) || (mode != txVector.GetMode ()))
-        {
-          phyRate = mode.GetPhyRate (txVector.GetChannelWidth () >= 40 ? 20 : txVector.GetChannelWidth ()); //This is the PHY header
-        }
-      else
-        {
-          phyRate = mode.GetPhyRate (txVector, staId);
-        }
+      uint64_t phyRate = GetPhyRate (mode, txVector, staId);
       if (mode.GetConstellationSize () == 2)
         {
           if (mode.GetCodeRate () == WIFI_CODE_RATE_1_2)
@@ -387,4 +389,17 @@ YansErrorRateModel::DoGetChunkSuccessRate (WifiMode mode, const WifiTxVector& tx
   return 0;
 }
 
+std::optional<uint64_t>
+YansErrorRateModel::GetLookupTableKey (WifiMode mode, const WifiTxVector& txVector, WifiPpduField field, uint16_t staId) const
+{
+  if (mode.GetModulationClass () < WIFI_MOD_CLASS_ERP_OFDM)
+    {
+      return std::nullopt;
+    }
+  // the success rate of a bit depends on the mode, the signal spread and the PHY rate
+  uint64_t phyRate = (mode.GetConstellationSize () == 4096 ? mode.GetPhyRate (txVector) : GetPhyRate (mode, txVector, staId));
+  NS_ASSERT (phyRate < (1ULL << 48));
+  return (static_cast<uint64_t> (txVector.GetChannelWidth ()) << 48) | phyRate;
+}
+
 } //namespace ns3
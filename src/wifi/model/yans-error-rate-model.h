@@ -65,6 +65,19 @@ public:
 private:
   double DoGetChunkSuccessRate (WifiMode mode, const WifiTxVector& txVector, double snr, uint64_t nbits,
                                 uint8_t numRxAntennas, WifiPpduField field, uint16_t staId) const override;
+  std::optional<uint64_t> GetLookupTableKey (WifiMode mode, const WifiTxVector& txVector,
+                                             WifiPpduField field, uint16_t staId) const override;
+  /**
+   * Return the PHY rate of a chunk.
+   *
+   * \param mode the Wi-Fi mode applicable to the chunk
+   * \param txVector TXVECTOR of the overall transmission
+   * \param staId the station ID for MU
+   *
+   * \return the PHY rate of the PHY header if mode is not the mode of the
+   *         payload, the PHY rate of the payload otherwise
+   */
+  uint64_t GetPhyRate (WifiMode mode, const WifiTxVector& txVector, uint16_t staId) const;
   /**
    * Return BER of BPSK with the given parameters.
    *
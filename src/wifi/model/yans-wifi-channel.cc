@@ -21,16 +21,28 @@
 #include "ns3/simulator.h"
 #include "ns3/log.h"
 #include "ns3/pointer.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
 #include "ns3/wifi-net-device.h"
 #include "ns3/node.h"
 #include "ns3/propagation-loss-model.h"
 #include "ns3/propagation-delay-model.h"
 #include "ns3/mobility-model.h"
+#include "ns3/constant-position-mobility-model.h"
 #include "yans-wifi-channel.h"
 #include "yans-wifi-phy.h"
 #include "wifi-utils.h"
 #include "wifi-ppdu.h"
 #include "wifi-psdu.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
 
 namespace ns3 {
 
@@ -38,6 +50,170 @@ NS_LOG_COMPONENT_DEFINE ("YansWifiChannel");
 
 NS_OBJECT_ENSURE_REGISTERED (YansWifiChannel);
 
+/**
+ * \ingroup wifi
+ *
+ * A pool of threads computing the propagation of a transmission to its
+ * receivers. Each thread, including the one that runs a job, has its own
+ * pair of mobility models, which it positions at the sender and at the
+ * receivers it processes, so that the mobility models of the PHYs are only
+ * accessed by the simulator thread.
+ */
+class YansWifiChannel::ThreadPool
+{
+public:
+  /// The propagation of a transmission to a receiver
+  struct Reception
+  {
+    Ptr<YansWifiPhy> receiver; //!< the receiver
+    Vector position;           //!< the position of the receiver
+    Time delay;                //!< the propagation delay
+    double rxPowerDbm;         //!< the RX power, in dBm
+  };
+
+  /**
+   * A job processes a reception, given its index, with the mobility models
+   * of the thread, given their index.
+   */
+  typedef std::function<void (std::size_t thread, std::size_t reception)> Job;
+
+  /**
+   * Create the threads of the pool.
+   *
+   * \param nThreads the number of threads, including the one that runs the jobs
+   */
+  ThreadPool (uint32_t nThreads);
+  /**
+   * Stop and join the threads of the pool.
+   */
+  ~ThreadPool ();
+
+  /**
+   * Run the given job for every reception and return when all of them are
+   * processed.
+   *
+   * \param job the job
+   */
+  void Run (const Job &job);
+
+  std::vector<Reception> m_receptions; //!< the receptions of the current transmission
+  /// the mobility models of the sender and of the receiver of each thread
+  std::vector<std::pair<Ptr<MobilityModel>, Ptr<MobilityModel> > > m_mobility;
+
+private:
+  /**
+   * The loop of the threads of the pool.
+   *
+   * \param thread the index of the thread
+   */
+  void Loop (std::size_t thread);
+  /**
+   * Process receptions of the current job until none is left.
+   *
+   * \param thread the index of the thread
+   */
+  void Process (std::size_t thread);
+
+  std::vector<std::thread> m_threads;  //!< the threads, other than the one that runs the jobs
+  std::mutex m_mutex;                  //!< protects the state of the pool
+  std::condition_variable m_start;     //!< notified when a job is started or the pool stopped
+  std::condition_variable m_done;      //!< notified when the threads are done with a job
+  const Job *m_job;                    //!< the current job
+  std::atomic<std::size_t> m_next;     //!< the index of the next reception to process
+  std::size_t m_nBusy;                 //!< the number of threads processing the current job
+  uint64_t m_generation;               //!< the number of jobs started
+  bool m_stop;                         //!< whether the pool is stopped
+};
+
+YansWifiChannel::ThreadPool::ThreadPool (uint32_t nThreads)
+  : m_job (0),
+    m_next (0),
+    m_nBusy (0),
+    m_generation (0),
+    m_stop (false)
+{
+  for (uint32_t i = 0; i < nThreads; i++)
+    {
+      m_mobility.push_back ({CreateObject<ConstantPositionMobilityModel> (),
+                             CreateObject<ConstantPositionMobilityModel> ()});
+    }
+  for (uint32_t i = 1; i < nThreads; i++)
+    {
+      m_threads.emplace_back (&ThreadPool::Loop, this, i);
+    }
+}
+
+YansWifiChannel::ThreadPool::~ThreadPool ()
+{
+  {
+    std::lock_guard<std::mutex> lock (m_mutex);
+    m_stop = true;
+  }
+  m_start.notify_all ();
+  for (auto &thread : m_threads)
+    {
+      thread.join ();
+    }
+}
+
+void
+YansWifiChannel::ThreadPool::Run (const Job &job)
+{
+  {
+    std::lock_guard<std::mutex> lock (m_mutex);
+    m_job = &job;
+    m_next = 0;
+    m_nBusy = m_threads.size ();
+    m_generation++;
+  }
+  m_start.notify_all ();
+  Process (0);
+  std::unique_lock<std::mutex> lock (m_mutex);
+  m_done.wait (lock, [this] { return m_nBusy == 0; });
+  m_job = 0;
+}
+
+void
+YansWifiChannel::ThreadPool::Loop (std::size_t thread)
+{
+  uint64_t generation = 0;
+  while (true)
+    {
+      {
+        std::unique_lock<std::mutex> lock (m_mutex);
+        m_start.wait (lock, [this, generation] { return m_stop || m_generation != generation; });
+        if (m_stop)
+          {
+            return;
+          }
+        generation = m_generation;
+      }
+      Process (thread);
+      {
+        std::lock_guard<std::mutex> lock (m_mutex);
+        if (--m_nBusy == 0)
+          {
+            m_done.notify_one ();
+          }
+      }
+    }
+}
+
+void
+YansWifiChannel::ThreadPool::Process (std::size_t thread)
+{
+  // receptions are taken in small batches to limit the contention on m_next
+  const std::size_t batch = 16;
+  const std::size_t n = m_receptions.size ();
+  for (std::size_t begin = m_next.fetch_add (batch); begin < n; begin = m_next.fetch_add (batch))
+    {
+      for (std::size_t i = begin; i < std::min (begin + batch, n); i++)
+        {
+          (*m_job) (thread, i);
+        }
+    }
+}
+
 TypeId
 YansWifiChannel::GetTypeId (void)
 {
@@ -53,11 +229,38 @@ YansWifiChannel::GetTypeId (void)
                    PointerValue (),
                    MakePointerAccessor (&YansWifiChannel::m_delay),
                    MakePointerChecker<PropagationDelayModel> ())
+    .AddAttribute ("ReceiverCulling",
+                   "If true, a transmission only visits the receivers within its range, "
+                   "looked up in a grid of their positions. Disable it to visit all the PHYs.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&YansWifiChannel::m_culling),
+                   MakeBooleanChecker ())
+    .AddAttribute ("MaxRange",
+                   "The range of the transmissions (m) when ReceiverCulling is enabled. If zero, "
+                   "it is derived from the propagation loss model and the RX sensitivity of the PHYs.",
+                   DoubleValue (0),
+                   MakeDoubleAccessor (&YansWifiChannel::m_maxRange),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("CullingCellSize",
+                   "The side (m) of the cells of the grid of receivers. If zero, it is "
+                   "the range of the first transmission.",
+                   DoubleValue (0),
+                   MakeDoubleAccessor (&YansWifiChannel::m_cellSize),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("NumThreads",
+                   "The number of threads that compute the propagation delay and loss "
+                   "of a transmission to its receivers, if the propagation models are "
+                   "thread safe. The receptions are scheduled in the same order whatever "
+                   "the number of threads, hence the results do not depend on it.",
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&YansWifiChannel::m_nThreads),
+                   MakeUintegerChecker<uint32_t> (1))
   ;
   return tid;
 }
 
 YansWifiChannel::YansWifiChannel ()
+  : m_nIndexed (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -65,9 +268,18 @@ YansWifiChannel::YansWifiChannel ()
 YansWifiChannel::~YansWifiChannel ()
 {
   NS_LOG_FUNCTION (this);
+  m_receivers.Clear ();
   m_phyList.clear ();
 }
 
+void
+YansWifiChannel::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_threadPool.reset ();
+  Channel::DoDispose ();
+}
+
 void
 YansWifiChannel::SetPropagationLossModel (const Ptr<PropagationLossModel> loss)
 {
@@ -88,37 +300,167 @@ YansWifiChannel::Send (Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double
   NS_LOG_FUNCTION (this << sender << ppdu << txPowerDbm);
   Ptr<MobilityModel> senderMobility = sender->GetMobility ();
   NS_ASSERT (senderMobility != 0);
-  for (PhyList::const_iterator i = m_phyList.begin (); i != m_phyList.end (); i++)
+  double range = m_culling ? GetRange (txPowerDbm) : std::numeric_limits<double>::infinity ();
+  if (std::isinf (range))
     {
-      if (sender != (*i))
+      if (IsParallel (m_phyList.size ()))
         {
-          //For now don't account for inter channel interference nor channel bonding
-          if ((*i)->GetChannelNumber () != sender->GetChannelNumber ())
-            {
-              continue;
-            }
-
-          Ptr<MobilityModel> receiverMobility = (*i)->GetMobility ()->GetObject<MobilityModel> ();
-          Time delay = m_delay->GetDelay (senderMobility, receiverMobility);
-          double rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility);
-          NS_LOG_DEBUG ("propagation: txPower=" << txPowerDbm << "dbm, rxPower=" << rxPowerDbm << "dbm, " <<
-                        "distance=" << senderMobility->GetDistanceFrom (receiverMobility) << "m, delay=" << delay);
-          Ptr<WifiPpdu> copy = ppdu->Copy ();
-          Ptr<NetDevice> dstNetDevice = (*i)->GetDevice ();
-          uint32_t dstNode;
-          if (dstNetDevice == 0)
-            {
-              dstNode = 0xffffffff;
-            }
-          else
-            {
-              dstNode = dstNetDevice->GetNode ()->GetId ();
-            }
-
-          Simulator::ScheduleWithContext (dstNode,
-                                          delay, &YansWifiChannel::Receive,
-                                          (*i), copy, rxPowerDbm);
+          DeliverInParallel (sender, senderMobility, m_phyList, ppdu, txPowerDbm);
+          return;
         }
+      for (PhyList::const_iterator i = m_phyList.begin (); i != m_phyList.end (); i++)
+        {
+          Deliver (sender, senderMobility, *i, ppdu, txPowerDbm);
+        }
+      return;
+    }
+
+  UpdateReceivers (range);
+  std::vector<Ptr<YansWifiPhy> > receivers;
+  m_receivers.GetReceivers (senderMobility->GetPosition (), range, receivers);
+  NS_LOG_DEBUG ("range=" << range << "m, " << receivers.size () << " candidate receivers out of " << m_phyList.size ());
+  // the receivers beyond the range would drop the signal
+  receivers.erase (std::remove_if (receivers.begin (), receivers.end (),
+                                   [&senderMobility, range] (Ptr<YansWifiPhy> phy)
+                                   { return senderMobility->GetDistanceFrom (phy->GetMobility ()) > range; }),
+                   receivers.end ());
+  if (IsParallel (receivers.size ()))
+    {
+      DeliverInParallel (sender, senderMobility, receivers, ppdu, txPowerDbm);
+      return;
+    }
+  for (std::vector<Ptr<YansWifiPhy> >::const_iterator i = receivers.begin (); i != receivers.end (); i++)
+    {
+      Deliver (sender, senderMobility, *i, ppdu, txPowerDbm);
+    }
+}
+
+void
+YansWifiChannel::Deliver (Ptr<YansWifiPhy> sender, Ptr<MobilityModel> senderMobility,
+                          Ptr<YansWifiPhy> receiver, Ptr<const WifiPpdu> ppdu, double txPowerDbm) const
+{
+  NS_LOG_FUNCTION (this << sender << receiver << ppdu << txPowerDbm);
+  if (sender == receiver)
+    {
+      return;
+    }
+  //For now don't account for inter channel interference nor channel bonding
+  if (receiver->GetChannelNumber () != sender->GetChannelNumber ())
+    {
+      return;
+    }
+
+  Ptr<MobilityModel> receiverMobility = receiver->GetMobility ()->GetObject<MobilityModel> ();
+  Time delay = m_delay->GetDelay (senderMobility, receiverMobility);
+  double rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, senderMobility, receiverMobility);
+  NS_LOG_DEBUG ("propagation: txPower=" << txPowerDbm << "dbm, rxPower=" << rxPowerDbm << "dbm, " <<
+                "distance=" << senderMobility->GetDistanceFrom (receiverMobility) << "m, delay=" << delay);
+  ScheduleReceive (receiver, delay, ppdu, rxPowerDbm);
+}
+
+void
+YansWifiChannel::DeliverInParallel (Ptr<YansWifiPhy> sender, Ptr<MobilityModel> senderMobility,
+                                    const PhyList &receivers, Ptr<const WifiPpdu> ppdu, double txPowerDbm) const
+{
+  NS_LOG_FUNCTION (this << sender << receivers.size () << ppdu << txPowerDbm);
+  if (!m_threadPool)
+    {
+      m_threadPool = std::make_unique<ThreadPool> (m_nThreads);
+    }
+  // only this thread accesses the PHYs and their mobility models
+  std::vector<ThreadPool::Reception> &receptions = m_threadPool->m_receptions;
+  for (const auto &receiver : receivers)
+    {
+      //For now don't account for inter channel interference nor channel bonding
+      if (receiver != sender && receiver->GetChannelNumber () == sender->GetChannelNumber ())
+        {
+          receptions.push_back ({receiver, receiver->GetMobility ()->GetPosition (), Time (), 0});
+        }
+    }
+  Vector senderPosition = senderMobility->GetPosition ();
+  for (const auto &mobility : m_threadPool->m_mobility)
+    {
+      mobility.first->SetPosition (senderPosition);
+    }
+
+  m_threadPool->Run ([this, txPowerDbm, &receptions] (std::size_t thread, std::size_t i)
+    {
+      const auto &mobility = m_threadPool->m_mobility[thread];
+      mobility.second->SetPosition (receptions[i].position);
+      receptions[i].delay = m_delay->GetDelay (mobility.first, mobility.second);
+      receptions[i].rxPowerDbm = m_loss->CalcRxPower (txPowerDbm, mobility.first, mobility.second);
+    });
+
+  for (const auto &reception : receptions)
+    {
+      NS_LOG_DEBUG ("propagation: txPower=" << txPowerDbm << "dbm, rxPower=" << reception.rxPowerDbm << "dbm, " <<
+                    "distance=" << CalculateDistance (senderPosition, reception.position) << "m, delay=" << reception.delay);
+      ScheduleReceive (reception.receiver, reception.delay, ppdu, reception.rxPowerDbm);
+    }
+  receptions.clear ();
+}
+
+bool
+YansWifiChannel::IsParallel (std::size_t nReceivers) const
+{
+  // waking up the threads costs more than computing the propagation to a
+  // few receivers
+  const std::size_t minReceivers = 64;
+  return m_nThreads > 1 && nReceivers >= minReceivers
+         && m_loss->IsThreadSafe () && m_delay->IsThreadSafe ();
+}
+
+void
+YansWifiChannel::ScheduleReceive (Ptr<YansWifiPhy> receiver, Time delay,
+                                  Ptr<const WifiPpdu> ppdu, double rxPowerDbm) const
+{
+  Ptr<WifiPpdu> copy = ppdu->Copy ();
+  Ptr<NetDevice> dstNetDevice = receiver->GetDevice ();
+  uint32_t dstNode;
+  if (dstNetDevice == 0)
+    {
+      dstNode = 0xffffffff;
+    }
+  else
+    {
+      dstNode = dstNetDevice->GetNode ()->GetId ();
+    }
+
+  Simulator::ScheduleWithContext (dstNode,
+                                  delay, &YansWifiChannel::Receive,
+                                  receiver, copy, rxPowerDbm);
+}
+
+double
+YansWifiChannel::GetRange (double txPowerDbm) const
+{
+  NS_LOG_FUNCTION (this << txPowerDbm);
+  if (m_maxRange > 0)
+    {
+      return m_maxRange;
+    }
+  // the sensitivity and the gain of the PHYs may change at any time
+  double rxPowerFloorDbm = std::numeric_limits<double>::infinity ();
+  for (const auto &phy : m_phyList)
+    {
+      rxPowerFloorDbm = std::min (rxPowerFloorDbm, phy->GetRxSensitivity () - phy->GetRxGain ());
+    }
+  return m_loss->GetMaxRange (txPowerDbm, rxPowerFloorDbm);
+}
+
+void
+YansWifiChannel::UpdateReceivers (double range) const
+{
+  NS_LOG_FUNCTION (this << range);
+  if (m_receivers.GetCellSize () == 0)
+    {
+      m_receivers.SetCellSize (m_cellSize > 0 ? m_cellSize : std::max (range, 1.0));
+    }
+  for (; m_nIndexed < m_phyList.size (); m_nIndexed++)
+    {
+      Ptr<YansWifiPhy> phy = m_phyList[m_nIndexed];
+      NS_ASSERT_MSG (phy->GetMobility () != 0, "Receiver culling needs the mobility model of every PHY");
+      m_receivers.Add (phy, phy->GetMobility ());
     }
 }
 
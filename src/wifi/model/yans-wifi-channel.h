@@ -22,6 +22,8 @@
 #define YANS_WIFI_CHANNEL_H
 
 #include "ns3/channel.h"
+#include "ns3/spatial-index.h"
+#include <memory>
 
 namespace ns3 {
 
@@ -32,6 +34,7 @@ class YansWifiPhy;
 class Packet;
 class Time;
 class WifiPpdu;
+class MobilityModel;
 
 /**
  * \brief a channel to interconnect ns3::YansWifiPhy objects.
@@ -41,6 +44,25 @@ class WifiPpdu;
  * class and supports an ns3::PropagationLossModel and an
  * ns3::PropagationDelayModel.  By default, no propagation models are set;
  * it is the caller's responsibility to set them before using the channel.
+ *
+ * With the ReceiverCulling attribute, a transmission only visits the
+ * receivers within its range, looked up in a grid of their positions,
+ * instead of scheduling a reception at every PHY of the channel. The range
+ * is the MaxRange attribute or, if zero, the distance beyond which the
+ * propagation loss model brings the signal below the lowest RX sensitivity
+ * (minus the RX gain) of the PHYs when they are first indexed. Since the
+ * receivers beyond that range would drop the signal, culling does not change
+ * the results, but it needs a loss model with a bounded range, such as a
+ * chain of deterministic path loss models (see
+ * PropagationLossModel::GetMaxRange); otherwise all the PHYs are visited.
+ *
+ * With the NumThreads attribute, the propagation delay and loss of a
+ * transmission to its receivers are computed by a pool of threads, each of
+ * which has its own copies of the positions of the sender and the receivers,
+ * provided that the propagation models are thread safe (see
+ * PropagationLossModel::IsThreadSafe); the receptions are then scheduled in
+ * the same order as with a single thread, hence the results do not depend
+ * on the number of threads.
  */
 class YansWifiChannel : public Channel
 {
@@ -98,6 +120,8 @@ public:
 
 
 private:
+  void DoDispose (void) override;
+
   /**
    * A vector of pointers to YansWifiPhy.
    */
@@ -114,9 +138,75 @@ private:
    */
   static void Receive (Ptr<YansWifiPhy> receiver, Ptr<WifiPpdu> ppdu, double txPowerDbm);
 
+  /**
+   * Schedule the reception of a PPDU by a PHY.
+   *
+   * \param sender the PHY object from which the packet is originating
+   * \param senderMobility the mobility model of the sender
+   * \param receiver the PHY object to which the packet is delivered
+   * \param ppdu the PPDU to send
+   * \param txPowerDbm the TX power associated to the packet, in dBm
+   */
+  void Deliver (Ptr<YansWifiPhy> sender, Ptr<MobilityModel> senderMobility,
+                Ptr<YansWifiPhy> receiver, Ptr<const WifiPpdu> ppdu, double txPowerDbm) const;
+
+  /**
+   * Schedule the reception of a PPDU by a PHY after the given delay, in the
+   * context of the node of the PHY.
+   *
+   * \param receiver the PHY object to which the packet is delivered
+   * \param delay the propagation delay
+   * \param ppdu the PPDU to send
+   * \param rxPowerDbm the RX power, in dBm
+   */
+  void ScheduleReceive (Ptr<YansWifiPhy> receiver, Time delay,
+                        Ptr<const WifiPpdu> ppdu, double rxPowerDbm) const;
+
+  /**
+   * Schedule the reception of a PPDU by the given PHYs, whose propagation
+   * delay and loss are computed by the threads of the pool.
+   *
+   * \param sender the PHY object from which the packet is originating
+   * \param senderMobility the mobility model of the sender
+   * \param receivers the PHY objects to which the packet is delivered
+   * \param ppdu the PPDU to send
+   * \param txPowerDbm the TX power associated to the packet, in dBm
+   */
+  void DeliverInParallel (Ptr<YansWifiPhy> sender, Ptr<MobilityModel> senderMobility,
+                          const PhyList &receivers, Ptr<const WifiPpdu> ppdu, double txPowerDbm) const;
+
+  /**
+   * \param nReceivers the number of receivers of a transmission
+   * \return whether the propagation to the receivers is computed by the thread pool
+   */
+  bool IsParallel (std::size_t nReceivers) const;
+
+  /**
+   * \param txPowerDbm the TX power of a transmission, in dBm
+   * \return the range of the transmission (m), possibly infinite
+   */
+  double GetRange (double txPowerDbm) const;
+
+  /**
+   * Add the PHYs attached since the last call to the receiver index, which
+   * is set up the first time.
+   *
+   * \param range the range of the current transmission (m)
+   */
+  void UpdateReceivers (double range) const;
+
   PhyList m_phyList;                   //!< List of YansWifiPhys connected to this YansWifiChannel
   Ptr<PropagationLossModel> m_loss;    //!< Propagation loss model
   Ptr<PropagationDelayModel> m_delay;  //!< Propagation delay model
+  bool m_culling;                      //!< whether transmissions only visit the receivers in range
+  double m_maxRange;                   //!< range of the transmissions (m), or zero to derive it
+  double m_cellSize;                   //!< side of the cells of the receiver index (m), or zero
+  mutable std::size_t m_nIndexed;      //!< number of PHYs of m_phyList in the receiver index
+  mutable SpatialIndex<Ptr<YansWifiPhy> > m_receivers; //!< receiver index
+  uint32_t m_nThreads;                 //!< number of threads computing the propagation
+
+  class ThreadPool;
+  mutable std::unique_ptr<ThreadPool> m_threadPool; //!< pool of threads, created on first use
 };
 
 } //namespace ns3
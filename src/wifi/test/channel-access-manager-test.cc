@@ -20,6 +20,7 @@
 
 #include "ns3/test.h"
 #include "ns3/simulator.h"
+#include "ns3/boolean.h"
 #include "ns3/channel-access-manager.h"
 #include "ns3/frame-exchange-manager.h"
 #include "ns3/qos-txop.h"
@@ -211,7 +212,12 @@ template <typename TxopType>
 class ChannelAccessManagerTest : public TestCase
 {
 public:
-  ChannelAccessManagerTest ();
+  /**
+   * Constructor
+   *
+   * \param analyticBackoff whether the channel access manager uses analytic backoff
+   */
+  ChannelAccessManagerTest (bool analyticBackoff = false);
   void DoRun (void) override;
 
   /**
@@ -377,6 +383,14 @@ private:
    * \param duration the duration
    */
   void AddRxStartEvt (uint64_t at, uint64_t duration);
+  /**
+   * Run a scenario in which two Txops request access to a medium made busy
+   * by receptions, a reception error, a CCA busy period and a NAV.
+   *
+   * \param analyticBackoff whether the channel access manager uses analytic backoff
+   * \return the access grant times
+   */
+  std::vector<Time> RunBusyMedium (bool analyticBackoff);
 
   typedef std::vector<Ptr<TxopTest<TxopType>>> TxopTests; //!< the TXOP tests typedef
 
@@ -384,6 +398,8 @@ private:
   Ptr<ChannelAccessManagerStub> m_ChannelAccessManager; //!< the channel access manager
   TxopTests m_txop; //!< the vector of Txop test instances
   uint32_t m_ackTimeoutValue; //!< the Ack timeout value
+  bool m_analyticBackoff; //!< whether the channel access manager uses analytic backoff
+  std::vector<Time> m_grantTimes; //!< the access grant times
 };
 
 template <typename TxopType>
@@ -443,8 +459,9 @@ TxopTest<TxopType>::NotifyWakeUp (void)
 }
 
 template <typename TxopType>
-ChannelAccessManagerTest<TxopType>::ChannelAccessManagerTest ()
-  : TestCase ("ChannelAccessManager")
+ChannelAccessManagerTest<TxopType>::ChannelAccessManagerTest (bool analyticBackoff)
+  : TestCase (analyticBackoff ? "ChannelAccessManager with analytic backoff" : "ChannelAccessManager"),
+    m_analyticBackoff (analyticBackoff)
 {
 }
 
@@ -452,6 +469,7 @@ template <typename TxopType>
 void
 ChannelAccessManagerTest<TxopType>::NotifyAccessGranted (uint32_t i)
 {
+  m_grantTimes.push_back (Simulator::Now ());
   Ptr<TxopTest<TxopType>> state = m_txop[i];
   NS_TEST_EXPECT_MSG_EQ (state->m_expectedGrants.empty (), false, "Have expected grants");
   if (!state->m_expectedGrants.empty ())
@@ -560,6 +578,7 @@ void
 ChannelAccessManagerTest<TxopType>::StartTest (uint64_t slotTime, uint64_t sifs, uint64_t eifsNoDifsNoSifs, uint32_t ackTimeoutValue)
 {
   m_ChannelAccessManager = CreateObject<ChannelAccessManagerStub> ();
+  m_ChannelAccessManager->SetAttribute ("AnalyticBackoff", BooleanValue (m_analyticBackoff));
   m_feManager = CreateObject<FrameExchangeManagerStub<TxopType>> (this);
   m_ChannelAccessManager->SetupFrameExchangeManager (m_feManager);
   m_ChannelAccessManager->SetSlot (MicroSeconds (slotTime));
@@ -1185,6 +1204,51 @@ ChannelAccessManagerTest<QosTxop>::DoRun (void)
   AddAccessRequest (30, 20, 107, 0);
   ExpectBackoff (30, 3, 0);
   EndTest ();
+
+  // The analytic backoff grants access at the same times as the
+  // slot-by-slot backoff on a busy medium
+  if (m_analyticBackoff)
+    {
+      std::vector<Time> slotted = RunBusyMedium (false);
+      std::vector<Time> analytic = RunBusyMedium (true);
+      NS_TEST_ASSERT_MSG_EQ (analytic.size (), slotted.size (), "Different numbers of access grants");
+      for (std::size_t i = 0; i < slotted.size (); i++)
+        {
+          NS_TEST_EXPECT_MSG_EQ (analytic[i], slotted[i], "Different access grant times");
+        }
+    }
+}
+
+template <typename TxopType>
+std::vector<Time>
+ChannelAccessManagerTest<TxopType>::RunBusyMedium (bool analyticBackoff)
+{
+  bool mode = m_analyticBackoff;
+  m_analyticBackoff = analyticBackoff;
+  m_grantTimes.clear ();
+
+  // Txop 0 (AIFSN 1) and Txop 1 (AIFSN 3) request access during receptions,
+  // an EIFS, a CCA busy period and a NAV, which interrupt their backoffs
+  StartTest (4, 6, 10);
+  AddTxop (1);
+  AddTxop (3);
+  AddRxOkEvt (20, 40);
+  AddAccessRequest (30, 2, 132, 0);
+  ExpectBackoff (30, 5, 0);
+  AddAccessRequest (35, 2, 203, 1);
+  ExpectBackoff (35, 2, 1);
+  AddRxErrorEvt (74, 20);
+  AddCcaBusyEvt (140, 10);
+  AddNavStart (155, 30);
+  AddAccessRequest (160, 4, 235, 0);
+  ExpectBackoff (160, 3, 0);
+  AddRxOkEvt (210, 15);
+  AddAccessRequest (215, 4, 281, 1);
+  ExpectBackoff (215, 6, 1);
+  EndTest ();
+
+  m_analyticBackoff = mode;
+  return m_grantTimes;
 }
 
 /**
@@ -1203,6 +1267,7 @@ TxopTestSuite::TxopTestSuite ()
   : TestSuite ("wifi-devices-dcf", UNIT)
 {
   AddTestCase (new ChannelAccessManagerTest<Txop>, TestCase::QUICK);
+  AddTestCase (new ChannelAccessManagerTest<Txop> (true), TestCase::QUICK);
 }
 
 static TxopTestSuite g_dcfTestSuite;
@@ -1223,6 +1288,7 @@ QosTxopTestSuite::QosTxopTestSuite ()
   : TestSuite ("wifi-devices-edca", UNIT)
 {
   AddTestCase (new ChannelAccessManagerTest<QosTxop>, TestCase::QUICK);
+  AddTestCase (new ChannelAccessManagerTest<QosTxop> (true), TestCase::QUICK);
 }
 
 static QosTxopTestSuite g_edcaTestSuite;
@@ -21,12 +21,15 @@
 
 #include "ns3/log.h"
 #include "ns3/test.h"
+#include "ns3/boolean.h"
+#include "ns3/object-factory.h"
 #include "ns3/nist-error-rate-model.h"
 #include "ns3/yans-error-rate-model.h"
 #include "ns3/dsss-error-rate-model.h"
 #include "ns3/wifi-phy.h"
 #include "ns3/wifi-utils.h"
 #include "ns3/table-based-error-rate-model.h"
+#include "ns3/dsss-phy.h"
 #include "ns3/he-phy.h" //includes HT and VHT
 #include "ns3/interference-helper.h"
 
@@ -1528,6 +1531,82 @@ TableBasedErrorRateTestCase::DoRun (void)
     }
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Check that the success rates interpolated from the lookup tables
+ * of an error rate model are close to those evaluated by the model.
+ */
+class ErrorRateLookupTableTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param typeName the TypeId name of the error rate model
+   */
+  ErrorRateLookupTableTestCase (const std::string &typeName);
+  virtual ~ErrorRateLookupTableTestCase ();
+
+private:
+  void DoRun (void) override;
+
+  std::string m_typeName; ///< the TypeId name of the error rate model
+};
+
+ErrorRateLookupTableTestCase::ErrorRateLookupTableTestCase (const std::string &typeName)
+  : TestCase ("Lookup tables of " + typeName),
+    m_typeName (typeName)
+{
+}
+
+ErrorRateLookupTableTestCase::~ErrorRateLookupTableTestCase ()
+{
+}
+
+void
+ErrorRateLookupTableTestCase::DoRun (void)
+{
+  ObjectFactory factory;
+  factory.SetTypeId (m_typeName);
+  Ptr<ErrorRateModel> model = factory.Create<ErrorRateModel> ();
+  factory.Set ("LookupTable", BooleanValue (true));
+  Ptr<ErrorRateModel> tabulated = factory.Create<ErrorRateModel> ();
+
+  std::vector<WifiMode> modes {DsssPhy::GetDsssRate1Mbps (), DsssPhy::GetDsssRate11Mbps (),
+                               OfdmPhy::GetOfdmRate6Mbps (), OfdmPhy::GetOfdmRate54Mbps (),
+                               HtPhy::GetHtMcs7 (), VhtPhy::GetVhtMcs8 (), HePhy::GetHeMcs11 ()};
+  for (const auto &mode : modes)
+    {
+      for (uint16_t channelWidth : {20, 80})
+        {
+          if (channelWidth > 20 && mode.GetModulationClass () < WIFI_MOD_CLASS_HT)
+            {
+              continue;
+            }
+          WifiTxVector txVector;
+          txVector.SetMode (mode);
+          txVector.SetChannelWidth (channelWidth);
+          // the payload, then the PHY header sent with a different mode
+          for (const auto &chunkMode : {mode, OfdmPhy::GetOfdmRate6Mbps ()})
+            {
+              for (uint64_t nbits : {32 * 8, 1500 * 8, 65535 * 8})
+                {
+                  for (double snr = -12; snr <= 55; snr += 0.13)
+                    {
+                      double snrRatio = std::pow (10, snr / 10);
+                      double expected = model->GetChunkSuccessRate (chunkMode, txVector, snrRatio, nbits);
+                      double psr = tabulated->GetChunkSuccessRate (chunkMode, txVector, snrRatio, nbits);
+                      NS_TEST_ASSERT_MSG_EQ_TOL (psr, expected, 5e-4, chunkMode << " " << channelWidth << " MHz"
+                                                 << " nbits=" << nbits << " snr=" << snr << "dB");
+                    }
+                }
+            }
+        }
+    }
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -1546,6 +1625,8 @@ WifiErrorRateModelsTestSuite::WifiErrorRateModelsTestSuite ()
   AddTestCase (new WifiErrorRateModelsTestCaseDsss, TestCase::QUICK);
   AddTestCase (new WifiErrorRateModelsTestCaseNist, TestCase::QUICK);
   AddTestCase (new WifiErrorRateModelsTestCaseMimo, TestCase::QUICK);
+  AddTestCase (new ErrorRateLookupTableTestCase ("ns3::NistErrorRateModel"), TestCase::QUICK);
+  AddTestCase (new ErrorRateLookupTableTestCase ("ns3::YansErrorRateModel"), TestCase::QUICK);
   AddTestCase (new TableBasedErrorRateTestCase ("DefaultTableBasedHtMcs0-1458bytes", HtPhy::GetHtMcs0 (), 1458), TestCase::QUICK);
   AddTestCase (new TableBasedErrorRateTestCase ("DefaultTableBasedHtMcs0-32bytes", HtPhy::GetHtMcs0 (), 32), TestCase::QUICK);
   AddTestCase (new TableBasedErrorRateTestCase ("DefaultTableBasedHtMcs0-1000bytes", HtPhy::GetHtMcs0 (), 1000), TestCase::QUICK);
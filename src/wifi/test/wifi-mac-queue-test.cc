@@ -20,6 +20,8 @@
 
 #include "ns3/test.h"
 #include "ns3/wifi-mac-queue.h"
+#include "ns3/qos-blocked-destinations.h"
+#include "ns3/random-variable-stream.h"
 #include "ns3/simulator.h"
 
 using namespace ns3;
@@ -107,6 +109,183 @@ WifiMacQueueDropOldestTest::DoRun ()
   Simulator::Destroy ();
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the per (receiver, TID) and expiry indexes of the queue.
+ *
+ * This test enqueues, pushes in front, replaces and dequeues QoS data
+ * frames of several (receiver, TID) pairs and other frames, some of which
+ * expire, and checks that the MPDUs peeked and counted by the queue are
+ * those found by traversing it.
+ */
+class WifiMacQueueIndexTest : public TestCase
+{
+public:
+  /**
+   * \brief Constructor
+   */
+  WifiMacQueueIndexTest ();
+
+  void DoRun () override;
+
+private:
+  /**
+   * Apply a random operation to the queue and check the queue.
+   */
+  void Step (void);
+  /**
+   * Return whether the given item is available, i.e., it has not expired.
+   * \param item the item
+   * \return true if the item has not expired
+   */
+  bool IsAvailable (Ptr<const WifiMacQueueItem> item) const;
+
+  Ptr<WifiMacQueue> m_queue;                    //!< the queue
+  Ptr<UniformRandomVariable> m_random;          //!< random variable for the operations
+  Ptr<QosBlockedDestinations> m_blocked;        //!< the blocked (receiver, TID) pairs
+  std::vector<Mac48Address> m_receivers;        //!< the receivers
+};
+
+WifiMacQueueIndexTest::WifiMacQueueIndexTest ()
+  : TestCase ("Test the per (receiver, TID) and expiry indexes")
+{
+}
+
+bool
+WifiMacQueueIndexTest::IsAvailable (Ptr<const WifiMacQueueItem> item) const
+{
+  return Simulator::Now () <= item->GetTimeStamp () + m_queue->GetMaxDelay ();
+}
+
+void
+WifiMacQueueIndexTest::Step (void)
+{
+  uint32_t op = m_random->GetInteger (0, 9);
+  Mac48Address receiver = m_receivers[m_random->GetInteger (0, m_receivers.size () - 1)];
+  uint8_t tid = m_random->GetInteger (0, 1) * 3;
+  WifiMacHeader header;
+  header.SetType (op == 0 ? WIFI_MAC_DATA : WIFI_MAC_QOSDATA);
+  header.SetAddr1 (receiver);
+  header.SetQosTid (tid);
+
+  if (op <= 4)
+    {
+      m_queue->Enqueue (Create<WifiMacQueueItem> (Create<Packet> (100), header));
+    }
+  else if (op == 5)
+    {
+      // an MPDU queued earlier, which may have expired
+      Time tstamp = Simulator::Now () - MilliSeconds (m_random->GetInteger (0, 30));
+      m_queue->PushFront (Create<WifiMacQueueItem> (Create<Packet> (200), header, tstamp));
+    }
+  else if (op == 6 && !m_queue->QueueBase::IsEmpty ())
+    {
+      auto it = std::next (m_queue->begin (), m_random->GetInteger (0, m_queue->QueueBase::GetNPackets () - 1));
+      Ptr<WifiMacQueueItem> item = Create<WifiMacQueueItem> (Create<Packet> (300), (*it)->GetHeader (), (*it)->GetTimeStamp ());
+      m_queue->Replace (*it, item);
+    }
+  else if (op == 7 && !m_queue->QueueBase::IsEmpty ())
+    {
+      auto it = std::next (m_queue->begin (), m_random->GetInteger (0, m_queue->QueueBase::GetNPackets () - 1));
+      m_queue->DequeueIfQueued (*it);
+    }
+  else if (op == 8)
+    {
+      if (m_blocked->IsBlocked (receiver, tid))
+        {
+          m_blocked->Unblock (receiver, tid);
+        }
+      else
+        {
+          m_blocked->Block (receiver, tid);
+        }
+    }
+
+  // check the MPDUs of each (receiver, TID) pair
+  for (const auto& address : m_receivers)
+    {
+      for (uint8_t t : {0, 3})
+        {
+          std::vector<Ptr<const WifiMacQueueItem> > expected;
+          for (auto it = m_queue->begin (); it != m_queue->end (); it++)
+            {
+              if ((*it)->GetHeader ().IsQosData () && (*it)->GetHeader ().GetAddr1 () == address
+                  && (*it)->GetHeader ().GetQosTid () == t && IsAvailable (*it))
+                {
+                  expected.push_back (*it);
+                }
+            }
+          Ptr<const WifiMacQueueItem> item = m_queue->PeekByTidAndAddress (t, address);
+          for (const auto& mpdu : expected)
+            {
+              NS_TEST_ASSERT_MSG_EQ (item, mpdu, "Unexpected MPDU of " << address << " TID " << +t);
+              item = m_queue->PeekByTidAndAddress (t, address, item);
+            }
+          NS_TEST_ASSERT_MSG_EQ (item, nullptr, "Unexpected MPDU of " << address << " TID " << +t);
+        }
+    }
+
+  // check the first available MPDU after each MPDU
+  std::vector<Ptr<const WifiMacQueueItem> > items {nullptr};
+  for (auto it = m_queue->begin (); it != m_queue->end (); it++)
+    {
+      items.push_back (*it);
+    }
+  for (std::size_t i = 0; i < items.size (); i++)
+    {
+      Ptr<const WifiMacQueueItem> expected;
+      for (std::size_t j = i + 1; j < items.size (); j++)
+        {
+          if (IsAvailable (items[j]) && (!items[j]->GetHeader ().IsQosData ()
+                                         || !m_blocked->IsBlocked (items[j]->GetHeader ().GetAddr1 (), items[j]->GetHeader ().GetQosTid ())))
+            {
+              expected = items[j];
+              break;
+            }
+        }
+      NS_TEST_ASSERT_MSG_EQ (m_queue->PeekFirstAvailable (m_blocked, items[i]), expected, "Unexpected first available MPDU");
+    }
+
+  // count the MPDUs, which removes the expired ones
+  uint32_t expected = 0;
+  uint32_t available = 0;
+  for (auto it = m_queue->begin (); it != m_queue->end (); it++)
+    {
+      if ((*it)->GetHeader ().IsQosData () && (*it)->GetHeader ().GetAddr1 () == receiver
+          && (*it)->GetHeader ().GetQosTid () == tid && IsAvailable (*it))
+        {
+          expected++;
+        }
+      available += IsAvailable (*it);
+    }
+  NS_TEST_ASSERT_MSG_EQ (m_queue->GetNPacketsByTidAndAddress (tid, receiver), expected, "Unexpected number of MPDUs");
+  NS_TEST_ASSERT_MSG_EQ (m_queue->QueueBase::GetNPackets (), available, "Expired MPDUs were not removed");
+}
+
+void
+WifiMacQueueIndexTest::DoRun ()
+{
+  m_queue = CreateObject<WifiMacQueue> (AC_BE);
+  m_queue->SetMaxSize (QueueSize ("100p"));
+  m_queue->SetMaxDelay (MilliSeconds (20));
+  m_random = CreateObject<UniformRandomVariable> ();
+  m_random->SetStream (1);
+  m_blocked = Create<QosBlockedDestinations> ();
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      m_receivers.push_back (Mac48Address::Allocate ());
+    }
+
+  for (uint32_t i = 0; i < 1000; i++)
+    {
+      Simulator::Schedule (MicroSeconds (200 * i), &WifiMacQueueIndexTest::Step, this);
+    }
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -123,6 +302,7 @@ WifiMacQueueTestSuite::WifiMacQueueTestSuite ()
   : TestSuite ("wifi-mac-queue", UNIT)
 {
   AddTestCase (new WifiMacQueueDropOldestTest, TestCase::QUICK);
+  AddTestCase (new WifiMacQueueIndexTest, TestCase::QUICK);
 }
 
 static WifiMacQueueTestSuite g_wifiMacQueueTestSuite; ///< the test suite
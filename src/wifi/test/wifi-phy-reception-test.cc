@@ -49,6 +49,7 @@
 #include "ns3/wifi-psdu.h"
 #include "ns3/he-ppdu.h"
 #include "ns3/he-phy.h"
+#include "ns3/ofdm-ppdu.h"
 
 using namespace ns3;
 
@@ -2557,6 +2558,340 @@ TestUnsupportedModulationReception::CheckResults (void)
   NS_TEST_EXPECT_MSG_EQ (m_dropped, 0, "Dropped some packets unexpectedly");
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief PHY abstraction test
+ *
+ * A PHY receives the same PPDUs with and without abstraction (\see
+ * WifiPhy::SetAbstraction): the MAC must be notified of the same receptions
+ * at the same times, with fewer events.
+ */
+class TestPhyAbstraction : public TestCase
+{
+public:
+  TestPhyAbstraction ();
+
+private:
+  void DoRun (void) override;
+
+  /**
+   * Receive the PPDUs of the test.
+   * \param abstraction whether to receive the PPDUs at an abstraction level
+   * \param nEvents the number of events executed by the simulator, set by this method
+   * \return the log of the notifications of the PHY
+   */
+  std::string Run (bool abstraction, uint64_t &nEvents);
+  /**
+   * Send an HE SU A-MPDU of three MPDUs.
+   * \param phy the receiving PHY
+   * \param rxPowerDbm the receive power in dBm
+   * \param referencePacketSize the size of the first packet in bytes (i-th packet has 100 bytes more than (i-1)-th)
+   */
+  void SendHeAmpdu (Ptr<SpectrumWifiPhy> phy, double rxPowerDbm, uint32_t referencePacketSize);
+  /**
+   * Send a non-HT MPDU.
+   * \param phy the receiving PHY
+   * \param rxPowerDbm the receive power in dBm
+   */
+  void SendNonHtMpdu (Ptr<SpectrumWifiPhy> phy, double rxPowerDbm);
+  /**
+   * RX payload begin trace
+   * \param txVector the TXVECTOR of the PPDU
+   * \param psduDuration the duration of the PSDU
+   */
+  void RxPayloadBegin (WifiTxVector txVector, Time psduDuration);
+  /**
+   * RX success function
+   * \param psdu the PSDU
+   * \param rxSignalInfo the info on the received signal (\see RxSignalInfo)
+   * \param txVector the transmit vector
+   * \param statusPerMpdu reception status per MPDU
+   */
+  void RxSuccess (Ptr<WifiPsdu> psdu, RxSignalInfo rxSignalInfo,
+                  WifiTxVector txVector, std::vector<bool> statusPerMpdu);
+  /**
+   * RX failure function
+   * \param psdu the PSDU
+   */
+  void RxFailure (Ptr<WifiPsdu> psdu);
+
+  std::ostringstream m_log; ///< the log of the notifications of the PHY
+  uint64_t m_uid;           ///< the UID to use for the PPDU
+};
+
+TestPhyAbstraction::TestPhyAbstraction ()
+  : TestCase ("PHY abstraction test"),
+    m_uid (0)
+{
+}
+
+void
+TestPhyAbstraction::SendHeAmpdu (Ptr<SpectrumWifiPhy> phy, double rxPowerDbm, uint32_t referencePacketSize)
+{
+  WifiTxVector txVector = WifiTxVector (HePhy::GetHeMcs5 (), 0, WIFI_PREAMBLE_HE_SU, 800, 1, 1, 0, 20, true);
+
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_QOSDATA);
+  hdr.SetQosTid (0);
+
+  std::vector<Ptr<WifiMacQueueItem>> mpduList;
+  for (size_t i = 0; i < 3; ++i)
+    {
+      Ptr<Packet> p = Create<Packet> (referencePacketSize + i * 100);
+      mpduList.push_back (Create<WifiMacQueueItem> (p, hdr));
+    }
+  Ptr<WifiPsdu> psdu = Create<WifiPsdu> (mpduList);
+  Time txDuration = phy->CalculateTxDuration (psdu->GetSize (), txVector, phy->GetPhyBand ());
+  Ptr<WifiPpdu> ppdu = Create<HePpdu> (psdu, txVector, txDuration, WIFI_PHY_BAND_5GHZ, m_uid++);
+
+  Ptr<WifiSpectrumSignalParameters> txParams = Create<WifiSpectrumSignalParameters> ();
+  txParams->psd = WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity (FREQUENCY, CHANNEL_WIDTH, DbmToW (rxPowerDbm), GUARD_WIDTH);
+  txParams->txPhy = 0;
+  txParams->duration = txDuration;
+  txParams->ppdu = ppdu;
+  phy->StartRx (txParams);
+}
+
+void
+TestPhyAbstraction::SendNonHtMpdu (Ptr<SpectrumWifiPhy> phy, double rxPowerDbm)
+{
+  WifiTxVector txVector = WifiTxVector (OfdmPhy::GetOfdmRate24Mbps (), 0, WIFI_PREAMBLE_LONG, 800, 1, 1, 0, 20, false);
+
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_QOSDATA);
+  hdr.SetQosTid (0);
+
+  Ptr<WifiPsdu> psdu = Create<WifiPsdu> (Create<Packet> (500), hdr);
+  Time txDuration = phy->CalculateTxDuration (psdu->GetSize (), txVector, phy->GetPhyBand ());
+  Ptr<WifiPpdu> ppdu = Create<OfdmPpdu> (psdu, txVector, WIFI_PHY_BAND_5GHZ, m_uid++);
+
+  Ptr<WifiSpectrumSignalParameters> txParams = Create<WifiSpectrumSignalParameters> ();
+  //the PSD is on the subcarriers of the HE PHY, as if converted by the channel
+  txParams->psd = WifiSpectrumValueHelper::CreateHeOfdmTxPowerSpectralDensity (FREQUENCY, CHANNEL_WIDTH, DbmToW (rxPowerDbm), GUARD_WIDTH);
+  txParams->txPhy = 0;
+  txParams->duration = txDuration;
+  txParams->ppdu = ppdu;
+  phy->StartRx (txParams);
+}
+
+void
+TestPhyAbstraction::RxPayloadBegin (WifiTxVector txVector, Time psduDuration)
+{
+  m_log << Simulator::Now ().GetNanoSeconds () << " RX start " << txVector.GetMode ()
+        << " " << psduDuration.GetNanoSeconds () << std::endl;
+}
+
+void
+TestPhyAbstraction::RxSuccess (Ptr<WifiPsdu> psdu, RxSignalInfo rxSignalInfo,
+                               WifiTxVector txVector, std::vector<bool> statusPerMpdu)
+{
+  m_log << Simulator::Now ().GetNanoSeconds () << " RX OK " << psdu->GetSize ()
+        << " SNR " << rxSignalInfo.snr << " status";
+  for (bool status : statusPerMpdu)
+    {
+      m_log << " " << status;
+    }
+  m_log << std::endl;
+}
+
+void
+TestPhyAbstraction::RxFailure (Ptr<WifiPsdu> psdu)
+{
+  m_log << Simulator::Now ().GetNanoSeconds () << " RX error " << psdu->GetSize () << std::endl;
+}
+
+std::string
+TestPhyAbstraction::Run (bool abstraction, uint64_t &nEvents)
+{
+  RngSeedManager::SetSeed (1);
+  RngSeedManager::SetRun (1);
+  m_log.str ("");
+  m_uid = 0;
+
+  Ptr<SpectrumWifiPhy> phy = CreateObject<SpectrumWifiPhy> ();
+  phy->SetAttribute ("Abstraction", BooleanValue (abstraction));
+  phy->ConfigureStandard (WIFI_STANDARD_80211ax);
+  Ptr<InterferenceHelper> interferenceHelper = CreateObject<InterferenceHelper> ();
+  phy->SetInterferenceHelper (interferenceHelper);
+  Ptr<ErrorRateModel> error = CreateObject<NistErrorRateModel> ();
+  phy->SetErrorRateModel (error);
+  phy->SetOperatingChannel (WifiPhy::ChannelTuple {CHANNEL_NUMBER, 0, WIFI_PHY_BAND_5GHZ, 0});
+  phy->AssignStreams (0);
+  phy->SetReceiveOkCallback (MakeCallback (&TestPhyAbstraction::RxSuccess, this));
+  phy->SetReceiveErrorCallback (MakeCallback (&TestPhyAbstraction::RxFailure, this));
+  phy->TraceConnectWithoutContext ("PhyRxPayloadBegin", MakeCallback (&TestPhyAbstraction::RxPayloadBegin, this));
+
+  BooleanValue lookupTable;
+  error->GetAttribute ("LookupTable", lookupTable);
+  NS_TEST_EXPECT_MSG_EQ (lookupTable.Get (), abstraction, "The lookup tables should be used with abstraction only");
+
+  double rxPowerDbm = -50;
+  // an A-MPDU without interference
+  Simulator::Schedule (Seconds (1.0), &TestPhyAbstraction::SendHeAmpdu, this, phy, rxPowerDbm, 1000);
+  // an A-MPDU whose first MPDU is received before a strong interference
+  Simulator::Schedule (Seconds (2.0), &TestPhyAbstraction::SendHeAmpdu, this, phy, rxPowerDbm, 1000);
+  Simulator::Schedule (Seconds (2.0) + MicroSeconds (200), &TestPhyAbstraction::SendHeAmpdu, this, phy, rxPowerDbm, 1000);
+  // an A-MPDU received with a weak interference
+  Simulator::Schedule (Seconds (3.0), &TestPhyAbstraction::SendHeAmpdu, this, phy, rxPowerDbm, 1000);
+  Simulator::Schedule (Seconds (3.0) + MicroSeconds (100), &TestPhyAbstraction::SendHeAmpdu, this, phy, rxPowerDbm - 30, 1000);
+  // an A-MPDU whose PHY header is not received because of an interference
+  Simulator::Schedule (Seconds (4.0), &TestPhyAbstraction::SendHeAmpdu, this, phy, rxPowerDbm, 1000);
+  Simulator::Schedule (Seconds (4.0) + MicroSeconds (10), &TestPhyAbstraction::SendHeAmpdu, this, phy, rxPowerDbm, 1000);
+  // a non-HT MPDU, whose PHY header is received in a single event with abstraction
+  Simulator::Schedule (Seconds (5.0), &TestPhyAbstraction::SendNonHtMpdu, this, phy, rxPowerDbm);
+  Simulator::Run ();
+
+  nEvents = Simulator::GetEventCount ();
+  phy->Dispose ();
+  Simulator::Destroy ();
+  return m_log.str ();
+}
+
+void
+TestPhyAbstraction::DoRun (void)
+{
+  uint64_t nEvents;
+  uint64_t nAbstractionEvents;
+  std::string log = Run (false, nEvents);
+  std::string abstractionLog = Run (true, nAbstractionEvents);
+
+  NS_TEST_EXPECT_MSG_EQ (abstractionLog, log, "The MAC should be notified of the same receptions with abstraction");
+  // the first MPDU of the second A-MPDU and the whole third A-MPDU are received
+  NS_TEST_EXPECT_MSG_EQ ((log.find ("RX OK 3406 SNR 961") != std::string::npos), true, "The third A-MPDU should have been received");
+  NS_TEST_EXPECT_MSG_EQ ((log.find ("status 1 0 0") != std::string::npos), true, "The first MPDU of the second A-MPDU should have been received");
+  NS_TEST_EXPECT_MSG_EQ ((log.find ("RX OK 530 SNR") != std::string::npos), true, "The non-HT MPDU should have been received");
+  NS_TEST_EXPECT_MSG_LT (nAbstractionEvents, nEvents, "Abstraction should save events");
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief InterferenceHelper PER test
+ *
+ * A non-HT PPDU is received with interfering signals that start and end at
+ * the same times as the PPDU, its payload or one another. The PERs of the
+ * PHY header and of windows of the payload must be those computed before
+ * the noise and interference changes were kept in sorted vectors.
+ *
+ * \verbatim
+       -10  0     20     50        110       200    250  (us)
+             |------------------ PPDU -------------|
+             | header |              payload       |
+        |-- 1 --|
+             |---- 2 -----|
+                          |--- 3 ---|
+                          |-------- 4 -------------|
+                                    |----- 5 ------|
+                                                   |-- 6 --|
+   \endverbatim
+ */
+class TestInterferenceHelperPer : public TestCase
+{
+public:
+  TestInterferenceHelperPer ();
+
+private:
+  void DoRun (void) override;
+
+  /**
+   * Add a signal to the InterferenceHelper.
+   * \param rxPowerDbm the received power in dBm
+   * \param duration the duration of the signal
+   * \param receive whether this is the PPDU being received
+   */
+  void AddSignal (double rxPowerDbm, Time duration, bool receive);
+  /**
+   * Compute the PERs of the PPDU being received.
+   */
+  void ComputePers (void);
+
+  Ptr<InterferenceHelper> m_interference; ///< the InterferenceHelper
+  WifiTxVector m_txVector;                ///< the TXVECTOR of the signals
+  WifiSpectrumBand m_band;                ///< the band of the signals
+  Ptr<Event> m_event;                     ///< the event of the PPDU being received
+  double m_headerPer;                     ///< the PER of the PHY header
+  std::vector<double> m_payloadPers;      ///< the PERs of the payload windows
+};
+
+TestInterferenceHelperPer::TestInterferenceHelperPer ()
+  : TestCase ("InterferenceHelper PER with simultaneous signal starts and ends"),
+    m_band (0, 0),
+    m_headerPer (0)
+{
+}
+
+void
+TestInterferenceHelperPer::AddSignal (double rxPowerDbm, Time duration, bool receive)
+{
+  Ptr<WifiPsdu> psdu = Create<WifiPsdu> (Create<Packet> (500), WifiMacHeader ());
+  Ptr<WifiPpdu> ppdu = Create<OfdmPpdu> (psdu, m_txVector, WIFI_PHY_BAND_5GHZ, 0);
+  RxPowerWattPerChannelBand rxPower;
+  rxPower.insert ({m_band, DbmToW (rxPowerDbm)});
+  Ptr<Event> event = m_interference->Add (ppdu, m_txVector, duration, rxPower);
+  if (receive)
+    {
+      m_event = event;
+      m_interference->NotifyRxStart ();
+    }
+}
+
+void
+TestInterferenceHelperPer::ComputePers (void)
+{
+  m_headerPer = m_interference->CalculatePhyHeaderSnrPer (m_event, 20, m_band,
+                                                          WIFI_PPDU_FIELD_NON_HT_HEADER).per;
+  // windows relative to the start of the payload
+  std::vector<std::pair<Time, Time>> windows {{MicroSeconds (0), MicroSeconds (30)},
+                                              {MicroSeconds (30), MicroSeconds (90)},
+                                              {MicroSeconds (90), MicroSeconds (180)},
+                                              {MicroSeconds (25), MicroSeconds (100)},
+                                              {MicroSeconds (0), MicroSeconds (180)}};
+  for (const auto &window : windows)
+    {
+      m_payloadPers.push_back (m_interference->CalculatePayloadSnrPer (m_event, 20, m_band,
+                                                                       SU_STA_ID, window).per);
+    }
+}
+
+void
+TestInterferenceHelperPer::DoRun (void)
+{
+  m_interference = CreateObject<InterferenceHelper> ();
+  m_interference->SetNoiseFigure (DbToRatio (7));
+  m_interference->SetErrorRateModel (CreateObject<NistErrorRateModel> ());
+  m_interference->SetNumberOfReceiveAntennas (1);
+  m_interference->AddBand (m_band);
+  m_txVector = WifiTxVector (OfdmPhy::GetOfdmRate24Mbps (), 0, WIFI_PREAMBLE_LONG, 800, 1, 1, 0, 20, false);
+
+  Time start = Seconds (1);
+  Simulator::Schedule (start - MicroSeconds (10), &TestInterferenceHelperPer::AddSignal, this, -75.0, MicroSeconds (30), false);
+  Simulator::Schedule (start, &TestInterferenceHelperPer::AddSignal, this, -70.0, MicroSeconds (200), true);
+  Simulator::Schedule (start, &TestInterferenceHelperPer::AddSignal, this, -83.5, MicroSeconds (50), false);
+  Simulator::Schedule (start + MicroSeconds (50), &TestInterferenceHelperPer::AddSignal, this, -85.0, MicroSeconds (60), false);
+  Simulator::Schedule (start + MicroSeconds (50), &TestInterferenceHelperPer::AddSignal, this, -92.0, MicroSeconds (150), false);
+  Simulator::Schedule (start + MicroSeconds (110), &TestInterferenceHelperPer::AddSignal, this, -85.5, MicroSeconds (90), false);
+  Simulator::Schedule (start + MicroSeconds (200), &TestInterferenceHelperPer::AddSignal, this, -75.0, MicroSeconds (50), false);
+  // the PERs are computed at the end of the PPDU, after signal 6 starts
+  Simulator::Schedule (start + MicroSeconds (200), &TestInterferenceHelperPer::ComputePers, this);
+  Simulator::Run ();
+
+  std::cout.precision (17);
+  std::cout << "PERS " << m_headerPer;
+  for (double per : m_payloadPers)
+    {
+      std::cout << " " << per;
+    }
+  std::cout << std::endl;
+
+  m_event = 0;
+  m_interference->Dispose ();
+  m_interference = 0;
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -2578,6 +2913,8 @@ WifiPhyReceptionTestSuite::WifiPhyReceptionTestSuite ()
   AddTestCase (new TestPhyHeadersReception, TestCase::QUICK);
   AddTestCase (new TestAmpduReception, TestCase::QUICK);
   AddTestCase (new TestUnsupportedModulationReception (), TestCase::QUICK);
+  AddTestCase (new TestPhyAbstraction, TestCase::QUICK);
+  AddTestCase (new TestInterferenceHelperPer, TestCase::QUICK);
 }
 
 static WifiPhyReceptionTestSuite wifiPhyReceptionTestSuite; ///< the test suite
@@ -22,15 +22,19 @@
  */
 
 #include "ns3/string.h"
+#include "ns3/boolean.h"
 #include "ns3/yans-wifi-helper.h"
 #include "ns3/mobility-helper.h"
 #include "ns3/wifi-net-device.h"
 #include "ns3/adhoc-wifi-mac.h"
 #include "ns3/ap-wifi-mac.h"
+#include "ns3/sta-wifi-mac.h"
+#include "ns3/qos-txop.h"
 #include "ns3/propagation-loss-model.h"
 #include "ns3/interference-helper.h"
 #include "ns3/yans-error-rate-model.h"
 #include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
 #include "ns3/test.h"
 #include "ns3/pointer.h"
 #include "ns3/rng-seed-manager.h"
@@ -3065,6 +3069,399 @@ IdealRateManagerMimoTest::DoRun (void)
   Simulator::Destroy ();
 }
 
+//-----------------------------------------------------------------------------
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Check that the receiver culling of YansWifiChannel starts the same
+ * receptions as visiting all the PHYs.
+ *
+ * Node 0 broadcasts a frame at 1 s, 10 s and 19.95 s. With the default log
+ * distance loss model, the range is about 220 m: nodes 1 and 2, at 10 m and
+ * 20 m, receive all the frames, and node 4, which moves from 6 km towards
+ * node 0 at 300 m/s, only the last one. Node 3, at 2 km, raises its RX gain
+ * to 50 dB at 5 s, which extends the range to about 10 km, and so receives
+ * the frames sent at 10 s and 19.95 s.
+ */
+class YansWifiChannelCullingTest : public TestCase
+{
+public:
+  YansWifiChannelCullingTest ();
+
+private:
+  void DoRun (void) override;
+
+  /**
+   * Run the scenario.
+   * \param culling whether the receiver culling is enabled
+   * \return the number of receptions started by each node
+   */
+  std::vector<uint32_t> RunScenario (bool culling);
+
+  /**
+   * Callback when a PHY starts receiving a PPDU.
+   * \param context the index of the node
+   * \param p the packet
+   * \param rxPowersW the received power per band
+   */
+  void RxBegin (std::string context, Ptr<const Packet> p, RxPowerWattPerChannelBand rxPowersW);
+
+  std::vector<uint32_t> m_rxBegin; //!< number of receptions started by each node
+};
+
+YansWifiChannelCullingTest::YansWifiChannelCullingTest ()
+  : TestCase ("Check the receiver culling of YansWifiChannel")
+{
+}
+
+void
+YansWifiChannelCullingTest::RxBegin (std::string context, Ptr<const Packet> p, RxPowerWattPerChannelBand rxPowersW)
+{
+  m_rxBegin[std::stoi (context)]++;
+}
+
+std::vector<uint32_t>
+YansWifiChannelCullingTest::RunScenario (bool culling)
+{
+  NodeContainer nodes;
+  nodes.Create (5);
+
+  YansWifiPhyHelper phy;
+  YansWifiChannelHelper channel = YansWifiChannelHelper::Default ();
+  Ptr<YansWifiChannel> yansChannel = channel.Create ();
+  yansChannel->SetAttribute ("ReceiverCulling", BooleanValue (culling));
+  phy.SetChannel (yansChannel);
+
+  WifiHelper wifi;
+  wifi.SetStandard (WIFI_STANDARD_80211a);
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager");
+  WifiMacHelper mac;
+  mac.SetType ("ns3::AdhocWifiMac");
+  NetDeviceContainer devices = wifi.Install (phy, mac, nodes);
+
+  MobilityHelper mobility;
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  positionAlloc->Add (Vector (0.0, 0.0, 0.0));
+  positionAlloc->Add (Vector (10.0, 0.0, 0.0));
+  positionAlloc->Add (Vector (20.0, 0.0, 0.0));
+  positionAlloc->Add (Vector (2000.0, 0.0, 0.0));
+  positionAlloc->Add (Vector (6000.0, 0.0, 0.0));
+  mobility.SetPositionAllocator (positionAlloc);
+  mobility.SetMobilityModel ("ns3::ConstantVelocityMobilityModel");
+  mobility.Install (nodes);
+  nodes.Get (4)->GetObject<ConstantVelocityMobilityModel> ()->SetVelocity (Vector (-300.0, 0.0, 0.0));
+
+  m_rxBegin.assign (nodes.GetN (), 0);
+  for (uint32_t i = 0; i < nodes.GetN (); i++)
+    {
+      DynamicCast<WifiNetDevice> (devices.Get (i))->GetPhy ()->TraceConnect ("PhyRxBegin", std::to_string (i),
+                                                                            MakeCallback (&YansWifiChannelCullingTest::RxBegin, this));
+    }
+
+  Simulator::Schedule (Seconds (5), &WifiPhy::SetRxGain,
+                       DynamicCast<WifiNetDevice> (devices.Get (3))->GetPhy (), 50.0);
+  Ptr<NetDevice> sender = devices.Get (0);
+  for (double t : {1.0, 10.0, 19.95})
+    {
+      Simulator::Schedule (Seconds (t), &NetDevice::Send, sender, Create<Packet> (1000),
+                           Mac48Address::GetBroadcast (), 1);
+    }
+  Simulator::Stop (Seconds (20));
+  Simulator::Run ();
+  Simulator::Destroy ();
+  return m_rxBegin;
+}
+
+void
+YansWifiChannelCullingTest::DoRun (void)
+{
+  std::vector<uint32_t> all = RunScenario (false);
+  std::vector<uint32_t> culled = RunScenario (true);
+  std::vector<uint32_t> expected {0, 3, 3, 2, 1};
+  for (uint32_t i = 0; i < expected.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (all[i], expected[i], "Unexpected receptions without culling at node " << i);
+      NS_TEST_EXPECT_MSG_EQ (culled[i], expected[i], "Unexpected receptions with culling at node " << i);
+    }
+}
+
+//-----------------------------------------------------------------------------
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Check that computing the propagation of the transmissions on a pool
+ * of threads starts the same receptions, with the same power, as with a
+ * single thread.
+ *
+ * Node 0, at a corner of a 10x10 grid of nodes spaced by 2 m, broadcasts a
+ * frame at 1 s, which all the other nodes receive.
+ */
+class YansWifiChannelParallelTest : public TestCase
+{
+public:
+  YansWifiChannelParallelTest ();
+
+private:
+  void DoRun (void) override;
+
+  /**
+   * Run the scenario.
+   * \param nThreads the number of threads of the channel
+   * \param culling whether the receiver culling is enabled
+   */
+  void RunScenario (uint32_t nThreads, bool culling);
+
+  /**
+   * Callback when a PHY starts receiving a PPDU.
+   * \param context the index of the node
+   * \param p the packet
+   * \param rxPowersW the received power per band
+   */
+  void RxBegin (std::string context, Ptr<const Packet> p, RxPowerWattPerChannelBand rxPowersW);
+
+  std::vector<std::vector<double> > m_rxPowerW; //!< power of the receptions started by each node
+};
+
+YansWifiChannelParallelTest::YansWifiChannelParallelTest ()
+  : TestCase ("Check the parallel propagation computation of YansWifiChannel")
+{
+}
+
+void
+YansWifiChannelParallelTest::RxBegin (std::string context, Ptr<const Packet> p, RxPowerWattPerChannelBand rxPowersW)
+{
+  m_rxPowerW[std::stoi (context)].push_back (rxPowersW.begin ()->second);
+}
+
+void
+YansWifiChannelParallelTest::RunScenario (uint32_t nThreads, bool culling)
+{
+  NodeContainer nodes;
+  nodes.Create (100);
+
+  YansWifiPhyHelper phy;
+  YansWifiChannelHelper channel = YansWifiChannelHelper::Default ();
+  Ptr<YansWifiChannel> yansChannel = channel.Create ();
+  yansChannel->SetAttribute ("NumThreads", UintegerValue (nThreads));
+  yansChannel->SetAttribute ("ReceiverCulling", BooleanValue (culling));
+  phy.SetChannel (yansChannel);
+
+  WifiHelper wifi;
+  wifi.SetStandard (WIFI_STANDARD_80211a);
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager");
+  WifiMacHelper mac;
+  mac.SetType ("ns3::AdhocWifiMac");
+  NetDeviceContainer devices = wifi.Install (phy, mac, nodes);
+
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator ("ns3::GridPositionAllocator",
+                                 "DeltaX", DoubleValue (2.0),
+                                 "DeltaY", DoubleValue (2.0),
+                                 "GridWidth", UintegerValue (10));
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (nodes);
+
+  m_rxPowerW.assign (nodes.GetN (), {});
+  for (uint32_t i = 0; i < nodes.GetN (); i++)
+    {
+      DynamicCast<WifiNetDevice> (devices.Get (i))->GetPhy ()->TraceConnect ("PhyRxBegin", std::to_string (i),
+                                                                            MakeCallback (&YansWifiChannelParallelTest::RxBegin, this));
+    }
+
+  Simulator::Schedule (Seconds (1), &NetDevice::Send, devices.Get (0), Create<Packet> (1000),
+                       Mac48Address::GetBroadcast (), 1);
+  Simulator::Stop (Seconds (2));
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+void
+YansWifiChannelParallelTest::DoRun (void)
+{
+  RunScenario (1, false);
+  std::vector<std::vector<double> > sequential = m_rxPowerW;
+  NS_TEST_EXPECT_MSG_EQ (sequential[0].size (), 0, "The sender received its own frame");
+  for (uint32_t i = 1; i < sequential.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (sequential[i].size (), 1, "Node " << i << " did not receive the frame");
+    }
+
+  for (bool culling : {false, true})
+    {
+      RunScenario (4, culling);
+      for (uint32_t i = 0; i < sequential.size (); i++)
+        {
+          NS_TEST_EXPECT_MSG_EQ (m_rxPowerW[i].size (), sequential[i].size (),
+                                 "Different receptions at node " << i << " with culling=" << culling);
+          for (uint32_t j = 0; j < std::min (m_rxPowerW[i].size (), sequential[i].size ()); j++)
+            {
+              NS_TEST_EXPECT_MSG_EQ (m_rxPowerW[i][j], sequential[i][j],
+                                     "Different power received at node " << i << " with culling=" << culling);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Pre-associated stations and unchanged beacons test
+ *
+ * Make sure that pre-associated stations are associated from the start of
+ * the simulation without any association exchange, and that skipping the
+ * processing of unchanged beacons does not prevent stations from applying
+ * the changes announced in later beacons.
+ *
+ * Two stations are pre-associated with an AP, and only the first one skips
+ * unchanged beacons. A second AP, in another BSS, also sends beacons. At
+ * 1 s, the AP changes the CWmin of AC_BE. Each station then sends a packet
+ * to the AP.
+ */
+class PreAssociationTestCase : public TestCase
+{
+public:
+  PreAssociationTestCase ();
+
+private:
+  void DoRun (void) override;
+
+  /**
+   * Callback on STA assoc and deassoc events
+   * \param context the index of the station
+   * \param bssid the AP's bssid
+   */
+  void AssocCallback (std::string context, Mac48Address bssid);
+  /**
+   * Callback on beacon arrival at the stations
+   * \param context the index of the station
+   * \param time the arrival time
+   */
+  void BeaconCallback (std::string context, Time time);
+  /**
+   * Callback on packet received by the AP
+   * \param p the packet
+   */
+  void RxCallback (Ptr<const Packet> p);
+
+  std::vector<uint32_t> m_nAssoc;   ///< number of assoc and deassoc events per station
+  std::vector<uint32_t> m_nBeacons; ///< number of beacons received per station
+  uint32_t m_nRx;                   ///< number of packets received by the AP
+};
+
+PreAssociationTestCase::PreAssociationTestCase ()
+  : TestCase ("Test case for pre-associated stations skipping unchanged beacons"),
+    m_nAssoc (2, 0),
+    m_nBeacons (2, 0),
+    m_nRx (0)
+{
+}
+
+void
+PreAssociationTestCase::AssocCallback (std::string context, Mac48Address bssid)
+{
+  m_nAssoc[std::stoi (context)]++;
+}
+
+void
+PreAssociationTestCase::BeaconCallback (std::string context, Time time)
+{
+  m_nBeacons[std::stoi (context)]++;
+}
+
+void
+PreAssociationTestCase::RxCallback (Ptr<const Packet> p)
+{
+  m_nRx++;
+}
+
+void
+PreAssociationTestCase::DoRun (void)
+{
+  NodeContainer apNodes;
+  apNodes.Create (2);
+  NodeContainer staNodes;
+  staNodes.Create (2);
+
+  YansWifiPhyHelper phy;
+  YansWifiChannelHelper channel = YansWifiChannelHelper::Default ();
+  phy.SetChannel (channel.Create ());
+
+  WifiHelper wifi;
+  wifi.SetStandard (WIFI_STANDARD_80211ax);
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager");
+
+  WifiMacHelper mac;
+  mac.SetType ("ns3::ApWifiMac",
+               "Ssid", SsidValue (Ssid ("ap")));
+  NetDeviceContainer apDevice = wifi.Install (phy, mac, apNodes.Get (0));
+  mac.SetType ("ns3::ApWifiMac",
+               "Ssid", SsidValue (Ssid ("other")));
+  wifi.Install (phy, mac, apNodes.Get (1));
+  NetDeviceContainer staDevices;
+  mac.SetType ("ns3::StaWifiMac",
+               "Ssid", SsidValue (Ssid ("ap")),
+               "SkipUnchangedBeacons", BooleanValue (true));
+  staDevices.Add (wifi.Install (phy, mac, staNodes.Get (0)));
+  mac.SetType ("ns3::StaWifiMac",
+               "Ssid", SsidValue (Ssid ("ap")),
+               "SkipUnchangedBeacons", BooleanValue (false));
+  staDevices.Add (wifi.Install (phy, mac, staNodes.Get (1)));
+
+  MobilityHelper mobility;
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  positionAlloc->Add (Vector (0.0, 0.0, 0.0));
+  positionAlloc->Add (Vector (10.0, 0.0, 0.0));
+  positionAlloc->Add (Vector (5.0, 0.0, 0.0));
+  positionAlloc->Add (Vector (0.0, 5.0, 0.0));
+  mobility.SetPositionAllocator (positionAlloc);
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (apNodes);
+  mobility.Install (staNodes);
+
+  Ptr<ApWifiMac> apMac = DynamicCast<ApWifiMac> (DynamicCast<WifiNetDevice> (apDevice.Get (0))->GetMac ());
+  WifiHelper::PreAssociate (staDevices, apDevice.Get (0));
+
+  NS_TEST_ASSERT_MSG_EQ (apMac->GetStaList ().size (), 2, "The stations are not in the AP's list of associated stations");
+  for (uint32_t i = 0; i < staDevices.GetN (); i++)
+    {
+      Ptr<WifiNetDevice> dev = DynamicCast<WifiNetDevice> (staDevices.Get (i));
+      Ptr<StaWifiMac> staMac = DynamicCast<StaWifiMac> (dev->GetMac ());
+      NS_TEST_ASSERT_MSG_EQ (staMac->IsAssociated (), true, "Station " << i << " is not pre-associated");
+      NS_TEST_EXPECT_MSG_EQ (staMac->GetAssociationId (), apMac->GetAssociationId (staMac->GetAddress ()),
+                             "Station " << i << " and the AP do not agree on the AID");
+      staMac->TraceConnect ("Assoc", std::to_string (i), MakeCallback (&PreAssociationTestCase::AssocCallback, this));
+      staMac->TraceConnect ("DeAssoc", std::to_string (i), MakeCallback (&PreAssociationTestCase::AssocCallback, this));
+      staMac->TraceConnect ("BeaconArrival", std::to_string (i), MakeCallback (&PreAssociationTestCase::BeaconCallback, this));
+      Simulator::Schedule (Seconds (1.5 + i * 0.1), &NetDevice::Send, dev, Create<Packet> (1000),
+                           apDevice.Get (0)->GetAddress (), 1);
+    }
+  apMac->TraceConnectWithoutContext ("MacRx", MakeCallback (&PreAssociationTestCase::RxCallback, this));
+
+  Ptr<QosTxop> apBe = apMac->GetQosTxop (AC_BE);
+  Simulator::Schedule (Seconds (1), &QosTxop::SetMinCw, apBe, 31);
+
+  Simulator::Stop (Seconds (2));
+  Simulator::Run ();
+
+  for (uint32_t i = 0; i < staDevices.GetN (); i++)
+    {
+      Ptr<StaWifiMac> staMac = DynamicCast<StaWifiMac> (DynamicCast<WifiNetDevice> (staDevices.Get (i))->GetMac ());
+      NS_TEST_EXPECT_MSG_EQ (m_nAssoc[i], 0, "Station " << i << " changed its association state");
+      NS_TEST_EXPECT_MSG_EQ (staMac->IsAssociated (), true, "Station " << i << " is no longer associated");
+      // about 2 s / 102.4 ms beacons are sent
+      NS_TEST_EXPECT_MSG_GT_OR_EQ (m_nBeacons[i], 18, "Station " << i << " missed beacons");
+      NS_TEST_EXPECT_MSG_EQ (m_nBeacons[i], m_nBeacons[0], "Stations received a different number of beacons");
+      NS_TEST_EXPECT_MSG_EQ (staMac->GetQosTxop (AC_BE)->GetMinCw (), 31, "Station " << i << " did not update its CWmin");
+    }
+  NS_TEST_EXPECT_MSG_EQ (m_nRx, 2, "The AP did not receive the packets of both stations");
+
+  Simulator::Destroy ();
+}
+
 //-----------------------------------------------------------------------------
 /**
  * \ingroup wifi-test
@@ -3183,6 +3580,9 @@ WifiTestSuite::WifiTestSuite ()
   AddTestCase (new IdealRateManagerChannelWidthTest, TestCase::QUICK);
   AddTestCase (new IdealRateManagerMimoTest, TestCase::QUICK);
   AddTestCase (new HeRuMcsDataRateTestCase, TestCase::QUICK);
+  AddTestCase (new YansWifiChannelCullingTest, TestCase::QUICK);
+  AddTestCase (new YansWifiChannelParallelTest, TestCase::QUICK);
+  AddTestCase (new PreAssociationTestCase, TestCase::QUICK);
 }
 
 static WifiTestSuite g_wifiTestSuite; ///< the test suite
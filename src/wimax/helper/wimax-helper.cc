@@ -462,9 +462,12 @@ WimaxHelper::EnableAsciiInternal (Ptr<OutputStreamWrapper> stream,
 
   //
   // Our default trace sinks are going to use packet printing, so we have to
-  // make sure that is turned on.
+  // make sure that is turned on, unless they log to a binary trace file.
   //
-  Packet::EnablePrinting ();
+  if (stream == 0 || stream->GetBinaryTraceFile () == 0)
+    {
+      Packet::EnablePrinting ();
+    }
 
   //
   // If we are not provided an OutputStreamWrapper, we are expected to create
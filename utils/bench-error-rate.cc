@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the chunk success rates of the
+// Wi-Fi error rate models, evaluated by the models or interpolated from
+// their lookup tables, over 'lookups' random SNR values between -5 and
+// 40 dB for each of a few modes.
+// Sample usage:  ./ns3 run 'bench-error-rate --lookups=1000000'
+
+#include <iostream>
+#include <vector>
+
+#include "ns3/command-line.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/boolean.h"
+#include "ns3/object-factory.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/error-rate-model.h"
+#include "ns3/wifi-tx-vector.h"
+#include "ns3/dsss-phy.h"
+#include "ns3/he-phy.h"
+
+using namespace ns3;
+
+/**
+ * \brief Print the lookup rate of a benchmark.
+ * \param lookups number of lookups
+ * \param ms elapsed time in milliseconds
+ * \param name name of the benchmark
+ */
+static void
+Report (uint32_t lookups, int64_t ms, std::string name)
+{
+  double rate = lookups * 1000.0 / std::max<int64_t> (ms, 1);
+  std::cout << rate << " lookups/s"
+            << " (" << ms << " ms elapsed)\t"
+            << name
+            << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t lookups = 1000000;
+  uint32_t nbits = 1500 * 8;
+
+  CommandLine cmd (__FILE__);
+  cmd.Usage ("Benchmark the chunk success rates of the Wi-Fi error rate models");
+  cmd.AddValue ("lookups", "number of lookups per mode", lookups);
+  cmd.AddValue ("nbits", "number of bits of the chunks", nbits);
+  cmd.Parse (argc, argv);
+
+  std::cout << "Running bench-error-rate with lookups=" << lookups << " nbits=" << nbits << std::endl;
+
+  std::vector<WifiMode> modes {DsssPhy::GetDsssRate11Mbps (), OfdmPhy::GetOfdmRate6Mbps (),
+                               OfdmPhy::GetOfdmRate54Mbps (), HtPhy::GetHtMcs7 (), HePhy::GetHeMcs11 ()};
+  Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable> ();
+  std::vector<double> snrs;
+  for (uint32_t i = 0; i < lookups; i++)
+    {
+      snrs.push_back (std::pow (10, random->GetValue (-5, 40) / 10));
+    }
+
+  double sum = 0;
+  SystemWallClockMs time;
+  for (const std::string typeName : {"ns3::NistErrorRateModel", "ns3::YansErrorRateModel"})
+    {
+      for (bool lookupTable : {false, true})
+        {
+          ObjectFactory factory;
+          factory.SetTypeId (typeName);
+          factory.Set ("LookupTable", BooleanValue (lookupTable));
+          Ptr<ErrorRateModel> model = factory.Create<ErrorRateModel> ();
+          for (const auto &mode : modes)
+            {
+              WifiTxVector txVector;
+              txVector.SetMode (mode);
+              txVector.SetChannelWidth (mode.GetModulationClass () < WIFI_MOD_CLASS_OFDM ? 22 : 20);
+              time.Start ();
+              for (uint32_t i = 0; i < lookups; i++)
+                {
+                  sum += model->GetChunkSuccessRate (mode, txVector, snrs[i], nbits);
+                }
+              Report (lookups, time.End (), typeName + (lookupTable ? " (lookup table) " : " ") + mode.GetUniqueName ());
+            }
+        }
+    }
+
+  std::cout << "average success rate " << sum / (4 * modes.size () * static_cast<double> (lookups)) << std::endl;
+  return 0;
+}
@@ -0,0 +1,225 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program can be used to benchmark the unicast route lookups of the
+// static and global routing protocols, whose forwarding tables are indexed
+// by a prefix trie, against a linear scan of the same routes, for various
+// numbers of host routes 'routes'.
+// Sample usage:  ./ns3 run 'bench-routing --routes=5000 --lookups=100000'
+
+#include <iostream>
+#include <list>
+#include <vector>
+#include <stdlib.h> // for exit ()
+
+#include "ns3/command-line.h"
+#include "ns3/system-wall-clock-ms.h"
+#include "ns3/node.h"
+#include "ns3/packet.h"
+#include "ns3/simulator.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-static-routing-helper.h"
+#include "ns3/ipv4-static-routing.h"
+#include "ns3/ipv4-global-routing.h"
+#include "ns3/ipv4-list-routing.h"
+#include "ns3/ipv4-routing-table-entry.h"
+#include "ns3/ipv4-route.h"
+#include "ns3/ipv6-static-routing-helper.h"
+#include "ns3/ipv6-static-routing.h"
+#include "ns3/ipv6-route.h"
+
+using namespace ns3;
+
+/**
+ * \brief Look up a destination the way the routing protocols did before
+ * their forwarding tables were indexed.
+ * \param routes the routes and their metrics
+ * \param dest the destination
+ * \return the selected route, or null
+ */
+static const Ipv4RoutingTableEntry *
+ScanRoutes (const std::list<std::pair<Ipv4RoutingTableEntry *, uint32_t> > &routes, Ipv4Address dest)
+{
+  const Ipv4RoutingTableEntry *selected = 0;
+  uint16_t longestMask = 0;
+  uint32_t shortestMetric = 0xffffffff;
+  for (std::list<std::pair<Ipv4RoutingTableEntry *, uint32_t> >::const_iterator i = routes.begin ();
+       i != routes.end (); i++)
+    {
+      Ipv4Mask mask = i->first->GetDestNetworkMask ();
+      uint16_t maskLen = mask.GetPrefixLength ();
+      if (!mask.IsMatch (dest, i->first->GetDestNetwork ()) || maskLen < longestMask)
+        {
+          continue;
+        }
+      if (maskLen > longestMask)
+        {
+          shortestMetric = 0xffffffff;
+        }
+      longestMask = maskLen;
+      if (i->second > shortestMetric)
+        {
+          continue;
+        }
+      shortestMetric = i->second;
+      selected = i->first;
+      if (maskLen == 32)
+        {
+          break;
+        }
+    }
+  return selected;
+}
+
+/**
+ * \brief Print the lookup rate of a benchmark.
+ * \param lookups number of lookups
+ * \param ms elapsed time in milliseconds
+ * \param name name of the benchmark
+ */
+static void
+Report (uint32_t lookups, int64_t ms, char const *name)
+{
+  double rate = lookups * 1000.0 / std::max<int64_t> (ms, 1);
+  std::cout << rate << " lookups/s"
+            << " (" << ms << " ms elapsed)\t"
+            << name
+            << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t nRoutes = 5000;
+  uint32_t lookups = 100000;
+
+  CommandLine cmd (__FILE__);
+  cmd.Usage ("Benchmark the unicast route lookups");
+  cmd.AddValue ("routes", "number of host routes", nRoutes);
+  cmd.AddValue ("lookups", "number of lookups", lookups);
+  cmd.Parse (argc, argv);
+
+  if (nRoutes == 0 || nRoutes > 0xffff)
+    {
+      std::cerr << "Error-- number of routes must be between 1 and 65535" << std::endl;
+      exit (1);
+    }
+  std::cout << "Running bench-routing with routes=" << nRoutes << " lookups=" << lookups << std::endl;
+
+  Ptr<Node> node = CreateObject<Node> ();
+  InternetStackHelper internet;
+  internet.Install (node);
+  Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice> ();
+  device->SetAddress (Mac48Address::Allocate ());
+  node->AddDevice (device);
+  Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
+  uint32_t ifIndex = ipv4->AddInterface (device);
+  ipv4->AddAddress (ifIndex, Ipv4InterfaceAddress (Ipv4Address ("10.0.0.1"), Ipv4Mask ("/16")));
+  ipv4->SetUp (ifIndex);
+  Ptr<Ipv6> ipv6 = node->GetObject<Ipv6> ();
+  ifIndex = ipv6->AddInterface (device);
+  ipv6->AddAddress (ifIndex, Ipv6InterfaceAddress (Ipv6Address ("2001:db8::1"), Ipv6Prefix (64)));
+  ipv6->SetUp (ifIndex);
+
+  Ipv4StaticRoutingHelper ipv4Helper;
+  Ptr<Ipv4StaticRouting> staticRouting = ipv4Helper.GetStaticRouting (ipv4);
+  Ipv6StaticRoutingHelper ipv6Helper;
+  Ptr<Ipv6StaticRouting> ipv6Routing = ipv6Helper.GetStaticRouting (ipv6);
+  Ptr<Ipv4ListRouting> listRouting = DynamicCast<Ipv4ListRouting> (ipv4->GetRoutingProtocol ());
+  Ptr<Ipv4GlobalRouting> globalRouting;
+  for (uint32_t i = 0; i < listRouting->GetNRoutingProtocols () && globalRouting == 0; i++)
+    {
+      int16_t priority;
+      globalRouting = DynamicCast<Ipv4GlobalRouting> (listRouting->GetRoutingProtocol (i, priority));
+    }
+
+  // One host route per peer, as when a node reaches each of its peers
+  // through a point to point link, behind a default route
+  std::list<std::pair<Ipv4RoutingTableEntry *, uint32_t> > scanned;
+  staticRouting->SetDefaultRoute (Ipv4Address ("10.0.0.2"), 1);
+  scanned.push_back (std::make_pair (new Ipv4RoutingTableEntry (Ipv4RoutingTableEntry::CreateDefaultRoute (Ipv4Address ("10.0.0.2"), 1)), 0));
+  for (uint32_t i = 0; i < nRoutes; i++)
+    {
+      Ipv4Address dest = Ipv4Address (0x0b000000 + i);
+      Ipv4Address gateway = Ipv4Address (0x0a000000 + 3 + i);
+      staticRouting->AddHostRouteTo (dest, gateway, 1);
+      globalRouting->AddHostRouteTo (dest, gateway, 1);
+      scanned.push_back (std::make_pair (new Ipv4RoutingTableEntry (Ipv4RoutingTableEntry::CreateHostRouteTo (dest, gateway, 1)), 0));
+      uint8_t bytes[16] = {0x20, 0x01, 0x0d, 0xb9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                           static_cast<uint8_t> (i >> 8), static_cast<uint8_t> (i)};
+      uint8_t gw[16] = {0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                        static_cast<uint8_t> (i >> 8), static_cast<uint8_t> (i + 2)};
+      ipv6Routing->AddHostRouteTo (Ipv6Address (bytes), Ipv6Address (gw), 1);
+    }
+
+  // Half of the destinations hit a host route, half the default route
+  std::vector<Ipv4Address> destinations;
+  for (uint32_t i = 0; i < lookups; i++)
+    {
+      uint32_t peer = (i * 2654435761u) % nRoutes;
+      destinations.push_back (Ipv4Address ((i % 2 ? 0x0b000000 : 0x0c000000) + peer));
+    }
+
+  Ptr<Packet> packet = Create<Packet> ();
+  Ipv4Header header;
+  Socket::SocketErrno err;
+  uint32_t found = 0;
+  SystemWallClockMs time;
+
+  time.Start ();
+  for (uint32_t i = 0; i < lookups; i++)
+    {
+      found += ScanRoutes (scanned, destinations[i]) != 0;
+    }
+  Report (lookups, time.End (), "List scan");
+
+  time.Start ();
+  for (uint32_t i = 0; i < lookups; i++)
+    {
+      header.SetDestination (destinations[i]);
+      found += staticRouting->RouteOutput (packet, header, 0, err) != 0;
+    }
+  Report (lookups, time.End (), "Ipv4StaticRouting");
+
+  time.Start ();
+  for (uint32_t i = 0; i < lookups; i++)
+    {
+      header.SetDestination (destinations[i]);
+      found += globalRouting->RouteOutput (packet, header, 0, err) != 0;
+    }
+  Report (lookups, time.End (), "Ipv4GlobalRouting");
+
+  Ipv6Header header6;
+  time.Start ();
+  for (uint32_t i = 0; i < lookups; i++)
+    {
+      uint32_t peer = destinations[i].Get () & 0xffff;
+      uint8_t bytes[16] = {0x20, 0x01, 0x0d, static_cast<uint8_t> (i % 2 ? 0xb9 : 0xba), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                           static_cast<uint8_t> (peer >> 8), static_cast<uint8_t> (peer)};
+      header6.SetDestination (Ipv6Address (bytes));
+      found += ipv6Routing->RouteOutput (packet, header6, 0, err) != 0;
+    }
+  Report (lookups, time.End (), "Ipv6StaticRouting");
+
+  std::cout << found << " routes found" << std::endl;
+  for (std::list<std::pair<Ipv4RoutingTableEntry *, uint32_t> >::iterator i = scanned.begin ();
+       i != scanned.end (); i++)
+    {
+      delete i->first;
+    }
+  Simulator::Destroy ();
+  return 0;
+}
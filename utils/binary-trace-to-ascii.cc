@@ -0,0 +1,68 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program converts a binary trace file, as written by the default
+// ascii trace sinks to a stream created with
+// AsciiTraceHelper::CreateBinaryFileStream, to the classic ascii trace layout.
+// Sample usage:  ./ns3 run 'binary-trace-to-ascii --in=trace.btr --out=trace.tr'
+
+#include "ns3/command-line.h"
+#include "ns3/binary-trace-file.h"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <stdlib.h> // for exit ()
+
+using namespace ns3;
+
+int main (int argc, char *argv[])
+{
+  std::string in;
+  std::string out;
+
+  CommandLine cmd (__FILE__);
+  cmd.Usage ("Convert a binary trace file to the ascii trace layout");
+  cmd.AddValue ("in", "binary trace file to read", in);
+  cmd.AddValue ("out", "ascii trace file to write (default: standard output)", out);
+  cmd.Parse (argc, argv);
+
+  if (in.empty ())
+    {
+      std::cerr << "Error-- the binary trace file must be specified " <<
+        "by command-line argument --in=(file name)" << std::endl;
+      exit (1);
+    }
+
+  std::ofstream file;
+  std::ostream *os = &std::cout;
+  if (!out.empty ())
+    {
+      file.open (out.c_str ());
+      if (!file.is_open ())
+        {
+          std::cerr << "Error-- unable to open " << out << std::endl;
+          exit (1);
+        }
+      os = &file;
+    }
+
+  if (!BinaryTraceFile::ConvertToAscii (in, *os))
+    {
+      std::cerr << "Error-- " << in << " is not a valid binary trace file" << std::endl;
+      exit (1);
+    }
+  return 0;
+}